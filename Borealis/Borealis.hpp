@@ -40,6 +40,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 
 #include <Graphics/Renderer.hpp>
 #include <Graphics/Renderer2D.hpp>
+#include <Graphics/ParticleRenderer.hpp>
 #include <Graphics/Framebuffer.hpp>
 #include <Graphics/RenderCommand.hpp>
 #include <Graphics/Buffer.hpp>
@@ -6,10 +6,13 @@ layout(location = 1) in vec3 a_Normal;
 layout(location = 2) in vec2 a_TexCoord;
 layout(location = 3) in vec3 a_Tangent;
 layout(location = 4) in vec3 a_Bitangent;
+layout(location = 7) in mat4 a_InstanceTransform; //instanced draws, takes locations 7 to 10
+layout(location = 11) in int a_InstanceEntityID;
 
 uniform mat4 u_ModelTransform;
 uniform mat4 u_ViewProjection;
 uniform int u_EntityID;
+uniform bool u_Instanced;
 uniform bool u_lightPass;
 
 out vec2 v_TexCoord;
@@ -19,13 +22,18 @@ out vec3 v_Tangent;
 out vec3 v_Bitangent;
 flat out int v_EntityID;
 
+mat4 ModelTransform()
+{
+	return u_Instanced ? a_InstanceTransform : u_ModelTransform;
+}
+
 void GeometryPass()
 {
 	v_TexCoord = vec2(a_TexCoord.x, 1.0 - a_TexCoord.y);
 
-	v_FragPos = vec3(u_ModelTransform * vec4(a_Position, 1.0));
+	v_FragPos = vec3(ModelTransform() * vec4(a_Position, 1.0));
 	
-	mat3 normalMatrix = transpose(inverse(mat3(u_ModelTransform)));
+	mat3 normalMatrix = transpose(inverse(mat3(ModelTransform())));
     vec3 N = normalize(normalMatrix * a_Normal);
     vec3 T = normalize(normalMatrix * a_Tangent);
     T = normalize(T - dot(T, N) * N); // Gram-Schmidt orthogonalization
@@ -36,7 +44,7 @@ void GeometryPass()
     v_Bitangent = B;
 
 	gl_Position = u_ViewProjection * vec4(v_FragPos, 1.0);	
-	v_EntityID = u_EntityID;
+	v_EntityID = u_Instanced ? a_InstanceEntityID : u_EntityID;
 }
 
 void LightPass()
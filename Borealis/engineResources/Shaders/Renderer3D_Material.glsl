@@ -8,6 +8,8 @@ layout(location = 3) in vec3 a_Tangent;
 layout(location = 4) in vec3 a_Bitangent;
 layout(location = 5) in ivec4 boneIds; 
 layout(location = 6) in vec4 weights;
+layout(location = 7) in mat4 a_InstanceTransform; //instanced draws, takes locations 7 to 10
+layout(location = 11) in int a_InstanceEntityID;
 
 //default variables
 uniform mat4 u_ModelTransform;
@@ -18,6 +20,7 @@ layout(std140) uniform Camera
     vec4 CameraPos;
 };
 uniform int u_EntityID;
+uniform bool u_Instanced;
 
 //Animation variables
 uniform bool u_HasAnimation;
@@ -48,18 +51,23 @@ out vec3 v_Normal;
 out vec4 v_LightPos;
 flat out int v_EntityID;
 
+mat4 ModelTransform()
+{
+	return u_Instanced ? a_InstanceTransform : u_ModelTransform;
+}
+
 void ShadowPass()
 {
-	mat4 MVP = u_LightViewProjection * u_ModelTransform;
+	mat4 MVP = u_LightViewProjection * ModelTransform();
 	gl_Position = MVP * vec4(a_Position, 1.0);
 }
 
 void Render3DPass()
 {
     v_TexCoord = vec2(a_TexCoord.x, a_TexCoord.y);
-	v_FragPos = vec3(u_ModelTransform * vec4(a_Position, 1.0));
+	v_FragPos = vec3(ModelTransform() * vec4(a_Position, 1.0));
 	
-	mat3 normalMatrix = transpose(inverse(mat3(u_ModelTransform))); //calculate T and N in compiler
+	mat3 normalMatrix = transpose(inverse(mat3(ModelTransform()))); //calculate T and N in compiler
     vec3 N = normalize(normalMatrix * a_Normal);
     vec3 T = normalize(normalMatrix * a_Tangent);
     T = normalize(T - dot(T, N) * N); // Gram-Schmidt orthogonalization
@@ -84,8 +92,8 @@ void Render3DPass()
             TotalPosition += localPosition * weights[i];
         }
 
-		gl_Position = u_ViewProjection * u_ModelTransform * TotalPosition;	
-		v_LightPos = u_LightViewProjection * u_ModelTransform * TotalPosition;
+		gl_Position = u_ViewProjection * ModelTransform() * TotalPosition;	
+		v_LightPos = u_LightViewProjection * ModelTransform() * TotalPosition;
 	}
 	else
 	{
@@ -93,7 +101,7 @@ void Render3DPass()
 		v_LightPos = u_LightViewProjection * vec4(v_FragPos, 1.0);	
 	}
 	
-	v_EntityID = u_EntityID;
+	v_EntityID = u_Instanced ? a_InstanceEntityID : u_EntityID;
 	v_Normal = N;
     v_Tangent = T;
     v_Bitangent = B;
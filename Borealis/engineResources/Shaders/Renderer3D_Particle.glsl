@@ -0,0 +1,78 @@
+#type vertex
+#version 410 core
+
+// per vertex
+layout(location = 0) in vec2 a_Corner;
+layout(location = 1) in vec2 a_TexCoord;
+
+// per particle
+layout(location = 2) in vec3 a_Position;
+layout(location = 3) in vec3 a_Size;
+layout(location = 4) in vec4 a_Rotation;
+layout(location = 5) in vec4 a_Colour;
+
+layout(std140) uniform Camera
+{
+	mat4 u_ViewProjection;
+	vec4 u_CameraPos;
+};
+
+uniform int u_Billboard;
+
+out vec2 v_TexCoord;
+out vec4 v_Color;
+
+vec3 Rotate(vec4 q, vec3 v)
+{
+	return v + 2.0 * cross(q.xyz, cross(q.xyz, v) + q.w * v);
+}
+
+void main()
+{
+	v_TexCoord = a_TexCoord;
+	v_Color = a_Colour;
+
+	vec3 position = a_Position;
+
+	if (u_Billboard != 0)
+	{
+		vec3 toCamera = normalize(u_CameraPos.xyz - position);
+
+		vec3 worldUp = vec3(0.0, 1.0, 0.0);
+		vec3 right = normalize(cross(worldUp, toCamera));
+		vec3 up = normalize(cross(toCamera, right));
+
+		vec2 quadOffset = (a_TexCoord - 0.5) * 2.0;
+		quadOffset *= -a_Size.x;
+		position += right * quadOffset.x + up * quadOffset.y;
+	}
+	else
+	{
+		position += Rotate(a_Rotation, vec3(a_Corner, 0.0) * a_Size);
+	}
+
+	gl_Position = u_ViewProjection * vec4(position, 1.0);
+}
+
+#type fragment
+#version 410 core
+layout(location = 0) out vec4 color;
+layout(location = 1) out int entityIDs;
+layout(location = 2) out float outRevealage;
+
+in vec2 v_TexCoord;
+in vec4 v_Color;
+
+uniform sampler2D u_Texture;
+
+void main()
+{
+	vec2 safeUV = clamp(v_TexCoord, vec2(0.0), vec2(1.0));
+	vec4 finalColor = texture(u_Texture, safeUV) * v_Color;
+
+	entityIDs = -1;
+
+	float weight = clamp(pow(min(1.0, finalColor.a * 10.0) + 0.01, 3.0) * 1e4 * pow(1.0 - gl_FragCoord.z * 0.9, 3.0), 1e-2, 3e3);
+	color = vec4(finalColor.rgb * finalColor.a * weight, finalColor.a * weight);
+	outRevealage = finalColor.a;
+}
@@ -48,6 +48,21 @@ namespace Borealis
 		AssetType mAssetType{AssetType::None};
 		virtual void swap(Asset& other) = 0;
 
+		/*!***********************************************************************
+			\brief
+				Bytes the asset holds in CPU and GPU memory, counted against
+				the residency budget of its type
+		*************************************************************************/
+		virtual uint64_t GetMemorySize() const { return 0; }
+
+		/*!***********************************************************************
+			\brief
+				Frees what the asset owns outside of itself, such as GPU
+				buffers, when the asset manager evicts it. Meshes are copied by
+				value, so their destructors cannot do it
+		*************************************************************************/
+		virtual void Release() {}
+
 
 		RTTR_ENABLE()
 	};
@@ -19,6 +19,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include <Core/Project.hpp>
 #include <Core/ApplicationManager.hpp>
 #include <Scripting/ScriptingSystem.hpp>
+#include <Assets/PakFile.hpp>
 
 namespace Borealis
 {
@@ -29,14 +30,58 @@ namespace Borealis
 		std::vector<std::string> extensions;
 		AssetLoaderFunc loadFunc;
 		AssetReloadFunc reloadFunc = nullptr;
+		AssetStreamFuncs streamFuncs = {};
+	};
+
+	struct PakBuildOptions
+	{
+		uint32_t version = PakHeader::Version;
+		bool compareWithV1 = false; // also writes a v1 pak and logs size and load time of both
+	};
+
+	struct PakBuildReport
+	{
+		PakWriteStats stats;
+		float buildMs = 0.f;
+		float loadMs = 0.f;		// filled when compared
+		uint64_t v1Bytes = 0;	// filled when compared
+		float v1LoadMs = 0.f;	// filled when compared
 	};
 
 	class AssetManager
 	{
 	public:
-		static void BuildPak(std::filesystem::path folderPath, std::filesystem::path location);
+		/*!***********************************************************************
+			\brief
+				Packs every cache file named by an asset id. Entries are
+				compressed by asset type, from the asset registry
+		*************************************************************************/
+		static PakBuildReport BuildPak(std::filesystem::path folderPath, std::filesystem::path location, PakBuildOptions const& options = {});
 		static void ReadPak(std::filesystem::path filePath);
-		static void RetrieveFromPak(uint64_t id, char*& buffer, uint64_t& size);
+
+		/*!***********************************************************************
+			\brief
+				Reads an asset from the mapped pak. Stored entries are a view of
+				the mapping that loaders parse in place, compressed ones are
+				decoded into the returned asset. Safe to call from any thread
+				once the pak is read. Empty when no pak is loaded or it does not
+				hold the asset
+		*************************************************************************/
+		static PakAsset ReadFromPak(uint64_t id);
+
+		/*!***********************************************************************
+			\brief
+				Same as above, with the id taken from the file name of the path
+		*************************************************************************/
+		static PakAsset ReadFromPak(std::filesystem::path const& path);
+
+		/*!***********************************************************************
+			\brief
+				Warms the bytes of an asset ahead of its loader, from the pak
+				when it holds the asset and from disk otherwise. Safe to call
+				from any thread
+		*************************************************************************/
+		static void PrefetchAsset(std::filesystem::path const& path);
 		static void RegisterAllAssetType();
 
 		static void RegisterAsset(AssetInfo const& assetInfo);
@@ -95,6 +140,7 @@ namespace Borealis
 	private:
 		inline static std::filesystem::path PakPath;
 		inline static bool PakLoaded = false;
+		inline static PakFile Pak;
 		inline static std::unordered_map<std::string, AssetType> extensionToAssetType;
 		inline static std::unordered_map<AssetType, std::string> assetTypeToString;
 		inline static std::unordered_map<std::string, AssetType> stringToAssetType;
@@ -17,6 +17,13 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 
 #include <unordered_map>
 #include <filesystem>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <list>
+#include <mutex>
+#include <thread>
 
 #include <Core/ProjectInfo.hpp>
 #include <Assets/IAssetManager.hpp>
@@ -28,24 +35,177 @@ namespace Borealis
 	using AssetRegistrySrcLoc = std::unordered_map<std::string, AssetHandle>;
 	using AssetLoaderFunc = std::function<Ref<Asset>(std::filesystem::path const&, AssetMetaData const&)>;
 	using AssetReloadFunc = std::function<void(AssetMetaData const&, Ref<Asset> const&)>;
+	using AssetDecodeFunc = std::function<Ref<Asset>(std::filesystem::path const&, AssetMetaData const&)>;
+	using AssetFinalizeFunc = std::function<void(AssetMetaData const&, Ref<Asset> const&)>;
+	using AssetDependencyFunc = std::function<std::vector<AssetHandle>(std::filesystem::path const&, AssetMetaData const&)>;
+
+	/*!***********************************************************************
+		\brief
+			Optional streaming hooks of an asset type. Decode and dependencies
+			run on a loader thread and must not touch the GPU or other assets,
+			finalize runs on the main thread. A type without decode is read
+			ahead on the loader thread and loaded by its load function on the
+			main thread
+	*************************************************************************/
+	struct AssetStreamFuncs
+	{
+		AssetDecodeFunc decode = nullptr;
+		AssetFinalizeFunc finalize = nullptr;
+		AssetDependencyFunc dependencies = nullptr;
+	};
+
+	enum class AssetLoadPriority : uint8_t
+	{
+		Background,
+		Normal,
+		High,
+		Critical,	// something is blocked on it
+		Count
+	};
+
+	enum class AssetLoadState : uint8_t
+	{
+		Queued,
+		Loading,	// on a loader thread
+		Decoded,	// waiting for the main thread
+		Ready,
+		Failed
+	};
+
+	/*!***********************************************************************
+		\brief
+			One asynchronous load, shared between the caller and the loader.
+			The asset is only handed out once the load is ready
+	*************************************************************************/
+	class AssetLoadRequest
+	{
+	public:
+		AssetHandle GetHandle() const { return mMetaData.Handle; }
+		AssetLoadState GetState() const { return mState.load(std::memory_order_acquire); }
+		bool IsReady() const { return GetState() == AssetLoadState::Ready; }
+		bool IsDone() const { return IsReady() || GetState() == AssetLoadState::Failed; }
+
+		Ref<Asset> GetAsset() const { return IsReady() ? mAsset : nullptr; }
+
+		template<typename T>
+		Ref<T> GetAsset() const { return std::static_pointer_cast<T>(GetAsset()); }
+
+	private:
+		friend class EditorAssetManager;
+
+		AssetMetaData mMetaData;
+		std::filesystem::path mCachePath;
+		std::atomic<AssetLoadState> mState{ AssetLoadState::Queued };
+		AssetLoadPriority mPriority = AssetLoadPriority::Normal; // guarded by the load mutex
+		Ref<Asset> mAsset;
+		std::vector<AssetHandle> mDependencies;
+		bool mDependenciesQueued = false;
+	};
+
+	using AssetLoadHandle = Ref<AssetLoadRequest>;
+
+	/*!***********************************************************************
+		\brief
+			Memory held by the loaded assets of one type against its budget
+	*************************************************************************/
+	struct AssetResidency
+	{
+		uint64_t residentBytes = 0;
+		uint64_t budgetBytes = 0;	// 0 for no budget
+		uint32_t assetCount = 0;
+		uint32_t evictions = 0;		// since startup
+		bool overBudget = false;	// with nothing left that can be evicted
+	};
 
 	class EditorAssetManager : public IAssetManager
 	{
 	public:
+		static constexpr float FinalizeBudgetMs = 4.f;
+
+		EditorAssetManager() = default;
+		~EditorAssetManager();
+
+		EditorAssetManager(EditorAssetManager const&) = delete;
+		EditorAssetManager& operator=(EditorAssetManager const&) = delete;
 
 		//TEMP
 		//===================================
 		void LoadAssetRegistryRunTime(std::string path, bool encrypt = false);
 		//===================================
 
-		void RegisterAsset(AssetType type, AssetLoaderFunc loadFunc, AssetReloadFunc reloadFunc);
+		void RegisterAsset(AssetType type, AssetLoaderFunc loadFunc, AssetReloadFunc reloadFunc, AssetStreamFuncs const& streamFuncs = {});
 
 		/*!***********************************************************************
 			\brief
-				Get asset by handle
+				Get asset by handle. Waits for the load when it is already
+				streaming, loads it on the spot otherwise
 		*************************************************************************/
 		Ref<Asset> GetAsset(AssetHandle assetHandle) override;
 
+		/*!***********************************************************************
+			\brief
+				Queues a load on the loader threads and returns at once. Asking
+				again for an asset in flight returns the same request, raising
+				its priority if needed. Main thread only
+			\return
+				The request, null when the handle is not registered
+		*************************************************************************/
+		AssetLoadHandle LoadAssetAsync(AssetHandle assetHandle, AssetLoadPriority priority = AssetLoadPriority::Normal);
+
+		/*!***********************************************************************
+			\brief
+				Queues every loadable asset of the list that is not loaded yet
+		*************************************************************************/
+		void PrefetchAssets(std::vector<AssetHandle> const& assetHandles, AssetLoadPriority priority = AssetLoadPriority::Normal);
+
+		/*!***********************************************************************
+			\brief
+				Finishes decoded loads on the main thread, highest priority
+				first, until the budget runs out. At least one load is finished
+				per call. Loads whose dependencies are still streaming wait
+		*************************************************************************/
+		void FinalizeLoads(float budgetMs);
+
+		/*!***********************************************************************
+			\brief
+				Sets the memory budget of a type, 0 lets it grow without limit.
+				Going over it evicts the least recently used assets of the
+				type that nothing else holds and that are not pinned
+		*************************************************************************/
+		void SetMemoryBudget(AssetType type, uint64_t bytes);
+		uint64_t GetMemoryBudget(AssetType type) const;
+		void ResetMemoryBudgets();
+
+		/*!***********************************************************************
+			\brief
+				Pinned assets are never evicted. Pins are counted, every
+				PinAsset needs its UnpinAsset
+		*************************************************************************/
+		void PinAsset(AssetHandle assetHandle);
+		void UnpinAsset(AssetHandle assetHandle);
+		bool IsAssetPinned(AssetHandle assetHandle) const;
+
+		/*!***********************************************************************
+			\brief
+				Replaces the pins of the previous scene with the assets the
+				scene being loaded references
+		*************************************************************************/
+		void PinSceneAssets(std::vector<AssetHandle> const& assetHandles);
+
+		/*!***********************************************************************
+			\brief
+				Evicts assets until every type is within its budget or has
+				nothing left that can be evicted
+		*************************************************************************/
+		void EnforceMemoryBudgets();
+
+		/*!***********************************************************************
+			\brief
+				Resident memory per loaded type, for telemetry
+		*************************************************************************/
+		std::unordered_map<AssetType, AssetResidency> const& GetResidency() const { return mResidency; }
+		uint64_t GetResidentBytes() const;
+
 		void SubmitAssetReloadRequest(AssetHandle assetHandle);
 
 		Ref<Asset> ReloadAsset(AssetHandle assetHandle);
@@ -84,17 +244,66 @@ namespace Borealis
 		*************************************************************************/
 		Ref<Asset> LoadAsset(AssetHandle assetHandle);
 
+		void StartLoadWorkers();
+		void StopLoadWorkers();
+		void LoadWorker();
+		void DecodeRequest(AssetLoadRequest& request) const;
+		void RaisePriority(AssetLoadHandle const& request, AssetLoadPriority priority);
+		Ref<Asset> WaitForLoad(AssetLoadHandle const& request);
+
+		/*!***********************************************************************
+			\brief
+				Finishes a decoded load
+			\return
+				False when it has to wait for its dependencies
+		*************************************************************************/
+		bool FinalizeRequest(AssetLoadHandle const& request, bool waitForDependencies);
+
+		struct LoadedAsset
+		{
+			Ref<Asset> asset;
+			AssetType type;
+			uint64_t bytes;
+			std::list<AssetHandle>::iterator lruPosition;
+		};
+
+		void AddLoadedAsset(AssetHandle assetHandle, Ref<Asset> const& asset);
+		Ref<Asset> const& TouchLoadedAsset(LoadedAsset& loaded);
+		void UpdateLoadedAssetSize(LoadedAsset& loaded);
+		std::list<AssetHandle>::iterator EvictAsset(AssetHandle assetHandle);
+		void EvictOverBudget();
+		void RecordResidency() const;
+
 	private:
 		std::filesystem::path mAssetRegistryPath;
 		std::filesystem::path mCachePath;
 		AssetRegistry mAssetRegistry;
 		AssetRegistrySrcLoc mAssetRegistrySrcLoc;
-		std::unordered_map<AssetHandle, Ref<Asset>> mLoadedAssets;
+		std::unordered_map<AssetHandle, LoadedAsset> mLoadedAssets;
+		std::list<AssetHandle> mLruAssets; // most recently used first
+		std::unordered_map<AssetType, AssetResidency> mResidency;
+		std::unordered_map<AssetHandle, uint32_t> mPinnedAssets;
+		std::unordered_set<AssetHandle> mScenePinnedAssets;
 
 		std::list<AssetHandle> mAssetReloadRequests;
 
 		std::unordered_map<AssetType, AssetLoaderFunc> mAssetLoaders;
 		std::unordered_map<AssetType, AssetReloadFunc> mAssetReloaders;
+		std::unordered_map<AssetType, AssetStreamFuncs> mAssetStreamFuncs;
+
+		// Main thread only
+		std::unordered_map<AssetHandle, AssetLoadHandle> mLoadRequests;
+		std::vector<AssetLoadHandle> mPendingFinalize;
+
+		// Shared with the loader threads, guarded by mLoadMutex
+		std::mutex mLoadMutex;
+		std::condition_variable mLoadCondition;
+		std::condition_variable mDecodedCondition;
+		std::array<std::deque<AssetLoadHandle>, static_cast<size_t>(AssetLoadPriority::Count)> mLoadQueues;
+		std::vector<AssetLoadHandle> mDecodedLoads;
+		bool mStopLoading = false;
+
+		std::vector<std::thread> mLoadWorkers;
 	};
 }
 
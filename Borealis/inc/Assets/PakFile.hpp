@@ -0,0 +1,236 @@
+/******************************************************************************
+/*!
+\file       PakFile.hpp
+\author     Chan Guo Geng Gordon
+\par        email: g.chan/@digipen.edu
+\date       October 17, 2026
+\brief      Declares the pak format, its writer, the memory mapped pak reader
+			and the stream buffer that lets loaders parse its views in place
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#ifndef PakFile_HPP
+#define PakFile_HPP
+
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <streambuf>
+#include <vector>
+
+namespace Borealis
+{
+	enum class PakCompression : uint32_t
+	{
+		None,	// stored as is, page aligned so it can be read straight from the mapping
+		LZ4,	// fast to build, for small text assets
+		LZ4HC	// slow to build, same decode speed, for large mesh and animation data
+	};
+
+	/*!***********************************************************************
+		\brief
+			Version 2 layout: header, entry data, then the index sorted by id.
+			Version 1 paks have no header, just the data followed by an
+			{id, offset, size} table and its count.
+	*************************************************************************/
+	struct PakHeader
+	{
+		static constexpr uint32_t Magic = 0x324B5042; // "BPK2"
+		static constexpr uint32_t Version = 2;
+
+		uint32_t magic = Magic;
+		uint32_t version = Version;
+		uint64_t entryCount = 0;
+		uint64_t indexOffset = 0;
+		uint32_t pageAlignment = 0;
+		uint32_t reserved = 0;
+	};
+
+	struct PakEntry
+	{
+		uint64_t id;
+		uint64_t offset;
+		uint64_t storedSize;	// bytes in the pak
+		uint64_t size;			// bytes once decompressed
+		uint64_t hash;			// of the decompressed bytes, 0 when unknown
+		PakCompression compression;
+		uint32_t reserved;
+	};
+
+	/*!***********************************************************************
+		\brief
+			File to pack and how to store it
+	*************************************************************************/
+	struct PakSource
+	{
+		uint64_t id;
+		std::filesystem::path path;
+		PakCompression compression = PakCompression::None;
+	};
+
+	struct PakWriteStats
+	{
+		uint64_t entries = 0;
+		uint64_t rawBytes = 0;
+		uint64_t fileBytes = 0;
+		uint64_t compressedEntries = 0;
+	};
+
+	/*!***********************************************************************
+		\brief
+			Bytes of one asset. Points into the mapping for stored entries and
+			owns the decompressed bytes otherwise. Moving it keeps the view
+			valid.
+	*************************************************************************/
+	class PakAsset
+	{
+	public:
+		PakAsset() = default;
+		PakAsset(PakAsset&&) = default;
+		PakAsset& operator=(PakAsset&&) = default;
+		PakAsset(PakAsset const&) = delete;
+		PakAsset& operator=(PakAsset const&) = delete;
+
+		std::span<const char> View() const { return mView; }
+		bool empty() const { return mView.empty(); }
+
+	private:
+		friend class PakFile;
+		std::span<const char> mView;
+		std::vector<char> mBuffer;
+	};
+
+	/*!***********************************************************************
+		\brief
+			Read only pak file mapped into memory. Version 2 indices are used
+			in place, version 1 tables are copied once and sorted. After Open
+			every read only touches immutable data, so Read can be called from
+			any number of threads. Views stay valid until the pak is closed.
+	*************************************************************************/
+	class PakFile
+	{
+	public:
+		static constexpr uint32_t PageSize = 4096;
+
+		PakFile() = default;
+		~PakFile();
+
+		PakFile(PakFile const&) = delete;
+		PakFile& operator=(PakFile const&) = delete;
+
+		/*!***********************************************************************
+			\brief
+				Maps the pak and loads its index, closing any pak already open
+			\return
+				False when the file cannot be mapped or its index is invalid
+		*************************************************************************/
+		bool Open(std::filesystem::path const& path);
+
+		/*!***********************************************************************
+			\brief
+				Unmaps the pak, invalidating every view handed out
+		*************************************************************************/
+		void Close();
+
+		bool IsOpen() const { return mData != nullptr; }
+		uint32_t GetVersion() const { return mVersion; }
+		std::span<const PakEntry> GetEntries() const { return mIndex; }
+
+		/*!***********************************************************************
+			\brief
+				Reads an asset by id, decompressing it when it is compressed
+			\return
+				The asset, empty when not in the pak or when it fails to decode
+		*************************************************************************/
+		PakAsset Read(uint64_t id) const;
+
+		/*!***********************************************************************
+			\brief
+				Touches every page of an entry so a later Read does not fault
+				them in one at a time
+			\return
+				False when the pak does not hold the id or the entry runs past
+				the end of the file
+		*************************************************************************/
+		bool Prefetch(uint64_t id) const;
+
+		/*!***********************************************************************
+			\brief
+				Decodes an entry and checks it against its content hash
+		*************************************************************************/
+		bool Verify(PakEntry const& entry) const;
+
+		/*!***********************************************************************
+			\brief
+				Writes a pak of the given version, 1 ignores the compression
+				of every source
+			\return
+				False when the file cannot be written
+		*************************************************************************/
+		static bool Write(std::filesystem::path const& location, std::vector<PakSource> const& sources, uint32_t version = PakHeader::Version, PakWriteStats* stats = nullptr);
+
+		/*!***********************************************************************
+			\brief
+				64 bit content hash stored with version 2 entries
+		*************************************************************************/
+		static uint64_t HashContent(const void* data, size_t size);
+
+	private:
+		PakEntry const* FindEntry(uint64_t id) const;
+		bool Decode(PakEntry const& entry, PakAsset& out) const;
+		bool LoadLegacyIndex(std::filesystem::path const& path);
+
+		void* mFile = nullptr;
+		void* mMapping = nullptr;
+		const char* mData = nullptr;
+		uint64_t mSize = 0;
+		uint32_t mVersion = 0;
+		std::span<const PakEntry> mIndex;
+		std::vector<PakEntry> mLegacyIndex;
+	};
+
+	/*!***********************************************************************
+		\brief
+			Read only stream buffer over memory owned elsewhere, so stream
+			based loaders can parse a pak view without copying it
+	*************************************************************************/
+	class MemoryStreamBuffer : public std::streambuf
+	{
+	public:
+		explicit MemoryStreamBuffer(std::span<const char> data)
+		{
+			// The get area is never written through
+			char* begin = const_cast<char*>(data.data());
+			setg(begin, begin, begin + data.size());
+		}
+
+		bool empty() const { return eback() == egptr(); }
+
+	protected:
+		pos_type seekoff(off_type offset, std::ios_base::seekdir dir, std::ios_base::openmode which) override
+		{
+			if (!(which & std::ios_base::in)) return pos_type(off_type(-1));
+
+			off_type base = 0;
+			if (dir == std::ios_base::cur) base = gptr() - eback();
+			else if (dir == std::ios_base::end) base = egptr() - eback();
+
+			off_type target = base + offset;
+			if (target < 0 || target > egptr() - eback()) return pos_type(off_type(-1));
+
+			setg(eback(), eback() + target, egptr());
+			return pos_type(target);
+		}
+
+		pos_type seekpos(pos_type position, std::ios_base::openmode which) override
+		{
+			return seekoff(off_type(position), std::ios_base::beg, which);
+		}
+	};
+}
+
+#endif
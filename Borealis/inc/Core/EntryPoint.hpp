@@ -18,6 +18,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include <Core/LoggerSystem.hpp>
 #include <Debugging/Profiler.hpp>
 #include <Debugging/Console.hpp>
+#include <Graphics/RendererAPI.hpp>
 
 	int main(int argc, char** argv)
 	{
@@ -25,6 +26,15 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 		BOREALIS_CORE_INFO("Logger System Initialized");
 		BOREALIS_CORE_TRACE("Welcome to the Borealis");
 
+		for (int i = 1; i < argc; ++i)
+		{
+			// Headless run, no GPU or display needed
+			if (std::string_view(argv[i]) == "--null-renderer")
+			{
+				Borealis::RendererAPI::SetAPI(Borealis::RendererAPI::API::Null);
+			}
+		}
+
 		PROFILE_START("Borealis Startup");
 		auto app = Borealis::CreateApplication();
 		PROFILE_END();
@@ -0,0 +1,63 @@
+/******************************************************************************
+/*!
+\file       JobSystem.hpp
+\author     Chua Zheng Yang
+\par        email: c.zhengyang\@digipen.edu
+\date       October 17, 2026
+\brief      Declares a small worker thread pool for splitting independent
+			work across cores
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#ifndef JOB_SYSTEM_HPP
+#define JOB_SYSTEM_HPP
+#include <cstdint>
+#include <functional>
+
+namespace Borealis
+{
+	class JobSystem
+	{
+	public:
+		/*!***********************************************************************
+			\brief
+				Starts the worker threads
+			\param threadCount
+				Number of workers, 0 to use one less than the number of cores
+		*************************************************************************/
+		static void Init(uint32_t threadCount = 0);
+
+		/*!***********************************************************************
+			\brief
+				Stops and joins the worker threads
+		*************************************************************************/
+		static void Free();
+
+		/*!***********************************************************************
+			\brief
+				Calls job on [begin, end) ranges covering [0, count), spread over
+				the workers and the calling thread, and returns once every range
+				is done. Runs inline when there are no workers, when the work
+				fits in one range, or when called from inside a job.
+			\param count
+				Number of items
+			\param job
+				Called with the begin and end of each range
+			\param grainSize
+				Items per range
+		*************************************************************************/
+		static void ParallelFor(uint32_t count, std::function<void(uint32_t, uint32_t)> const& job, uint32_t grainSize = 1);
+
+		/*!***********************************************************************
+			\brief
+				Get the number of worker threads, not counting the caller
+		*************************************************************************/
+		static uint32_t GetThreadCount();
+	};
+}
+
+#endif
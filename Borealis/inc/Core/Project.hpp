@@ -116,6 +116,18 @@ namespace Borealis
 		*************************************************************************/
 		static void CopyIndividualFile(const std::filesystem::path& source, const std::filesystem::path& destination, bool encrypt = false);
 
+		/*!***********************************************************************
+			\brief
+				Writes every scene under source in the binary scene format,
+				keeping its path relative to source. Scenes that fail to
+				convert keep whatever copy is already at the destination
+			\param[in] source
+				Folder of YAML scenes
+			\param[in] destination
+				Build folder to write to
+		*************************************************************************/
+		static void BuildSceneBinaries(const std::filesystem::path& source, const std::filesystem::path& destination, bool encrypt = false);
+
 		/*!***********************************************************************
 			\brief
 				Gets the Asset Manager
@@ -8,6 +8,8 @@
 #include <Assets/AssetMetaData.hpp>
 #include "Bone.hpp"
 
+#define MAX_BONES 128
+
 namespace Borealis
 {
 	struct AssimpNodeData
@@ -18,6 +20,20 @@ namespace Borealis
 		std::vector<AssimpNodeData> children;
 	};
 
+	/*!***********************************************************************
+		\brief
+			Node of the flattened hierarchy. Nodes are stored depth first so
+			a parent always comes before its children.
+	*************************************************************************/
+	struct AnimationNode
+	{
+		glm::mat4 transformation;	// bind pose, used when the node has no channel
+		glm::mat4 offsetMatrix;
+		int parent;					// -1 for the root
+		int channel;				// index into mBones, -1 if not animated
+		int boneIndex;				// index into the final bone matrices, -1 if not skinned
+	};
+
 	class Animation : public Asset
 	{
 	public:
@@ -29,7 +45,15 @@ namespace Borealis
 
 		void Save();
 
-		std::map<std::string, BoneData> GetBoneDataMap() const { return mBoneDataMap; }
+		/*!***********************************************************************
+			\brief
+				Binds the animation to a skeleton and rebuilds the node table so
+				sampling needs no name lookups
+		*************************************************************************/
+		void BindSkeleton(std::map<std::string, BoneData> const& boneDataMap);
+
+		std::map<std::string, BoneData> const& GetBoneDataMap() const { return mBoneDataMap; }
+		std::vector<AnimationNode> const& GetNodes() const { return mNodes; }
 		float GetDuration() const { return mDuration; }
 		float GetTicksPerSecond() const { return mTicksPerSecond; }
 		AssimpNodeData& GetRootNode() { return mRootNode; }
@@ -39,13 +63,16 @@ namespace Borealis
 		std::vector<Bone> mBones;
 		AssimpNodeData mRootNode;
 		std::map<std::string, BoneData> mBoneDataMap;
+		std::vector<AnimationNode> mNodes;
 
 		static Ref<Asset> Load(std::filesystem::path const& cachePath, AssetMetaData const& assetMetaData);
 		static void Reload(AssetMetaData const& assetMetaData, Ref<Asset> const& asset);
 
 		void swap (Asset& other) override;
+		uint64_t GetMemorySize() const override;
 
 	private:
+		void BuildNodeTable();
 
 		RTTR_ENABLE(Asset)
 	};
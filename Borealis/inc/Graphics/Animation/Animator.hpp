@@ -14,10 +14,52 @@ namespace Borealis
 		Animator();
 		Animator(Ref<Animation> animation);
 
+		/*!***********************************************************************
+			\brief
+				Runs every stage below for this animator
+		*************************************************************************/
 		void UpdateAnimation(float dt);
+
+		/*!***********************************************************************
+			\brief
+				Advances the playback time of the current animation, and of the
+				blended one when there is one. Asset binding must be done
+				before, every other stage only reads the animations
+			\return
+				True when a pose has to be evaluated this frame, the other
+				stages do nothing otherwise
+		*************************************************************************/
+		bool AdvanceTime(float dt);
+
+		/*!***********************************************************************
+			\brief
+				Samples the local transform of every node, for both animations
+				when blending
+		*************************************************************************/
+		void SamplePose();
+
+		/*!***********************************************************************
+			\brief
+				Blends the sampled local transforms of the two animations
+		*************************************************************************/
+		void BlendPose();
+
+		/*!***********************************************************************
+			\brief
+				Concatenates the local transforms down the hierarchy into model
+				space
+		*************************************************************************/
+		void LocalToModel();
+
+		/*!***********************************************************************
+			\brief
+				Builds the skinning matrices of the bones from the model space
+				transforms
+		*************************************************************************/
+		void BuildPalette();
+
 		bool HasAnimation();
 		void PlayAnimation(Ref<Animation> animation);
-		void BlendTwoAnimations(Ref<Animation> baseAnimation, Ref<Animation> layerAnimation, float blendFactor, float dt);
 
 		std::vector<glm::mat4> const& GetFinalBoneMatrices() { return mFinalBoneMatrices; }
 		void SetLoop(bool loop) { mLoop = loop; }
@@ -29,12 +71,12 @@ namespace Borealis
 		Ref<Animation> mNextAnimation;
 
 	private:
-		void CalculateBoneTransform(AssimpNodeData const* node, glm::mat4 parentTransform);
-		void CalculateBlendedBoneTransform(Ref<Animation> animationBase, AssimpNodeData const* node,
-			Ref<Animation> animationLayer, AssimpNodeData const* nodeLayer,
-			float currentTimeBase, float currentTimeLayer, glm::mat4 const& parentTransform, float blendFactor);
-
 		std::vector<glm::mat4> mFinalBoneMatrices;
+		std::vector<glm::mat4> mLocalTransforms;		// per node, sampled then blended, only grows
+		std::vector<glm::mat4> mLayerLocalTransforms;	// per node of the blended layer, only grows
+		std::vector<glm::mat4> mGlobalTransforms;		// per node model space, only grows
+		std::vector<BoneCursor> mCursors;		// per channel of the current or base animation
+		std::vector<BoneCursor> mLayerCursors;	// per channel of the blended layer
 		Ref<Animation> mCurrentAnimation;
 
 		bool mLoop;
@@ -43,6 +85,13 @@ namespace Borealis
 		float mCurrentTime;
 		float mCurrentTimeLayer;
 		float mCurrentTimeBase;
+
+		// What AdvanceTime decided this frame's pose is, read by the later stages
+		Animation const* mPoseBase = nullptr;		// nullptr when there is no pose to evaluate
+		Animation const* mPoseLayer = nullptr;		// nullptr when not blending
+		float mPoseBaseTime = 0.f;
+		float mPoseLayerTime = 0.f;
+		float mPoseBlend = 0.f;
 		//float mDeltaTime;
 	};
 }
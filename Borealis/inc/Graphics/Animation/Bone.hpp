@@ -18,6 +18,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #define GLM_ENABLE_EXPERIMENTAL
 #include <glm/gtx/quaternion.hpp>
 #include <string>
+#include <vector>
 
 namespace Borealis 
 {
@@ -46,6 +47,18 @@ namespace Borealis
 		float timeStamp;
 	};
 
+	/*!***********************************************************************
+		\brief
+			Last key used on each track of a bone, kept per animator so
+			sampling usually starts from where the previous frame ended
+	*************************************************************************/
+	struct BoneCursor
+	{
+		int position = -1;
+		int rotation = -1;
+		int scale = -1;
+	};
+
 	class Bone
 	{
 	public:
@@ -56,12 +69,27 @@ namespace Borealis
 
 		void Update(float animationTime);
 
+		/*!***********************************************************************
+			\brief
+				Interpolates the local transform at animationTime without
+				touching the bone, so a shared animation can be sampled by
+				several animators
+		*************************************************************************/
+		glm::mat4 Sample(float animationTime) const;
+
+		/*!***********************************************************************
+			\brief
+				Same as Sample, starting the key search from the cursor and
+				moving it to the keys used
+		*************************************************************************/
+		glm::mat4 Sample(float animationTime, BoneCursor& cursor) const;
+
 		glm::mat4 GetLocalTransform() { return mLocalTransform; }
-		std::string GetBoneName() const { return mName; }
+		std::string const& GetBoneName() const { return mName; }
 		int GetBoneID() { return mId; }
-		int GetPositionIndex(float animationTime);
-		int GetRotationIndex(float animationTime);
-		int GetScaleIndex(float animationTime);
+		int GetPositionIndex(float animationTime) const;
+		int GetRotationIndex(float animationTime) const;
+		int GetScaleIndex(float animationTime) const;
 
 		int mNumPositions;
 		int mNumRotations;
@@ -76,11 +104,11 @@ namespace Borealis
 
 		glm::mat4 mLocalTransform;
 	private:
-		float GetScaleFactor(float lastTimeStamp, float nextTimeStamp, float animationTime);
+		float GetScaleFactor(float lastTimeStamp, float nextTimeStamp, float animationTime) const;
 
-		glm::mat4 InterpolatePosition(float animationTime);
-		glm::mat4 InterpolateRotation(float animationTime);
-		glm::mat4 InterpolateScaling(float animationTime);
+		glm::vec3 InterpolatePosition(float animationTime, int& cursor) const;
+		glm::quat InterpolateRotation(float animationTime, int& cursor) const;
+		glm::vec3 InterpolateScaling(float animationTime, int& cursor) const;
 
 	};
 }
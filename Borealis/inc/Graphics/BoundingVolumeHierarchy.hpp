@@ -0,0 +1,196 @@
+/******************************************************************************
+/*!
+\file       BoundingVolumeHierarchy.hpp
+\author     Chan Guo Geng Gordon
+\par        email: g.chan/@digipen.edu
+\date       October 17, 2026
+\brief      Declares the dynamic AABB tree used for culling scene renderables
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#ifndef BoundingVolumeHierarchy_HPP
+#define BoundingVolumeHierarchy_HPP
+
+#include <vector>
+
+#include <entt.hpp>
+
+#include <Graphics/Mesh.hpp>
+#include <Graphics/Frustum.hpp>
+
+namespace Borealis
+{
+	struct TransformComponent;
+
+	/*!***********************************************************************
+		\brief
+			Dynamic AABB tree. Leaves store a fattened AABB so small movements
+			only need a containment check, larger ones reinsert the leaf.
+			Leaf indices (proxies) stay valid across Rebuild().
+	*************************************************************************/
+	class BoundingVolumeHierarchy
+	{
+	public:
+		static constexpr int32_t NullNode = -1;
+
+		BoundingVolumeHierarchy(float margin = 0.1f);
+
+		/*!***********************************************************************
+			\brief
+				Inserts a leaf into the tree
+			\param[in] aabb
+				The world space bounds
+			\param[in] userData
+				Value returned by queries for this leaf
+			\return
+				The proxy id of the leaf
+		*************************************************************************/
+		int32_t Insert(AABB const& aabb, uint32_t userData);
+
+		/*!***********************************************************************
+			\brief
+				Removes a leaf from the tree
+			\param[in] proxy
+				The proxy id returned by Insert
+		*************************************************************************/
+		void Remove(int32_t proxy);
+
+		/*!***********************************************************************
+			\brief
+				Refits a leaf to new bounds
+			\param[in] proxy
+				The proxy id returned by Insert
+			\param[in] aabb
+				The new world space bounds
+			\return
+				True if the leaf had to be reinserted
+		*************************************************************************/
+		bool Move(int32_t proxy, AABB const& aabb);
+
+		/*!***********************************************************************
+			\brief
+				Rebuilds the whole tree top down from its current leaves, used for
+				sets of leaves that rarely move
+		*************************************************************************/
+		void Rebuild();
+
+		/*!***********************************************************************
+			\brief
+				Removes every leaf
+		*************************************************************************/
+		void Clear();
+
+		/*!***********************************************************************
+			\brief
+				Appends the user data of every leaf touching the volume
+		*************************************************************************/
+		void QueryFrustum(Frustum const& frustum, std::vector<uint32_t>& outResults) const;
+		void QuerySphere(BoundingSphere const& sphere, std::vector<uint32_t>& outResults) const;
+		void QueryAABB(AABB const& aabb, std::vector<uint32_t>& outResults) const;
+
+		uint32_t GetUserData(int32_t proxy) const { return mNodes[proxy].userData; }
+		uint32_t GetProxyCount() const { return mProxyCount; }
+		int32_t GetHeight() const { return mRoot == NullNode ? 0 : mNodes[mRoot].height; }
+
+	private:
+		struct Node
+		{
+			AABB aabb;
+			uint32_t userData;
+			int32_t parent; // next free node when in the free list
+			int32_t child1;
+			int32_t child2;
+			int32_t height; // 0 for leaves, -1 for free nodes
+
+			bool IsLeaf() const { return child1 == NullNode; }
+		};
+
+		int32_t AllocateNode();
+		void FreeNode(int32_t node);
+		void InsertLeaf(int32_t leaf);
+		void RemoveLeaf(int32_t leaf);
+		int32_t Balance(int32_t node);
+		int32_t BuildTopDown(int32_t* leaves, int32_t count);
+		void CollectLeaves(int32_t node, std::vector<uint32_t>& outResults) const;
+
+		std::vector<Node> mNodes;
+		int32_t mRoot = NullNode;
+		int32_t mFreeList = NullNode;
+		uint32_t mProxyCount = 0;
+		float mMargin;
+
+		mutable std::vector<int32_t> mStack; // reused traversal stack
+	};
+
+	/*!***********************************************************************
+		\brief
+			Keeps a static and a dynamic tree in sync with the mesh and
+			skinned mesh entities of a registry. Entities whose world transform
+			has not changed for a while migrate into the static tree, which is
+			rebuilt instead of refit.
+	*************************************************************************/
+	class RenderBVH
+	{
+	public:
+		/*!***********************************************************************
+			\brief
+				Inserts, refits, migrates and removes proxies, call once per frame
+				after the transform hierarchy is up to date
+			\param[in] registry
+				The registry of the scene
+		*************************************************************************/
+		void Update(entt::registry& registry);
+
+		/*!***********************************************************************
+			\brief
+				Appends every renderable entity touching the volume, in no
+				particular order
+		*************************************************************************/
+		void QueryFrustum(Frustum const& frustum, std::vector<entt::entity>& outResults) const;
+		void QuerySphere(BoundingSphere const& sphere, std::vector<entt::entity>& outResults) const;
+		void QueryAABB(AABB const& aabb, std::vector<entt::entity>& outResults) const;
+
+		/*!***********************************************************************
+			\brief
+				Removes every proxy
+		*************************************************************************/
+		void Clear();
+
+		static constexpr uint32_t StaticFrameThreshold = 60; // still frames before an entity counts as static
+
+	private:
+		struct Proxy
+		{
+			int32_t proxy = BoundingVolumeHierarchy::NullNode;
+			bool isStatic = false;
+			uint32_t stillFrames = 0;
+			uint32_t worldVersion = 0;
+			void const* model = nullptr;
+			AABB bounds; // world AABB at worldVersion, reused while nothing changes
+		};
+
+		/*!***********************************************************************
+			\brief
+				Inserts or refreshes the proxy of a renderable. The world AABB
+				is only recomputed when the transform version or the model
+				differs from what the proxy was built from
+		*************************************************************************/
+		void SyncProxy(entt::entity entity, TransformComponent& transform, AABB const& modelAABB, void const* model);
+		void RemoveProxy(entt::entity entity);
+		void AppendEntities(std::vector<entt::entity>& outResults) const;
+
+		BoundingVolumeHierarchy mStaticTree{ 0.f };
+		BoundingVolumeHierarchy mDynamicTree;
+		entt::storage<Proxy> mProxies;
+		std::vector<entt::entity> mStaleEntities;
+		bool mStaticDirty = false;
+
+		mutable std::vector<uint32_t> mQueryScratch;
+	};
+}
+
+#endif
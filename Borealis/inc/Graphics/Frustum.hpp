@@ -88,6 +88,17 @@ namespace Borealis
 	void GetCornersViewProj(std::vector<glm::vec4>& corners, glm::mat4 const& viewProj);
 
 	bool CullBoundingSphere(Frustum const& frustum, BoundingSphere boundingSphere);
+
+	bool CullAABB(Frustum const& frustum, AABB const& aabb);
+
+	enum class FrustumTest
+	{
+		Outside,
+		Intersect,
+		Inside
+	};
+
+	FrustumTest ClassifyAABB(Frustum const& frustum, AABB const& aabb);
 }
 
 #endif
@@ -257,9 +257,19 @@ namespace Borealis
 		static Ref<Asset> Load(std::filesystem::path const& cachePath, AssetMetaData const& assetMetaData);
 
 		static void Reload(AssetMetaData const& assetMetaData, Ref<Asset> const& asset);
+
+		/*!***********************************************************************
+			\brief
+				Reads the texture handles of a material file without loading
+				them, so the streaming loader can queue the textures first
+		*************************************************************************/
+		static std::vector<AssetHandle> GetDependencies(std::filesystem::path const& cachePath, AssetMetaData const& assetMetaData);
 		bool mNonRepeatingTiles = false;
 
 		void swap(Asset& o) override;
+
+		// Texture maps are assets of their own and are counted there
+		uint64_t GetMemorySize() const override { return sizeof(Material); }
 	private:
 		/*!***********************************************************************
 			\brief
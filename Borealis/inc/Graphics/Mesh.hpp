@@ -19,6 +19,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include <glm/gtc/matrix_transform.hpp>
 
 #include <Graphics/Shader.hpp>
+#include <Graphics/Buffer.hpp>
 
 namespace Borealis
 {
@@ -47,6 +48,20 @@ namespace Borealis
 		void Transform(glm::mat4 const& transform);
 	};
 
+	/*!***********************************************************************
+		\brief
+			Per instance data of an instanced mesh draw, read by vertex
+			attributes 7 to 10 (transform columns) and 11 (entity id)
+	*************************************************************************/
+	struct InstanceData
+	{
+		glm::mat4 transform;
+		int entityID;
+		int padding[3];
+	};
+
+	static constexpr uint32_t InstanceAttributeLocation = 7;
+
 
 	class Mesh
 	{
@@ -94,12 +109,49 @@ namespace Borealis
 		*************************************************************************/
 		void SetupMesh();
 
+		/*!***********************************************************************
+			\brief
+				CPU half of SetupMesh, safe to run on a loader thread
+		*************************************************************************/
+		void PrepareMesh();
+
+		/*!***********************************************************************
+			\brief
+				GPU half of SetupMesh, main thread only
+		*************************************************************************/
+		void UploadMesh();
+
+		/*!***********************************************************************
+			\brief
+				Deletes the GPU buffers of the mesh, main thread only
+		*************************************************************************/
+		void ReleaseMesh();
+
+		/*!***********************************************************************
+			\brief
+				Bytes of the vertex data, counting the CPU copy and the upload
+		*************************************************************************/
+		uint64_t GetMemorySize() const;
+
 		/*!***********************************************************************
 			\brief
 				Draw mesh
 		*************************************************************************/
 		void Draw(const glm::mat4& transform, Ref<Shader> shader, int entityID, bool posOnly);
 
+		/*!***********************************************************************
+			\brief
+				Draw many copies of the mesh in one call, the shader has to read
+				the instance attributes when u_Instanced is set
+			\param instanceBuffer
+				Buffer of InstanceData
+			\param firstInstance
+				Index of the first InstanceData of this draw in the buffer
+			\param instanceCount
+				Number of copies to draw
+		*************************************************************************/
+		void DrawInstanced(Ref<Shader> shader, Ref<VertexBuffer> const& instanceBuffer, uint32_t firstInstance, uint32_t instanceCount, bool posOnly);
+
 		void GenerateRitterBoundingSphere();
 
 		void GenerateAABB();
@@ -171,8 +223,8 @@ namespace Borealis
 		uint32_t mIndicesCount; // Number of indices
 
 
-		unsigned int VAO, EBO; 
-		unsigned int VBOs[5];
+		unsigned int VAO{}, EBO{};
+		unsigned int VBOs[5]{};
 
 		BoundingSphere mBoundingSphere;
 		AABB mAABB;
@@ -41,12 +41,33 @@ namespace Borealis
 		*************************************************************************/
 		void Draw(const glm::mat4& transform, Ref<Shader> shader, int entityID, bool posOnly = false);
 
+		/*!***********************************************************************
+			\brief
+				Renders instanceCount copies of the model in one draw per mesh,
+				reading transforms and entity ids from the instance buffer
+		*************************************************************************/
+		void DrawInstanced(Ref<Shader> shader, Ref<VertexBuffer> const& instanceBuffer, uint32_t firstInstance, uint32_t instanceCount, bool posOnly = false);
+
 		/*!***********************************************************************
 			\brief
 				Load the model from a file path
 		*************************************************************************/
 		void LoadModel(std::filesystem::path const& path);
 
+		/*!***********************************************************************
+			\brief
+				Reads the meshes and their bounds without touching the GPU, so
+				it can run on a loader thread. LoadModel is ReadModel followed
+				by UploadMeshes
+		*************************************************************************/
+		void ReadModel(std::filesystem::path const& path);
+
+		/*!***********************************************************************
+			\brief
+				Creates the GPU buffers of every mesh read, main thread only
+		*************************************************************************/
+		void UploadMeshes();
+
 		/*!***********************************************************************
 				TO REMOVE
 		*************************************************************************/
@@ -58,12 +79,22 @@ namespace Borealis
 		static Ref<Asset> Load(std::filesystem::path const& cachePath, AssetMetaData const& assetMetaData);
 		static void Reload(AssetMetaData const& assetMetaData, Ref<Asset> asset);
 
+		/*!***********************************************************************
+			\brief
+				Streaming halves of Load. Decode reads a model or skinned model
+				on a loader thread, Finalize uploads it on the main thread
+		*************************************************************************/
+		static Ref<Asset> Decode(std::filesystem::path const& cachePath, AssetMetaData const& assetMetaData);
+		static void Finalize(AssetMetaData const& assetMetaData, Ref<Asset> const& asset);
+
 		BoundingSphere mBoundingSphere{};
 		AABB mAABB;
 
 		std::vector<Mesh> mMeshes;
 
 		void swap(Asset& other) override;
+		uint64_t GetMemorySize() const override;
+		void Release() override;
 	private:
 
 		RTTR_ENABLE(Asset)
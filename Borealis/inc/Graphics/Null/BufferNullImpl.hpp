@@ -0,0 +1,81 @@
+/******************************************************************************
+/*!
+\file       BufferNullImpl.hpp
+\author     Chua Zheng Yang
+\par        email: c.zhengyang\@digipen.edu
+\date       October 17, 2026
+\brief      Declares the headless vertex and element buffers
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#ifndef BUFFER_NULL_IMPL_HPP
+#define BUFFER_NULL_IMPL_HPP
+#include <Graphics/Buffer.hpp>
+
+namespace Borealis
+{
+	class NullVertexBuffer : public VertexBuffer
+	{
+	public:
+		/*!***********************************************************************
+			\brief
+				Constructor for a dynamic NullVertexBuffer, nothing is uploaded
+			\param size
+				The size of the buffer
+		*************************************************************************/
+		NullVertexBuffer(uint32_t size);
+
+		/*!***********************************************************************
+			\brief
+				Constructor for a static NullVertexBuffer, counts the upload
+			\param vertices
+				The vertices of the buffer
+			\param size
+				The size of the buffer
+		*************************************************************************/
+		NullVertexBuffer(float* vertices, uint32_t size);
+
+		~NullVertexBuffer() override;
+
+		void Bind() const override;
+		void Unbind() const override;
+		void SetData(const void* data, uint32_t size) override;
+
+		void SetLayout(const BufferLayout& layout) override { mLayout = layout; }
+		const BufferLayout& GetLayout() const override { return mLayout; }
+
+	private:
+		BufferLayout mLayout; //!< The layout of the buffer
+		uint32_t mSize; //!< The size of the buffer in bytes
+	};
+
+	class NullElementBuffer : public ElementBuffer
+	{
+	public:
+		/*!***********************************************************************
+			\brief
+				Constructor for NullElementBuffer, counts the upload
+			\param indices
+				The indices of the buffer
+			\param count
+				The number of indices
+		*************************************************************************/
+		NullElementBuffer(uint32_t* indices, uint32_t count);
+
+		~NullElementBuffer() override;
+
+		void Bind() const override;
+		void Unbind() const override;
+
+		uint32_t GetCount() const override { return mCount; }
+
+	private:
+		uint32_t mCount; //!< The number of indices
+	};
+}
+
+#endif
@@ -0,0 +1,67 @@
+/******************************************************************************
+/*!
+\file       FramebufferNullImpl.hpp
+\author     Chua Zheng Yang
+\par        email: c.zhengyang\@digipen.edu
+\date       October 17, 2026
+\brief      Declares the headless frame buffer
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#ifndef FRAME_BUFFER_NULL_IMPL_HPP
+#define FRAME_BUFFER_NULL_IMPL_HPP
+#include <Graphics/Framebuffer.hpp>
+
+namespace Borealis
+{
+	class NullFrameBuffer : public FrameBuffer
+	{
+	public:
+		/*!***********************************************************************
+			\brief
+				Constructor for NullFrameBuffer, hands out a fake id for every
+				attachment so passes can pass them around
+			\param[in] properties
+				The properties of the frame buffer
+		*************************************************************************/
+		NullFrameBuffer(const FrameBufferProperties& properties);
+
+		~NullFrameBuffer() override;
+
+		void Bind() override;
+		void Unbind() override;
+		void BindTexture(uint32_t attachmentIndex, uint32_t textureUnit) override;
+		void BindDepthBuffer(uint32_t textureUnit, bool is3D = false) override;
+		void Resize(uint32_t width, uint32_t height) override;
+
+		/*!***********************************************************************
+			\brief
+				There is nothing to read back, always reports no entity
+			\return
+				-1
+		*************************************************************************/
+		int ReadPixel(uint32_t attachmentIndex, int x, int y) override;
+
+		void ClearAttachment(uint32_t attachmentIndex, int value) override;
+		void ClearAttachment(uint32_t attachmentIndex, glm::vec4 value) override;
+
+		uint32_t GetColorAttachmentRendererID(uint32_t index = 0) const override;
+		uint32_t DetachDepthBuffer() override { return mDepthAttachment; }
+		void AttachDepthBuffer(uint32_t index) override;
+		uint32_t DetachTextureAttachment(uint32_t index = 0) override { return mColorAttachments[index]; }
+		void AttachTextureAttachment(uint32_t textureID, uint32_t index = 0) override;
+
+		const FrameBufferProperties& GetProperties() const override { return mProperties; }
+
+	private:
+		FrameBufferProperties mProperties; //!< The properties of the frame buffer
+		std::vector<uint32_t> mColorAttachments; //!< Fake ids of the color attachments
+		uint32_t mDepthAttachment = 0; //!< Fake id of the depth attachment
+	};
+}
+
+#endif
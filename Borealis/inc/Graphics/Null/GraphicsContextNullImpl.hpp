@@ -0,0 +1,38 @@
+/******************************************************************************
+/*!
+\file       GraphicsContextNullImpl.hpp
+\author     Chua Zheng Yang
+\par        email: c.zhengyang\@digipen.edu
+\date       October 17, 2026
+\brief      Declares the headless graphics context
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#ifndef GRAPHICS_CONTEXT_NULL_IMPL_HPP
+#define GRAPHICS_CONTEXT_NULL_IMPL_HPP
+#include "Graphics/GraphicsContext.hpp"
+
+namespace Borealis
+{
+	class NullContext : public GraphicsContext
+	{
+	public:
+		/*!***********************************************************************
+			\brief
+				Nothing to load, no driver is used
+		*************************************************************************/
+		virtual void Init() override;
+
+		/*!***********************************************************************
+			\brief
+				Counts the present as a back buffer bind
+		*************************************************************************/
+		virtual void SwapBuffers() override;
+	}; // class NullContext
+} // namespace Borealis
+
+#endif
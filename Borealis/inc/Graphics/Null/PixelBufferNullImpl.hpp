@@ -0,0 +1,50 @@
+/******************************************************************************
+/*!
+\file       PixelBufferNullImpl.hpp
+\author     Chan Guo Geng Gordon
+\par        email: g.chan/@digipen.edu
+\date       October 17, 2026
+\brief      Declares the headless pixel buffer
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#ifndef PixelBufferNullImpl_HPP
+#define PixelBufferNullImpl_HPP
+
+#include <Core/Core.hpp>
+#include <Graphics/PixelBuffer.hpp>
+
+namespace Borealis
+{
+	class NullPixelBuffer : public PixelBuffer
+	{
+	public:
+		NullPixelBuffer(PixelBufferProperties const& props);
+
+		void ReadTexture(uint32_t index) override;
+
+		/*!***********************************************************************
+			\brief
+				There is nothing to read back, always reports no entity
+			\return
+				-1
+		*************************************************************************/
+		int ReadPixel(int x, int y) override;
+
+		void BindForRead() override;
+		void BindForWrite() override;
+		void Unbind() override;
+		void Resize(uint32_t width, uint32_t height) override;
+		void SwapBuffers() override;
+
+		const PixelBufferProperties& GetProperties() const override { return mProps; }
+	private:
+		PixelBufferProperties mProps;
+	};
+}
+
+#endif
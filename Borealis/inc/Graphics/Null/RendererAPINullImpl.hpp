@@ -0,0 +1,177 @@
+/******************************************************************************
+/*!
+\file       RendererAPINullImpl.hpp
+\author     Chua Zheng Yang
+\par        email: c.zhengyang\@digipen.edu
+\date       October 17, 2026
+\brief      Declares the headless renderer backend, which records and counts
+			commands instead of calling a graphics driver
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#ifndef RENDERER_API_NULL_IMPL_HPP
+#define RENDERER_API_NULL_IMPL_HPP
+#include <vector>
+#include "Graphics/RendererAPI.hpp"
+
+namespace Borealis
+{
+	enum class NullCommand : uint8_t
+	{
+		Clear,
+		DrawElements,
+		DrawLines,
+		StateChange,
+		BindShader,
+		SetUniform,
+		BindTexture,
+		BindBuffer,
+		BindFrameBuffer,
+		Upload,
+		ReadBack,
+		CreateResource,
+		DestroyResource
+	};
+
+	struct NullCommandRecord
+	{
+		NullCommand command;
+		uint64_t amount; //!< Index count, vertex count or byte count depending on the command
+	};
+
+	struct NullRenderStats
+	{
+		uint64_t clears = 0;
+		uint64_t drawCalls = 0;
+		uint64_t indices = 0;
+		uint64_t lineVertices = 0;
+		uint64_t stateChanges = 0;
+		uint64_t shaderBinds = 0;
+		uint64_t uniformSets = 0;
+		uint64_t textureBinds = 0;
+		uint64_t bufferBinds = 0;
+		uint64_t frameBufferBinds = 0;
+		uint64_t bytesUploaded = 0;
+		uint64_t readBacks = 0;
+		uint64_t resourcesCreated = 0;
+		uint64_t resourcesDestroyed = 0;
+	};
+
+	class NullRendererAPI : public RendererAPI
+	{
+	public:
+		/*!***********************************************************************
+			\brief
+				Init the RendererAPI
+		*************************************************************************/
+		void Init() override;
+
+		void Clear() override;
+		void ClearStencil() override;
+		void SetClearColor(const float& r, const float& g, const float& b, const float& a) override;
+		void SetClearColor(const glm::vec4& color) override;
+		void SetStencilClear(int clear) override;
+
+		/*!***********************************************************************
+			\brief
+				Counts a draw call, using the element buffer count when no index
+				count is given like the OpenGL backend does
+			\param VAO
+				The VertexArray to draw
+			\param indexCount
+				The number of indices to draw
+		*************************************************************************/
+		void DrawElements(const Ref<VertexArray>& VAO, uint32_t indexCount = 0) override;
+
+		void DrawElementsInstanced(const Ref<VertexArray>& VAO, uint32_t indexCount, uint32_t instanceCount) override;
+		void DrawLines(const Ref<VertexArray>& VAO, uint32_t vertexCount = 0) override;
+		void SetViewport(const uint32_t& x, const uint32_t& y, const uint32_t& width, const uint32_t& height) override;
+		void SetLineThickness(const float& thickness) override;
+		void BindBackBuffer() override;
+		void EnableBlend() override;
+		void DisableBlend() override;
+		void ConfigureBlendForTransparency(TransparencyStage stage) override;
+		void EnableDepthTest() override;
+		void ConfigureDepthFunc(DepthFunc func) override;
+		void DisableDepthTest() override;
+		void SetDepthMask(bool depthMask) override;
+		void EnableBackFaceCull() override;
+		void EnableFrontFaceCull() override;
+		void EnableStencilTest() override;
+		void ConfigureStencilForHighlight() override;
+		void DisableStencilTest() override;
+		void EnableWireFrameMode() override;
+		void DisableWireFrameMode() override;
+		void EnablePolygonOffset() override;
+		void SetPolygonOffset(float factor, float units) override;
+		void DisablePolygonOffset() override;
+		void DisableDrawToSecondaryBuffer() override;
+		void EnableDrawToSecondaryBuffer() override;
+		void ResetTextureBinding() override;
+		void IgnoreNextError() override;
+		unsigned GetError(std::string const& errorMsg) override;
+
+		/*!***********************************************************************
+			\brief
+				Counts a command, and appends it to the command list while
+				recording. Called by every null graphics object.
+			\param command
+				The command
+			\param amount
+				Indices, vertices or bytes involved, depending on the command
+		*************************************************************************/
+		static void Record(NullCommand command, uint64_t amount = 0);
+
+		/*!***********************************************************************
+			\brief
+				Hands out a unique fake renderer id for a null graphics object
+			\return
+				The renderer id, never 0
+		*************************************************************************/
+		static uint32_t NextRendererID();
+
+		/*!***********************************************************************
+			\brief
+				Get the counters accumulated since the last ResetStats
+			\return
+				The counters
+		*************************************************************************/
+		static NullRenderStats const& GetStats() { return sStats; }
+
+		/*!***********************************************************************
+			\brief
+				Zeroes the counters and clears the recorded commands, call at the
+				start of the frame being measured
+		*************************************************************************/
+		static void ResetStats();
+
+		/*!***********************************************************************
+			\brief
+				Enables or disables appending to the command list. Counting is
+				always on.
+			\param recording
+				True to record
+		*************************************************************************/
+		static void SetRecording(bool recording) { sRecording = recording; }
+
+		/*!***********************************************************************
+			\brief
+				Get the commands recorded since the last ResetStats
+			\return
+				The commands, in submission order
+		*************************************************************************/
+		static std::vector<NullCommandRecord> const& GetCommands() { return sCommands; }
+
+	private:
+		static NullRenderStats sStats; //!< Counters since the last reset
+		static std::vector<NullCommandRecord> sCommands; //!< Recorded commands since the last reset
+		static bool sRecording; //!< Whether commands are appended to sCommands
+		static uint32_t sNextRendererID; //!< Next fake renderer id
+	}; // class NullRendererAPI
+} // namespace Borealis
+
+#endif
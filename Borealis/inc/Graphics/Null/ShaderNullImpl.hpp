@@ -0,0 +1,63 @@
+/******************************************************************************
+/*!
+\file       ShaderNullImpl.hpp
+\author     Chua Zheng Yang
+\par        email: c.zhengyang\@digipen.edu
+\date       October 17, 2026
+\brief      Declares the headless shader, which compiles nothing and counts binds and uniform sets
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#ifndef SHADER_NULL_IMPL_HPP
+#define SHADER_NULL_IMPL_HPP
+#include <Graphics/Shader.hpp>
+
+namespace Borealis
+{
+	class NullShader : public Shader
+	{
+	public:
+		/*!***********************************************************************
+			\brief
+				Constructor for NullShader, the file is not read
+			\param[in] filepath
+				The filepath of the shader, used for the name
+		*************************************************************************/
+		NullShader(const std::string& filepath);
+
+		/*!***********************************************************************
+			\brief
+				Constructor for NullShader
+			\param[in] name
+				The name of the shader
+		*************************************************************************/
+		NullShader(const std::string& name, const std::string& vertexSource, const std::string& fragmentSource);
+
+		~NullShader() override;
+
+		uint32_t GetID() override { return mRendererID; }
+		void Bind() const override;
+		void Unbind() const override;
+		const std::string& GetName() const override { return mName; }
+
+		void Set(const char* name, const int& value) override;
+		void Set(const char* name, const int* values, const uint32_t& count) override;
+		void Set(const char* name, const float& value) override;
+		void Set(const char* name, const glm::vec2& value) override;
+		void Set(const char* name, const glm::vec3& value) override;
+		void Set(const char* name, const glm::vec4& value) override;
+		void Set(const char* name, const glm::mat3& value) override;
+		void Set(const char* name, const glm::mat4& value) override;
+		bool HasUniform(const char* name) override;
+
+	private:
+		std::string mName; //!< The name of the shader
+		uint32_t mRendererID; //!< Fake renderer id, unique per shader
+	}; // class NullShader
+} // namespace Borealis
+
+#endif
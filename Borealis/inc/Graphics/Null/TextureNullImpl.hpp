@@ -0,0 +1,94 @@
+/******************************************************************************
+/*!
+\file       TextureNullImpl.hpp
+\author     Chua Zheng Yang
+\par        email: c.zhengyang\@digipen.edu
+\date       October 17, 2026
+\brief      Declares the headless 2D and cube map textures
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#ifndef TEXTURE_NULL_IMPL_HPP
+#define TEXTURE_NULL_IMPL_HPP
+#include <Graphics/Texture.hpp>
+
+namespace Borealis
+{
+	class NullTexture2D : public Texture2D
+	{
+	public:
+		/*!***********************************************************************
+			\brief
+				Constructor for NullTexture2D, the file is not decoded so the
+				texture reports a 1x1 size
+			\param[in] path
+				Path to the texture file
+		*************************************************************************/
+		NullTexture2D(const std::string& path, std::optional<TextureConfig> textureConfig = std::nullopt);
+
+		/*!***********************************************************************
+			\brief
+				Constructor for NullTexture2D
+			\param[in] textureInfo
+				Infomation of the texture
+		*************************************************************************/
+		NullTexture2D(const TextureInfo& textureInfo);
+
+		~NullTexture2D();
+
+		void SetData(void* data, uint32_t size) override;
+
+		uint32_t GetWidth() const override { return mWidth; }
+		uint32_t GetHeight() const override { return mHeight; }
+		uint32_t GetRendererID() const override { return mRendererID; }
+		void SetRendererID(uint32_t ID) override { mRendererID = ID; }
+
+		void Bind(uint32_t unit = 0) const override;
+		bool IsValid() const override { return true; }
+		void swap(Asset& other) override;
+
+		bool operator==(const Texture& other) const override { return mRendererID == other.GetRendererID(); }
+
+	private:
+		std::string mPath; // Path to the texture file
+		uint32_t mRendererID; // Fake renderer ID of the texture
+		uint32_t mWidth = 1, mHeight = 1; // Width and Height of the texture
+	};
+
+	class NullTextureCubeMap : public TextureCubeMap
+	{
+	public:
+		/*!***********************************************************************
+			\brief
+				Constructor for NullTextureCubeMap, the file is not decoded
+			\param[in] path
+				Path to the texture file
+		*************************************************************************/
+		NullTextureCubeMap(const std::filesystem::path& path);
+
+		~NullTextureCubeMap();
+
+		void SetData(void* data, uint32_t size) override;
+
+		uint32_t GetWidth() const override { return 1; }
+		uint32_t GetHeight() const override { return 1; }
+		uint32_t GetRendererID() const override { return mRendererID; }
+		void SetRendererID(uint32_t id) override { mRendererID = id; }
+
+		void Bind(uint32_t unit = 0) const override;
+		bool IsValid() const override { return true; }
+		void swap(Asset& other) override;
+
+		bool operator==(const Texture& other) const override { return mRendererID == other.GetRendererID(); }
+
+	private:
+		std::string mPath; // Path to the texture file
+		uint32_t mRendererID; // Fake renderer ID of the texture
+	};
+}
+
+#endif
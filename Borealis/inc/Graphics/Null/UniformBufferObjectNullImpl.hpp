@@ -0,0 +1,38 @@
+/******************************************************************************
+/*!
+\file       UniformBufferObjectNullImpl.hpp
+\author     Chan Guo Geng Gordon
+\par        email: g.chan/@digipen.edu
+\date       October 17, 2026
+\brief      Declares the headless uniform buffer object
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#ifndef UniformBufferObjectNullImpl_HPP
+#define UniformBufferObjectNullImpl_HPP
+
+#include <Graphics/UniformBufferObject.hpp>
+
+namespace Borealis
+{
+	class UniformBufferObjectNullImpl : public UniformBufferObject
+	{
+	public:
+		UniformBufferObjectNullImpl(uint32_t size, uint32_t binding);
+		virtual ~UniformBufferObjectNullImpl();
+
+		virtual void SetData(const void* data, uint32_t size, uint32_t offset = 0) override;
+		virtual void Bind() override;
+
+		static void BindToShader(uint32_t shaderID, const char* blockName, uint32_t binding);
+
+	private:
+		uint32_t mSize = 0;
+	};
+}
+
+#endif
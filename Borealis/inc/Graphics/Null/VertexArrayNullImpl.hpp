@@ -0,0 +1,42 @@
+/******************************************************************************
+/*!
+\file       VertexArrayNullImpl.hpp
+\author     Chua Zheng Yang
+\par        email: c.zhengyang\@digipen.edu
+\date       October 17, 2026
+\brief      Declares the headless vertex array
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#ifndef VERTEX_ARRAY_NULL_IMPL_HPP
+#define VERTEX_ARRAY_NULL_IMPL_HPP
+#include <vector>
+#include <Graphics/VertexArray.hpp>
+
+namespace Borealis
+{
+	class NullVertexArray : public VertexArray
+	{
+	public:
+		NullVertexArray();
+		~NullVertexArray() override;
+
+		void Bind() const override;
+		void Unbind() const override;
+		void AddVertexBuffer(const Ref<VertexBuffer>& VBO, bool perInstance = false) override;
+		void SetElementBuffer(const Ref<ElementBuffer>& EBO) override;
+
+		const std::vector<Ref<VertexBuffer>>& GetVertexBuffers() const override { return mVBOs; }
+		const Ref<ElementBuffer> GetElementBuffer() const override { return mEBO; }
+
+	private:
+		std::vector<Ref<VertexBuffer>> mVBOs; //!< The Vertex Buffers of the Vertex Array
+		Ref<ElementBuffer> mEBO; //!< The Element Buffer of the Vertex Array
+	};
+}
+
+#endif
@@ -70,6 +70,12 @@ namespace Borealis
 		*************************************************************************/
 		void DrawElements(const Ref<VertexArray>& VAO, uint32_t indexCount = 0) override;
 
+		/*!***********************************************************************
+			\brief
+				Draw the elements in the VAO once per instance
+		*************************************************************************/
+		void DrawElementsInstanced(const Ref<VertexArray>& VAO, uint32_t indexCount, uint32_t instanceCount) override;
+
 		/*!***********************************************************************
 			\brief
 				Draw the lines of the vertex array
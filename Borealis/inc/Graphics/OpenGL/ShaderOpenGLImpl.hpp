@@ -86,6 +86,7 @@ namespace Borealis
 		void Set(const char* name, const glm::vec4& value) override;
 		void Set(const char* name, const glm::mat3& value) override;
 		void Set(const char* name, const glm::mat4& value) override;
+		bool HasUniform(const char* name) override;
 
 	private:
 		using GLenum = unsigned int;
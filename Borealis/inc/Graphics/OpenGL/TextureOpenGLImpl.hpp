@@ -104,6 +104,7 @@ namespace Borealis
 
 		void swap(Asset& other) override;
 
+		uint64_t GetMemorySize() const override { return mMemorySize; }
 
 		/*!***********************************************************************
 			\brief
@@ -120,6 +121,7 @@ namespace Borealis
 		uint32_t mRendererID; // Renderer ID of the texture
 		uint32_t mWidth, mHeight, mChannels; // Width, Height and Channels of the texture
 		GLenum mInternalFormat, mDataFormat; // Internal Format and Data Format of the texture
+		uint64_t mMemorySize = 0; // Bytes uploaded, every mip level included
 	};
 
 	class OpenGLTextureCubeMap : public TextureCubeMap
@@ -185,6 +187,8 @@ namespace Borealis
 
 		bool IsValid() const override;
 
+		uint64_t GetMemorySize() const override { return mMemorySize; }
+
 		/*!***********************************************************************
 			\brief
 				Operator overload to check if two textures are the same
@@ -200,6 +204,7 @@ namespace Borealis
 		uint32_t mRendererID = 0; // Renderer ID of the texture
 		uint32_t mWidth, mHeight, mChannels; // Width, Height and Channels of the texture
 		GLenum mInternalFormat, mDataFormat; // Internal Format and Data Format of the texture
+		uint64_t mMemorySize = 0; // Bytes uploaded, every face and mip level included
 	};
 }
 
@@ -26,12 +26,14 @@ namespace Borealis
 		virtual ~UniformBufferObjectOpenGLImpl();
 
 		virtual void SetData(const void* data, uint32_t size, uint32_t offset = 0) override;
+		virtual void Bind() override;
 		static int GetBlockSize(uint32_t shaderID, const char* blockName);
 
 		static void BindToShader(uint32_t shaderID, const char* blockName, uint32_t binding);
 
 	private:
 		uint32_t mRendererID = 0;
+		uint32_t mBinding = 0;
 	};
 }
 
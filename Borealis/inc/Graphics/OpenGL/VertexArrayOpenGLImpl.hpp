@@ -52,8 +52,10 @@ namespace Borealis
 				Add a Vertex Buffer to the Vertex Array
 			\param VBO
 				The Vertex Buffer to add
+			\param perInstance
+				True if the buffer advances once per instance
 		*************************************************************************/
-		void AddVertexBuffer(const Ref<VertexBuffer>& VBO) override;
+		void AddVertexBuffer(const Ref<VertexBuffer>& VBO, bool perInstance = false) override;
 
 		/*!***********************************************************************
 			\brief
@@ -83,6 +85,7 @@ namespace Borealis
 		std::vector<Ref<VertexBuffer>> mVBOs; //!< The Vertex Buffers of the Vertex Array
 		Ref<ElementBuffer> mEBO; //!< The Element Buffer of the Vertex Array
 		uint32_t mRendererID = 0; //!< The Renderer ID of the Vertex Array
+		uint32_t mAttributeIndex = 0; //!< Next free attribute location
 	};
 }
 
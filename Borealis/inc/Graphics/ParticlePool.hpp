@@ -0,0 +1,151 @@
+/******************************************************************************
+/*!
+\file       ParticlePool.hpp
+\author     Chan Guo Geng Gordon
+\par        email: g.chan/@digipen.edu
+\date       October 17, 2026
+\brief      Declares the structure-of-arrays storage and update kernels for
+			particle systems
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#ifndef PARTICLE_POOL_HPP
+#define PARTICLE_POOL_HPP
+#include <vector>
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+namespace Borealis
+{
+	/*!***********************************************************************
+		\brief
+			Xorshift random generator, deterministic for a given seed and
+			cheap enough to call several times per spawned particle
+	*************************************************************************/
+	struct ParticleRandom
+	{
+		uint32_t state = 0x9E3779B9u;
+
+		/*!***********************************************************************
+			\brief
+				Seeds the generator for one emitter, so overlapping emitters do
+				not spawn the same sequence
+			\param[in] entityID
+				UUID of the entity that owns the emitter
+			\param[in] emitterIndex
+				Index of the emitter on that entity
+		*************************************************************************/
+		void Seed(uint64_t entityID, uint32_t emitterIndex)
+		{
+			// splitmix64 finaliser, nearby ids and indices give unrelated seeds
+			uint64_t z = entityID + (static_cast<uint64_t>(emitterIndex) + 1) * 0x9E3779B97F4A7C15ull;
+			z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+			z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+			z ^= z >> 31;
+			state = static_cast<uint32_t>(z ^ (z >> 32));
+			// xorshift never leaves 0
+			if (state == 0)
+				state = 0x9E3779B9u;
+		}
+
+		uint32_t NextUInt()
+		{
+			state ^= state << 13;
+			state ^= state >> 17;
+			state ^= state << 5;
+			return state;
+		}
+
+		/*!***********************************************************************
+			\brief
+				Get a float in [0, 1)
+		*************************************************************************/
+		float Next01()
+		{
+			return static_cast<float>(NextUInt() >> 8) * (1.f / 16777216.f);
+		}
+	};
+
+	/*!***********************************************************************
+		\brief
+			Emitter world transform, resolved once per frame before the
+			systems update
+	*************************************************************************/
+	struct ParticleEmitterTransform
+	{
+		glm::vec3 position{ 0.f };
+		glm::quat orientation{ 1.f, 0.f, 0.f, 0.f };
+		glm::vec3 scale{ 1.f };
+	};
+
+	/*!***********************************************************************
+		\brief
+			Alive particles of one system stored as parallel arrays. Alive
+			particles are always packed in [0, Size()), killing a particle
+			moves the last one into its slot.
+	*************************************************************************/
+	class ParticlePool
+	{
+	public:
+		uint32_t Size() const { return static_cast<uint32_t>(life.size()); }
+		bool Empty() const { return life.empty(); }
+
+		void Clear();
+		void Reserve(uint32_t capacity);
+
+		/*!***********************************************************************
+			\brief
+				Appends a particle, the caller fills every array at the index
+			\return
+				Index of the new particle
+		*************************************************************************/
+		uint32_t Add();
+
+		/*!***********************************************************************
+			\brief
+				Ages every particle and removes the ones past lifeTime
+		*************************************************************************/
+		void Age(float dt, float lifeTime);
+
+		/*!***********************************************************************
+			\brief
+				Applies a constant acceleration to the velocities
+		*************************************************************************/
+		void Accelerate(glm::vec3 const& acceleration, float dt);
+
+		/*!***********************************************************************
+			\brief
+				Applies perlin noise acceleration sampled at each position
+		*************************************************************************/
+		void ApplyNoise(float frequency, float strength, float scroll, float dt);
+
+		/*!***********************************************************************
+			\brief
+				Moves the positions by the velocities
+		*************************************************************************/
+		void Integrate(float dt);
+
+		/*!***********************************************************************
+			\brief
+				Lerps each color from its start color to endColor over lifeTime
+		*************************************************************************/
+		void FadeColor(glm::vec4 const& endColor, float lifeTime);
+
+		std::vector<float> posX, posY, posZ;
+		std::vector<float> velX, velY, velZ;
+		std::vector<float> life;
+		std::vector<glm::vec3> size; //if not 3d, use .x for size
+		std::vector<glm::quat> rotation;
+		std::vector<glm::vec4> startColor;
+		std::vector<glm::vec4> color;
+
+	private:
+		void Remove(uint32_t index);
+	};
+}
+
+#endif
@@ -0,0 +1,66 @@
+/******************************************************************************
+/*!
+\file       ParticleRenderer.hpp
+\author     Chan Guo Geng Gordon
+\par        email: g.chan/@digipen.edu
+\date       October 17, 2026
+\brief      Declares the instanced renderer that draws particle pools directly
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#ifndef PARTICLE_RENDERER_HPP
+#define PARTICLE_RENDERER_HPP
+#include <Core/Core.hpp>
+#include <Graphics/Texture.hpp>
+#include <Graphics/ParticlePool.hpp>
+
+namespace Borealis
+{
+	class ParticleRenderer
+	{
+	public:
+		/*!***********************************************************************
+			\brief
+				Creates the unit quad, the instance buffer and the particle shader
+		*************************************************************************/
+		static void Init();
+
+		/*!***********************************************************************
+			\brief
+				Releases the buffers and the shader
+		*************************************************************************/
+		static void Free();
+
+		/*!***********************************************************************
+			\brief
+				Packs the alive particles of one emitter into the instance buffer
+				with a single upload and draws them in one instanced call. The
+				quads are expanded in the vertex shader. Expects the weighted
+				transparency accumulation target to be bound.
+			\param[in] particles
+				Particles to draw
+			\param[in] texture
+				Texture sampled by every particle of the emitter
+			\param[in] billboard
+				Face the camera using size.x as the half extent, instead of
+				using the particle rotation and size
+		*************************************************************************/
+		static void DrawEmitter(ParticlePool const& particles, Ref<Texture2D> const& texture, bool billboard);
+
+		struct Statistics
+		{
+			uint32_t DrawCalls = 0;
+			uint32_t ParticleCount = 0;
+			uint32_t UploadedBytes = 0;
+		};
+
+		static void ResetStats();
+		static Statistics& GetStats();
+	};
+}
+
+#endif
@@ -25,10 +25,12 @@ namespace Borealis
 
 		/*!***********************************************************************
 			\brief
-				Initialises the Renderer
+				Initialises the Renderer, recreating the backend in case the API
+				was changed with RendererAPI::SetAPI
 		*************************************************************************/
 		inline static void Init() {
 			PROFILE_FUNCTION();
+			sRendererAPI = RendererAPI::Create();
 			sRendererAPI->Init(); }
 		/*!***********************************************************************
 			\brief
@@ -40,6 +42,18 @@ namespace Borealis
 		*************************************************************************/
 		inline static void DrawElements(const Ref<VertexArray>& VAO, uint32_t count = 0) { sRendererAPI->DrawElements(VAO, count); }
 
+		/*!***********************************************************************
+			\brief
+				Draw Elements in the VAO once per instance
+			\param[in] VAO
+				The Vertex Array Object to draw
+			\param[in] count
+				The number of elements per instance
+			\param[in] instanceCount
+				The number of instances
+		*************************************************************************/
+		inline static void DrawElementsInstanced(const Ref<VertexArray>& VAO, uint32_t count, uint32_t instanceCount) { sRendererAPI->DrawElementsInstanced(VAO, count, instanceCount); }
+
 		/*!***********************************************************************
 			\brief
 				Draw Lines in the VAO
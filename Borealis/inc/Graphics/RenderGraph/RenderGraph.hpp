@@ -20,6 +20,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include <Graphics/Framebuffer.hpp>
 #include <Graphics/Pixelbuffer.hpp>
 #include <Graphics/Shader.hpp>
+#include <Graphics/ParticlePool.hpp>
 
 #include <string>
 #include <vector>
@@ -28,6 +29,9 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 
 namespace Borealis
 {
+	struct ParticleSystemComponent;
+	class Animator;
+
 	enum class RenderSourceType
 	{
 		Bool,
@@ -49,6 +53,13 @@ namespace Borealis
 		RenderSourceType sourceType;
 		virtual void Bind() = 0;
 		virtual void Unbind() {};
+
+		/*!***********************************************************************
+			\brief
+				Re-reads state owned by the wrapped object, called once per frame
+				since sources now live across frames
+		*************************************************************************/
+		virtual void Refresh() {};
 	};
 
 	class BoolSource : public RenderSource
@@ -101,6 +112,7 @@ namespace Borealis
 		RenderTargetSource(std::string name, Ref<FrameBuffer> framebuffer);
 		void Bind() override;
 		void Unbind() override;
+		void Refresh() override;
 
 		void BindDepthBuffer(int index, bool is3D = false);
 
@@ -142,6 +154,7 @@ namespace Borealis
 		void ReadTexture(uint32_t index);
 		void Bind() override;
 		void Unbind() override;
+		void Refresh() override;
 
 		void SwapBuffer();
 		void Resize(uint32_t width, uint32_t height);
@@ -155,6 +168,13 @@ namespace Borealis
 		CameraSource(std::string name, EditorCamera const& camera);
 		CameraSource(std::string name, const Camera& camera, const glm::mat4& transform);
 
+		/*!***********************************************************************
+			\brief
+				Updates the source in place from a camera
+		*************************************************************************/
+		void Set(EditorCamera const& camera);
+		void Set(const Camera& camera, const glm::mat4& transform);
+
 		bool editor;
 		glm::vec3 position;
 		glm::vec3 lookAt;
@@ -180,6 +200,25 @@ namespace Borealis
 
 		std::string sourceName{};
 		Ref<RenderSource> source = nullptr;
+
+		/*!***********************************************************************
+			\brief
+				Links the sink to its source and fills the typed handle matching
+				the source type, so passes do not cast at execute time
+			\param[in] resolved
+				The source, or nullptr if it could not be found
+		*************************************************************************/
+		void Resolve(Ref<RenderSource> const& resolved);
+
+		// Typed handles of source, only the one matching source->sourceType is set
+		Ref<BoolSource> boolSource = nullptr;
+		Ref<IntSource> intSource = nullptr;
+		Ref<Vec2IntSource> vec2IntSource = nullptr;
+		Ref<IntListSource> intListSource = nullptr;
+		Ref<RenderTargetSource> renderTarget = nullptr;
+		Ref<GBufferSource> gBuffer = nullptr;
+		Ref<PixelBufferSource> pixelBuffer = nullptr;
+		Ref<CameraSource> camera = nullptr;
 	};
 
 	enum class RenderPassType
@@ -220,6 +259,7 @@ namespace Borealis
 		std::vector<Ref<RenderSink>> sinkList;
 		std::vector<Ref<RenderSource>> sourceList;
 		Ref<Shader> shader;
+		bool resolved = false; //every sink found its source when the graph was compiled
 	};
 
 	class ObjectPickingPass : public RenderPass
@@ -398,6 +438,8 @@ namespace Borealis
 
 		RenderPassConfig(RenderPassType type, std::string passName);
 		RenderPassConfig& AddSinkLinkage(std::string sinkName, std::string sourceName);
+
+		bool operator==(RenderPassConfig const& other) const;
 	};
 
 	class RenderGraphConfig
@@ -406,6 +448,13 @@ namespace Borealis
 		void AddPass(RenderPassConfig renderPassConfig);
 		void AddGlobalSource(Ref<RenderSource> globalSource);
 
+		/*!***********************************************************************
+			\brief
+				Two configs are equal if they have the same passes and linkages
+				and the same global source objects
+		*************************************************************************/
+		bool operator==(RenderGraphConfig const& other) const;
+
 		std::vector<Ref<RenderSource>> globalRenderSourceList;
 		std::vector<RenderPassConfig> passesConfigList;
 	};
@@ -413,24 +462,94 @@ namespace Borealis
 	class RenderGraph
 	{
 	public:
+		/*!***********************************************************************
+			\brief
+				Work done rebuilding the graph, all zero in a frame where the
+				compiled graph was reused
+		*************************************************************************/
+		struct RebuildStats
+		{
+			uint32_t compiles = 0;
+			uint32_t passAllocations = 0;
+			uint32_t sinkAllocations = 0;
+			uint32_t sourceLookups = 0;
+		};
+
+		/*!***********************************************************************
+			\brief
+				Frame times of the staged animation update, for each number of
+				threads it was allowed to use
+		*************************************************************************/
+		struct AnimationBenchmark
+		{
+			uint32_t instances = 0;					// 0 when the scene has nothing to animate
+			std::vector<double> frameMilliseconds;	// index i ran on i + 1 threads
+		};
+
+		/*!***********************************************************************
+			\brief
+				Drops the compiled passes and every global source
+		*************************************************************************/
 		void Init();
 
+		/*!***********************************************************************
+			\brief
+				Times the staged animation update on copies of the first
+				animator of the registry, limiting each stage from one thread up
+				to every worker plus the caller
+			\param instances
+				Number of animated characters
+			\param frames
+				Frames timed per thread count
+		*************************************************************************/
+		static AnimationBenchmark BenchmarkAnimations(entt::registry& registry, uint32_t instances = 200, uint32_t frames = 60);
+
 		void Update(float dt);
 		void AddPass(Ref<RenderPass> pass);
+
+		/*!***********************************************************************
+			\brief
+				Runs the compiled passes in order, skipping passes with a missing
+				source
+		*************************************************************************/
 		void Execute();
 
-		void SetConfig(RenderGraphConfig renderGraphConfig);
+		/*!***********************************************************************
+			\brief
+				Sets the passes and global sources of the graph, the graph is only
+				recompiled if the config differs from the current one
+		*************************************************************************/
+		void SetConfig(RenderGraphConfig const& renderGraphConfig);
 
-		void Finalize();
+		/*!***********************************************************************
+			\brief
+				Builds the passes from the config, orders them so that each pass
+				runs after the passes it reads from and links every sink to its
+				source. Does nothing if nothing changed since the last compile.
+		*************************************************************************/
+		void Compile();
 
-		Ref<RenderSource> FindSource(std::string sourceName);
+		Ref<RenderSource> FindSource(std::string const& sourceName);
 
 		void AddRenderPassConfig(RenderPassConfig const& renderPassConfig);
 
 		void AddEntityPassConfig(RenderPassConfig const& renderPassConfig);
 
+		/*!***********************************************************************
+			\brief
+				Adds a global source that stays across compiles, replacing the
+				source with the same name
+		*************************************************************************/
 		void SetGlobalSource(Ref<RenderSource> source);
 
+		void RemoveGlobalSource(std::string const& sourceName);
+
+		/*!***********************************************************************
+			\brief
+				Get the rebuild work done in the last executed frame
+		*************************************************************************/
+		RebuildStats const& GetLastFrameStats() const { return mLastFrameStats; }
+
 		void SetEntityRegistry(entt::registry& registry);
 		void SetFinalSink(std::string sinkName, std::string sourceName);//set render output
 
@@ -439,7 +558,7 @@ namespace Borealis
 
 		RenderGraphConfig mRenderGraphConfig;
 
-		entt::registry* registryPtr;
+		entt::registry* registryPtr = nullptr;
 
 		struct SceneRenderConfigUBO
 		{
@@ -461,6 +580,42 @@ namespace Borealis
 		};
 
 		SceneRenderConfig sceneRenderConfig{};
+
+	private:
+		void SortPasses();
+
+		struct ParticleJob
+		{
+			ParticleSystemComponent* system;
+			ParticleEmitterTransform emitter;
+		};
+
+		struct AnimationJob
+		{
+			Animator* animator;
+			int paletteSlot; //-1 when the model has no animation to skin with
+			bool posed; //set by the time stage, the later stages are skipped otherwise
+		};
+
+		/*!***********************************************************************
+			\brief
+				Evaluates the animators in one parallel-for, each job running
+				every stage of its animator: time, sampling, blending, local
+				to model space, then the skinning palette
+			\param palette
+				Receives MAX_BONES matrices per palette slot
+			\param grainSize
+				Animators per range
+		*************************************************************************/
+		static void EvaluateAnimations(std::vector<AnimationJob>& jobs, std::vector<glm::mat4>& palette, float dt, uint32_t grainSize = 1);
+
+		std::vector<ParticleJob> mParticleJobs; //systems updated this frame, kept to reuse its memory
+		std::vector<AnimationJob> mAnimationJobs; //animators updated this frame, kept to reuse its memory
+		std::vector<glm::mat4> mAnimationPalette; //bone matrices of every palette slot, uploaded in one write
+		std::vector<Ref<RenderSource>> mPersistentSources; //sources set through SetGlobalSource
+		bool mDirty = true;
+		RebuildStats mFrameStats{};
+		RebuildStats mLastFrameStats{};
 	};
 }
 
@@ -33,9 +33,7 @@ namespace Borealis
 		static void Begin(const Camera& camera, const glm::mat4& transform);
 		static void Begin(glm::mat4 viewProj);
 		static void End();
-		static void EndParticles();
 		static void Flush();
-		static void FlushParticles();
 
 		static void DrawSprite(const glm::mat4& transform, const SpriteRendererComponent& sprite, int entityID = -1);
 
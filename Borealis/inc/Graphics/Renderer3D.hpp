@@ -107,6 +107,27 @@ namespace Borealis
 
 		static void UpdateMaterialUBO();
 
+		/*!***********************************************************************
+			\brief
+				Uploads the bone palettes of this frame, spread over as many
+				animation UBOs of MAX_ANIMATION_PER_UBO palettes as needed
+			\param palettes
+				MAX_BONES matrices per palette, one palette after another
+			\param count
+				Number of palettes
+		*************************************************************************/
+		static void SetAnimationPalettes(glm::mat4 const* palettes, uint32_t count);
+
+		/*!***********************************************************************
+			\brief
+				Binds the animation UBO holding a palette
+			\param slot
+				Palette index given to SetAnimationPalettes
+			\return
+				Index of the palette inside the bound UBO, for u_AnimationIndex
+		*************************************************************************/
+		static int BindAnimationPalette(int slot);
+
 		struct DrawData
 		{
 			bool hasAnimation{};
@@ -117,19 +138,51 @@ namespace Borealis
 		{
 			std::variant<Ref<Model>,Ref<SkinnedModel>> model;
 			Ref<Shader> shaderID;
-			std::size_t materialHash;
+			Ref<Material> material;
 			uint32_t entityID;
 			glm::mat4 transform;
 			DrawData drawData;
 		};
 
+		/*!***********************************************************************
+			\brief
+				Sort key of a draw call, packed from most to least significant as
+				pass (2 bits), shader (14), material (14), mesh (16) and depth (18)
+		*************************************************************************/
+		struct DrawKey
+		{
+			uint64_t key;
+			uint32_t index; //!< Index into the draw queue
+		};
+
 	private:
+		/*!***********************************************************************
+			\brief
+				Sorts a draw queue by key, merges runs of the same model and
+				material into instanced draws and submits them
+			\param[in] queue
+				The draw queue to submit
+			\param[in] posOnly
+				Only the position attribute is enabled
+			\param[in] transparent
+				Value of u_Transparent
+			\param[in] firstTextureUnit
+				Texture unit of the first material texture
+		*************************************************************************/
+		static void SubmitDrawQueue(std::vector<DrawCall> const& queue, bool posOnly, bool transparent, int firstTextureUnit);
+
+		static uint64_t MakeSortKey(DrawCall const& drawCall);
+
 		inline static bool mGlobalWireFrame = false;
 		inline static bool mNewMaterialAdded = false;
 		static LightEngine mLightEngine;
 
 		inline static std::vector<DrawCall> drawQueue;
 		inline static std::vector<DrawCall> drawQueueTransparent;
+		inline static std::vector<DrawKey> drawKeys;
+		inline static std::vector<DrawKey> drawKeysScratch;
+		inline static std::vector<InstanceData> instanceData;
+		inline static std::unordered_map<void const*, uint32_t> meshSlots;
 		inline static std::unordered_map<std::size_t, Ref<Material>> materialMap;
 		inline static std::unordered_map<std::size_t, MaterialUBOData> materialUBODataMap;
 		static void AddToDrawQueue(std::variant<Ref<Model>, Ref<SkinnedModel>> model, Ref<Shader> shaderID, Ref<Material> materialHash, uint32_t entityID, glm::mat4 const& transform, std::optional<DrawData> drawData = std::nullopt);
@@ -38,7 +38,7 @@ namespace Borealis
 	public:
 		enum class API
 		{
-			None = 0, OpenGL = 1	
+			None = 0, OpenGL = 1, Null = 2
 		};
 
 		/*!***********************************************************************
@@ -95,6 +95,18 @@ namespace Borealis
 		*************************************************************************/
 		virtual void DrawElements(const Ref<VertexArray>& VAO, uint32_t indexCount = 0) = 0;
 
+		/*!***********************************************************************
+			\brief
+				Draw the elements in the VAO once per instance
+			\param[in] VAO
+				The Vertex Array Object to draw, with its per instance buffers
+			\param[in] indexCount
+				The number of indices per instance
+			\param[in] instanceCount
+				The number of instances
+		*************************************************************************/
+		virtual void DrawElementsInstanced(const Ref<VertexArray>& VAO, uint32_t indexCount, uint32_t instanceCount) = 0;
+
 		/*!***********************************************************************
 			\brief
 				Draw Lines in the VAO
@@ -172,6 +184,23 @@ namespace Borealis
 				The API being used
 		*************************************************************************/
 		inline static API GetAPI() { return sAPI; }
+
+		/*!***********************************************************************
+			\brief
+				Set the API to use, only takes effect if called before
+				Renderer::Init
+			\param[in] api
+				The API to use
+		*************************************************************************/
+		inline static void SetAPI(API api) { sAPI = api; }
+
+		/*!***********************************************************************
+			\brief
+				Create the RendererAPI for the API being used
+			\return
+				The RendererAPI
+		*************************************************************************/
+		static Scope<RendererAPI> Create();
 	private:
 		static API sAPI; //!< The API being used
 	}; // class RendererAPI
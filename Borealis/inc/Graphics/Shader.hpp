@@ -91,6 +91,16 @@ namespace Borealis
 		virtual void Set(const char* name, const glm::vec4& value) = 0;
 		virtual void Set(const char* name, const glm::mat3& value) = 0;
 		virtual void Set(const char* name, const glm::mat4& value) = 0;
+
+		/*!***********************************************************************
+			\brief
+				Check if the shader declares an active uniform
+			\param[in] name
+				The Name of the Uniform
+			\return
+				True if the uniform can be set
+		*************************************************************************/
+		virtual bool HasUniform(const char* name) = 0;
 	}; // class Shader
 
 	class ShaderAPI
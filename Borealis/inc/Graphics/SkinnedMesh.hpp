@@ -66,6 +66,26 @@ namespace Borealis
 		void SetIndicesCount(uint32_t count);
 
 		void SetupMesh();
+
+		/*!***********************************************************************
+			\brief
+				CPU and GPU halves of SetupMesh, only UploadMesh needs the main
+				thread
+		*************************************************************************/
+		void PrepareMesh();
+		void UploadMesh();
+
+		/*!***********************************************************************
+			\brief
+				Deletes the GPU buffers of the mesh, main thread only
+		*************************************************************************/
+		void ReleaseMesh();
+
+		/*!***********************************************************************
+			\brief
+				Bytes of the vertex data, counting the CPU copy and the upload
+		*************************************************************************/
+		uint64_t GetMemorySize() const;
 	private:
 
 		void ComputeTangents();
@@ -76,7 +96,7 @@ namespace Borealis
 		uint32_t mVerticesCount; // Number of vertices
 		uint32_t mIndicesCount; // Number of indices
 
-		unsigned int VAO, VBO, EBO;
+		unsigned int VAO{}, VBO{}, EBO{};
 	};
 }
 
@@ -40,8 +40,23 @@ namespace Borealis
 		*************************************************************************/
 		void LoadModel(std::filesystem::path const& path);
 
+		/*!***********************************************************************
+			\brief
+				CPU and GPU halves of LoadModel, only UploadMeshes needs the
+				main thread
+		*************************************************************************/
+		void ReadModel(std::filesystem::path const& path);
+		void UploadMeshes();
+
 		void AssignAnimation(Ref<Animation> animation);
 
+		/*!***********************************************************************
+			\brief
+				Generates the bind pose bounds of all meshes, padded since the
+				animated pose can reach past them
+		*************************************************************************/
+		void GenerateAABB();
+
 		/*!***********************************************************************
 				TO REMOVE
 		*************************************************************************/
@@ -51,8 +66,11 @@ namespace Borealis
 		std::map<std::string, BoneData> mBoneDataMap{};
 		int mBoneCounter{};
 		Ref<Animation> mAnimation;
+		AABB mAABB{};
 
 		void swap(Asset& other) override;
+		uint64_t GetMemorySize() const override;
+		void Release() override;
 	private:
 		RTTR_ENABLE(Asset)
 	};
@@ -24,6 +24,7 @@ namespace Borealis
 	public:
 		virtual ~UniformBufferObject() {}
 		virtual void SetData(const void* data, uint32_t size, uint32_t offset = 0) = 0;
+		virtual void Bind() = 0; // Makes this buffer the one behind its binding point again
 		static Ref<UniformBufferObject> Create(uint32_t size, uint32_t binding);
 
 		static void BindToShader(uint32_t shaderID, const char* blockName, uint32_t binding);
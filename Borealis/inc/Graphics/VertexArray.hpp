@@ -40,11 +40,15 @@ namespace Borealis
 
 		/*!***********************************************************************
 			\brief
-				Adds a VertexBuffer to the VertexArray
+				Adds a VertexBuffer to the VertexArray, its attributes follow the
+				attributes of the buffers added before it
 			\param vertexBuffer
 				The VertexBuffer to be added
+			\param perInstance
+				True if the buffer advances once per instance instead of once
+				per vertex
 		*************************************************************************/
-		virtual void AddVertexBuffer(const Ref<VertexBuffer>& vertexBuffer) = 0;
+		virtual void AddVertexBuffer(const Ref<VertexBuffer>& vertexBuffer, bool perInstance = false) = 0;
 
 		/*!***********************************************************************
 			\brief
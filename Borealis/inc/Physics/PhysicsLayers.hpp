@@ -0,0 +1,117 @@
+/******************************************************************************/
+/*!
+\file		PhysicsLayers.hpp
+\author 	Benjamin Lee Zhi Yuan
+\par    	email: benjaminzhiyuan.lee\@digipen.edu
+\date   	October 17, 2026
+\brief		Declares the project layer collision matrix and its mapping onto
+			Jolt object and broadphase layers
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#ifndef PHYSICS_LAYERS_HPP
+#define PHYSICS_LAYERS_HPP
+#include <cstdint>
+
+namespace Borealis
+{
+	/*!***********************************************************************
+		\brief
+			Broadphase tree a body is placed in. Each category is its own
+			bounding volume tree, so trees whose categories never collide are
+			never tested against each other
+	*************************************************************************/
+	enum class BroadPhaseCategory : uint8_t
+	{
+		Static,
+		Moving,
+		Debris,
+		Trigger,
+		Character,
+		Count
+	};
+
+	/*!***********************************************************************
+		\brief
+			Project wide collision matrix between the 32 entity layers, plus
+			the layers whose dynamic bodies are treated as debris. A Jolt
+			object layer is the category times LayerCount plus the entity
+			layer, so both the broadphase tree and the matrix row can be read
+			back from it without a lookup
+	*************************************************************************/
+	class PhysicsLayers
+	{
+	public:
+		static constexpr uint32_t LayerCount = 32;
+		static constexpr uint32_t AllLayers = 0xFFFFFFFF;
+		static constexpr uint16_t ObjectLayerCount = static_cast<uint16_t>(LayerCount * static_cast<uint32_t>(BroadPhaseCategory::Count));
+
+		/*!***********************************************************************
+			\brief
+				Every layer collides with every layer and no layer is debris
+		*************************************************************************/
+		static void Reset();
+
+		/*!***********************************************************************
+			\brief
+				Sets whether two layers collide, both rows are updated so the
+				matrix stays symmetric
+		*************************************************************************/
+		static void SetCollision(uint32_t layerA, uint32_t layerB, bool collide);
+		static bool GetCollision(uint32_t layerA, uint32_t layerB);
+
+		/*!***********************************************************************
+			\brief
+				Row of the matrix as a bit mask of the layers it collides with.
+				Setting a row also updates the matching column
+		*************************************************************************/
+		static void SetCollisionMask(uint32_t layer, uint32_t mask);
+		static uint32_t GetCollisionMask(uint32_t layer);
+
+		/*!***********************************************************************
+			\brief
+				Dynamic bodies on debris layers go in the debris tree, which
+				collides with static, moving and debris bodies and triggers,
+				but not with characters
+		*************************************************************************/
+		static void SetDebrisMask(uint32_t mask) { sDebrisMask = mask; }
+		static uint32_t GetDebrisMask() { return sDebrisMask; }
+		static bool IsDebrisLayer(uint32_t layer) { return layer < LayerCount && (sDebrisMask & (1u << layer)) != 0; }
+
+		/*!***********************************************************************
+			\brief
+				Packs and unpacks Jolt object layers
+		*************************************************************************/
+		static uint16_t ToObjectLayer(uint32_t layer, BroadPhaseCategory category)
+		{
+			return static_cast<uint16_t>(static_cast<uint32_t>(category) * LayerCount + (layer % LayerCount));
+		}
+		static uint32_t ToLayer(uint16_t objectLayer) { return objectLayer % LayerCount; }
+		static BroadPhaseCategory ToCategory(uint16_t objectLayer) { return static_cast<BroadPhaseCategory>(objectLayer / LayerCount); }
+
+		/*!***********************************************************************
+			\brief
+				Whether bodies of the two broadphase categories can ever touch
+		*************************************************************************/
+		static bool CategoriesCollide(BroadPhaseCategory a, BroadPhaseCategory b);
+
+		/*!***********************************************************************
+			\brief
+				Whether two Jolt object layers collide, by category and by the
+				layer matrix
+		*************************************************************************/
+		static bool ShouldCollide(uint16_t objectLayerA, uint16_t objectLayerB);
+
+		static const char* GetCategoryName(BroadPhaseCategory category);
+
+	private:
+		static uint32_t sCollisionMasks[LayerCount];
+		static uint32_t sDebrisMask;
+	};
+}
+
+#endif
@@ -0,0 +1,113 @@
+/******************************************************************************/
+/*!
+\file		PhysicsStepPipeline.hpp
+\author 	Benjamin Lee Zhi Yuan
+\par    	email: benjaminzhiyuan.lee\@digipen.edu
+\date   	October 17, 2026
+\brief		Declares the pipeline that runs one fixed physics step between the
+			scene and Jolt
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#ifndef PHYSICS_STEP_PIPELINE_HPP
+#define PHYSICS_STEP_PIPELINE_HPP
+#include <vector>
+#include <entt.hpp>
+#include <Physics/PhysicsSystem.hpp>
+
+namespace Borealis
+{
+	class Scene;
+
+	/*!***********************************************************************
+		\brief
+			Runs a fixed physics step as four stages: gather the active bodies
+			and characters of every collider type into one list, push them in
+			a single chunked parallel-for, simulate, then pull the awake bodies
+			back in a second parallel-for. There is one join before the
+			simulation and one after it. Each transform is written by one job,
+			entities with several bodies have the rest pulled after the join.
+			Every buffer is kept between steps.
+	*************************************************************************/
+	class PhysicsStepPipeline
+	{
+	public:
+		/*!***********************************************************************
+			\brief
+				Time spent in each stage, summed over the steps since the last
+				reset
+		*************************************************************************/
+		struct Timings
+		{
+			float gatherMs = 0.f;
+			float pushMs = 0.f;
+			float simulateMs = 0.f;
+			float pullMs = 0.f;
+			uint32_t steps = 0;
+			uint32_t bodies = 0;       // gathered in the last step
+			uint32_t pushedBodies = 0; // changed since their last sync in the last step
+			uint32_t pulledBodies = 0; // awake after the last step
+		};
+
+		/*!***********************************************************************
+			\brief
+				Runs one fixed step for the scene, leaving its world matrices
+				up to date with the simulation
+			\param[in] scene
+				Scene to step
+			\param[in] dt
+				Fixed time step
+		*************************************************************************/
+		void Step(Scene& scene, float dt);
+
+		/*!***********************************************************************
+			\brief
+				Sets how many bodies or characters each job of the push and pull
+				stages handles
+		*************************************************************************/
+		void SetGrainSize(uint32_t grainSize) { mGrainSize = grainSize ? grainSize : 1; }
+		uint32_t GetGrainSize() const { return mGrainSize; }
+
+		Timings const& GetTimings() const { return mTimings; }
+		void ResetTimings() { mTimings = {}; }
+
+	private:
+		struct BodyEntry
+		{
+			TransformComponent* transform;
+			ColliderComponent* collider;
+			bool shared; // the entity has another body or a character, pulled after the parallel-for
+		};
+
+		struct CharacterEntry
+		{
+			TransformComponent* transform;
+			CharacterControllerComponent* character;
+		};
+
+		void Gather(Scene& scene);
+		void Push(float dt);
+		void Simulate(float dt);
+		void Pull(Scene& scene);
+
+		template<typename Collider, typename... Earlier>
+		void GatherBodies(Scene& scene);
+
+		std::vector<BodyEntry> mBodies;
+		std::vector<CharacterEntry> mCharacters;
+		std::vector<uint32_t> mBodyLookup;      // body index to mBodies slot, validated by the body ID
+		std::vector<BodyTransform> mBodySyncs;  // one slot per gathered body, compacted to the changed ones
+		std::vector<uint8_t> mBodyChanged;
+		std::vector<unsigned int> mActiveBodies;
+		std::vector<BodyEntry> mPulledBodies;   // one slot per active body, null when not a gathered body
+
+		uint32_t mGrainSize = 32;
+		Timings mTimings;
+	};
+}
+
+#endif
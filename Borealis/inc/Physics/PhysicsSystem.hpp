@@ -32,7 +32,74 @@ namespace Borealis
 		glm::vec3 point;
 	};
 
-	using CollisionPair = std::pair<uint64_t, uint64_t>;
+	enum class QueryShape : uint32_t
+	{
+		Ray,
+		Sphere,
+		Box,
+		Capsule
+	};
+
+	/*!***********************************************************************
+		\brief
+			One query of a batch. Casts sweep the shape from origin along
+			direction up to maxDistance, overlaps test the shape at origin.
+			Mirrored by Borealis.PhysicsQuery in the script core, keep the
+			layout in sync.
+	*************************************************************************/
+	struct PhysicsQuery
+	{
+		glm::vec3 origin{ 0.f };
+		glm::vec3 direction{ 0.f, 0.f, 1.f };
+		glm::vec3 extents{ 0.5f }; // sphere: x is the radius, box: half extents, capsule: x is the radius and y the half height of the cylinder part
+		glm::vec3 rotation{ 0.f }; // degrees, used by box and capsule
+		float maxDistance = 0.f;
+		uint32_t layerMask = 0;    // 0 tests every layer
+		QueryShape shape = QueryShape::Ray;
+	};
+
+	enum class ContactEventType : uint8_t
+	{
+		CollisionEnter,
+		CollisionStay,
+		CollisionExit,
+		TriggerEnter,
+		TriggerStay,
+		TriggerExit
+	};
+
+	/*!***********************************************************************
+		\brief
+			One contact seen from the receiving entity, both are entity
+			handles of the scene that owns the bodies
+	*************************************************************************/
+	struct ContactEvent
+	{
+		uint32_t receiver;
+		uint32_t other;
+		ContactEventType type;
+
+		bool operator<(ContactEvent const& rhs) const
+		{
+			if (receiver != rhs.receiver) return receiver < rhs.receiver;
+			if (type != rhs.type) return type < rhs.type;
+			return other < rhs.other;
+		}
+
+		bool operator==(ContactEvent const& rhs) const
+		{
+			return receiver == rhs.receiver && other == rhs.other && type == rhs.type;
+		}
+	};
+
+	struct BodyTransform
+	{
+		unsigned int bodyID;
+		glm::vec3 position;
+		glm::quat rotation;
+		MovementType movement;
+		bool movementChanged;
+	};
 
 
 	class Entity;
@@ -69,6 +136,20 @@ namespace Borealis
    */
 		static void PullTransform(ColliderComponent& collider, TransformComponent& transform);
 
+		/**
+   * \brief Pushes a batch of changed body transforms to the physics system.
+   * Poses that did not really move are skipped, moved bodies are woken up
+   * with a single activation call.
+   * \param bodies The bodies to update, only the ones that changed since the last step.
+   */
+		static void PushTransforms(std::vector<BodyTransform> const& bodies);
+
+		/**
+   * \brief Gets the IDs of the rigid bodies that are awake after the last update.
+   * \param bodyIDs Filled with the body IDs, cleared first.
+   */
+		static void GetActiveBodies(std::vector<unsigned int>& bodyIDs);
+
         /**
         * \brief Adds a body to the physics system.
         * \param position The position of the body.
@@ -112,16 +193,22 @@ namespace Borealis
 		static UUID BodyIDToUUID(unsigned int bodyID);
 		static bool BodyIDToIsSensor(unsigned int bodyID);
 
+		/**
+   * \brief Gets the index part of a body ID, it is below the maximum body count.
+   * \param bodyID The ID of the body.
+   */
+		static uint32_t GetBodyIndex(unsigned int bodyID);
+
 		static void SetActive(unsigned int bodyID);
 		static void SetInactive(unsigned int bodyID);
 
-		static std::queue<CollisionPair>& GetCollisionEnterQueue();
-		static std::queue<CollisionPair>& GetCollisionPersistQueue();
-		static std::queue<CollisionPair>& GetCollisionExitQueue();
-
-		static std::queue<CollisionPair>& GetTriggerEnterQueue();
-		static std::queue<CollisionPair>& GetTriggerPersistQueue();
-		static std::queue<CollisionPair>& GetTriggerExitQueue();
+		/**
+   * \brief Merges the contacts every thread recorded during the last update.
+   * Each contact is listed once for both entities, sorted by receiver then
+   * event type, with duplicates from compound shapes removed.
+   * \return The events, valid until the next call.
+   */
+		static std::vector<ContactEvent> const& CollectContactEvents();
 
 		static void DrawDebug();
 
@@ -145,6 +232,31 @@ namespace Borealis
 
 		static std::vector<RaycastHit> RayCastAll(glm::vec3 origin, glm::vec3 direction, float maxDistance, Bitset32 LayerMask);
 
+		/**
+   * \brief Runs a batch of ray and shape casts in parallel on the physics job system.
+   * \param queries The casts to run.
+   * \param count Number of queries.
+   * \param hits Caller owned, receives the closest hit of each query, a miss has an ID of 0.
+   * \return Number of queries that hit something.
+   */
+		static uint32_t CastBatch(PhysicsQuery const* queries, uint32_t count, RaycastHit* hits);
+
+		/**
+   * \brief Same as above, writing each field of the hits into its own caller owned array.
+   */
+		static uint32_t CastBatch(PhysicsQuery const* queries, uint32_t count, uint64_t* IDs, float* distances, glm::vec3* normals, glm::vec3* points);
+
+		/**
+   * \brief Runs a batch of overlap tests in parallel on the physics job system.
+   * Rays have no volume and never overlap anything.
+   * \param queries The shapes to test, direction and maxDistance are ignored.
+   * \param count Number of queries.
+   * \param hitIDs Caller owned, maxHitsPerQuery entity IDs for each query.
+   * \param maxHitsPerQuery Entries of hitIDs reserved for each query.
+   * \param hitCounts Caller owned, receives the number of entities stored for each query.
+   */
+		static void OverlapBatch(PhysicsQuery const* queries, uint32_t count, uint64_t* hitIDs, uint32_t maxHitsPerQuery, uint32_t* hitCounts);
+
 		static bool IsCharacterOnGround(void* Character);
 
 		static void UpdateScale(ColliderComponent& collider, TransformComponent& transform);
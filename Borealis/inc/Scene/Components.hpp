@@ -28,6 +28,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include <Graphics/Material.hpp>
 #include <Graphics/Font.hpp>
 #include <Graphics/Framebuffer.hpp>
+#include <Graphics/ParticlePool.hpp>
 #include <AI/BehaviourTree/BehaviourTree.hpp>
 #include <AI/BehaviourTree/BTreeFactory.hpp>
 #include <Core/UUID.hpp>
@@ -41,6 +42,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 namespace Borealis
 {
 	class Entity;
+	class Scene;
 
 	struct IDComponent
 	{
@@ -57,6 +59,9 @@ namespace Borealis
 		Bitset32 mLayer;
 		int mHierarchyLayer = 0;
 
+		// Cached "active && parent active in hierarchy", kept by Scene
+		bool mActiveInHierarchy = true;
+
 		TagComponent() = default;
 		TagComponent(const TagComponent&) = default;
 		TagComponent(const std::string& tag)
@@ -65,6 +70,29 @@ namespace Borealis
 		}
 	};
 
+	// Empty tag present on every entity that is active in hierarchy, lets
+	// systems iterate only active entities through a view
+	struct ActiveTag {};
+
+	/*!***********************************************************************
+		\brief
+			Scene a component was added to, set by the scene when the component
+			is constructed in its registry. Assigning a component over another
+			keeps the scene of the one assigned to, so a copy pasted into
+			another scene does not point back at the original
+	*************************************************************************/
+	struct OwnerScene
+	{
+		Scene* scene = nullptr;
+
+		OwnerScene() = default;
+		OwnerScene(OwnerScene const& other) : scene(other.scene) {}
+		OwnerScene(OwnerScene&& other) noexcept : scene(other.scene) {}
+		OwnerScene& operator=(OwnerScene const&) { return *this; }
+		// Storages move components around inside the same registry
+		OwnerScene& operator=(OwnerScene&& other) noexcept { scene = other.scene; return *this; }
+	};
+
 	struct TransformComponent
 	{
 		glm::vec3 Translate { 0.0f, 0.0f ,0.0f };
@@ -72,6 +100,17 @@ namespace Borealis
 		glm::vec3 Scale = { 1.0f, 1.0f, 1.0f };
 		UUID ParentID = 0;
 		std::vector<UUID> ChildrenID{};
+
+		// World matrix cache, refreshed lazily or by Scene::UpdateTransformHierarchy
+		glm::mat4 mCachedWorld{ 1.0f };
+		glm::vec3 mCachedTranslate{ 0.0f, 0.0f ,0.0f };
+		glm::vec3 mCachedRotation{ 0.0f, 0.0f ,0.0f };
+		glm::vec3 mCachedScale = { 1.0f, 1.0f, 1.0f };
+		UUID mCachedParentID = 0;
+		uint32_t mCachedParentVersion = 0; // mWorldVersion of the parent mCachedWorld was built from
+		bool mWorldDirty = true;
+		uint32_t mWorldVersion = 0; // bumped whenever mCachedWorld is recomputed
+		OwnerScene mOwner;
 	
 		TransformComponent() = default;
 		TransformComponent(const TransformComponent&) = default;
@@ -98,6 +137,42 @@ namespace Borealis
 		void ResetParent(Entity entity);
 		int GetHierarchyLayer(Entity entity);
 
+		/*!***********************************************************************
+			\brief
+				Checks if the local TRS or parent changed since the world matrix
+				was last cached
+			\return
+				True if the cached world matrix is out of date
+		*************************************************************************/
+		bool IsLocalChanged() const
+		{
+			return Translate != mCachedTranslate || Rotation != mCachedRotation || Scale != mCachedScale || ParentID != mCachedParentID;
+		}
+
+		/*!***********************************************************************
+			\brief
+				Marks this transform and all of its children as needing a world
+				matrix refresh
+		*************************************************************************/
+		void SetDirty();
+
+		/*!***********************************************************************
+			\brief
+				Recomputes the cached world matrix from the parent's world matrix
+			\param[in] parentWorld
+				The world matrix of the parent, identity for roots
+			\param[in] parentVersion
+				The world version of the parent, 0 for roots
+		*************************************************************************/
+		void RefreshWorldTransform(glm::mat4 const& parentWorld, uint32_t parentVersion);
+
+		/*!***********************************************************************
+			\brief
+				Scene the transform lives in, the active scene for a transform
+				that is not in any scene's registry
+		*************************************************************************/
+		Scene* GetScene() const;
+
 		operator glm::mat4() { return GetTransform(); }
 	};
 
@@ -298,6 +373,10 @@ namespace Borealis
 		RigidbodyComponent* rigidBody = nullptr;
 		unsigned int bodyID = 0;
 		bool isActive = true;
+
+		// Runtime only, what was last sent to the physics body
+		uint32_t syncedWorldVersion = UINT32_MAX;
+		MovementType syncedMovement = MovementType::Static;
 	};
 
 	struct CylinderColliderComponent : public ColliderComponent
@@ -516,18 +595,6 @@ namespace Borealis
 		CanvasRendererComponent(const CanvasRendererComponent&) = default;
 	};
 
-	struct Particle
-	{
-		bool		isActive = false;
-		float		life = 0.f;
-		glm::vec3	position = glm::vec3{ 5.f };
-		glm::vec3	startVelocity = glm::vec3{ 5.f };
-		glm::vec3	startSize = glm::vec3{ 1.f }; //if not 3d, use .x for size
-		glm::quat	startRotation = glm::vec3{ 0.f }; // if not 3d, use .x for rotation
-		glm::vec4	startColor = glm::vec4{ 1.f };
-		glm::vec4	currentColor = glm::vec4{ 1.f };
-	};
-
 	enum class EmitterShape : int
 	{
 		Cone,
@@ -584,19 +651,25 @@ namespace Borealis
 		//Private
 		float		Timer = 0.f;
 		float		Accumulator = 0.f;
-		uint32_t	mParticlesCount = 0;
-		std::vector<Particle> mParticles;
-		uint32_t mDeadParticlesCount = 0;
-		std::vector<Particle*> mDeadParticles;
+		ParticlePool	mParticles;
+		ParticleRandom	mRandom;
 
 		bool isActive = true;
 
 		void Init();
 		void Start();
 		void Stop();
-		void Update(TransformComponent& transfrom, float dt);
-		std::vector<Particle> const& GetParticles();
-		uint32_t GetParticlesCount();
+
+		/*!***********************************************************************
+			\brief
+				Spawns and simulates the particles. Only touches this component,
+				so different systems can update on different threads.
+			\param[in] emitter
+				World transform of the emitter, resolved by the caller
+		*************************************************************************/
+		void Update(ParticleEmitterTransform const& emitter, float dt);
+		ParticlePool const& GetParticles() const;
+		uint32_t GetParticlesCount() const;
 
 		static Ref<Texture2D> GetDefaultParticleTexture();
 		//Add variables for over time
@@ -606,7 +679,7 @@ namespace Borealis
 
 	private:
 		inline static Ref<Texture2D> mDefaultParticle = nullptr;
-		void SpawnParticle(TransformComponent& transfrom, Particle& particle);
+		void SpawnParticle(ParticleEmitterTransform const& emitter, glm::quat const& startRotationA, glm::quat const& startRotationB);
 	};
 
 	struct ButtonComponent
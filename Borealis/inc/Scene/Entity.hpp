@@ -168,18 +168,27 @@ namespace Borealis
 				return mScene->mRegistry.valid(mID);
 		}
 
+		/*!***********************************************************************
+			\brief
+				Checks if the entity and all of its parents are active
+			\return
+				True if the entity is active in the hierarchy, false otherwise
+		*************************************************************************/
 		bool IsActive()
 		{
-			bool activeResult = GetComponent<TagComponent>().active;
-			if (!activeResult)
-			{
-				return false;
-			}
-			else
-			{
-				UUID parentID = GetComponent<TransformComponent>().ParentID;
-				return parentID == 0 ? true : mScene->GetEntityByUUID(parentID).IsActive();
-			}
+			return GetComponent<TagComponent>().mActiveInHierarchy;
+		}
+
+		/*!***********************************************************************
+			\brief
+				Sets the active state of the entity and updates its children
+			\param[in] active
+				The new active state
+		*************************************************************************/
+		void SetActive(bool active)
+		{
+			GetComponent<TagComponent>().active = active;
+			mScene->RefreshActiveInHierarchy(*this);
 		}
 
 		/*!***********************************************************************
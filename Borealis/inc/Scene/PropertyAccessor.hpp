@@ -0,0 +1,138 @@
+/******************************************************************************
+/*!
+\file       PropertyAccessor.hpp
+\author     Chua Zheng Yang
+\par        email: c.zhengyang\@digipen.edu
+\date       October 17, 2026
+\brief      Declares the per component cache of reflected properties and the
+			typed accessors that read and write them without rttr variants
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#ifndef PropertyAccessor_HPP
+#define PropertyAccessor_HPP
+
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <string>
+#include <vector>
+#include <Scene/ReflectionInstance.hpp>
+
+namespace Borealis
+{
+	/*!***********************************************************************
+		\brief
+			Type tag of a reflected property, one per type SerializeProperty
+			writes to YAML. The values are stored in binary scenes, append only
+	*************************************************************************/
+	enum class ScenePropertyKind : uint8_t
+	{
+		Unsupported,
+		Enum,		// name, so reordering an enum does not break old scenes
+		Int,
+		Float,
+		Bool,
+		String,
+		UInt8,
+		Int8,
+		UInt16,
+		Int16,
+		UInt32,
+		Int64,
+		UInt64,
+		UUID,
+		Double,
+		Vec2,
+		Vec3,
+		Vec4,
+		Bitset,
+		UUIDSet,
+		UUIDList,
+		StringSet,
+		Asset,		// handle, 0 when unset
+		Class		// nested properties, each prefixed by whether it is present
+	};
+
+	/*!***********************************************************************
+		\brief
+			One reflected property of a component. Plain data members get the
+			offset of the member, so they are read and written in place;
+			everything else goes through the rttr property
+	*************************************************************************/
+	struct PropertyAccessor
+	{
+		static constexpr uint32_t NoOffset = UINT32_MAX;
+
+		explicit PropertyAccessor(rttr::property const& prop) : property(prop) {}
+
+		rttr::property property;
+		std::string name;
+		ScenePropertyKind kind = ScenePropertyKind::Unsupported;
+		uint32_t offset = NoOffset;
+		uint32_t size = 0;
+
+		bool IsDirect() const { return offset != NoOffset; }
+
+		template<typename T>
+		T const& Get(void const* object) const { return *std::launder(reinterpret_cast<T const*>(static_cast<char const*>(object) + offset)); }
+
+		template<typename T>
+		void Set(void* object, T const& value) const { *std::launder(reinterpret_cast<T*>(static_cast<char*>(object) + offset)) = value; }
+
+		void Copy(void* dst, void const* src) const { std::memcpy(static_cast<char*>(dst) + offset, static_cast<char const*>(src) + offset, size); }
+	};
+
+	/*!***********************************************************************
+		\brief
+			Accessors of every component type, built once per type the first
+			time it is asked for and shared after. Offsets are found by
+			writing two values through the rttr property of a scratch
+			component and checking that exactly the bytes of one member took
+			them, so setters with side effects keep going through rttr.
+	*************************************************************************/
+	class PropertyAccessorCache
+	{
+	public:
+		/*!***********************************************************************
+			\brief
+				Kind of a reflected type, checked in the same order as
+				SerializeProperty
+		*************************************************************************/
+		static ScenePropertyKind GetKind(rttr::type const& type);
+
+		/*!***********************************************************************
+			\brief
+				Accessors of the properties of a component, in the order rttr
+				lists them
+		*************************************************************************/
+		template<typename Component>
+		static std::vector<PropertyAccessor> const& Get()
+		{
+			static std::vector<PropertyAccessor> const accessors = Build(rttr::type::get<Component>(), {
+				sizeof(Component), alignof(Component),
+				[](void* memory) { new (memory) Component(); },
+				[](void* memory) { static_cast<Component*>(memory)->~Component(); },
+				[](void* memory) { return rttr::instance(*static_cast<Component*>(memory)); } });
+			return accessors;
+		}
+
+	private:
+		struct Probe
+		{
+			size_t size;
+			size_t alignment;
+			void (*construct)(void*);
+			void (*destroy)(void*);
+			rttr::instance (*instance)(void*);
+		};
+
+		static std::vector<PropertyAccessor> Build(rttr::type const& type, Probe const& probe);
+	};
+}
+
+#endif
@@ -18,9 +18,12 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include <Core/UUID.hpp>
 #include <Graphics/EditorCamera.hpp>
 #include <Graphics/RenderGraph/RenderGraph.hpp>
+#include <Graphics/BoundingVolumeHierarchy.hpp>
+#include <Physics/PhysicsStepPipeline.hpp>
 namespace Borealis
 {
 	class Entity;
+	struct TransformComponent;
 
 	class Scene
 	{
@@ -29,6 +32,8 @@ namespace Borealis
 		friend class Entity;
 		friend class SceneHierarchyPanel;
 		friend class Serialiser;
+		friend class PhysicsStepPipeline;
+		friend class SceneSnapshot;
 
 		/*!***********************************************************************
 			\brief
@@ -56,6 +61,16 @@ namespace Borealis
 		*************************************************************************/
 		static Ref<Scene> Copy(const Ref<Scene>& other);
 
+		/*!***********************************************************************
+			\brief
+				Replaces every script component with fresh instances of the
+				scripts of another registry holding the same entities, with
+				their serialised fields and references copied over
+			\param[in] source
+				The registry to take the scripts from
+		*************************************************************************/
+		void CloneScriptInstances(entt::registry& source);
+
 		/*!***********************************************************************
 			\brief
 				Runtime update function
@@ -79,6 +94,72 @@ namespace Borealis
 
 		void UpdateRenderer(float dt);
 
+		/*!***********************************************************************
+			\brief
+				Refreshes the cached world matrix of every dirty transform, parents
+				before children
+		*************************************************************************/
+		void UpdateTransformHierarchy();
+
+		/*!***********************************************************************
+			\brief
+				Gets the bounding volume hierarchy of the renderables, up to date
+				as of the last UpdateRenderer or UpdateEditor call
+			\return
+				The render BVH
+		*************************************************************************/
+		RenderBVH& GetRenderBVH() { return mRenderBVH; }
+
+		/*!***********************************************************************
+			\brief
+				Recomputes the active in hierarchy state of an entity and its
+				children, after its active flag or parent has changed
+			\param[in] entity
+				The entity
+		*************************************************************************/
+		void RefreshActiveInHierarchy(Entity entity);
+
+		/*!***********************************************************************
+			\brief
+				Recomputes the active in hierarchy state of every entity, only
+				when it was marked dirty by a bulk change
+		*************************************************************************/
+		void UpdateActiveHierarchy();
+
+		/*!***********************************************************************
+			\brief
+				Requests a full recompute of the active in hierarchy state at
+				the next update, after active flags were written directly, such
+				as when a scene is loaded or restored
+		*************************************************************************/
+		void MarkActiveHierarchyDirty() { mActiveHierarchyDirty = true; }
+
+		/*!***********************************************************************
+			\brief
+				Milliseconds per pass of the active in hierarchy lookups, walking
+				up the parents as IsActive used to against the cached flag
+		*************************************************************************/
+		struct ActiveHierarchyBenchmark
+		{
+			uint32_t entities = 0;
+			double recursiveMilliseconds = 0.0;	// every entity walking up its parents
+			double cachedMilliseconds = 0.0;	// every entity reading its cached flag
+			double refreshMilliseconds = 0.0;	// every root toggled off and on again
+		};
+
+		/*!***********************************************************************
+			\brief
+				Times the active in hierarchy lookups on a scratch scene of
+				chains, so the active scene is left untouched
+			\param entities
+				Number of entities
+			\param depth
+				Number of entities in each chain
+			\param passes
+				Passes timed for each lookup
+		*************************************************************************/
+		static ActiveHierarchyBenchmark BenchmarkActiveHierarchy(uint32_t entities = 10000, uint32_t depth = 8, uint32_t passes = 100);
+
 		/*!***********************************************************************
 			\brief
 				Creates an entity in the scene
@@ -149,6 +230,15 @@ namespace Borealis
 		*************************************************************************/
 		const std::string& GetName() const { return mName; }
 
+		/*!***********************************************************************
+			\brief
+				Getter for the id of this scene object, unique per Scene created
+				even when a reloaded scene reuses the address of a freed one
+			\return
+				The instance id of the scene
+		*************************************************************************/
+		UUID GetInstanceID() const { return mInstanceID; }
+
 		/*!***********************************************************************
 			\brief
 				Getter for the path of the scene
@@ -197,7 +287,7 @@ namespace Borealis
 		Ref<FrameBuffer> GetEditorFB();
 		Ref<PixelBuffer> GetPixelBuffer();
 
-		void SetRenderGraphConfig(RenderGraphConfig renderGraphConfig);
+		void SetRenderGraphConfig(RenderGraphConfig const& renderGraphConfig);
 
 		void AddRenderGraphGlobalSource(Ref<RenderSource> globalSource);
 
@@ -205,11 +295,24 @@ namespace Borealis
 
 		RenderGraph::SceneRenderConfig& GetSceneRenderConfig();
 
+		/*!***********************************************************************
+			\brief
+				Get the render graph rebuild work of the last rendered frame
+		*************************************************************************/
+		RenderGraph::RebuildStats const& GetRenderGraphStats() const;
+
 		void SetRunTimeRenderPass();
 
 		RenderGraphConfig& GetRenderGraphConfig();
 
 		void SetRunTimeViewPort(bool isView);
+
+		/*!***********************************************************************
+			\brief
+				Get the pipeline that runs the fixed physics steps, for its
+				grain size and stage timings
+		*************************************************************************/
+		PhysicsStepPipeline& GetPhysicsStepPipeline();
 	private:
 
 		/*!***********************************************************************
@@ -226,13 +329,51 @@ namespace Borealis
 		entt::registry mRegistry;
 		uint32_t mViewportWidth = 0, mViewportHeight = 0;
 		std::string mName;
+		UUID mInstanceID;
 		std::string mScenePath;
 		std::unordered_map<UUID, entt::entity> mEntityMap;
 
+		struct TransformStackEntry
+		{
+			entt::entity entity;
+			TransformComponent const* parent; // nullptr for roots
+		};
+		std::vector<TransformStackEntry> mTransformStack; // reused by UpdateTransformHierarchy
+		std::vector<std::pair<entt::entity, bool>> mActiveStack; // reused by UpdateActiveHierarchy
+		bool mActiveHierarchyDirty = true;
+
+		PhysicsStepPipeline mPhysicsStep;
+
+		RenderBVH mRenderBVH;
+
+		void SetActiveInHierarchy(entt::entity entity, bool active);
+
+		/*!***********************************************************************
+			\brief
+				Registry hook that records this scene as the owner of every
+				transform constructed in it
+		*************************************************************************/
+		void OnTransformConstructed(entt::registry& registry, entt::entity entity);
+
+		/*!***********************************************************************
+			\brief
+				Delivers the contacts of the last physics step to the scripts of
+				the entities involved, one receiver at a time
+		*************************************************************************/
+		void DispatchContactEvents();
+		void PropagateActiveInHierarchy();
+
 		bool hasRuntimeStarted = false;
 
 		void CreateBuffers();
 
+		/*!***********************************************************************
+			\brief
+				Registers the scene's buffers as render graph sources, done once
+				when the buffers are created
+		*************************************************************************/
+		void RegisterRenderSources();
+
 		//render graph being in scene cause error with imgui when scene is changed, consider moving it out
 		Ref<FrameBuffer> mViewportFrameBuffer;
 		Ref<FrameBuffer> mRuntimeFrameBuffer;
@@ -244,6 +385,8 @@ namespace Borealis
 		Ref<FrameBuffer> mCompositeFBO;
 		RenderGraph mRenderGraph;
 		RenderGraphConfig mRenderConfig;
+		Ref<RenderTargetSource> mRunTimeBufferSource;
+		Ref<CameraSource> mRunTimeCameraSource; //only registered while the scene has a primary camera
 		bool mIsRunTimeViewPort = true;
 	};
 }
@@ -0,0 +1,180 @@
+/******************************************************************************
+/*!
+\file       SceneBinary.hpp
+\author     Chua Zheng Yang
+\par        email: c.zhengyang\@digipen.edu
+\date       October 17, 2026
+\brief      Declares the binary scene format written at export time and the
+			reader the runtime loads it through
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#ifndef SceneBinary_HPP
+#define SceneBinary_HPP
+
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <Scene/PropertyAccessor.hpp>
+
+namespace YAML
+{
+	class Node;
+}
+
+namespace Borealis
+{
+	/*!***********************************************************************
+		\brief
+			Layout: header, string table, entity ids, asset handles, component
+			tables, then the script blocks. Every name and string value is an
+			index into the string table. Entities are referred to by their
+			index in the entity id array, which the loader maps onto one range
+			of registry entities.
+	*************************************************************************/
+	struct SceneBinaryHeader
+	{
+		static constexpr uint32_t Magic = 0x4E435342; // "BSCN"
+		static constexpr uint32_t Version = 1;
+
+		uint32_t magic = Magic;
+		uint32_t version = Version;
+		uint32_t sceneName = 0;
+		uint32_t stringCount = 0;
+		uint32_t entityCount = 0;
+		uint32_t assetCount = 0;
+		uint32_t tableCount = 0;
+		uint32_t scriptCount = 0;
+
+		uint32_t hasRenderSettings = 0;
+		uint32_t bloom = 0;
+		float bloomThreshold = 0.f;
+		float bloomScale = 0.f;
+		float bloomKnee = 0.f;
+		float exposure = 0.f;
+	};
+
+	struct ScenePropertySchema
+	{
+		uint32_t name = 0;
+		ScenePropertyKind kind = ScenePropertyKind::Unsupported;
+		std::vector<ScenePropertySchema> nested;
+	};
+
+	/*!***********************************************************************
+		\brief
+			All components of one type. Columns hold one property each, a
+			presence bit per row followed by the values of the rows that have
+			it
+	*************************************************************************/
+	struct SceneComponentTable
+	{
+		std::string_view name;
+		std::vector<uint32_t> entities;
+		std::vector<ScenePropertySchema> schema;
+		std::string_view columns;
+	};
+
+	struct SceneBinaryScript
+	{
+		uint32_t entity;
+		std::string_view source;	// YAML of the ScriptComponent, fields are resolved through mono
+	};
+
+	class SceneBinary
+	{
+	public:
+		/*!***********************************************************************
+			\brief
+				Whether the bytes start with a binary scene header
+		*************************************************************************/
+		static bool IsBinary(std::string_view data);
+
+		/*!***********************************************************************
+			\brief
+				Converts a scene in its YAML form into the binary form
+			\param[in] scene
+				Root of the YAML scene
+			\param[in] assetHandles
+				Assets the scene references, prefetched before it is built
+			\param[out] out
+				The binary scene
+			\return
+				False when the YAML does not describe a scene
+		*************************************************************************/
+		static bool Write(YAML::Node const& scene, std::vector<uint64_t> const& assetHandles, std::string& out);
+	};
+
+	/*!***********************************************************************
+		\brief
+			Reads a binary scene in place. The data must outlive the reader
+	*************************************************************************/
+	class SceneBinaryReader
+	{
+	public:
+		explicit SceneBinaryReader(std::string_view data) : mData(data) {}
+
+		/*!***********************************************************************
+			\brief
+				Reads and validates everything but the column values
+			\return
+				False when the data is not a binary scene of this version or
+				is truncated
+		*************************************************************************/
+		bool Open();
+
+		SceneBinaryHeader const& GetHeader() const { return mHeader; }
+		std::string_view GetSceneName() const { return mStrings[mHeader.sceneName]; }
+		uint32_t GetEntityCount() const { return mHeader.entityCount; }
+		uint64_t GetEntityID(uint32_t index) const { return mEntityIDs[index]; }
+		std::vector<uint64_t> const& GetAssetHandles() const { return mAssetHandles; }
+		std::vector<SceneComponentTable> const& GetTables() const { return mTables; }
+		std::vector<SceneBinaryScript> const& GetScripts() const { return mScripts; }
+
+		/*!***********************************************************************
+			\brief
+				Table of a component type by its reflected name, null when no
+				entity in the scene has one
+		*************************************************************************/
+		SceneComponentTable const* FindTable(std::string_view name) const;
+
+		/*!***********************************************************************
+			\brief
+				Sets the properties of a table onto its components. Properties
+				with a direct accessor are written in place, the rest through
+				rttr. Properties that no longer exist or changed type are
+				skipped
+			\param[in] table
+				Table to read
+			\param[in] type
+				Reflected type of the components
+			\param[in] accessors
+				Accessors of the component type
+			\param[in] instances
+				Component of every row of the table
+			\param[in] objects
+				The same components as raw pointers, for the direct accessors
+			\return
+				False when the columns are truncated
+		*************************************************************************/
+		bool ReadColumns(SceneComponentTable const& table, rttr::type const& type, std::vector<PropertyAccessor> const& accessors,
+			std::span<ReflectionInstance> instances, std::span<void* const> objects) const;
+
+	private:
+		std::string_view mData;
+		SceneBinaryHeader mHeader;
+		std::vector<std::string_view> mStrings;
+		std::vector<uint64_t> mEntityIDs;
+		std::vector<uint64_t> mAssetHandles;
+		std::vector<SceneComponentTable> mTables;
+		std::vector<SceneBinaryScript> mScripts;
+	};
+}
+
+#endif
@@ -0,0 +1,161 @@
+/******************************************************************************
+/*!
+\file       SceneSnapshot.hpp
+\author     Chua Zheng Yang
+\par        email: c.zhengyang\@digipen.edu
+\date       October 17, 2026
+\brief      Declares the snapshot of a scene's registry that play mode is
+			entered from and restored to
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#ifndef SceneSnapshot_HPP
+#define SceneSnapshot_HPP
+
+#include <entt.hpp>
+#include <Core/UUID.hpp>
+#include <Graphics/RenderGraph/RenderGraph.hpp>
+
+namespace Borealis
+{
+	class Scene;
+
+	/*!***********************************************************************
+		\brief
+			What changed in a scene since its snapshot was taken
+	*************************************************************************/
+	struct SceneSnapshotDiff
+	{
+		std::vector<UUID> created;		// entities that are not in the snapshot
+		std::vector<UUID> destroyed;	// entities of the snapshot that are gone
+		std::vector<UUID> moved;		// entities whose local transform changed
+		uint32_t addedComponents = 0;
+		uint32_t removedComponents = 0;
+
+		bool Empty() const { return created.empty() && destroyed.empty() && moved.empty() && !addedComponents && !removedComponents; }
+	};
+
+	/*!***********************************************************************
+		\brief
+			Copy of every registered component storage of a scene, kept
+			packed in a registry of its own under the same entity identifiers.
+			Capturing and restoring copy whole storages at a time, so neither
+			goes through the add hooks or the UUID map entity by entity. The
+			engine components are registered already, modules with components
+			of their own, such as the editor, register them before capturing.
+	*************************************************************************/
+	class SceneSnapshot
+	{
+	public:
+		/*!***********************************************************************
+			\brief
+				Adds a component type to the storages captured and restored.
+				Registering a type twice has no effect
+		*************************************************************************/
+		template<typename Component>
+		static void RegisterComponent()
+		{
+			GetComponentTypes().try_emplace(entt::type_hash<Component>::value(), MakeComponentType<Component>());
+		}
+
+		/*!***********************************************************************
+			\brief
+				Replaces the snapshot with the current state of the scene.
+				Warns about storages of types that are not registered
+		*************************************************************************/
+		void Capture(Scene& scene);
+
+		/*!***********************************************************************
+			\brief
+				Puts the scene back the way it was captured. Entities created
+				since are destroyed, destroyed ones come back under their old
+				identifiers, so handles taken before the capture stay valid
+		*************************************************************************/
+		void Restore(Scene& scene);
+
+		/*!***********************************************************************
+			\brief
+				Compares the scene against the snapshot
+		*************************************************************************/
+		SceneSnapshotDiff Diff(Scene& scene);
+
+		/*!***********************************************************************
+			\brief
+				Frees the snapshot
+		*************************************************************************/
+		void Clear();
+
+		bool IsValid() const { return mValid; }
+		entt::registry& GetRegistry() { return mRegistry; }
+
+	private:
+		struct ComponentType
+		{
+			void (*copy)(entt::registry& dst, entt::registry& src);
+			void (*diff)(entt::registry& current, entt::registry& captured, SceneSnapshotDiff& diff);
+		};
+
+		/*!***********************************************************************
+			\brief
+				Replaces a storage of one registry with a copy of the same
+				storage of another. Every entity of the source must be valid in
+				the destination
+		*************************************************************************/
+		template<typename Component>
+		static void CopyStorage(entt::registry& dst, entt::registry& src)
+		{
+			auto& source = src.storage<Component>();
+			auto& target = dst.storage<Component>();
+			target.clear();
+			if (source.empty()) return;
+
+			target.reserve(source.size());
+			// Entities of the sparse set and components of the storage iterate in the same order
+			entt::sparse_set const& entities = source;
+			if constexpr (std::is_empty_v<Component>)
+				dst.insert<Component>(entities.begin(), entities.end());
+			else
+				dst.insert<Component>(entities.begin(), entities.end(), source.begin());
+		}
+
+		/*!***********************************************************************
+			\brief
+				Counts the components added to and removed from entities that
+				exist both in the scene and in the snapshot
+		*************************************************************************/
+		template<typename Component>
+		static void DiffStorage(entt::registry& current, entt::registry& captured, SceneSnapshotDiff& diff)
+		{
+			entt::sparse_set const& now = current.storage<Component>();
+			entt::sparse_set const& then = captured.storage<Component>();
+
+			// Components of created or destroyed entities are counted with the entity
+			for (entt::entity entity : now)
+				if (captured.valid(entity) && !then.contains(entity)) ++diff.addedComponents;
+			for (entt::entity entity : then)
+				if (current.valid(entity) && !now.contains(entity)) ++diff.removedComponents;
+		}
+
+		template<typename Component>
+		static ComponentType MakeComponentType() { return { &CopyStorage<Component>, &DiffStorage<Component> }; }
+
+		template<typename... Components>
+		static std::unordered_map<entt::id_type, ComponentType> MakeComponentTypes();
+
+		static std::unordered_map<entt::id_type, ComponentType>& GetComponentTypes();
+
+		entt::registry mRegistry;
+		std::unordered_map<UUID, entt::entity> mEntityMap;
+		std::string mName;
+		std::string mScenePath;
+		uint32_t mViewportWidth = 0, mViewportHeight = 0;
+		RenderGraph::SceneRenderConfig mRenderConfig;
+		bool mValid = false;
+	};
+}
+
+#endif
@@ -30,6 +30,21 @@ namespace Borealis
 {
 	class BehaviourNode;
 	class BehaviourTree;
+	class SceneBinaryReader;
+
+	/*!***********************************************************************
+		\brief
+			Properties per second through rttr and through the accessor cache
+	*************************************************************************/
+	struct PropertyBenchmark
+	{
+		uint64_t properties = 0;			// read or written per pass
+		double reflectedAccess = 0.0;
+		double cachedAccess = 0.0;
+		double reflectedSerialise = 0.0;
+		double cachedSerialise = 0.0;
+	};
+
 	class Serialiser
 	{
 	public:
@@ -65,6 +80,33 @@ namespace Borealis
 		*************************************************************************/
 		bool DeserialiseScene(const std::string& filepath, bool encrypt = false);
 
+		/*!***********************************************************************
+			\brief
+				Converts a YAML scene into the binary scene format loaded by
+				builds. The YAML file stays the source the editor works on
+			\param[in] filepath
+				The path to the YAML scene
+			\param[out] out
+				The binary scene
+			\return
+				True if the conversion was successful, false otherwise
+		*************************************************************************/
+		static bool BuildSceneBinary(const std::string& filepath, std::string& out);
+
+		/*!***********************************************************************
+			\brief
+				Times reading and serialising every reflected property of the
+				components of a scene, once through rttr and once through the
+				property accessor cache
+			\param[in] scene
+				The scene to read
+			\param[in] passes
+				How many times each path goes over the scene
+			\return
+				The rates of both paths
+		*************************************************************************/
+		static PropertyBenchmark BenchmarkProperties(Scene& scene, uint32_t passes);
+
 		virtual void SerialiseAbstractItems(YAML::Emitter& out, Entity& entity) {};
 		virtual void DeserialiseAbstractItems(YAML::detail::iterator_value& data, Entity& entity) {};
 
@@ -96,6 +138,27 @@ namespace Borealis
 		void SerializeEntity(YAML::Emitter& out, Entity& entity);
 		void SerializeEntityScript(YAML::Emitter& out, Entity& entity);
 
+		/*!***********************************************************************
+			\brief
+				Loads a scene written by BuildSceneBinary
+			\param[in] data
+				Decrypted contents of the scene file
+			\return
+				True if the deserialisation was successful, false otherwise
+		*************************************************************************/
+		bool DeserialiseSceneBinary(std::string_view data);
+
+		/*!***********************************************************************
+			\brief
+				Creates the components of every row of a binary component table
+				in one bulk insert, then reads their properties column by column
+		*************************************************************************/
+		template<typename Component>
+		void DeserialiseComponentTable(SceneBinaryReader const& reader, std::vector<entt::entity> const& entities);
+
+		void DeserialiseScriptComponent(YAML::Node const& scriptComponent, Entity& entity);
+		void ResolveScriptReferences();
+		void RemoveInvalidChildren();
 
 		Ref<Scene> mScene;
 
@@ -19,6 +19,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include <yaml-cpp/yaml.h>
 #include <Assets/AssetManager.hpp>
 #include <Scene/ReflectionInstance.hpp>
+#include <Scene/PropertyAccessor.hpp>
 #include <Scene/Components.hpp>
 #include <Scripting/ScriptInstance.hpp>
 #include <Scripting/ScriptField.hpp>
@@ -371,15 +372,56 @@ namespace Borealis
 
 
 
+	/*!***********************************************************************
+		\brief
+			Writes a property that has an offset, the same way SerializeProperty
+			writes its kind
+		\param[in] out
+			The emitter
+		\param[in] accessor
+			The property
+		\param[in] object
+			The component holding it
+	*************************************************************************/
+	static void SerializeDirectProperty(YAML::Emitter& out, PropertyAccessor const& accessor, const void* object)
+	{
+		out << YAML::Key << accessor.name << YAML::Value;
+		switch (accessor.kind)
+		{
+		case ScenePropertyKind::Int:	out << accessor.Get<int>(object); break;
+		case ScenePropertyKind::Float:	out << accessor.Get<float>(object); break;
+		case ScenePropertyKind::Bool:	out << accessor.Get<bool>(object); break;
+		case ScenePropertyKind::UInt8:	out << (unsigned)accessor.Get<unsigned char>(object); break;
+		case ScenePropertyKind::Int8:	out << (int)accessor.Get<char>(object); break;
+		case ScenePropertyKind::UInt16:	out << (unsigned)accessor.Get<unsigned short>(object); break;
+		case ScenePropertyKind::Int16:	out << (int)accessor.Get<short>(object); break;
+		case ScenePropertyKind::UInt32:	out << accessor.Get<unsigned>(object); break;
+		case ScenePropertyKind::Int64:	out << accessor.Get<long long>(object); break;
+		case ScenePropertyKind::UInt64:	out << accessor.Get<unsigned long long>(object); break;
+		case ScenePropertyKind::UUID:	out << (uint64_t)accessor.Get<UUID>(object); break;
+		case ScenePropertyKind::Double:	out << accessor.Get<double>(object); break;
+		case ScenePropertyKind::Vec2:	out << accessor.Get<glm::vec2>(object); break;
+		case ScenePropertyKind::Vec3:	out << accessor.Get<glm::vec3>(object); break;
+		case ScenePropertyKind::Vec4:	out << accessor.Get<glm::vec4>(object); break;
+		case ScenePropertyKind::Bitset:	out << accessor.Get<Bitset32>(object).to_ulong(); break;
+		default:						out << YAML::Null; break;
+		}
+	}
+
 	template <typename Component>
 	static void SerializeComponent(YAML::Emitter& out, Component& component)
 	{
 		ReflectionInstance rInstance(component);
 		out << YAML::Key << rInstance.get_type().get_name().to_string();
 		out << YAML::BeginMap;
-		auto properties = rInstance.get_type().get_properties();
-		for (auto prop : properties)
+		for (PropertyAccessor const& accessor : PropertyAccessorCache::Get<Component>())
 		{
+			if (accessor.IsDirect())
+			{
+				SerializeDirectProperty(out, accessor, &component);
+				continue;
+			}
+			rttr::property prop = accessor.property;
 			SerializeProperty(out, prop, rInstance);
 		}
 		out << YAML::EndMap;
@@ -616,6 +658,41 @@ namespace Borealis
 		return false;
 	}
 
+	/*!***********************************************************************
+		\brief
+			Reads a property that has an offset, the same way
+			DeserialiseProperty reads its kind
+		\param[in] propData
+			The value of the property
+		\param[in] accessor
+			The property
+		\param[in] object
+			The component holding it
+	*************************************************************************/
+	static void DeserialiseDirectProperty(YAML::Node const& propData, PropertyAccessor const& accessor, void* object)
+	{
+		switch (accessor.kind)
+		{
+		case ScenePropertyKind::Int:	accessor.Set(object, propData.as<int>()); break;
+		case ScenePropertyKind::Float:	accessor.Set(object, propData.as<float>()); break;
+		case ScenePropertyKind::Bool:	accessor.Set(object, propData.as<bool>()); break;
+		case ScenePropertyKind::UInt8:	accessor.Set(object, propData.as<unsigned char>()); break;
+		case ScenePropertyKind::Int8:	accessor.Set(object, propData.as<char>()); break;
+		case ScenePropertyKind::UInt16:	accessor.Set(object, propData.as<unsigned short>()); break;
+		case ScenePropertyKind::Int16:	accessor.Set(object, propData.as<short>()); break;
+		case ScenePropertyKind::UInt32:	accessor.Set(object, propData.as<unsigned>()); break;
+		case ScenePropertyKind::Int64:	accessor.Set(object, propData.as<long long>()); break;
+		case ScenePropertyKind::UInt64:	accessor.Set(object, propData.as<unsigned long long>()); break;
+		case ScenePropertyKind::UUID:	accessor.Set(object, UUID(propData.as<uint64_t>())); break;
+		case ScenePropertyKind::Double:	accessor.Set(object, propData.as<double>()); break;
+		case ScenePropertyKind::Vec2:	accessor.Set(object, propData.as<glm::vec2>()); break;
+		case ScenePropertyKind::Vec3:	accessor.Set(object, propData.as<glm::vec3>()); break;
+		case ScenePropertyKind::Vec4:	accessor.Set(object, propData.as<glm::vec4>()); break;
+		case ScenePropertyKind::Bitset:	accessor.Set(object, Bitset32(propData.as<uint32_t>())); break;
+		default:						break;
+		}
+	}
+
 	template <typename Component>
 	static bool DeserialiseComponent(YAML::detail::iterator_value& data, Entity& entity)
 	{
@@ -632,9 +709,18 @@ namespace Borealis
 			auto& component = entity.GetComponent<Component>();
 			ReflectionInstance rInstance(component);
 
-			auto properties = rInstance.get_type().get_properties();
-			for (auto prop : properties)
+			for (PropertyAccessor const& accessor : PropertyAccessorCache::Get<Component>())
 			{
+				if (accessor.IsDirect())
+				{
+					YAML::Node propData = componentData[accessor.name];
+					if (propData && propData.IsDefined() && !(propData.IsMap() && propData.size() == 0))
+					{
+						DeserialiseDirectProperty(propData, accessor, &component);
+					}
+					continue;
+				}
+				rttr::property prop = accessor.property;
 				DeserialiseProperty(componentData, prop, rInstance);
 			}
 		}
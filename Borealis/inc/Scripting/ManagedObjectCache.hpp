@@ -0,0 +1,93 @@
+/******************************************************************************
+/*!
+\file       ManagedObjectCache.hpp
+\author     Chua Zheng Yang
+\par        email: c.zhengyang\@digipen.edu
+\date       October 17, 2026
+\brief      Declares the cache of managed entity wrappers handed to scripts
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#ifndef ManagedObjectCache_HPP
+#define ManagedObjectCache_HPP
+
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include <Core/UUID.hpp>
+
+extern "C" {
+	typedef struct _MonoObject MonoObject;
+	typedef struct _MonoArray MonoArray;
+}
+
+namespace Borealis
+{
+	/*!***********************************************************************
+		\brief
+			Managed wrappers of entities, such as the GameObject and Collider
+			objects passed to scripts, kept alive by a GC handle so every call
+			hands out the same object instead of allocating a new one. Query
+			results are written into arrays owned by the script, so a query
+			allocates nothing once its wrappers exist. Main thread only.
+	*************************************************************************/
+	class ManagedObjectCache
+	{
+	public:
+		/*!***********************************************************************
+			\brief
+				Gets the wrapper of an entity, creating it on first use
+			\param[in] id
+				The entity
+			\param[in] className
+				Managed class of the wrapper, constructed from the id
+			\return
+				The wrapper
+		*************************************************************************/
+		static MonoObject* GetWrapper(UUID id, std::string_view className);
+
+		/*!***********************************************************************
+			\brief
+				Writes the wrappers of some entities into an object array owned
+				by the caller, as many as fit
+			\param[in] destination
+				The array to fill, may be null to only count the entities
+			\param[in] ids
+				The entities, in order
+			\param[in] className
+				Managed class of the wrappers
+			\return
+				The number of entities, which may be more than were written
+		*************************************************************************/
+		static uint32_t FillWrapperArray(MonoArray* destination, std::vector<UUID> const& ids, std::string_view className);
+
+		/*!***********************************************************************
+			\brief
+				Drops the wrappers of a destroyed entity
+		*************************************************************************/
+		static void Remove(UUID id);
+
+		/*!***********************************************************************
+			\brief
+				Drops every wrapper. Must be called before the app
+				domain they live in is unloaded
+		*************************************************************************/
+		static void Clear();
+
+	private:
+		struct CachedObject
+		{
+			std::string className;
+			uint32_t handle;
+		};
+
+		static std::unordered_map<UUID, std::vector<CachedObject>> mObjects;
+	};
+}
+
+#endif
@@ -16,6 +16,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 
 #ifndef SCRIPT_CLASS_HPP
 #define SCRIPT_CLASS_HPP
+#include <array>
 #include <string>
 #include <Scripting/ScriptField.hpp>
 
@@ -30,6 +31,50 @@ extern "C" {
 
 namespace Borealis
 {
+	/*!***********************************************************************
+		\brief
+			MonoBehaviour lifecycle methods the engine calls, the collision
+			and trigger ones take the other collider
+	*************************************************************************/
+	enum class ScriptMethod : uint8_t
+	{
+		Awake,
+		Start,
+		Update,
+		LateUpdate,
+		FixedUpdate,
+		OnEnable,
+		OnDisable,
+		OnDestroy,
+		OnApplicationQuit,
+		OnApplicationPause,
+		OnApplicationFocus,
+		OnGUI,
+		OnDrawGizmos,
+		OnDrawGizmosSelected,
+		OnValidate,
+		Reset,
+		OnBecameVisible,
+		OnBecameInvisible,
+		OnPreCull,
+		OnPreRender,
+		OnPostRender,
+		OnRenderObject,
+		OnWillRenderObject,
+		OnRenderImage,
+		OnAudioFilterRead,
+		OnParticleCollision,
+		OnJointBreak,
+		OnAnimatorMove,
+		OnAnimatorIK,
+		OnCollisionEnter,
+		OnCollisionExit,
+		OnCollisionStay,
+		OnTriggerEnter,
+		OnTriggerExit,
+		OnTriggerStay,
+		Count
+	};
 
 	class ScriptClass
 	{
@@ -88,6 +133,25 @@ namespace Borealis
 		*************************************************************************/
 		MonoObject* InvokeMethod(MonoObject* instance, MonoMethod* method, void** params);
 
+		/*!***********************************************************************
+			\brief
+				Looks up the lifecycle methods the class declares and gets an
+				unmanaged thunk for each, so calling them skips the name lookup
+				and mono_runtime_invoke. Must be redone whenever the class is
+				reloaded
+		*************************************************************************/
+		void ResolveMethods();
+
+		/*!***********************************************************************
+			\brief
+				Get the thunk of a lifecycle method
+			\param[in] method
+				The method
+			\return
+				The thunk, null when the class does not declare the method
+		*************************************************************************/
+		void* GetMethodThunk(ScriptMethod method) const { return mMethodThunks[static_cast<size_t>(method)]; }
+
 		/*!***********************************************************************
 			\brief
 				Get the class
@@ -117,6 +181,7 @@ namespace Borealis
 		std::string mClassName; // Name of the class
 		std::string mNamespaceName; // Namespace of the class
 		MonoClass* mMonoClass; // The class
+		std::array<void*, static_cast<size_t>(ScriptMethod::Count)> mMethodThunks{}; // Lifecycle thunks, null if not declared
 	};
 }
 #endif
\ No newline at end of file
@@ -191,6 +191,13 @@ namespace Borealis
 
 		bool IsActive();
 
+		/*!***********************************************************************
+			\brief
+				Whether the script class defines a lifecycle method, checked
+				before IsActive so scripts without it skip the field read
+		*************************************************************************/
+		bool HasMethod(ScriptMethod method) const { return mScriptClass->GetMethodThunk(method) != nullptr; }
+
 	private:
 
 		/*!***********************************************************************
@@ -120,8 +120,8 @@ namespace Borealis
 
 	void Entity_FindEntity(MonoString* name, UUID* ID);
 
-	void Entity_GetEntitiesFromLayer(int32_t layerNum, MonoArray** objectArray);
-	void Entity_GetEntitiesFromTag(MonoString* layerNum, MonoArray** objectArray);
+	int Entity_GetEntitiesFromLayer(int32_t layerNum, MonoArray* objectArray);
+	int Entity_GetEntitiesFromTag(MonoString* layerNum, MonoArray* objectArray);
 	float Time_GetDeltaTime();
 	float Time_GetUnscaledDeltaTime();
 	void Time_SetTimeScale(float scale);
@@ -435,6 +435,22 @@ namespace Borealis
 	void Physics_RaycastAll(glm::vec3 origin, glm::vec3 direction, float maxDistance, int layerMask,
 			MonoArray** entityIDArray, MonoArray** distanceArray, MonoArray** normalArray, MonoArray** pointArray);
 
+	/*!***********************************************************************
+		\brief
+			Runs a batch of ray and shape casts, writing the closest hit of
+			each query into the caller's arrays. A miss has an entity ID of 0.
+		\return
+			Number of queries that hit something
+	*************************************************************************/
+	int Physics_CastBatch(MonoArray* queries, int count, MonoArray* entityIDs, MonoArray* distances, MonoArray* normals, MonoArray* points);
+
+	/*!***********************************************************************
+		\brief
+			Runs a batch of overlap tests. Query i writes its entities from
+			entityIDs[i * maxHitsPerQuery] and its count into hitCounts[i].
+	*************************************************************************/
+	void Physics_OverlapBatch(MonoArray* queries, int count, MonoArray* entityIDs, int maxHitsPerQuery, MonoArray* hitCounts);
+
 	void CharacterController_Move(uint64_t id, glm::vec3* motion);
 	void CharacterController_Jump(uint64_t id, float jumpSpeed);
 
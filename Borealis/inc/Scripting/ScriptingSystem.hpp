@@ -94,6 +94,28 @@ namespace Borealis
 
 		static void ReloadAllEntities();
 
+		/*!***********************************************************************
+			\brief
+				Whether the build counts managed allocations. Mono's allocation
+				events slow down every allocation, so the profiler is only
+				installed when BOREALIS_MANAGED_ALLOCATION_PROFILER is defined
+		*************************************************************************/
+		static bool IsManagedAllocationProfilerEnabled();
+
+		/*!***********************************************************************
+			\brief
+				Number of managed objects allocated since Mono was initialised,
+				always 0 when the allocation profiler is not installed
+		*************************************************************************/
+		static uint64_t GetManagedAllocationCount();
+
+		/*!***********************************************************************
+			\brief
+				Number of young generation collections Mono has run, the ones
+				short lived allocations cause
+		*************************************************************************/
+		static int GetGarbageCollectionCount();
+
 	private:
 
 		/*!***********************************************************************
@@ -0,0 +1,28 @@
+project "LZ4"
+	kind "StaticLib"
+	language "C"
+	staticruntime "on"
+
+	targetdir ("build/" .. outputdir .. "/%{prj.name}")
+	objdir ("build-int/" .. outputdir .. "/%{prj.name}")
+
+	files
+	{
+		"lz4.h",
+		"lz4.c",
+		"lz4hc.h",
+		"lz4hc.c"
+	}
+
+	filter "system:windows"
+		systemversion "latest"
+
+
+	filter "configurations:Debug"
+		symbols "On"
+		runtime "Debug"
+
+	filter "configurations:Release"
+		optimize "On"
+		runtime "Release"
+
@@ -56,28 +56,12 @@ namespace Borealis
 
         // Load and parse the YAML file
         YAML::Node data;
-        if (AssetManager::IsPakLoaded())
+        PakAsset pakAsset = AssetManager::ReadFromPak(std::filesystem::path(filepath));
+        MemoryStreamBuffer pakBuffer(pakAsset.View());
+        if (!pakBuffer.empty())
         {
-            try
-            {
-                char* buffer;
-                uint64_t size;
-                std::string subPath = filepath.substr(filepath.find_last_of("/\\") + 1);
-                AssetManager::RetrieveFromPak(std::stoull(subPath), buffer, size);
-                std::string yamlContent(buffer, size);
-                data = YAML::Load(yamlContent);
-                delete[] buffer;
-            }
-            catch (...)
-            {
-                try {
-                    data = YAML::LoadFile(filepath);
-                }
-                catch (const YAML::Exception& e) {
-                    BOREALIS_CORE_ERROR("Failed to load behaviour tree from {}: {}", filepath, e.what());
-                    return treeData;
-                }
-			}
+            std::istream pakStream(&pakBuffer);
+            data = YAML::Load(pakStream);
         }
         else
         {
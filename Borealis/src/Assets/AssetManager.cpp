@@ -21,121 +21,137 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include <Graphics/Material.hpp>
 #include <Graphics/Animation/Animation.hpp>
 #include <Scripting/ScriptingSystem.hpp>
-#include <map>
+#include <charconv>
+#include <chrono>
 namespace Borealis
 {
-	struct AssetEntry
+	namespace
 	{
-		uint64_t id;
-		uint64_t offset;
-		uint64_t size;
-	};
+		using PakClock = std::chrono::high_resolution_clock;
 
-	struct AssetEntryValue
-	{
-		uint64_t offset;
-		uint64_t size;
-	};
+		// Mesh and animation data is large and compressible, textures are already compressed for the GPU
+		PakCompression CompressionForType(AssetType type)
+		{
+			switch (type)
+			{
+			case AssetType::Mesh:
+			case AssetType::Animation:
+				return PakCompression::LZ4HC;
+			case AssetType::Texture2D:
+				return PakCompression::None;
+			default:
+				return PakCompression::LZ4;
+			}
+		}
+
+		// Assets in the pak and in the cache are named by their id
+		bool IdFromFileName(std::filesystem::path const& path, uint64_t& id)
+		{
+			std::string name = path.filename().string();
+			auto [end, error] = std::from_chars(name.data(), name.data() + name.size(), id);
+			return error == std::errc();
+		}
 
-	void AssetManager::BuildPak(std::filesystem::path folderPath, std::filesystem::path location)
+		// Opens a pak and reads every entry, as a runtime level load would
+		float MeasurePakLoad(std::filesystem::path const& path)
+		{
+			auto start = PakClock::now();
+			PakFile pak;
+			if (!pak.Open(path)) return -1.f;
+
+			uint64_t touched = 0;
+			for (PakEntry const& entry : pak.GetEntries())
+			{
+				PakAsset asset = pak.Read(entry.id);
+				for (size_t i = 0; i < asset.View().size(); i += PakFile::PageSize)
+				{
+					touched += static_cast<unsigned char>(asset.View()[i]);
+				}
+			}
+			(void)touched;
+			return std::chrono::duration<float, std::milli>(PakClock::now() - start).count();
+		}
+	}
+
+	PakBuildReport AssetManager::BuildPak(std::filesystem::path folderPath, std::filesystem::path location, PakBuildOptions const& options)
 	{
-		std::vector<AssetEntry> entries;
-		uint64_t offset = 0;
-		std::ofstream out(location, std::ios::binary);
+		PakBuildReport report;
+		AssetRegistry& registry = Project::GetEditorAssetsManager()->GetAssetRegistry();
 
+		std::vector<PakSource> sources;
 		for (const auto& entry : std::filesystem::directory_iterator(folderPath)) {
 			if (!entry.is_regular_file()) continue;
 
-			try {
-				// Assume the filename is a valid hexadecimal string representing the ID
-				uint64_t hashId = std::stoull(entry.path().filename().string());
+			uint64_t id = 0;
+			if (!IdFromFileName(entry.path(), id)) continue; // Skip if filename isn't an id
 
-				std::ifstream in(entry.path(), std::ios::binary | std::ios::ate);
-				if (!in) continue;
+			auto it = registry.find(AssetHandle(id));
+			AssetType type = it != registry.end() ? it->second.Type : AssetType::None;
+			sources.push_back({ id, entry.path(), CompressionForType(type) });
+		}
 
-				uint64_t size = static_cast<uint64_t>(in.tellg());
-				in.seekg(0);
-				std::vector<char> buffer(size);
-				in.read(buffer.data(), size);
-				out.write(buffer.data(), size);
+		auto start = PakClock::now();
+		if (!PakFile::Write(location, sources, options.version, &report.stats))
+		{
+			BOREALIS_CORE_ERROR("Failed to write pak {}", location.string());
+			return report;
+		}
+		report.buildMs = std::chrono::duration<float, std::milli>(PakClock::now() - start).count();
+		BOREALIS_CORE_INFO("Pak v{}: {} entries, {} of {} bytes, {} compressed, built in {} ms", options.version, report.stats.entries,
+			report.stats.fileBytes, report.stats.rawBytes, report.stats.compressedEntries, report.buildMs);
 
-				entries.push_back({ hashId, offset, size });
-				offset += size;
-			}
-			catch (...) {
-				continue; // Skip if filename isn't a valid hex string
+		if (options.compareWithV1 && options.version != 1)
+		{
+			std::filesystem::path legacyLocation = location;
+			legacyLocation += ".v1";
+			PakWriteStats legacyStats;
+			if (PakFile::Write(legacyLocation, sources, 1, &legacyStats))
+			{
+				report.v1Bytes = legacyStats.fileBytes;
+				report.v1LoadMs = MeasurePakLoad(legacyLocation);
+				report.loadMs = MeasurePakLoad(location);
+				BOREALIS_CORE_INFO("Pak v1: {} bytes, loaded in {} ms. Pak v{}: {} bytes, loaded in {} ms", report.v1Bytes, report.v1LoadMs,
+					options.version, report.stats.fileBytes, report.loadMs);
 			}
+			std::error_code error;
+			std::filesystem::remove(legacyLocation, error);
 		}
 
-		uint64_t count = entries.size();
-		out.write(reinterpret_cast<char*>(entries.data()), sizeof(AssetEntry) * entries.size());
-		out.write(reinterpret_cast<char*>(&count), sizeof(count));
-		out.close();
+		return report;
 	}
-	std::map<uint64_t, AssetEntryValue> entryMap;
-
-	static std::ifstream pakStream;
 
 	void AssetManager::ReadPak(std::filesystem::path folderPath)
 	{
-		pakStream.open(folderPath, std::ios::binary);
-		if (!pakStream) return;
-
-		// Seek to the end of the file to determine the total size
-		pakStream.seekg(0, std::ios::end);
-		uint64_t fileSize = pakStream.tellg();
-
-		// Ensure the file has at least the size for a count and entries
-		if (fileSize < sizeof(uint64_t)) return;
-
-		// Read count first (4 bytes) from the end of the file
-		pakStream.seekg(-static_cast<std::streamoff>(sizeof(uint64_t)), std::ios::end);
-		uint64_t count = 0;
-		pakStream.read(reinterpret_cast<char*>(&count), sizeof(count));
-
-		//in.seekg(-32, std::ios::end);  // 4 * sizeof(uint32_t) = 16 bytes
-
-		// Read the last 4 integers (uint32_t values)
-		//uint6_t values[8] = { 0 };  // Array to hold the 4 integers
-		//in.read(reinterpret_cast<char*>(values), sizeof(values));
-
-
-		if (!pakStream) return;
-
-		// Ensure there is enough room in the file for the entries (count * sizeof(AssetEntry))
-		uint64_t entriesSize = static_cast<uint64_t>(count) * sizeof(AssetEntry);
-		if (fileSize < sizeof(uint64_t) + entriesSize) return;
-
-		// Read the AssetEntry array (entries metadata) from the file, just before the count
-		pakStream.seekg(-static_cast<std::streamoff>(sizeof(uint64_t) + entriesSize), std::ios::end);
-		std::vector<AssetEntry> entries(count);
-		pakStream.read(reinterpret_cast<char*>(entries.data()), entriesSize);
-		if (!pakStream) return;
-
-		// Map entries (id -> {offset, size})
-		for (const AssetEntry& entry : entries) {
-			entryMap[entry.id] = { entry.offset, entry.size };
-		}
+		if (!Pak.Open(folderPath)) return;
 
 		PakPath = folderPath;
 		
 		PakLoaded = true;
 	}
 
-	void AssetManager::RetrieveFromPak(uint64_t id, char*& buffer, uint64_t& size)
+	PakAsset AssetManager::ReadFromPak(uint64_t id)
 	{
-		auto it = entryMap.find(id);
-		if (it != entryMap.end())
-		{
-			AssetEntryValue entry = it->second;
-			size = entry.size;
-			buffer = new char[size];
-			pakStream.seekg(entry.offset);
-			pakStream.read(buffer, size);
-		}
-		else
+		if (!PakLoaded) return {};
+		return Pak.Read(id);
+	}
+
+	PakAsset AssetManager::ReadFromPak(std::filesystem::path const& path)
+	{
+		uint64_t id = 0;
+		if (!PakLoaded || !IdFromFileName(path, id)) return {};
+		return Pak.Read(id);
+	}
+
+	void AssetManager::PrefetchAsset(std::filesystem::path const& path)
+	{
+		uint64_t id = 0;
+		if (PakLoaded && IdFromFileName(path, id) && Pak.Prefetch(id)) return;
+
+		// Reading the file through once leaves it in the OS file cache
+		std::ifstream file(path, std::ios::binary);
+		std::vector<char> chunk(PakFile::PageSize * 16);
+		while (file.read(chunk.data(), chunk.size()) || file.gcount() > 0)
 		{
-			std::cerr << "Asset ID not found in pak file." << std::endl;
 		}
 	}
 
@@ -143,14 +159,14 @@ namespace Borealis
 	{
 		std::vector<AssetInfo> infos
 		{
-		//Asset Type					//Asset Name				//extensions			//load function			//Reload function
+		//Asset Type					//Asset Name				//extensions			//load function			//Reload function		//Streaming functions
 		{ AssetType::None,				"AssetType::None",			{},						nullptr},
 		{ AssetType::Animation,			"AssetType::Animation",		{ ".anim" },			Animation::Load,		Animation::Reload },
 		{ AssetType::BehaviourTreeData,	"AssetType::BehaviourTree", { ".btree" },			BTreeFactory::Load },
 		{ AssetType::Folder,			"AssetType::Folder",		{},						nullptr},
 		{ AssetType::Font,				"AssetType::Font",			{ ".ttf"},				nullptr},
-		{ AssetType::Material,			"AssetType::Material",		{ ".mat" },				Material::Load,			Material::Reload },
-		{ AssetType::Mesh,				"AssetType::Mesh",			{ ".fbx"},				Model::Load,			Model::Reload },
+		{ AssetType::Material,			"AssetType::Material",		{ ".mat" },				Material::Load,			Material::Reload,		{ nullptr, nullptr, Material::GetDependencies } },
+		{ AssetType::Mesh,				"AssetType::Mesh",			{ ".fbx"},				Model::Load,			Model::Reload,			{ Model::Decode, Model::Finalize } },
 		{ AssetType::Prefab,			"AssetType::Prefab",		{ ".prefab"},			nullptr},
 		{ AssetType::Scene,				"AssetType::Scene",			{ ".sc"},				nullptr},
 		{ AssetType::Script,			"AssetType::Script",		{ ".cs"},				nullptr,				ScriptingSystem::Reload},
@@ -175,7 +191,7 @@ namespace Borealis
 		assetTypeToString.insert({ assetInfo.type , assetInfo.name });
 		stringToAssetType.insert({ assetInfo.name , assetInfo.type });
 
-		Project::GetEditorAssetsManager()->RegisterAsset(assetInfo.type, assetInfo.loadFunc, assetInfo.reloadFunc);
+		Project::GetEditorAssetsManager()->RegisterAsset(assetInfo.type, assetInfo.loadFunc, assetInfo.reloadFunc, assetInfo.streamFuncs);
 	}
 
 	AssetType AssetManager::GetAssetTypeFromExtension(std::filesystem::path path)
@@ -23,6 +23,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include <Graphics/Model.hpp>
 #include <AI/BehaviourTree/BTreeFactory.hpp>
 #include <mutex>
+#include <chrono>
 #include <openssl/evp.h>
 namespace Borealis
 {
@@ -187,6 +188,29 @@ namespace Borealis
 
 	//=================================ABOVE IS TEMP==================
 
+	namespace
+	{
+		const char* ResidencyPlotName(AssetType type)
+		{
+			switch (type)
+			{
+			case AssetType::Animation:			return "Assets Animation (MB)";
+			case AssetType::Mesh:				return "Assets Mesh (MB)";
+			case AssetType::Shader:				return "Assets Shader (MB)";
+			case AssetType::Texture2D:			return "Assets Texture2D (MB)";
+			case AssetType::Font:				return "Assets Font (MB)";
+			case AssetType::Material:			return "Assets Material (MB)";
+			case AssetType::BehaviourTreeData:	return "Assets BehaviourTree (MB)";
+			default:							return "Assets Other (MB)";
+			}
+		}
+
+		bool OverBudget(AssetResidency const& residency)
+		{
+			return residency.budgetBytes != 0 && residency.residentBytes > residency.budgetBytes;
+		}
+	}
+
 	void EditorAssetManager::LoadAssetRegistryRunTime(std::string path, bool encrypt)
 	{
 		if (!std::filesystem::exists(path)) {
@@ -225,7 +249,12 @@ namespace Borealis
 
 	//=====================================
 
-	void EditorAssetManager::RegisterAsset(AssetType type, AssetLoaderFunc loadFunc, AssetReloadFunc reloadFunc)
+	EditorAssetManager::~EditorAssetManager()
+	{
+		StopLoadWorkers();
+	}
+
+	void EditorAssetManager::RegisterAsset(AssetType type, AssetLoaderFunc loadFunc, AssetReloadFunc reloadFunc, AssetStreamFuncs const& streamFuncs)
 	{
 		if (loadFunc != nullptr)
 		{
@@ -236,6 +265,11 @@ namespace Borealis
 		{
 			mAssetReloaders.insert({ type, reloadFunc });
 		}
+
+		if (streamFuncs.decode != nullptr || streamFuncs.dependencies != nullptr)
+		{
+			mAssetStreamFuncs.insert({ type, streamFuncs });
+		}
 	}
 
 	Ref<Asset> EditorAssetManager::GetAsset(AssetHandle assetHandle)
@@ -249,16 +283,115 @@ namespace Borealis
 		Ref<Asset> asset = nullptr;
 		if (mLoadedAssets.contains(assetHandle))
 		{
-			asset = mLoadedAssets.at(assetHandle);
+			asset = TouchLoadedAsset(mLoadedAssets.at(assetHandle));
+		}
+		else if (mLoadRequests.contains(assetHandle))
+		{
+			asset = WaitForLoad(mLoadRequests.at(assetHandle));
 		}
 		else
 		{
 			asset = LoadAsset(assetHandle);
-			mLoadedAssets.insert({ assetHandle, asset });
+			AddLoadedAsset(assetHandle, asset);
 		}
 		return asset;
 	}
 
+	AssetLoadHandle EditorAssetManager::LoadAssetAsync(AssetHandle assetHandle, AssetLoadPriority priority)
+	{
+		if (!mAssetRegistry.contains(assetHandle))
+		{
+			BOREALIS_CORE_ERROR("NO Asset Handle : {}", assetHandle);
+			return nullptr;
+		}
+
+		if (mLoadedAssets.contains(assetHandle))
+		{
+			AssetLoadHandle request = MakeRef<AssetLoadRequest>();
+			request->mMetaData = mAssetRegistry.at(assetHandle);
+			request->mAsset = TouchLoadedAsset(mLoadedAssets.at(assetHandle));
+			request->mState = AssetLoadState::Ready;
+			return request;
+		}
+
+		if (mLoadRequests.contains(assetHandle))
+		{
+			AssetLoadHandle const& request = mLoadRequests.at(assetHandle);
+			RaisePriority(request, priority);
+			return request;
+		}
+
+		AssetLoadHandle request = MakeRef<AssetLoadRequest>();
+		request->mMetaData = mAssetRegistry.at(assetHandle);
+		request->mCachePath = mCachePath;
+		request->mPriority = priority;
+		mLoadRequests.insert({ assetHandle, request });
+
+		StartLoadWorkers();
+		{
+			std::lock_guard<std::mutex> lock(mLoadMutex);
+			mLoadQueues[static_cast<size_t>(priority)].push_back(request);
+		}
+		mLoadCondition.notify_one();
+
+		return request;
+	}
+
+	void EditorAssetManager::PrefetchAssets(std::vector<AssetHandle> const& assetHandles, AssetLoadPriority priority)
+	{
+		PROFILE_FUNCTION();
+
+		uint32_t queued = 0;
+		for (AssetHandle assetHandle : assetHandles)
+		{
+			if (!mAssetRegistry.contains(assetHandle) || mLoadedAssets.contains(assetHandle)) continue;
+			if (!mAssetLoaders.contains(mAssetRegistry.at(assetHandle).Type)) continue;
+
+			LoadAssetAsync(assetHandle, priority);
+			++queued;
+		}
+
+		if (queued)
+		{
+			BOREALIS_CORE_TRACE("Streaming {} assets", queued);
+		}
+	}
+
+	void EditorAssetManager::FinalizeLoads(float budgetMs)
+	{
+		PROFILE_FUNCTION();
+
+		{
+			std::lock_guard<std::mutex> lock(mLoadMutex);
+			if (mDecodedLoads.empty() && mPendingFinalize.empty()) return;
+			mPendingFinalize.insert(mPendingFinalize.end(), mDecodedLoads.begin(), mDecodedLoads.end());
+			mDecodedLoads.clear();
+
+			std::stable_sort(mPendingFinalize.begin(), mPendingFinalize.end(),
+				[](AssetLoadHandle const& a, AssetLoadHandle const& b) { return a->mPriority > b->mPriority; });
+		}
+
+		auto start = std::chrono::high_resolution_clock::now();
+		std::vector<AssetLoadHandle> pending;
+		pending.swap(mPendingFinalize);
+
+		size_t i = 0;
+		for (; i < pending.size(); ++i)
+		{
+			if (i > 0 && std::chrono::duration<float, std::milli>(std::chrono::high_resolution_clock::now() - start).count() >= budgetMs)
+			{
+				break;
+			}
+
+			if (!FinalizeRequest(pending[i], true))
+			{
+				mPendingFinalize.push_back(pending[i]);
+			}
+		}
+
+		mPendingFinalize.insert(mPendingFinalize.end(), pending.begin() + i, pending.end());
+	}
+
 	void EditorAssetManager::SubmitAssetReloadRequest(AssetHandle assetHandle)
 	{
 		auto it = std::find_if(mAssetReloadRequests.begin(), mAssetReloadRequests.end(),
@@ -284,8 +417,10 @@ namespace Borealis
 			}
 			else if (mLoadedAssets.contains(assetHandle))
 			{
-				mAssetReloaders[assetMetaData.Type](assetMetaData, mLoadedAssets[assetHandle]);
-				return mLoadedAssets[assetHandle];
+				LoadedAsset& loaded = mLoadedAssets.at(assetHandle);
+				mAssetReloaders[assetMetaData.Type](assetMetaData, loaded.asset);
+				UpdateLoadedAssetSize(loaded);
+				return loaded.asset;
 			}
 		}
 		//if not already loaded, no need to load it
@@ -363,6 +498,24 @@ namespace Borealis
 
 	void EditorAssetManager::Clear()
 	{
+		// Every outstanding request fails, whether queued, decoding or waiting to be finalized.
+		// A worker still decoding one sees it failed and drops the result.
+		{
+			std::lock_guard<std::mutex> lock(mLoadMutex);
+			for (auto& [assetHandle, request] : mLoadRequests)
+			{
+				request->mState = AssetLoadState::Failed;
+			}
+			for (auto& queue : mLoadQueues)
+			{
+				queue.clear();
+			}
+			mDecodedLoads.clear();
+		}
+		mDecodedCondition.notify_all();
+		mLoadRequests.clear();
+		mPendingFinalize.clear();
+
 		mAssetRegistry.clear();
 		mAssetRegistryPath.clear();
 		mAssetRegistrySrcLoc.clear();
@@ -375,6 +528,10 @@ namespace Borealis
 
 	void EditorAssetManager::Update()
 	{
+		FinalizeLoads(FinalizeBudgetMs);
+		EnforceMemoryBudgets();
+		RecordResidency();
+
 		std::lock_guard<std::mutex> lock(reloadMutex);
 
 		if (mAssetReloadRequests.empty()) return;
@@ -416,10 +573,385 @@ namespace Borealis
 		if (asset == nullptr)
 		{
 			//asset = GetDefaultAsset();
+			return nullptr;
 		}
 
 		asset->mAssetHandle = assetHandle;
 		return asset;
 	}
+
+	void EditorAssetManager::SetMemoryBudget(AssetType type, uint64_t bytes)
+	{
+		mResidency[type].budgetBytes = bytes;
+	}
+
+	uint64_t EditorAssetManager::GetMemoryBudget(AssetType type) const
+	{
+		auto residency = mResidency.find(type);
+		return residency != mResidency.end() ? residency->second.budgetBytes : 0;
+	}
+
+	void EditorAssetManager::ResetMemoryBudgets()
+	{
+		for (auto& [type, residency] : mResidency)
+		{
+			residency.budgetBytes = 0;
+		}
+	}
+
+	void EditorAssetManager::PinAsset(AssetHandle assetHandle)
+	{
+		++mPinnedAssets[assetHandle];
+	}
+
+	void EditorAssetManager::UnpinAsset(AssetHandle assetHandle)
+	{
+		auto pin = mPinnedAssets.find(assetHandle);
+		if (pin == mPinnedAssets.end()) return;
+
+		if (--pin->second == 0)
+		{
+			mPinnedAssets.erase(pin);
+		}
+	}
+
+	bool EditorAssetManager::IsAssetPinned(AssetHandle assetHandle) const
+	{
+		return mScenePinnedAssets.contains(assetHandle) || mPinnedAssets.contains(assetHandle);
+	}
+
+	void EditorAssetManager::PinSceneAssets(std::vector<AssetHandle> const& assetHandles)
+	{
+		mScenePinnedAssets.clear();
+		for (AssetHandle assetHandle : assetHandles)
+		{
+			if (mAssetRegistry.contains(assetHandle))
+			{
+				mScenePinnedAssets.insert(assetHandle);
+			}
+		}
+	}
+
+	void EditorAssetManager::EnforceMemoryBudgets()
+	{
+		if (std::any_of(mResidency.begin(), mResidency.end(), [](auto const& residency) { return OverBudget(residency.second); }))
+		{
+			EvictOverBudget();
+		}
+
+		for (auto& [type, residency] : mResidency)
+		{
+			bool overBudget = OverBudget(residency);
+			if (overBudget && !residency.overBudget)
+			{
+				BOREALIS_CORE_WARN("{} is over its memory budget with everything left in use, {} of {} bytes",
+					AssetManager::AssetTypeToString(type), residency.residentBytes, residency.budgetBytes);
+			}
+			residency.overBudget = overBudget;
+		}
+	}
+
+	void EditorAssetManager::EvictOverBudget()
+	{
+		PROFILE_FUNCTION();
+
+		// Evicting a material can free its textures, so go again while something was evicted
+		bool evicted = true;
+		while (evicted)
+		{
+			evicted = false;
+			for (auto lru = mLruAssets.end(); lru != mLruAssets.begin();)
+			{
+				--lru;
+				LoadedAsset const& loaded = mLoadedAssets.at(*lru);
+				if (!OverBudget(mResidency[loaded.type])) continue;
+
+				// Held by a scene, a component or another asset
+				if (loaded.asset.use_count() > 1 || IsAssetPinned(*lru)) continue;
+
+				lru = EvictAsset(*lru);
+				evicted = true;
+			}
+		}
+	}
+
+	uint64_t EditorAssetManager::GetResidentBytes() const
+	{
+		uint64_t bytes = 0;
+		for (auto const& [type, residency] : mResidency)
+		{
+			bytes += residency.residentBytes;
+		}
+		return bytes;
+	}
+
+	void EditorAssetManager::AddLoadedAsset(AssetHandle assetHandle, Ref<Asset> const& asset)
+	{
+		if (mLoadedAssets.contains(assetHandle)) return;
+
+		AssetType type = mAssetRegistry.contains(assetHandle) ? mAssetRegistry.at(assetHandle).Type : AssetType::None;
+		mLruAssets.push_front(assetHandle);
+
+		LoadedAsset loaded{ asset, type, asset ? asset->GetMemorySize() : 0, mLruAssets.begin() };
+		AssetResidency& residency = mResidency[type];
+		residency.residentBytes += loaded.bytes;
+		++residency.assetCount;
+
+		mLoadedAssets.insert({ assetHandle, loaded });
+	}
+
+	Ref<Asset> const& EditorAssetManager::TouchLoadedAsset(LoadedAsset& loaded)
+	{
+		mLruAssets.splice(mLruAssets.begin(), mLruAssets, loaded.lruPosition);
+		return loaded.asset;
+	}
+
+	void EditorAssetManager::UpdateLoadedAssetSize(LoadedAsset& loaded)
+	{
+		AssetResidency& residency = mResidency[loaded.type];
+		residency.residentBytes -= loaded.bytes;
+		loaded.bytes = loaded.asset ? loaded.asset->GetMemorySize() : 0;
+		residency.residentBytes += loaded.bytes;
+	}
+
+	std::list<AssetHandle>::iterator EditorAssetManager::EvictAsset(AssetHandle assetHandle)
+	{
+		auto found = mLoadedAssets.find(assetHandle);
+		LoadedAsset& loaded = found->second;
+
+		AssetResidency& residency = mResidency[loaded.type];
+		residency.residentBytes -= loaded.bytes;
+		--residency.assetCount;
+		++residency.evictions;
+
+		if (loaded.asset)
+		{
+			loaded.asset->Release();
+		}
+
+		auto next = mLruAssets.erase(loaded.lruPosition);
+		mLoadedAssets.erase(found);
+		return next;
+	}
+
+	void EditorAssetManager::RecordResidency() const
+	{
+		if (!TracyProfiler::g_EnableProfiler) return;
+
+		constexpr float bytesPerMB = 1024.f * 1024.f;
+		for (auto const& [type, residency] : mResidency)
+		{
+			TracyProfiler::recordPlot(ResidencyPlotName(type), residency.residentBytes / bytesPerMB);
+		}
+		TracyProfiler::recordPlot("Assets Total (MB)", GetResidentBytes() / bytesPerMB);
+	}
+
+	void EditorAssetManager::StartLoadWorkers()
+	{
+		if (!mLoadWorkers.empty()) return;
+
+		// Loads are mostly file reads, a few threads keep the disk busy without taking cores from the job system
+		uint32_t threadCount = std::clamp(std::thread::hardware_concurrency() / 2, 1u, 4u);
+
+		mStopLoading = false;
+		mLoadWorkers.reserve(threadCount);
+		for (uint32_t i = 0; i < threadCount; ++i)
+		{
+			mLoadWorkers.emplace_back(&EditorAssetManager::LoadWorker, this);
+		}
+	}
+
+	void EditorAssetManager::StopLoadWorkers()
+	{
+		{
+			std::lock_guard<std::mutex> lock(mLoadMutex);
+			mStopLoading = true;
+		}
+		mLoadCondition.notify_all();
+
+		for (auto& worker : mLoadWorkers)
+		{
+			worker.join();
+		}
+		mLoadWorkers.clear();
+	}
+
+	void EditorAssetManager::LoadWorker()
+	{
+		while (true)
+		{
+			AssetLoadHandle request;
+			{
+				std::unique_lock<std::mutex> lock(mLoadMutex);
+				mLoadCondition.wait(lock, [this]
+					{
+						return mStopLoading || std::any_of(mLoadQueues.begin(), mLoadQueues.end(), [](auto const& queue) { return !queue.empty(); });
+					});
+				if (mStopLoading) return;
+
+				// Highest priority first, oldest first within a priority
+				for (auto queue = mLoadQueues.rbegin(); queue != mLoadQueues.rend(); ++queue)
+				{
+					if (queue->empty()) continue;
+					request = queue->front();
+					queue->pop_front();
+					break;
+				}
+				request->mState = AssetLoadState::Loading;
+			}
+
+			DecodeRequest(*request);
+
+			{
+				std::lock_guard<std::mutex> lock(mLoadMutex);
+				if (request->GetState() == AssetLoadState::Failed) continue; // Cleared while decoding
+				request->mState = AssetLoadState::Decoded;
+				mDecodedLoads.push_back(request);
+			}
+			mDecodedCondition.notify_all();
+		}
+	}
+
+	void EditorAssetManager::DecodeRequest(AssetLoadRequest& request) const
+	{
+		PROFILE_FUNCTION();
+
+		AssetMetaData const& metaData = request.mMetaData;
+		auto streamFuncs = mAssetStreamFuncs.find(metaData.Type);
+
+		// A failed decode falls back to the regular loader on the main thread, which reports the error
+		try
+		{
+			if (streamFuncs != mAssetStreamFuncs.end())
+			{
+				if (streamFuncs->second.dependencies)
+				{
+					request.mDependencies = streamFuncs->second.dependencies(request.mCachePath, metaData);
+				}
+				if (streamFuncs->second.decode)
+				{
+					request.mAsset = streamFuncs->second.decode(request.mCachePath, metaData);
+				}
+			}
+		}
+		catch (std::exception const& e)
+		{
+			BOREALIS_CORE_WARN("Streaming {} failed: {}", metaData.name, e.what());
+			request.mAsset = nullptr;
+		}
+
+		if (!request.mAsset)
+		{
+			AssetManager::PrefetchAsset(request.mCachePath / std::to_string(metaData.Handle));
+		}
+	}
+
+	void EditorAssetManager::RaisePriority(AssetLoadHandle const& request, AssetLoadPriority priority)
+	{
+		bool moved = false;
+		{
+			std::lock_guard<std::mutex> lock(mLoadMutex);
+			if (priority <= request->mPriority) return;
+
+			if (request->GetState() == AssetLoadState::Queued)
+			{
+				auto& queue = mLoadQueues[static_cast<size_t>(request->mPriority)];
+				auto it = std::find(queue.begin(), queue.end(), request);
+				if (it != queue.end())
+				{
+					queue.erase(it);
+					mLoadQueues[static_cast<size_t>(priority)].push_back(request);
+					moved = true;
+				}
+			}
+			request->mPriority = priority;
+		}
+
+		if (moved)
+		{
+			mLoadCondition.notify_one();
+		}
+	}
+
+	Ref<Asset> EditorAssetManager::WaitForLoad(AssetLoadHandle const& request)
+	{
+		PROFILE_FUNCTION();
+
+		RaisePriority(request, AssetLoadPriority::Critical);
+		{
+			std::unique_lock<std::mutex> lock(mLoadMutex);
+			mDecodedCondition.wait(lock, [&request]
+				{
+					AssetLoadState state = request->GetState();
+					return state != AssetLoadState::Queued && state != AssetLoadState::Loading;
+				});
+		}
+
+		// Dependencies are fetched by the loader itself, through GetAsset
+		FinalizeRequest(request, false);
+		return request->GetAsset();
+	}
+
+	bool EditorAssetManager::FinalizeRequest(AssetLoadHandle const& request, bool waitForDependencies)
+	{
+		AssetHandle assetHandle = request->GetHandle();
+
+		// Cleared, or already finished by GetAsset
+		auto found = mLoadRequests.find(assetHandle);
+		if (found == mLoadRequests.end() || found->second != request)
+		{
+			return true;
+		}
+
+		if (waitForDependencies)
+		{
+			// Dependencies are queued once, one that failed to load is not waited on again
+			bool waiting = false;
+			for (AssetHandle dependency : request->mDependencies)
+			{
+				if (!mAssetRegistry.contains(dependency) || mLoadedAssets.contains(dependency)) continue;
+
+				if (!mLoadRequests.contains(dependency))
+				{
+					if (request->mDependenciesQueued) continue;
+					LoadAssetAsync(dependency, request->mPriority);
+				}
+				waiting = true;
+			}
+			request->mDependenciesQueued = true;
+			if (waiting) return false;
+		}
+
+		PROFILE_SCOPE("EditorAssetManager::FinalizeRequest");
+
+		AssetMetaData const& metaData = request->mMetaData;
+		Ref<Asset> asset = request->mAsset;
+		if (asset)
+		{
+			auto streamFuncs = mAssetStreamFuncs.find(metaData.Type);
+			if (streamFuncs != mAssetStreamFuncs.end() && streamFuncs->second.finalize)
+			{
+				streamFuncs->second.finalize(metaData, asset);
+			}
+			asset->mAssetHandle = assetHandle;
+		}
+		else
+		{
+			// The bytes were read ahead, the loader now only parses and uploads them
+			asset = LoadAsset(assetHandle);
+		}
+
+		mLoadRequests.erase(assetHandle);
+		if (!asset)
+		{
+			request->mState = AssetLoadState::Failed;
+			return true;
+		}
+
+		AddLoadedAsset(assetHandle, asset);
+		request->mAsset = asset;
+		request->mState = AssetLoadState::Ready;
+		return true;
+	}
 }
 
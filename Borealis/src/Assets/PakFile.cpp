@@ -0,0 +1,454 @@
+/******************************************************************************
+/*!
+\file       PakFile.cpp
+\author     Chan Guo Geng Gordon
+\par        email: g.chan/@digipen.edu
+\date       October 17, 2026
+\brief      Defines the pak writer and the memory mapped pak reader
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#include <BorealisPCH.hpp>
+#include <Assets/PakFile.hpp>
+#include <Core/LoggerSystem.hpp>
+
+#include <lz4.h>
+#include <lz4hc.h>
+
+namespace Borealis
+{
+	static_assert(sizeof(PakHeader) == 32, "Pak header layout changed");
+	static_assert(sizeof(PakEntry) == 48, "Pak entry layout changed");
+
+	namespace
+	{
+		// Version 1 table entry
+		struct LegacyEntry
+		{
+			uint64_t id;
+			uint64_t offset;
+			uint64_t size;
+		};
+
+		// Smallest alignment of a compressed entry, stored entries start on a page
+		constexpr uint64_t CompressedAlignment = 16;
+
+		constexpr uint64_t Prime1 = 11400714785074694791ULL;
+		constexpr uint64_t Prime2 = 14029467366897019727ULL;
+		constexpr uint64_t Prime3 = 1609587929392839161ULL;
+		constexpr uint64_t Prime4 = 9650029242287828579ULL;
+		constexpr uint64_t Prime5 = 2870177450012600261ULL;
+
+		uint64_t RotateLeft(uint64_t value, int bits)
+		{
+			return (value << bits) | (value >> (64 - bits));
+		}
+
+		uint64_t Read64(const unsigned char* p)
+		{
+			uint64_t value;
+			std::memcpy(&value, p, sizeof(value));
+			return value;
+		}
+
+		uint32_t Read32(const unsigned char* p)
+		{
+			uint32_t value;
+			std::memcpy(&value, p, sizeof(value));
+			return value;
+		}
+
+		uint64_t HashRound(uint64_t acc, uint64_t input)
+		{
+			acc += input * Prime2;
+			acc = RotateLeft(acc, 31);
+			return acc * Prime1;
+		}
+
+		uint64_t HashMerge(uint64_t acc, uint64_t value)
+		{
+			acc ^= HashRound(0, value);
+			return acc * Prime1 + Prime4;
+		}
+
+		uint64_t AlignUp(uint64_t value, uint64_t alignment)
+		{
+			return (value + alignment - 1) / alignment * alignment;
+		}
+	}
+
+	uint64_t PakFile::HashContent(const void* data, size_t size)
+	{
+		// XXH64 with a zero seed
+		const unsigned char* p = static_cast<const unsigned char*>(data);
+		const unsigned char* const end = p + size;
+		uint64_t hash;
+
+		if (size >= 32)
+		{
+			uint64_t v1 = Prime1 + Prime2;
+			uint64_t v2 = Prime2;
+			uint64_t v3 = 0;
+			uint64_t v4 = 0 - Prime1;
+			const unsigned char* const limit = end - 32;
+			do
+			{
+				v1 = HashRound(v1, Read64(p)); p += 8;
+				v2 = HashRound(v2, Read64(p)); p += 8;
+				v3 = HashRound(v3, Read64(p)); p += 8;
+				v4 = HashRound(v4, Read64(p)); p += 8;
+			} while (p <= limit);
+
+			hash = RotateLeft(v1, 1) + RotateLeft(v2, 7) + RotateLeft(v3, 12) + RotateLeft(v4, 18);
+			hash = HashMerge(hash, v1);
+			hash = HashMerge(hash, v2);
+			hash = HashMerge(hash, v3);
+			hash = HashMerge(hash, v4);
+		}
+		else
+		{
+			hash = Prime5;
+		}
+
+		hash += static_cast<uint64_t>(size);
+
+		for (; p + 8 <= end; p += 8)
+		{
+			hash ^= HashRound(0, Read64(p));
+			hash = RotateLeft(hash, 27) * Prime1 + Prime4;
+		}
+		if (p + 4 <= end)
+		{
+			hash ^= static_cast<uint64_t>(Read32(p)) * Prime1;
+			hash = RotateLeft(hash, 23) * Prime2 + Prime3;
+			p += 4;
+		}
+		for (; p < end; ++p)
+		{
+			hash ^= (*p) * Prime5;
+			hash = RotateLeft(hash, 11) * Prime1;
+		}
+
+		hash ^= hash >> 33;
+		hash *= Prime2;
+		hash ^= hash >> 29;
+		hash *= Prime3;
+		hash ^= hash >> 32;
+		return hash;
+	}
+
+	bool PakFile::Write(std::filesystem::path const& location, std::vector<PakSource> const& sources, uint32_t version, PakWriteStats* stats)
+	{
+		std::ofstream out(location, std::ios::binary);
+		if (!out) return false;
+
+		PakWriteStats written;
+		std::vector<PakEntry> entries;
+		entries.reserve(sources.size());
+		std::vector<char> raw;
+		std::vector<char> packed;
+		uint64_t offset = 0;
+
+		auto pad = [&out, &offset](uint64_t alignment)
+			{
+				static const char zeros[PageSize] = {};
+				uint64_t aligned = AlignUp(offset, alignment);
+				out.write(zeros, static_cast<std::streamsize>(aligned - offset));
+				offset = aligned;
+			};
+
+		PakHeader header;
+		if (version >= PakHeader::Version)
+		{
+			// Filled in once the index offset is known
+			header.pageAlignment = PageSize;
+			out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+			offset = sizeof(header);
+		}
+
+		for (PakSource const& source : sources)
+		{
+			std::ifstream in(source.path, std::ios::binary | std::ios::ate);
+			if (!in) continue;
+
+			raw.resize(static_cast<size_t>(in.tellg()));
+			in.seekg(0);
+			in.read(raw.data(), static_cast<std::streamsize>(raw.size()));
+			if (!in) continue;
+
+			PakEntry entry{ source.id, 0, raw.size(), raw.size(), 0, PakCompression::None, 0 };
+			const char* stored = raw.data();
+
+			if (version >= PakHeader::Version)
+			{
+				entry.hash = HashContent(raw.data(), raw.size());
+
+				if (source.compression != PakCompression::None && !raw.empty() && raw.size() <= LZ4_MAX_INPUT_SIZE)
+				{
+					int const rawSize = static_cast<int>(raw.size());
+					packed.resize(static_cast<size_t>(LZ4_compressBound(rawSize)));
+					int const packedSize = source.compression == PakCompression::LZ4HC
+						? LZ4_compress_HC(raw.data(), packed.data(), rawSize, static_cast<int>(packed.size()), LZ4HC_CLEVEL_DEFAULT)
+						: LZ4_compress_default(raw.data(), packed.data(), rawSize, static_cast<int>(packed.size()));
+
+					// Keep it only when it saves an eighth, otherwise decoding costs more than it saves in reading
+					if (packedSize > 0 && static_cast<uint64_t>(packedSize) < raw.size() - raw.size() / 8)
+					{
+						entry.compression = source.compression;
+						entry.storedSize = static_cast<uint64_t>(packedSize);
+						stored = packed.data();
+						++written.compressedEntries;
+					}
+				}
+
+				pad(entry.compression == PakCompression::None ? PageSize : CompressedAlignment);
+			}
+
+			entry.offset = offset;
+			out.write(stored, static_cast<std::streamsize>(entry.storedSize));
+			offset += entry.storedSize;
+
+			written.rawBytes += entry.size;
+			entries.push_back(entry);
+		}
+
+		if (version >= PakHeader::Version)
+		{
+			// Sorted and aligned so the reader can search it in place
+			std::sort(entries.begin(), entries.end(), [](PakEntry const& a, PakEntry const& b) { return a.id < b.id; });
+			pad(alignof(PakEntry));
+			header.entryCount = entries.size();
+			header.indexOffset = offset;
+			out.write(reinterpret_cast<const char*>(entries.data()), static_cast<std::streamsize>(entries.size() * sizeof(PakEntry)));
+			offset += entries.size() * sizeof(PakEntry);
+
+			out.seekp(0);
+			out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+		}
+		else
+		{
+			std::vector<LegacyEntry> table;
+			table.reserve(entries.size());
+			for (PakEntry const& entry : entries)
+			{
+				table.push_back({ entry.id, entry.offset, entry.size });
+			}
+			uint64_t count = table.size();
+			out.write(reinterpret_cast<const char*>(table.data()), static_cast<std::streamsize>(table.size() * sizeof(LegacyEntry)));
+			out.write(reinterpret_cast<const char*>(&count), sizeof(count));
+			offset += table.size() * sizeof(LegacyEntry) + sizeof(count);
+		}
+
+		written.entries = entries.size();
+		written.fileBytes = offset;
+		if (stats) *stats = written;
+
+		out.close();
+		return !out.fail();
+	}
+
+	PakFile::~PakFile()
+	{
+		Close();
+	}
+
+	bool PakFile::Open(std::filesystem::path const& path)
+	{
+		Close();
+
+		HANDLE file = CreateFileW(path.wstring().c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS, nullptr);
+		if (file == INVALID_HANDLE_VALUE) return false;
+		mFile = file;
+
+		LARGE_INTEGER fileSize{};
+		if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart < static_cast<LONGLONG>(sizeof(uint64_t)))
+		{
+			Close();
+			return false;
+		}
+		mSize = static_cast<uint64_t>(fileSize.QuadPart);
+
+		mMapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (!mMapping)
+		{
+			Close();
+			return false;
+		}
+
+		mData = static_cast<const char*>(MapViewOfFile(mMapping, FILE_MAP_READ, 0, 0, 0));
+		if (!mData)
+		{
+			Close();
+			return false;
+		}
+
+		PakHeader header;
+		if (mSize >= sizeof(PakHeader))
+		{
+			std::memcpy(&header, mData, sizeof(header));
+		}
+		if (mSize < sizeof(PakHeader) || header.magic != PakHeader::Magic)
+		{
+			return LoadLegacyIndex(path);
+		}
+
+		// The index is used straight from the mapping, entries are bounds checked when read
+		if (header.version != PakHeader::Version
+			|| header.indexOffset % alignof(PakEntry) != 0
+			|| header.indexOffset > mSize
+			|| header.entryCount > (mSize - header.indexOffset) / sizeof(PakEntry))
+		{
+			BOREALIS_CORE_ERROR("Pak file {} has an invalid header", path.string());
+			Close();
+			return false;
+		}
+
+		mVersion = header.version;
+		mIndex = { reinterpret_cast<const PakEntry*>(mData + header.indexOffset), static_cast<size_t>(header.entryCount) };
+		return true;
+	}
+
+	bool PakFile::LoadLegacyIndex(std::filesystem::path const& path)
+	{
+		// Count is the last 8 bytes, the entry table sits right before it
+		uint64_t count = 0;
+		std::memcpy(&count, mData + mSize - sizeof(uint64_t), sizeof(count));
+		uint64_t const tableSize = sizeof(uint64_t) + count * sizeof(LegacyEntry);
+		if (count > mSize / sizeof(LegacyEntry) || tableSize > mSize)
+		{
+			BOREALIS_CORE_ERROR("Pak file {} has an invalid entry table", path.string());
+			Close();
+			return false;
+		}
+
+		uint64_t const dataSize = mSize - tableSize;
+		std::vector<LegacyEntry> table(count);
+		std::memcpy(table.data(), mData + dataSize, count * sizeof(LegacyEntry));
+
+		mLegacyIndex.reserve(table.size());
+		for (LegacyEntry const& entry : table)
+		{
+			// Entries pointing outside the data region would hand out views past the mapping
+			if (entry.offset > dataSize || entry.size > dataSize - entry.offset) continue;
+			mLegacyIndex.push_back({ entry.id, entry.offset, entry.size, entry.size, 0, PakCompression::None, 0 });
+		}
+		std::sort(mLegacyIndex.begin(), mLegacyIndex.end(), [](PakEntry const& a, PakEntry const& b) { return a.id < b.id; });
+
+		mVersion = 1;
+		mIndex = mLegacyIndex;
+		return true;
+	}
+
+	void PakFile::Close()
+	{
+		mIndex = {};
+		mLegacyIndex.clear();
+		mVersion = 0;
+
+		if (mData)
+		{
+			UnmapViewOfFile(mData);
+			mData = nullptr;
+		}
+		if (mMapping)
+		{
+			CloseHandle(mMapping);
+			mMapping = nullptr;
+		}
+		if (mFile)
+		{
+			CloseHandle(mFile);
+			mFile = nullptr;
+		}
+		mSize = 0;
+	}
+
+	PakEntry const* PakFile::FindEntry(uint64_t id) const
+	{
+		auto it = std::lower_bound(mIndex.begin(), mIndex.end(), id, [](PakEntry const& entry, uint64_t value) { return entry.id < value; });
+		if (it == mIndex.end() || it->id != id)
+		{
+			return nullptr;
+		}
+		return &*it;
+	}
+
+	bool PakFile::Decode(PakEntry const& entry, PakAsset& out) const
+	{
+		if (entry.offset > mSize || entry.storedSize > mSize - entry.offset) return false;
+
+		const char* stored = mData + entry.offset;
+		switch (entry.compression)
+		{
+		case PakCompression::None:
+			if (entry.storedSize != entry.size) return false;
+			out.mView = { stored, static_cast<size_t>(entry.size) };
+			return true;
+
+		case PakCompression::LZ4:
+		case PakCompression::LZ4HC:
+		{
+			if (entry.size > LZ4_MAX_INPUT_SIZE || entry.storedSize > static_cast<uint64_t>(INT32_MAX)) return false;
+			out.mBuffer.resize(static_cast<size_t>(entry.size));
+			int const decoded = LZ4_decompress_safe(stored, out.mBuffer.data(), static_cast<int>(entry.storedSize), static_cast<int>(entry.size));
+			if (decoded < 0 || static_cast<uint64_t>(decoded) != entry.size) return false;
+			out.mView = out.mBuffer;
+			return true;
+		}
+
+		default:
+			return false;
+		}
+	}
+
+	PakAsset PakFile::Read(uint64_t id) const
+	{
+		PakAsset asset;
+		PakEntry const* entry = FindEntry(id);
+		if (!entry) return asset;
+
+		if (!Decode(*entry, asset))
+		{
+			BOREALIS_CORE_ERROR("Pak entry {} could not be decoded", id);
+			return {};
+		}
+
+#ifdef _DEB
+		if (entry->hash && HashContent(asset.mView.data(), asset.mView.size()) != entry->hash)
+		{
+			BOREALIS_CORE_ERROR("Pak entry {} does not match its content hash", id);
+			return {};
+		}
+#endif
+
+		return asset;
+	}
+
+	bool PakFile::Prefetch(uint64_t id) const
+	{
+		PakEntry const* entry = FindEntry(id);
+		if (!entry) return false;
+		if (entry->offset > mSize || entry->storedSize > mSize - entry->offset) return false;
+
+		// One read per page is enough for the OS to map it in
+		volatile char sink = 0;
+		const char* begin = mData + entry->offset;
+		for (uint64_t offset = 0; offset < entry->storedSize; offset += PageSize)
+		{
+			sink = begin[offset];
+		}
+		(void)sink;
+		return true;
+	}
+
+	bool PakFile::Verify(PakEntry const& entry) const
+	{
+		PakAsset asset;
+		if (!Decode(entry, asset)) return false;
+		return entry.hash == 0 || HashContent(asset.mView.data(), asset.mView.size()) == entry.hash;
+	}
+}
@@ -24,6 +24,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include <Scripting/ScriptingSystem.hpp>
 #include <Physics/PhysicsSystem.hpp>
 #include <Core/TimeManager.hpp>
+#include <Core/JobSystem.hpp>
 
 namespace Borealis
 {
@@ -50,6 +51,7 @@ namespace Borealis
 		ScriptingSystem::Init();
 
 		InputSystem::Init();
+		JobSystem::Init();
 		//PhysicsSystem::Init();
 	}
 
@@ -63,6 +65,7 @@ namespace Borealis
 
 		Renderer::Free();
 		mLayerSystem.Clear();
+		JobSystem::Free();
 		ScriptingSystem::Free();
 		AudioEngine::Shutdown();
 		//PhysicsSystem::Free();
@@ -0,0 +1,170 @@
+/******************************************************************************
+/*!
+\file       JobSystem.cpp
+\author     Chua Zheng Yang
+\par        email: c.zhengyang\@digipen.edu
+\date       October 17, 2026
+\brief      Defines a small worker thread pool for splitting independent
+			work across cores
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#include <BorealisPCH.hpp>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <Core/JobSystem.hpp>
+
+namespace Borealis
+{
+	namespace
+	{
+		struct JobData
+		{
+			std::vector<std::thread> workers;
+
+			std::mutex mutex; // guards the batch fields below and the waits
+			std::condition_variable wake;
+			std::condition_variable done;
+			std::mutex submitMutex; // one batch in flight at a time
+
+			std::function<void(uint32_t, uint32_t)> const* job = nullptr;
+			uint32_t count = 0;
+			uint32_t grainSize = 1;
+			uint32_t chunkCount = 0;
+			uint64_t generation = 0;
+			bool batchOpen = false;
+			bool stop = false;
+			uint32_t workersInBatch = 0;
+
+			std::atomic<uint32_t> nextChunk{ 0 };
+			std::atomic<uint32_t> chunksDone{ 0 };
+		};
+
+		JobData sJobData;
+		thread_local bool tInsideJob = false;
+
+		void RunChunks()
+		{
+			tInsideJob = true;
+			uint32_t chunk;
+			while ((chunk = sJobData.nextChunk.fetch_add(1)) < sJobData.chunkCount)
+			{
+				uint32_t begin = chunk * sJobData.grainSize;
+				uint32_t end = std::min(begin + sJobData.grainSize, sJobData.count);
+				(*sJobData.job)(begin, end);
+
+				if (sJobData.chunksDone.fetch_add(1) + 1 == sJobData.chunkCount)
+				{
+					{ std::lock_guard<std::mutex> lock(sJobData.mutex); }
+					sJobData.done.notify_all();
+				}
+			}
+			tInsideJob = false;
+		}
+
+		void WorkerLoop()
+		{
+			uint64_t seenGeneration = 0;
+			while (true)
+			{
+				{
+					std::unique_lock<std::mutex> lock(sJobData.mutex);
+					sJobData.wake.wait(lock, [&seenGeneration]
+						{ return sJobData.stop || (sJobData.batchOpen && sJobData.generation != seenGeneration); });
+					if (sJobData.stop) return;
+
+					seenGeneration = sJobData.generation;
+					++sJobData.workersInBatch;
+				}
+
+				RunChunks();
+
+				{
+					std::lock_guard<std::mutex> lock(sJobData.mutex);
+					--sJobData.workersInBatch;
+				}
+				sJobData.done.notify_all();
+			}
+		}
+	}
+
+	void JobSystem::Init(uint32_t threadCount)
+	{
+		if (!sJobData.workers.empty()) return;
+
+		if (threadCount == 0)
+		{
+			uint32_t cores = std::thread::hardware_concurrency();
+			threadCount = cores > 1 ? cores - 1 : 0;
+		}
+
+		sJobData.stop = false;
+		sJobData.workers.reserve(threadCount);
+		for (uint32_t i = 0; i < threadCount; ++i)
+		{
+			sJobData.workers.emplace_back(WorkerLoop);
+		}
+	}
+
+	void JobSystem::Free()
+	{
+		{
+			std::lock_guard<std::mutex> lock(sJobData.mutex);
+			sJobData.stop = true;
+		}
+		sJobData.wake.notify_all();
+
+		for (auto& worker : sJobData.workers)
+		{
+			worker.join();
+		}
+		sJobData.workers.clear();
+	}
+
+	void JobSystem::ParallelFor(uint32_t count, std::function<void(uint32_t, uint32_t)> const& job, uint32_t grainSize)
+	{
+		if (count == 0) return;
+		if (grainSize == 0) grainSize = 1;
+
+		uint32_t chunkCount = (count + grainSize - 1) / grainSize;
+		if (sJobData.workers.empty() || chunkCount == 1 || tInsideJob)
+		{
+			job(0, count);
+			return;
+		}
+
+		std::lock_guard<std::mutex> submitLock(sJobData.submitMutex);
+		{
+			std::lock_guard<std::mutex> lock(sJobData.mutex);
+			sJobData.job = &job;
+			sJobData.count = count;
+			sJobData.grainSize = grainSize;
+			sJobData.chunkCount = chunkCount;
+			sJobData.nextChunk = 0;
+			sJobData.chunksDone = 0;
+			sJobData.batchOpen = true;
+			++sJobData.generation;
+		}
+		sJobData.wake.notify_all();
+
+		RunChunks();
+
+		std::unique_lock<std::mutex> lock(sJobData.mutex);
+		sJobData.done.wait(lock, [] { return sJobData.chunksDone == sJobData.chunkCount; });
+		// workers still inside RunChunks must leave before the batch fields are reused
+		sJobData.batchOpen = false;
+		sJobData.done.wait(lock, [] { return sJobData.workersInBatch == 0; });
+		sJobData.job = nullptr;
+	}
+
+	uint32_t JobSystem::GetThreadCount()
+	{
+		return static_cast<uint32_t>(sJobData.workers.size());
+	}
+}
@@ -18,7 +18,9 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include <Core/LoggerSystem.hpp>
 #include <Core/LoggerSystem.hpp>
 #include <Scene/SceneManager.hpp>
+#include <Scene/Serialiser.hpp>
 #include <Core/LayerList.hpp>
+#include <Physics/PhysicsLayers.hpp>
 #include <Audio/AudioEngine.hpp>
 #include <openssl/evp.h>
 #include <cstdint>
@@ -212,6 +214,8 @@ namespace Borealis
 				AudioEngine::Init(projectFilePath);
 
 				LayerList::Reset();
+				PhysicsLayers::Reset();
+				GetEditorAssetsManager()->ResetMemoryBudgets();
 				////pass in project info
 				//GetEditorAssetsManager()->LoadRegistry(mProjectInfo);
 				std::stringstream ss;
@@ -238,6 +242,28 @@ namespace Borealis
 					}
 				}
 
+				if (data["PhysicsLayerMatrix"])
+				{
+					for (const auto& item : data["PhysicsLayerMatrix"])
+					{
+						PhysicsLayers::SetCollisionMask(item.first.as<uint32_t>(), item.second.as<uint32_t>());
+					}
+				}
+
+				if (data["DebrisLayers"])
+				{
+					PhysicsLayers::SetDebrisMask(data["DebrisLayers"].as<uint32_t>());
+				}
+
+				// Asset type to budget in MB
+				if (data["AssetMemoryBudgets"])
+				{
+					for (const auto& item : data["AssetMemoryBudgets"])
+					{
+						GetEditorAssetsManager()->SetMemoryBudget(static_cast<AssetType>(item.first.as<int>()), item.second.as<uint64_t>() * 1024 * 1024);
+					}
+				}
+
 				// Load Scenes
 				if (data["Scenes"])
 				{
@@ -326,6 +352,30 @@ namespace Borealis
 		}
 		out << YAML::EndMap;
 
+		// Only rows that differ from the all-collide default
+		out << YAML::Key << "PhysicsLayerMatrix";
+		out << YAML::BeginMap;
+		for (uint32_t i = 0; i < PhysicsLayers::LayerCount; i++)
+		{
+			if (PhysicsLayers::GetCollisionMask(i) != PhysicsLayers::AllLayers)
+			{
+				out << YAML::Key << i << YAML::Value << PhysicsLayers::GetCollisionMask(i);
+			}
+		}
+		out << YAML::EndMap;
+		out << YAML::Key << "DebrisLayers" << YAML::Value << PhysicsLayers::GetDebrisMask();
+
+		out << YAML::Key << "AssetMemoryBudgets";
+		out << YAML::BeginMap;
+		for (auto const& [type, residency] : GetEditorAssetsManager()->GetResidency())
+		{
+			if (residency.budgetBytes)
+			{
+				out << YAML::Key << static_cast<int>(type) << YAML::Value << residency.budgetBytes / (1024 * 1024);
+			}
+		}
+		out << YAML::EndMap;
+
 		std::string projectFilePath = mProjectInfo.ProjectPath.string();
 		projectFilePath += "/Project.brproj";
 
@@ -370,6 +420,30 @@ namespace Borealis
 		}
 		out << YAML::EndMap;
 
+		// Only rows that differ from the all-collide default
+		out << YAML::Key << "PhysicsLayerMatrix";
+		out << YAML::BeginMap;
+		for (uint32_t i = 0; i < PhysicsLayers::LayerCount; i++)
+		{
+			if (PhysicsLayers::GetCollisionMask(i) != PhysicsLayers::AllLayers)
+			{
+				out << YAML::Key << i << YAML::Value << PhysicsLayers::GetCollisionMask(i);
+			}
+		}
+		out << YAML::EndMap;
+		out << YAML::Key << "DebrisLayers" << YAML::Value << PhysicsLayers::GetDebrisMask();
+
+		out << YAML::Key << "AssetMemoryBudgets";
+		out << YAML::BeginMap;
+		for (auto const& [type, residency] : GetEditorAssetsManager()->GetResidency())
+		{
+			if (residency.budgetBytes)
+			{
+				out << YAML::Key << static_cast<int>(type) << YAML::Value << residency.budgetBytes / (1024 * 1024);
+			}
+		}
+		out << YAML::EndMap;
+
 		if (encrypt)
 			encryptString(out.c_str(), buildPath, assembleKey().data(), assembleIV().data());
 		else
@@ -467,6 +541,44 @@ namespace Borealis
 		}
 	}
 
+	void Project::BuildSceneBinaries(const std::filesystem::path& source, const std::filesystem::path& destination, bool encrypt)
+	{
+		if (!std::filesystem::exists(source) || !std::filesystem::is_directory(source))
+		{
+			BOREALIS_CORE_ERROR("Source directory does not exist or is not a directory");
+			return;
+		}
+
+		for (const auto& entry : std::filesystem::recursive_directory_iterator(source))
+		{
+			if (!entry.is_regular_file() || entry.path().extension().string() != ".sc")
+			{
+				continue;
+			}
+
+			std::string binary;
+			if (!Serialiser::BuildSceneBinary(entry.path().string(), binary))
+			{
+				BOREALIS_CORE_WARN("Scene {} could not be converted, it is shipped as YAML", entry.path().string());
+				continue;
+			}
+
+			auto destPath = destination / std::filesystem::relative(entry.path(), source);
+			std::filesystem::create_directories(destPath.parent_path());
+			if (encrypt)
+			{
+				std::vector<uint8_t> key = assembleKey();
+				std::vector<uint8_t> iv = assembleIV();
+				encryptString(binary, destPath.string(), key.data(), iv.data());
+			}
+			else
+			{
+				std::ofstream outStream(destPath, std::ios::binary);
+				outStream.write(binary.data(), binary.size());
+			}
+		}
+	}
+
 	std::shared_ptr<EditorAssetManager> Project::GetEditorAssetsManager()
 	{
 		if (!mAssetManager)
@@ -22,6 +22,8 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include <Events/EventWindow.hpp>
 #include <Events/EventInput.hpp>
 #include <Graphics/OpenGL/GraphicsContextOpenGLImpl.hpp>
+#include <Graphics/Null/GraphicsContextNullImpl.hpp>
+#include <Graphics/RendererAPI.hpp>
 #include <Audio/AudioEngine.hpp>
 namespace Borealis
 {
@@ -78,6 +80,13 @@ namespace Borealis
 	{
 		PROFILE_FUNCTION();
 
+		if (RendererAPI::GetAPI() == RendererAPI::API::Null)
+		{
+			// No context to swap when headless
+			mData.mIsVSync = enabled;
+			return;
+		}
+
 		if (enabled)
 			glfwSwapInterval(1);
 		else
@@ -190,6 +199,11 @@ namespace Borealis
 		if (!sGLFWInitialized)
 		{
 			PROFILE_SCOPE("glfwInit");
+			if (RendererAPI::GetAPI() == RendererAPI::API::Null)
+			{
+				// GLFW's null platform needs no display server
+				glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
+			}
 			int success = glfwInit();
 
 			BOREALIS_CORE_ASSERT(success, "Failed to initialize GLFW!");
@@ -201,13 +215,25 @@ namespace Borealis
 		{
 			PROFILE_SCOPE("glfwCreateWindow");
 
-			//lock the version of opengl to 4.1
-			glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
-			glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 1);
-			glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+			if (RendererAPI::GetAPI() == RendererAPI::API::Null)
+			{
+				// Window without a client API, only used for input and events
+				glfwWindowHint(GLFW_CLIENT_API, GLFW_NO_API);
+				glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
 
-			mWindow = (void*)(glfwCreateWindow((int)mData.mWidth, (int)mData.mHeight, mData.mTitle, nullptr, nullptr));
-			mContext = new OpenGLContext((GLFWwindow*)mWindow);
+				mWindow = (void*)(glfwCreateWindow((int)mData.mWidth, (int)mData.mHeight, mData.mTitle, nullptr, nullptr));
+				mContext = new NullContext();
+			}
+			else
+			{
+				//lock the version of opengl to 4.1
+				glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+				glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 1);
+				glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+
+				mWindow = (void*)(glfwCreateWindow((int)mData.mWidth, (int)mData.mHeight, mData.mTitle, nullptr, nullptr));
+				mContext = new OpenGLContext((GLFWwindow*)mWindow);
+			}
 			mContext->Init();
 		}
 
@@ -19,7 +19,184 @@ namespace Borealis
 		return &(*i);
 	}
 
-	void LoadAssimpNodeData(std::stringstream& inFile, AssimpNodeData& node) 
+	void Animation::BindSkeleton(std::map<std::string, BoneData> const& boneDataMap)
+	{
+		mBoneDataMap = boneDataMap;
+		BuildNodeTable();
+	}
+
+	void Animation::BuildNodeTable()
+	{
+		std::unordered_map<std::string_view, int> channels;
+		channels.reserve(mBones.size());
+		for (int i = 0; i < static_cast<int>(mBones.size()); ++i)
+		{
+			channels.emplace(mBones[i].GetBoneName(), i);
+		}
+
+		mNodes.clear();
+
+		// depth first, each entry holds the node and the index of its parent
+		std::vector<std::pair<AssimpNodeData const*, int>> stack;
+		stack.emplace_back(&mRootNode, -1);
+		while (!stack.empty())
+		{
+			auto [node, parent] = stack.back();
+			stack.pop_back();
+
+			AnimationNode flat;
+			flat.transformation = node->transformation;
+			flat.offsetMatrix = glm::mat4(1.f);
+			flat.parent = parent;
+			flat.channel = -1;
+			flat.boneIndex = -1;
+
+			auto channel = channels.find(node->name);
+			if (channel != channels.end())
+			{
+				flat.channel = channel->second;
+			}
+
+			auto boneData = mBoneDataMap.find(node->name);
+			if (boneData != mBoneDataMap.end() && boneData->second.id >= 0 && boneData->second.id < MAX_BONES)
+			{
+				flat.boneIndex = boneData->second.id;
+				flat.offsetMatrix = boneData->second.offsetMatrix;
+			}
+
+			int index = static_cast<int>(mNodes.size());
+			mNodes.push_back(flat);
+
+			// pushed in reverse so children keep their original order
+			for (auto child = node->children.rbegin(); child != node->children.rend(); ++child)
+			{
+				stack.emplace_back(&*child, index);
+			}
+		}
+	}
+
+	namespace
+	{
+		// compact clip layout, written by the asset compiler's AnimationImporter
+		constexpr char ClipMagic[4] = { 'B', 'A', 'N', 'M' };
+		constexpr uint32_t ClipVersion = 2;
+
+		template <typename T>
+		void Read(std::istream& inText, T& value)
+		{
+			inText.read(reinterpret_cast<char*>(&value), sizeof(T));
+		}
+
+		/*!***********************************************************************
+			\brief
+				Rebuilds a quaternion packed as its three smallest components,
+				see PackQuat in the asset compiler
+		*************************************************************************/
+		glm::quat UnpackQuat(std::array<uint16_t, 3> const& packed)
+		{
+			constexpr float range = 0.70710678f;
+			int largest = ((packed[0] >> 15) << 1) | (packed[1] >> 15);
+
+			float components[4];
+			float sumOfSquares = 0.f;
+			for (int i = 0, j = 0; i < 4; ++i)
+			{
+				if (i == largest) continue;
+				float normalized = static_cast<float>(packed[j++] & 0x7FFF) / 32767.f;
+				components[i] = (normalized * 2.f - 1.f) * range;
+				sumOfSquares += components[i] * components[i];
+			}
+			components[largest] = std::sqrt(std::max(0.f, 1.f - sumOfSquares));
+
+			return glm::normalize(glm::quat(components[3], components[0], components[1], components[2]));
+		}
+
+		/*!***********************************************************************
+			\brief
+				Reads the bones of a compact clip. Keys are stored as frame
+				numbers on a uniform grid and rotations are quantized, both are
+				expanded back to the runtime key layout.
+			\return
+				False if the stream does not start with a compact clip header,
+				the stream position is then undefined
+		*************************************************************************/
+		bool LoadCompactClip(std::istream& inText, Animation& anim)
+		{
+			char magic[4]{};
+			inText.read(magic, sizeof(magic));
+			if (inText.gcount() != sizeof(magic) || !std::equal(magic, magic + sizeof(magic), ClipMagic))
+			{
+				return false;
+			}
+
+			uint32_t version;
+			Read(inText, version);
+			if (version != ClipVersion)
+			{
+				BOREALIS_CORE_ERROR("Unsupported animation clip version {}", version);
+				return false;
+			}
+
+			float frameStep;
+			Read(inText, anim.mDuration);
+			Read(inText, anim.mTicksPerSecond);
+			Read(inText, frameStep);
+
+			auto frameTime = [&](uint16_t frame) { return std::min(static_cast<float>(frame) * frameStep, anim.mDuration); };
+
+			uint32_t boneCount;
+			Read(inText, boneCount);
+			anim.mBones.resize(boneCount);
+
+			for (Bone& bone : anim.mBones)
+			{
+				uint32_t nameLength;
+				Read(inText, nameLength);
+				bone.mName.resize(nameLength);
+				inText.read(bone.mName.data(), nameLength);
+				Read(inText, bone.mId);
+
+				uint32_t numPositions, numRotations, numScalings;
+				Read(inText, numPositions);
+				Read(inText, numRotations);
+				Read(inText, numScalings);
+				bone.mNumPositions = static_cast<int>(numPositions);
+				bone.mNumRotations = static_cast<int>(numRotations);
+				bone.mNumScalings = static_cast<int>(numScalings);
+
+				uint16_t frame;
+				bone.mPositions.resize(numPositions);
+				for (KeyPosition& pos : bone.mPositions)
+				{
+					Read(inText, frame);
+					Read(inText, pos.position);
+					pos.timeStamp = frameTime(frame);
+				}
+
+				std::array<uint16_t, 3> packed;
+				bone.mRotations.resize(numRotations);
+				for (KeyRotation& rot : bone.mRotations)
+				{
+					Read(inText, frame);
+					Read(inText, packed);
+					rot.orientation = UnpackQuat(packed);
+					rot.timeStamp = frameTime(frame);
+				}
+
+				bone.mScales.resize(numScalings);
+				for (KeyScale& scale : bone.mScales)
+				{
+					Read(inText, frame);
+					Read(inText, scale.scale);
+					scale.timeStamp = frameTime(frame);
+				}
+			}
+
+			return true;
+		}
+	}
+
+	void LoadAssimpNodeData(std::istream& inFile, AssimpNodeData& node) 
 	{
 		// Read transformation matrix
 		inFile.read(reinterpret_cast<char*>(&node.transformation), sizeof(node.transformation));
@@ -43,102 +220,89 @@ namespace Borealis
 	void Animation::LoadAnimation(std::filesystem::path const& path)
 	{
 		
-		std::stringstream inText;
-		if (AssetManager::IsPakLoaded())
-		{
-			try
-			// concat to the last path
-			{
-				std::string subPath = path.filename().string();
-				uint64_t id = std::stoull(subPath);
-				char* buffer;
-				uint64_t size;
-				AssetManager::RetrieveFromPak(id, buffer, size);
-				inText.write(buffer, size);
-				delete[] buffer;
-			}
-
-			catch (const std::exception&) {
-				std::ifstream inFile(path, std::ios::binary);
-				inFile >> inText.rdbuf();
-				if (!inFile.is_open())
-				{
-					BOREALIS_CORE_ASSERT(!inFile.is_open(), "File Not found");
-					return;
-				}
-				inFile.close();
-			}
-		}
-		else
+		// Parse the pak asset in place, or stream from disk when the pak does not hold it
+		PakAsset pakAsset = AssetManager::ReadFromPak(path);
+		MemoryStreamBuffer pakBuffer(pakAsset.View());
+		std::ifstream inFile;
+		std::istream inText(&pakBuffer);
+		if (pakBuffer.empty())
 		{
-			std::ifstream inFile(path, std::ios::binary);
-			inFile >> inText.rdbuf();
+			inFile.open(path, std::ios::binary);
 			if (!inFile.is_open())
 			{
 				BOREALIS_CORE_ASSERT(!inFile.is_open(), "File Not found");
 				return;
 			}
-			inFile.close();
+			inText.rdbuf(inFile.rdbuf());
 		}
 
 
 		
 		
 
-		// Load mDuration
-		inText.read(reinterpret_cast<char*>(&mDuration), sizeof(mDuration));
+		if (!LoadCompactClip(inText, *this))
+		{
+			// legacy layout, written before clips were compressed
+			inText.clear();
+			inText.seekg(0);
 
-		// Load mTicksPerSecond
-		inText.read(reinterpret_cast<char*>(&mTicksPerSecond), sizeof(mTicksPerSecond));
+			// Load mDuration
+			inText.read(reinterpret_cast<char*>(&mDuration), sizeof(mDuration));
 
-		// Load the number of bones
-		uint32_t boneCount;
-		inText.read(reinterpret_cast<char*>(&boneCount), sizeof(boneCount));
-		mBones.resize(boneCount);
+			// Load mTicksPerSecond
+			inText.read(reinterpret_cast<char*>(&mTicksPerSecond), sizeof(mTicksPerSecond));
 
-		for (Bone& bone : mBones) 
-		{
-			// Load the length of the name and then the name itself
-			uint32_t nameLength;
-			inText.read(reinterpret_cast<char*>(&nameLength), sizeof(nameLength));
-			bone.mName.resize(nameLength);
-			inText.read(&bone.mName[0], nameLength);
-
-			// Load bone ID
-			inText.read(reinterpret_cast<char*>(&bone.mId), sizeof(bone.mId));
-
-			// Load the number of keyframes for positions, rotations, and scales
-			inText.read(reinterpret_cast<char*>(&bone.mNumPositions), sizeof(bone.mNumPositions));
-			inText.read(reinterpret_cast<char*>(&bone.mNumRotations), sizeof(bone.mNumRotations));
-			inText.read(reinterpret_cast<char*>(&bone.mNumScalings), sizeof(bone.mNumScalings));
-
-			// Load all position keyframes
-			bone.mPositions.resize(bone.mNumPositions);
-			for (KeyPosition& pos : bone.mPositions) 
-			{
-				inText.read(reinterpret_cast<char*>(&pos.position), sizeof(pos.position));
-				inText.read(reinterpret_cast<char*>(&pos.timeStamp), sizeof(pos.timeStamp));
-			}
+			// Load the number of bones
+			uint32_t boneCount;
+			inText.read(reinterpret_cast<char*>(&boneCount), sizeof(boneCount));
+			mBones.resize(boneCount);
 
-			// Load all rotation keyframes
-			bone.mRotations.resize(bone.mNumRotations);
-			for (KeyRotation& rot : bone.mRotations) 
+			for (Bone& bone : mBones) 
 			{
-				inText.read(reinterpret_cast<char*>(&rot.orientation), sizeof(rot.orientation));
-				inText.read(reinterpret_cast<char*>(&rot.timeStamp), sizeof(rot.timeStamp));
-			}
+				// Load the length of the name and then the name itself
+				uint32_t nameLength;
+				inText.read(reinterpret_cast<char*>(&nameLength), sizeof(nameLength));
+				bone.mName.resize(nameLength);
+				inText.read(&bone.mName[0], nameLength);
+
+				// Load bone ID
+				inText.read(reinterpret_cast<char*>(&bone.mId), sizeof(bone.mId));
+
+				// Load the number of keyframes for positions, rotations, and scales
+				inText.read(reinterpret_cast<char*>(&bone.mNumPositions), sizeof(bone.mNumPositions));
+				inText.read(reinterpret_cast<char*>(&bone.mNumRotations), sizeof(bone.mNumRotations));
+				inText.read(reinterpret_cast<char*>(&bone.mNumScalings), sizeof(bone.mNumScalings));
+
+				// Load all position keyframes
+				bone.mPositions.resize(bone.mNumPositions);
+				for (KeyPosition& pos : bone.mPositions) 
+				{
+					inText.read(reinterpret_cast<char*>(&pos.position), sizeof(pos.position));
+					inText.read(reinterpret_cast<char*>(&pos.timeStamp), sizeof(pos.timeStamp));
+				}
 
-			// Load all scale keyframes
-			bone.mScales.resize(bone.mNumScalings);
-			for (KeyScale& scale : bone.mScales) 
-			{
-				inText.read(reinterpret_cast<char*>(&scale.scale), sizeof(scale.scale));
-				inText.read(reinterpret_cast<char*>(&scale.timeStamp), sizeof(scale.timeStamp));
+				// Load all rotation keyframes
+				bone.mRotations.resize(bone.mNumRotations);
+				for (KeyRotation& rot : bone.mRotations) 
+				{
+					inText.read(reinterpret_cast<char*>(&rot.orientation), sizeof(rot.orientation));
+					inText.read(reinterpret_cast<char*>(&rot.timeStamp), sizeof(rot.timeStamp));
+				}
+
+				// Load all scale keyframes
+				bone.mScales.resize(bone.mNumScalings);
+				for (KeyScale& scale : bone.mScales) 
+				{
+					inText.read(reinterpret_cast<char*>(&scale.scale), sizeof(scale.scale));
+					inText.read(reinterpret_cast<char*>(&scale.timeStamp), sizeof(scale.timeStamp));
+				}
 			}
 		}
 
 		// Load AssimpNodeData structure (root node of the hierarchy)
 		LoadAssimpNodeData(inText, mRootNode);
+
+		BuildNodeTable();
 	}
 
 	void SaveAssimpNodeData(std::ofstream& outFile, const AssimpNodeData& node) {
@@ -240,6 +404,18 @@ namespace Borealis
 
 		newAsset->swap(*asset);
 	}
+	uint64_t Animation::GetMemorySize() const
+	{
+		// The source hierarchy is left out, it is only walked to build the node table
+		uint64_t bytes = sizeof(Animation) + mNodes.size() * sizeof(AnimationNode) + mBoneDataMap.size() * sizeof(BoneData);
+		for (Bone const& bone : mBones)
+		{
+			bytes += sizeof(Bone) + bone.mPositions.size() * sizeof(KeyPosition) +
+				bone.mRotations.size() * sizeof(KeyRotation) + bone.mScales.size() * sizeof(KeyScale);
+		}
+		return bytes;
+	}
+
 	void Animation::swap(Asset& other)
 	{
 		Animation& o = static_cast<Animation&>(other);
@@ -248,5 +424,6 @@ namespace Borealis
 		std::swap(mBones, o.mBones);
 		std::swap(mRootNode, o.mRootNode);
 		std::swap(mBoneDataMap, o.mBoneDataMap);
+		std::swap(mNodes, o.mNodes);
 	}
 }
\ No newline at end of file
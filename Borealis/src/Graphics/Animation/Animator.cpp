@@ -3,8 +3,6 @@
 
 namespace Borealis
 {
-	#define MAX_BONES 128
-
 	void DecomposeMatrix(const glm::mat4& matrix, glm::vec3& position, glm::quat& rotation, glm::vec3& scale)
 	{
 		// Extract translation
@@ -48,165 +46,200 @@ namespace Borealis
 
 	void Animator::UpdateAnimation(float dt)
 	{
+		if (AdvanceTime(dt))
+		{
+			SamplePose();
+			BlendPose();
+			LocalToModel();
+			BuildPalette();
+		}
+	}
+
+	bool Animator::AdvanceTime(float dt)
+	{
+		mPoseBase = nullptr;
+		mPoseLayer = nullptr;
+
 		if (mPlayed && mLoop)
 		{
 			mCurrentTime = fmod(mCurrentTime, mCurrentAnimation->mDuration);
 			mPlayed = false;
 		}
 
-		if (mCurrentAnimation && !mPlayed)
+		if (!mCurrentAnimation || mPlayed)
 		{
-			if (!mNextAnimation) // temp
+			return false;
+		}
+
+		if (!mNextAnimation) // temp
+		{
+			mCurrentTime += mCurrentAnimation->mTicksPerSecond * dt * mSpeed;
+
+			if (mLoop)
+			{
+				mCurrentTime = fmod(mCurrentTime, mCurrentAnimation->mDuration);
+			}
+			else if (mCurrentTime >= mCurrentAnimation->mDuration)
 			{
-				mCurrentTime += mCurrentAnimation->mTicksPerSecond * dt * mSpeed;
-
-				if (mLoop)
-				{
-					mCurrentTime = fmod(mCurrentTime, mCurrentAnimation->mDuration);
-				}
-				else if (mCurrentTime >= mCurrentAnimation->mDuration)
-				{
-					mCurrentTime = mCurrentAnimation->mDuration;
-					mPlayed = true;
-				}
-
-				if (!mPlayed)
-				{
-					CalculateBoneTransform(&mCurrentAnimation->mRootNode, glm::mat4(1.0f));
-				}
-			} else
+				mCurrentTime = mCurrentAnimation->mDuration;
+				mPlayed = true;
+			}
+
+			if (mPlayed)
 			{
-				BlendTwoAnimations(mCurrentAnimation, mNextAnimation, mBlendFactor, dt);
+				return false;
 			}
+
+			mPoseBase = mCurrentAnimation.get();
+			mPoseBaseTime = mCurrentTime;
+			return true;
 		}
-	}
 
-	bool Animator::HasAnimation()
-	{
-		return mCurrentAnimation ? true : false;
-	}
+		Animation const& baseAnimation = *mCurrentAnimation;
+		Animation const& layerAnimation = *mNextAnimation;
 
-	void Animator::PlayAnimation(Ref<Animation> animation)
-	{
-		mCurrentAnimation = animation;
-		mCurrentTime = 0.0f;
-		mPlayed = false;
-	}
+		float a = 1.f;
+		float b = baseAnimation.GetDuration() / layerAnimation.GetDuration();
+		float animSpeedMultiplierUp = (1.f - mBlendFactor) * a + b * mBlendFactor;
 
-	void Animator::CalculateBoneTransform(const AssimpNodeData* node, glm::mat4 parentTransform)
-	{
-		std::string nodeName = node->name;
-		glm::mat4 nodeTransform = node->transformation;
+		a = layerAnimation.GetDuration() / baseAnimation.GetDuration();
+		b = 1.f;
+		float animSpeedMultiplierDown = (1.f - mBlendFactor) * a + b * mBlendFactor;
 
-		Bone* Bone = mCurrentAnimation->FindBone(nodeName);
+		mCurrentTimeBase += baseAnimation.GetTicksPerSecond() * dt * mSpeed * animSpeedMultiplierUp;
+		mCurrentTimeLayer += layerAnimation.GetTicksPerSecond() * dt * mSpeed * animSpeedMultiplierDown;
 
-		if (Bone)
+		bool basePlayed = false;
+		bool layerPlayed = false;
+
+		if (mLoop)
 		{
-			Bone->Update(mCurrentTime);
-			nodeTransform = Bone->GetLocalTransform();
+			mCurrentTimeBase = fmod(mCurrentTimeBase, baseAnimation.GetDuration());
+		}
+		else if (mCurrentTimeBase >= baseAnimation.GetDuration())
+		{
+			mCurrentTimeBase = baseAnimation.GetDuration();
+			basePlayed = true;
 		}
 
-		glm::mat4 globalTransformation = parentTransform * nodeTransform;
-
-		auto boneInfoMap = mCurrentAnimation->mBoneDataMap;
-		if (boneInfoMap.find(nodeName) != boneInfoMap.end())
+		if (mLoop)
 		{
-			int index = boneInfoMap[nodeName].id;
-			glm::mat4 offset = boneInfoMap[nodeName].offsetMatrix;
-			mFinalBoneMatrices[index] = globalTransformation * offset;
+			mCurrentTimeLayer = fmod(mCurrentTimeLayer, layerAnimation.GetDuration());
+		}
+		else if (mCurrentTimeLayer >= layerAnimation.GetDuration())
+		{
+			mCurrentTimeLayer = layerAnimation.GetDuration();
+			layerPlayed = true;
 		}
 
-		for (int i = 0; i < node->childrenCount; i++)
+		if (basePlayed && layerPlayed)
 		{
-			CalculateBoneTransform(&node->children[i], globalTransformation);
+			return false;
 		}
+
+		BOREALIS_CORE_ASSERT(baseAnimation.GetNodes().size() == layerAnimation.GetNodes().size(), "Blended animations have different hierarchies");
+		mPoseBase = &baseAnimation;
+		mPoseLayer = &layerAnimation;
+		mPoseBaseTime = mCurrentTimeBase;
+		mPoseLayerTime = mCurrentTimeLayer;
+		mPoseBlend = mBlendFactor;
+		return true;
 	}
 
-	void Animator::CalculateBlendedBoneTransform(Ref<Animation> animationBase, AssimpNodeData const* node, Ref<Animation> animationLayer, AssimpNodeData const* nodeLayer, float currentTimeBase, float currentTimeLayer, glm::mat4 const& parentTransform, float blendFactor)
+	void Animator::SamplePose()
 	{
-		std::string nodeName = node->name;
-		glm::mat4 nodeTransform = node->transformation;
+		if (!mPoseBase) return;
 
-		Bone* bone = animationBase->FindBone(nodeName);
-		if (bone)
+		std::vector<AnimationNode> const& nodes = mPoseBase->GetNodes();
+		if (mLocalTransforms.size() < nodes.size())
 		{
-			bone->Update(currentTimeBase);
-			nodeTransform = bone->GetLocalTransform();
+			mLocalTransforms.resize(nodes.size());
+			mGlobalTransforms.resize(nodes.size());
 		}
-
-		glm::mat4 layerNodeTransform = nodeLayer->transformation;
-		bone = animationLayer->FindBone(nodeName);
-		if (bone)
+		if (mCursors.size() < mPoseBase->mBones.size())
 		{
-			bone->Update(currentTimeLayer);
-			layerNodeTransform = bone->GetLocalTransform();
+			mCursors.resize(mPoseBase->mBones.size());
 		}
 
-		glm::quat rot0 = glm::quat_cast(nodeTransform);
-		glm::quat rot1 = glm::quat_cast(layerNodeTransform);
-		glm::quat finalRot = glm::slerp(rot0, rot1, blendFactor);
-		glm::mat4 blendedMat = glm::mat4_cast(finalRot);
-		blendedMat[3] = (1.f - blendFactor) * nodeTransform[3] + layerNodeTransform[3] * blendFactor;
+		for (size_t i = 0; i < nodes.size(); ++i)
+		{
+			AnimationNode const& node = nodes[i];
+			mLocalTransforms[i] = node.channel >= 0
+				? mPoseBase->mBones[node.channel].Sample(mPoseBaseTime, mCursors[node.channel])
+				: node.transformation;
+		}
 
-		glm::mat4 globalTransformation = parentTransform * blendedMat;
+		if (!mPoseLayer) return;
 
-		auto const& boneDataMap = animationBase->GetBoneDataMap();
-		if (boneDataMap.find(nodeName) != boneDataMap.end())
+		std::vector<AnimationNode> const& layerNodes = mPoseLayer->GetNodes();
+		if (mLayerLocalTransforms.size() < nodes.size())
+		{
+			mLayerLocalTransforms.resize(nodes.size());
+		}
+		if (mLayerCursors.size() < mPoseLayer->mBones.size())
 		{
-			int index = boneDataMap.at(nodeName).id;
-			glm::mat4 offset = boneDataMap.at(nodeName).offsetMatrix;
-			mFinalBoneMatrices[index] = globalTransformation * offset;
+			mLayerCursors.resize(mPoseLayer->mBones.size());
 		}
 
-		for (int i = 0; i < node->children.size(); i++)
+		for (size_t i = 0; i < nodes.size(); ++i)
 		{
-			CalculateBlendedBoneTransform(animationBase, &node->children[i], 
-				animationLayer, &nodeLayer->children[i], 
-				currentTimeBase, currentTimeLayer, globalTransformation, blendFactor);
+			glm::mat4 layerNodeTransform = nodes[i].transformation;
+			if (i < layerNodes.size())
+			{
+				AnimationNode const& layerNode = layerNodes[i];
+				layerNodeTransform = layerNode.channel >= 0
+					? mPoseLayer->mBones[layerNode.channel].Sample(mPoseLayerTime, mLayerCursors[layerNode.channel])
+					: layerNode.transformation;
+			}
+			mLayerLocalTransforms[i] = layerNodeTransform;
 		}
 	}
 
-	void Animator::BlendTwoAnimations(Ref<Animation> baseAnimation, Ref<Animation> layerAnimation, float blendFactor, float dt)
+	void Animator::BlendPose()
 	{
-		float a = 1.f;
-		float b = baseAnimation->GetDuration() / layerAnimation->GetDuration();
-		float animSpeedMultiplierUp = (1.f - blendFactor) * a + b * blendFactor;
-
-		a = layerAnimation->GetDuration() / baseAnimation->GetDuration();
-		b = 1.f;
-		float animSpeedMultiplierDown = (1.f - blendFactor) * a + b * blendFactor;
-
-		mCurrentTimeBase += baseAnimation->GetTicksPerSecond() * dt * mSpeed * animSpeedMultiplierUp;
-		mCurrentTimeLayer += layerAnimation->GetTicksPerSecond() * dt * mSpeed * animSpeedMultiplierDown;
-
-		bool basePlayed = false;
-		bool layerPlayed = false;
+		if (!mPoseBase || !mPoseLayer) return;
 
-		if (mLoop)
-		{
-			mCurrentTimeBase = fmod(mCurrentTimeBase, baseAnimation->GetDuration());
-		}
-		else if (mCurrentTimeBase >= baseAnimation->GetDuration())
+		// Nodes are paired by index since both animations share the skeleton hierarchy
+		size_t nodeCount = mPoseBase->GetNodes().size();
+		for (size_t i = 0; i < nodeCount; ++i)
 		{
-			mCurrentTimeBase = baseAnimation->GetDuration();
-			basePlayed = true;
+			glm::mat4 const& nodeTransform = mLocalTransforms[i];
+			glm::mat4 const& layerNodeTransform = mLayerLocalTransforms[i];
+
+			glm::quat rot0 = glm::quat_cast(nodeTransform);
+			glm::quat rot1 = glm::quat_cast(layerNodeTransform);
+			glm::quat finalRot = glm::slerp(rot0, rot1, mPoseBlend);
+			glm::mat4 blendedMat = glm::mat4_cast(finalRot);
+			blendedMat[3] = (1.f - mPoseBlend) * nodeTransform[3] + layerNodeTransform[3] * mPoseBlend;
+			mLocalTransforms[i] = blendedMat;
 		}
+	}
 
-		if (mLoop)
-		{
-			mCurrentTimeLayer = fmod(mCurrentTimeLayer, layerAnimation->GetDuration());
-		}
-		else if (mCurrentTimeLayer >= layerAnimation->GetDuration())
+	void Animator::LocalToModel()
+	{
+		if (!mPoseBase) return;
+
+		// Parents come before their children in the node table
+		std::vector<AnimationNode> const& nodes = mPoseBase->GetNodes();
+		for (size_t i = 0; i < nodes.size(); ++i)
 		{
-			mCurrentTimeLayer = layerAnimation->GetDuration();
-			layerPlayed = true;
+			int parent = nodes[i].parent;
+			mGlobalTransforms[i] = parent >= 0 ? mGlobalTransforms[parent] * mLocalTransforms[i] : mLocalTransforms[i];
 		}
+	}
 
-		if (!(basePlayed && layerPlayed))
+	void Animator::BuildPalette()
+	{
+		if (!mPoseBase) return;
+
+		std::vector<AnimationNode> const& nodes = mPoseBase->GetNodes();
+		for (size_t i = 0; i < nodes.size(); ++i)
 		{
-			CalculateBlendedBoneTransform(baseAnimation, &baseAnimation->GetRootNode(),
-				layerAnimation, &layerAnimation->GetRootNode(),
-				mCurrentTimeBase, mCurrentTimeLayer, glm::mat4(1.f), blendFactor);
+			AnimationNode const& node = nodes[i];
+			if (node.boneIndex >= 0)
+			{
+				mFinalBoneMatrices[node.boneIndex] = mGlobalTransforms[i] * node.offsetMatrix;
+			}
 		}
 	}
 
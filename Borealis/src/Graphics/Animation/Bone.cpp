@@ -14,48 +14,81 @@ namespace Borealis
 		mNumScalings =  (int)scale.size();
 	}
 
+	namespace
+	{
+		/*!***********************************************************************
+			\brief
+				Finds the key k with keys[k] <= animationTime < keys[k + 1]. The
+				cursor is checked first, then the key after it, since playback
+				moves forward a little each frame. Anything else is a seek or a
+				loop and falls back to a binary search.
+		*************************************************************************/
+		template <typename Key>
+		int FindKey(std::vector<Key> const& keys, float animationTime, int& cursor)
+		{
+			int const last = static_cast<int>(keys.size()) - 2;
+
+			if (cursor >= 0 && cursor <= last && keys[cursor].timeStamp <= animationTime)
+			{
+				if (animationTime < keys[cursor + 1].timeStamp)
+					return cursor;
+
+				if (cursor + 1 <= last && animationTime < keys[cursor + 2].timeStamp)
+					return ++cursor;
+			}
+
+			auto next = std::upper_bound(keys.begin(), keys.end(), animationTime,
+				[](float time, Key const& key) { return time < key.timeStamp; });
+			cursor = std::clamp(static_cast<int>(next - keys.begin()) - 1, 0, last);
+			return cursor;
+		}
+	}
+
 	void Bone::Update(float animationTime)
 	{
-		glm::mat4 translation = InterpolatePosition(animationTime);
-		glm::mat4 rotation = InterpolateRotation(animationTime);
-		glm::mat4 scale = InterpolateScaling(animationTime);
-		mLocalTransform = translation * rotation * scale;
+		mLocalTransform = Sample(animationTime);
 	}
 
-	int Bone::GetPositionIndex(float animationTime)
+	glm::mat4 Bone::Sample(float animationTime) const
 	{
-		for (int i{}; i < mNumPositions - 1; ++i)
-		{
-			if (animationTime < mPositions[i + 1].timeStamp)
-				return i;
-		}
-		BOREALIS_CORE_ASSERT(false, "Failed to find position");
-		return -1;
+		BoneCursor cursor{ -1, -1, -1 };
+		return Sample(animationTime, cursor);
 	}
 
-	int Bone::GetRotationIndex(float animationTime)
+	glm::mat4 Bone::Sample(float animationTime, BoneCursor& cursor) const
 	{
-		for (int i{}; i < mNumRotations - 1; ++i)
-		{
-			if (animationTime < mRotations[i + 1].timeStamp)
-				return i;
-		}
-		BOREALIS_CORE_ASSERT(false, "Failed to find rotation");
-		return -1;
+		glm::vec3 position = InterpolatePosition(animationTime, cursor.position);
+		glm::quat rotation = InterpolateRotation(animationTime, cursor.rotation);
+		glm::vec3 scale = InterpolateScaling(animationTime, cursor.scale);
+
+		// translation * rotation * scale, built directly instead of multiplying three matrices
+		glm::mat4 local = glm::mat4_cast(rotation);
+		local[0] *= scale.x;
+		local[1] *= scale.y;
+		local[2] *= scale.z;
+		local[3] = glm::vec4(position, 1.f);
+		return local;
 	}
 
-	int Bone::GetScaleIndex(float animationTime)
+	int Bone::GetPositionIndex(float animationTime) const
 	{
-		for (int i{}; i < mNumScalings - 1; ++i)
-		{
-			if (animationTime < mScales[i + 1].timeStamp)
-				return i;
-		}
-		BOREALIS_CORE_ASSERT(false, "Failed to find scale");
-		return -1;
+		int cursor = -1;
+		return FindKey(mPositions, animationTime, cursor);
+	}
+
+	int Bone::GetRotationIndex(float animationTime) const
+	{
+		int cursor = -1;
+		return FindKey(mRotations, animationTime, cursor);
+	}
+
+	int Bone::GetScaleIndex(float animationTime) const
+	{
+		int cursor = -1;
+		return FindKey(mScales, animationTime, cursor);
 	}
 
-	float Bone::GetScaleFactor(float lastTimeStamp, float nextTimeStamp, float animationTime)
+	float Bone::GetScaleFactor(float lastTimeStamp, float nextTimeStamp, float animationTime) const
 	{
 		float scaleFactor = 0.0f;
 		float midWayLength = animationTime - lastTimeStamp;
@@ -64,52 +97,44 @@ namespace Borealis
 		return scaleFactor;
 	}
 
-	glm::mat4 Bone::InterpolatePosition(float animationTime)
+	glm::vec3 Bone::InterpolatePosition(float animationTime, int& cursor) const
 	{
 		if (1 == mNumPositions)
-			return glm::translate(glm::mat4(1.0f), mPositions[0].position);
+			return mPositions[0].position;
 
-		int p0Index = GetPositionIndex(animationTime);
+		int p0Index = FindKey(mPositions, animationTime, cursor);
 		int p1Index = p0Index + 1;
 		float scaleFactor = GetScaleFactor(mPositions[p0Index].timeStamp,
 			mPositions[p1Index].timeStamp, animationTime);
-		glm::vec3 finalPosition = glm::mix(mPositions[p0Index].position, mPositions[p1Index].position
+		return glm::mix(mPositions[p0Index].position, mPositions[p1Index].position
 			, scaleFactor);
-		return glm::translate(glm::mat4(1.0f), finalPosition);
 	}
 
-	glm::mat4 Bone::InterpolateRotation(float animationTime)
+	glm::quat Bone::InterpolateRotation(float animationTime, int& cursor) const
 	{
 		if (1 == mNumRotations)
-		{
-			auto rotation = glm::normalize(mRotations[0].orientation);
-			return glm::toMat4(rotation);
-		}
+			return glm::normalize(mRotations[0].orientation);
 
-		int p0Index = GetRotationIndex(animationTime);
+		int p0Index = FindKey(mRotations, animationTime, cursor);
 		int p1Index = p0Index + 1;
 		float scaleFactor = GetScaleFactor(mRotations[p0Index].timeStamp,
 			mRotations[p1Index].timeStamp, animationTime);
 		glm::quat finalRotation = glm::slerp(mRotations[p0Index].orientation, mRotations[p1Index].orientation
 			, scaleFactor);
-		finalRotation = glm::normalize(finalRotation);
-		return glm::toMat4(finalRotation);
-
+		return glm::normalize(finalRotation);
 	}
 
-	glm::mat4 Bone::InterpolateScaling(float animationTime)
+	glm::vec3 Bone::InterpolateScaling(float animationTime, int& cursor) const
 	{
 		if (1 == mNumScalings)
-			return glm::scale(glm::mat4(1.0f), mScales[0].scale);
+			return mScales[0].scale;
 
-		int p0Index = GetScaleIndex(animationTime);
+		int p0Index = FindKey(mScales, animationTime, cursor);
 		int p1Index = p0Index + 1;
 		float scaleFactor = GetScaleFactor(mScales[p0Index].timeStamp,
 			mScales[p1Index].timeStamp, animationTime);
-		glm::vec3 finalScale = glm::mix(mScales[p0Index].scale, mScales[p1Index].scale
+		return glm::mix(mScales[p0Index].scale, mScales[p1Index].scale
 			, scaleFactor);
-		return glm::scale(glm::mat4(1.0f), finalScale);
 	}
 
-}
-
+}
\ No newline at end of file
@@ -0,0 +1,632 @@
+/******************************************************************************
+/*!
+\file       BoundingVolumeHierarchy.cpp
+\author     Chan Guo Geng Gordon
+\par        email: g.chan/@digipen.edu
+\date       October 17, 2026
+\brief      Defines the dynamic AABB tree used for culling scene renderables
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#include <BorealisPCH.hpp>
+
+#include <Graphics/BoundingVolumeHierarchy.hpp>
+#include <Scene/Components.hpp>
+
+namespace Borealis
+{
+	static AABB Combine(AABB const& a, AABB const& b)
+	{
+		return { glm::min(a.minExtent, b.minExtent), glm::max(a.maxExtent, b.maxExtent) };
+	}
+
+	static float SurfaceArea(AABB const& aabb)
+	{
+		glm::vec3 d = aabb.maxExtent - aabb.minExtent;
+		return 2.f * (d.x * d.y + d.y * d.z + d.z * d.x);
+	}
+
+	static bool Contains(AABB const& outer, AABB const& inner)
+	{
+		return glm::all(glm::lessThanEqual(outer.minExtent, inner.minExtent)) &&
+			glm::all(glm::greaterThanEqual(outer.maxExtent, inner.maxExtent));
+	}
+
+	static bool Overlaps(AABB const& a, AABB const& b)
+	{
+		return glm::all(glm::lessThanEqual(a.minExtent, b.maxExtent)) &&
+			glm::all(glm::greaterThanEqual(a.maxExtent, b.minExtent));
+	}
+
+	static bool Overlaps(AABB const& aabb, BoundingSphere const& sphere)
+	{
+		glm::vec3 closest = glm::clamp(sphere.Center, aabb.minExtent, aabb.maxExtent);
+		glm::vec3 d = closest - sphere.Center;
+		return glm::dot(d, d) <= sphere.Radius * sphere.Radius;
+	}
+
+	BoundingVolumeHierarchy::BoundingVolumeHierarchy(float margin) : mMargin(margin)
+	{
+	}
+
+	int32_t BoundingVolumeHierarchy::AllocateNode()
+	{
+		if (mFreeList == NullNode)
+		{
+			mNodes.push_back({});
+			mNodes.back().height = -1;
+			mNodes.back().parent = NullNode;
+			mFreeList = static_cast<int32_t>(mNodes.size()) - 1;
+		}
+
+		int32_t node = mFreeList;
+		mFreeList = mNodes[node].parent;
+		mNodes[node].parent = NullNode;
+		mNodes[node].child1 = NullNode;
+		mNodes[node].child2 = NullNode;
+		mNodes[node].height = 0;
+		mNodes[node].userData = 0;
+		return node;
+	}
+
+	void BoundingVolumeHierarchy::FreeNode(int32_t node)
+	{
+		mNodes[node].parent = mFreeList;
+		mNodes[node].height = -1;
+		mFreeList = node;
+	}
+
+	int32_t BoundingVolumeHierarchy::Insert(AABB const& aabb, uint32_t userData)
+	{
+		int32_t proxy = AllocateNode();
+		mNodes[proxy].aabb = { aabb.minExtent - glm::vec3(mMargin), aabb.maxExtent + glm::vec3(mMargin) };
+		mNodes[proxy].userData = userData;
+		InsertLeaf(proxy);
+		++mProxyCount;
+		return proxy;
+	}
+
+	void BoundingVolumeHierarchy::Remove(int32_t proxy)
+	{
+		RemoveLeaf(proxy);
+		FreeNode(proxy);
+		--mProxyCount;
+	}
+
+	bool BoundingVolumeHierarchy::Move(int32_t proxy, AABB const& aabb)
+	{
+		if (Contains(mNodes[proxy].aabb, aabb))
+		{
+			return false;
+		}
+
+		RemoveLeaf(proxy);
+		mNodes[proxy].aabb = { aabb.minExtent - glm::vec3(mMargin), aabb.maxExtent + glm::vec3(mMargin) };
+		InsertLeaf(proxy);
+		return true;
+	}
+
+	void BoundingVolumeHierarchy::Clear()
+	{
+		mNodes.clear();
+		mRoot = NullNode;
+		mFreeList = NullNode;
+		mProxyCount = 0;
+	}
+
+	void BoundingVolumeHierarchy::InsertLeaf(int32_t leaf)
+	{
+		if (mRoot == NullNode)
+		{
+			mRoot = leaf;
+			mNodes[mRoot].parent = NullNode;
+			return;
+		}
+
+		// Walk down picking the child with the cheapest surface area increase
+		AABB leafAABB = mNodes[leaf].aabb;
+		int32_t index = mRoot;
+		while (!mNodes[index].IsLeaf())
+		{
+			int32_t child1 = mNodes[index].child1;
+			int32_t child2 = mNodes[index].child2;
+
+			float area = SurfaceArea(mNodes[index].aabb);
+			float combinedArea = SurfaceArea(Combine(mNodes[index].aabb, leafAABB));
+
+			float cost = 2.f * combinedArea;
+			float inheritanceCost = 2.f * (combinedArea - area);
+
+			auto childCost = [&](int32_t child)
+				{
+					float newArea = SurfaceArea(Combine(leafAABB, mNodes[child].aabb));
+					if (mNodes[child].IsLeaf())
+						return newArea + inheritanceCost;
+					return newArea - SurfaceArea(mNodes[child].aabb) + inheritanceCost;
+				};
+
+			float cost1 = childCost(child1);
+			float cost2 = childCost(child2);
+
+			if (cost < cost1 && cost < cost2)
+				break;
+
+			index = cost1 < cost2 ? child1 : child2;
+		}
+
+		int32_t sibling = index;
+		int32_t oldParent = mNodes[sibling].parent;
+		int32_t newParent = AllocateNode();
+		mNodes[newParent].parent = oldParent;
+		mNodes[newParent].aabb = Combine(leafAABB, mNodes[sibling].aabb);
+		mNodes[newParent].height = mNodes[sibling].height + 1;
+		mNodes[newParent].child1 = sibling;
+		mNodes[newParent].child2 = leaf;
+		mNodes[sibling].parent = newParent;
+		mNodes[leaf].parent = newParent;
+
+		if (oldParent != NullNode)
+		{
+			if (mNodes[oldParent].child1 == sibling)
+				mNodes[oldParent].child1 = newParent;
+			else
+				mNodes[oldParent].child2 = newParent;
+		}
+		else
+		{
+			mRoot = newParent;
+		}
+
+		// Refit ancestors
+		index = mNodes[leaf].parent;
+		while (index != NullNode)
+		{
+			index = Balance(index);
+
+			int32_t child1 = mNodes[index].child1;
+			int32_t child2 = mNodes[index].child2;
+			mNodes[index].height = 1 + std::max(mNodes[child1].height, mNodes[child2].height);
+			mNodes[index].aabb = Combine(mNodes[child1].aabb, mNodes[child2].aabb);
+
+			index = mNodes[index].parent;
+		}
+	}
+
+	void BoundingVolumeHierarchy::RemoveLeaf(int32_t leaf)
+	{
+		if (leaf == mRoot)
+		{
+			mRoot = NullNode;
+			return;
+		}
+
+		int32_t parent = mNodes[leaf].parent;
+		int32_t grandParent = mNodes[parent].parent;
+		int32_t sibling = mNodes[parent].child1 == leaf ? mNodes[parent].child2 : mNodes[parent].child1;
+
+		if (grandParent != NullNode)
+		{
+			if (mNodes[grandParent].child1 == parent)
+				mNodes[grandParent].child1 = sibling;
+			else
+				mNodes[grandParent].child2 = sibling;
+			mNodes[sibling].parent = grandParent;
+			FreeNode(parent);
+
+			int32_t index = grandParent;
+			while (index != NullNode)
+			{
+				index = Balance(index);
+
+				int32_t child1 = mNodes[index].child1;
+				int32_t child2 = mNodes[index].child2;
+				mNodes[index].aabb = Combine(mNodes[child1].aabb, mNodes[child2].aabb);
+				mNodes[index].height = 1 + std::max(mNodes[child1].height, mNodes[child2].height);
+
+				index = mNodes[index].parent;
+			}
+		}
+		else
+		{
+			mRoot = sibling;
+			mNodes[sibling].parent = NullNode;
+			FreeNode(parent);
+		}
+	}
+
+	int32_t BoundingVolumeHierarchy::Balance(int32_t a)
+	{
+		// Tree rotation, promotes the taller grandchild when the subtrees differ by more than one
+		Node& A = mNodes[a];
+		if (A.IsLeaf() || A.height < 2)
+			return a;
+
+		int32_t b = A.child1;
+		int32_t c = A.child2;
+		int32_t balance = mNodes[c].height - mNodes[b].height;
+
+		auto rotate = [&](int32_t up, int32_t down) -> int32_t
+			{
+				// 'up' is the taller child of 'a', 'down' its sibling
+				Node& U = mNodes[up];
+				int32_t f = U.child1;
+				int32_t g = U.child2;
+
+				U.child1 = a;
+				U.parent = mNodes[a].parent;
+				mNodes[a].parent = up;
+
+				if (U.parent != NullNode)
+				{
+					if (mNodes[U.parent].child1 == a)
+						mNodes[U.parent].child1 = up;
+					else
+						mNodes[U.parent].child2 = up;
+				}
+				else
+				{
+					mRoot = up;
+				}
+
+				int32_t keep = mNodes[f].height > mNodes[g].height ? f : g;
+				int32_t give = keep == f ? g : f;
+
+				U.child2 = keep;
+				if (mNodes[a].child1 == up)
+					mNodes[a].child1 = give;
+				else
+					mNodes[a].child2 = give;
+				mNodes[give].parent = a;
+
+				mNodes[a].aabb = Combine(mNodes[down].aabb, mNodes[give].aabb);
+				U.aabb = Combine(mNodes[a].aabb, mNodes[keep].aabb);
+				mNodes[a].height = 1 + std::max(mNodes[down].height, mNodes[give].height);
+				U.height = 1 + std::max(mNodes[a].height, mNodes[keep].height);
+				return up;
+			};
+
+		if (balance > 1 && !mNodes[c].IsLeaf())
+			return rotate(c, b);
+		if (balance < -1 && !mNodes[b].IsLeaf())
+			return rotate(b, c);
+
+		return a;
+	}
+
+	void BoundingVolumeHierarchy::Rebuild()
+	{
+		std::vector<int32_t> leaves;
+		leaves.reserve(mProxyCount);
+
+		for (int32_t i = 0; i < static_cast<int32_t>(mNodes.size()); ++i)
+		{
+			if (mNodes[i].height < 0)
+				continue;
+
+			if (mNodes[i].IsLeaf())
+			{
+				leaves.push_back(i);
+			}
+			else
+			{
+				FreeNode(i);
+			}
+		}
+
+		mRoot = leaves.empty() ? NullNode : BuildTopDown(leaves.data(), static_cast<int32_t>(leaves.size()));
+		if (mRoot != NullNode)
+			mNodes[mRoot].parent = NullNode;
+	}
+
+	int32_t BoundingVolumeHierarchy::BuildTopDown(int32_t* leaves, int32_t count)
+	{
+		if (count == 1)
+		{
+			mNodes[leaves[0]].height = 0;
+			return leaves[0];
+		}
+
+		// Split at the median centroid along the longest axis of the centroid bounds
+		glm::vec3 minCentroid(std::numeric_limits<float>::max());
+		glm::vec3 maxCentroid(std::numeric_limits<float>::lowest());
+		for (int32_t i = 0; i < count; ++i)
+		{
+			AABB const& aabb = mNodes[leaves[i]].aabb;
+			glm::vec3 centroid = (aabb.minExtent + aabb.maxExtent) * 0.5f;
+			minCentroid = glm::min(minCentroid, centroid);
+			maxCentroid = glm::max(maxCentroid, centroid);
+		}
+
+		glm::vec3 extent = maxCentroid - minCentroid;
+		int axis = extent.x > extent.y ? (extent.x > extent.z ? 0 : 2) : (extent.y > extent.z ? 1 : 2);
+
+		int32_t half = count / 2;
+		std::nth_element(leaves, leaves + half, leaves + count, [this, axis](int32_t lhs, int32_t rhs)
+			{
+				return mNodes[lhs].aabb.minExtent[axis] + mNodes[lhs].aabb.maxExtent[axis] <
+					mNodes[rhs].aabb.minExtent[axis] + mNodes[rhs].aabb.maxExtent[axis];
+			});
+
+		int32_t child1 = BuildTopDown(leaves, half);
+		int32_t child2 = BuildTopDown(leaves + half, count - half);
+
+		int32_t node = AllocateNode();
+		mNodes[node].child1 = child1;
+		mNodes[node].child2 = child2;
+		mNodes[node].aabb = Combine(mNodes[child1].aabb, mNodes[child2].aabb);
+		mNodes[node].height = 1 + std::max(mNodes[child1].height, mNodes[child2].height);
+		mNodes[child1].parent = node;
+		mNodes[child2].parent = node;
+		return node;
+	}
+
+	void BoundingVolumeHierarchy::CollectLeaves(int32_t node, std::vector<uint32_t>& outResults) const
+	{
+		size_t base = mStack.size();
+		mStack.push_back(node);
+		while (mStack.size() > base)
+		{
+			int32_t index = mStack.back();
+			mStack.pop_back();
+
+			if (mNodes[index].IsLeaf())
+			{
+				outResults.push_back(mNodes[index].userData);
+				continue;
+			}
+			mStack.push_back(mNodes[index].child1);
+			mStack.push_back(mNodes[index].child2);
+		}
+	}
+
+	void BoundingVolumeHierarchy::QueryFrustum(Frustum const& frustum, std::vector<uint32_t>& outResults) const
+	{
+		if (mRoot == NullNode)
+			return;
+
+		mStack.clear();
+		mStack.push_back(mRoot);
+		while (!mStack.empty())
+		{
+			int32_t index = mStack.back();
+			mStack.pop_back();
+
+			Node const& node = mNodes[index];
+			FrustumTest test = ClassifyAABB(frustum, node.aabb);
+			if (test == FrustumTest::Outside)
+				continue;
+
+			if (node.IsLeaf())
+			{
+				outResults.push_back(node.userData);
+			}
+			else if (test == FrustumTest::Inside)
+			{
+				// Whole subtree is visible, no need to test the children
+				CollectLeaves(index, outResults);
+			}
+			else
+			{
+				mStack.push_back(node.child1);
+				mStack.push_back(node.child2);
+			}
+		}
+	}
+
+	void BoundingVolumeHierarchy::QuerySphere(BoundingSphere const& sphere, std::vector<uint32_t>& outResults) const
+	{
+		if (mRoot == NullNode)
+			return;
+
+		mStack.clear();
+		mStack.push_back(mRoot);
+		while (!mStack.empty())
+		{
+			int32_t index = mStack.back();
+			mStack.pop_back();
+
+			Node const& node = mNodes[index];
+			if (!Overlaps(node.aabb, sphere))
+				continue;
+
+			if (node.IsLeaf())
+			{
+				outResults.push_back(node.userData);
+			}
+			else
+			{
+				mStack.push_back(node.child1);
+				mStack.push_back(node.child2);
+			}
+		}
+	}
+
+	void BoundingVolumeHierarchy::QueryAABB(AABB const& aabb, std::vector<uint32_t>& outResults) const
+	{
+		if (mRoot == NullNode)
+			return;
+
+		mStack.clear();
+		mStack.push_back(mRoot);
+		while (!mStack.empty())
+		{
+			int32_t index = mStack.back();
+			mStack.pop_back();
+
+			Node const& node = mNodes[index];
+			if (!Overlaps(node.aabb, aabb))
+				continue;
+
+			if (node.IsLeaf())
+			{
+				outResults.push_back(node.userData);
+			}
+			else
+			{
+				mStack.push_back(node.child1);
+				mStack.push_back(node.child2);
+			}
+		}
+	}
+
+	void RenderBVH::SyncProxy(entt::entity entity, TransformComponent& transform, AABB const& modelAABB, void const* model)
+	{
+		uint32_t userData = static_cast<uint32_t>(entity);
+
+		// Brings mWorldVersion up to date, a clean transform hands back its cached matrix
+		glm::mat4 world = transform.GetGlobalTransform();
+		uint32_t worldVersion = transform.mWorldVersion;
+
+		if (!mProxies.contains(entity))
+		{
+			Proxy& proxy = mProxies.emplace(entity);
+			proxy.bounds = modelAABB;
+			proxy.bounds.Transform(world);
+			proxy.proxy = mDynamicTree.Insert(proxy.bounds, userData);
+			proxy.worldVersion = worldVersion;
+			proxy.model = model;
+			return;
+		}
+
+		Proxy& proxy = mProxies.get(entity);
+		if (proxy.worldVersion == worldVersion && proxy.model == model)
+		{
+			// Still entities are moved into the static tree once they settle
+			if (!proxy.isStatic && ++proxy.stillFrames >= StaticFrameThreshold)
+			{
+				mDynamicTree.Remove(proxy.proxy);
+				proxy.proxy = mStaticTree.Insert(proxy.bounds, userData);
+				proxy.isStatic = true;
+				mStaticDirty = true;
+			}
+			return;
+		}
+
+		proxy.worldVersion = worldVersion;
+		proxy.model = model;
+		proxy.bounds = modelAABB;
+		proxy.bounds.Transform(world);
+
+		proxy.stillFrames = 0;
+		if (proxy.isStatic)
+		{
+			mStaticTree.Remove(proxy.proxy);
+			proxy.proxy = mDynamicTree.Insert(proxy.bounds, userData);
+			proxy.isStatic = false;
+			mStaticDirty = true;
+		}
+		else
+		{
+			mDynamicTree.Move(proxy.proxy, proxy.bounds);
+		}
+	}
+
+	void RenderBVH::RemoveProxy(entt::entity entity)
+	{
+		Proxy& proxy = mProxies.get(entity);
+		if (proxy.isStatic)
+		{
+			mStaticTree.Remove(proxy.proxy);
+			mStaticDirty = true;
+		}
+		else
+		{
+			mDynamicTree.Remove(proxy.proxy);
+		}
+		mProxies.erase(entity);
+	}
+
+	void RenderBVH::Update(entt::registry& registry)
+	{
+		PROFILE_FUNCTION();
+
+		// Drop proxies of destroyed entities or entities that lost their renderer
+		mStaleEntities.clear();
+		for (auto entity : static_cast<entt::sparse_set const&>(mProxies))
+		{
+			bool valid = registry.valid(entity) &&
+				((registry.all_of<MeshFilterComponent, MeshRendererComponent>(entity) && registry.get<MeshFilterComponent>(entity).Model) ||
+				(registry.all_of<SkinnedMeshRendererComponent>(entity) && registry.get<SkinnedMeshRendererComponent>(entity).SkinnnedModel));
+			if (!valid)
+				mStaleEntities.push_back(entity);
+		}
+		for (auto entity : mStaleEntities)
+		{
+			RemoveProxy(entity);
+		}
+
+		{
+			auto view = registry.view<TransformComponent, MeshFilterComponent, MeshRendererComponent>();
+			for (auto entity : view)
+			{
+				auto [transform, meshFilter] = view.get<TransformComponent, MeshFilterComponent>(entity);
+				if (!meshFilter.Model)
+					continue;
+
+				SyncProxy(entity, transform, meshFilter.Model->mAABB, meshFilter.Model.get());
+			}
+		}
+
+		{
+			auto view = registry.view<TransformComponent, SkinnedMeshRendererComponent>();
+			for (auto entity : view)
+			{
+				auto [transform, skinnedMesh] = view.get<TransformComponent, SkinnedMeshRendererComponent>(entity);
+				if (!skinnedMesh.SkinnnedModel)
+					continue;
+
+				SyncProxy(entity, transform, skinnedMesh.SkinnnedModel->mAABB, skinnedMesh.SkinnnedModel.get());
+			}
+		}
+
+		if (mStaticDirty)
+		{
+			mStaticTree.Rebuild();
+			mStaticDirty = false;
+		}
+	}
+
+	void RenderBVH::AppendEntities(std::vector<entt::entity>& outResults) const
+	{
+		for (uint32_t userData : mQueryScratch)
+		{
+			outResults.push_back(static_cast<entt::entity>(userData));
+		}
+	}
+
+	void RenderBVH::QueryFrustum(Frustum const& frustum, std::vector<entt::entity>& outResults) const
+	{
+		mQueryScratch.clear();
+		mStaticTree.QueryFrustum(frustum, mQueryScratch);
+		mDynamicTree.QueryFrustum(frustum, mQueryScratch);
+		AppendEntities(outResults);
+	}
+
+	void RenderBVH::QuerySphere(BoundingSphere const& sphere, std::vector<entt::entity>& outResults) const
+	{
+		mQueryScratch.clear();
+		mStaticTree.QuerySphere(sphere, mQueryScratch);
+		mDynamicTree.QuerySphere(sphere, mQueryScratch);
+		AppendEntities(outResults);
+	}
+
+	void RenderBVH::QueryAABB(AABB const& aabb, std::vector<entt::entity>& outResults) const
+	{
+		mQueryScratch.clear();
+		mStaticTree.QueryAABB(aabb, mQueryScratch);
+		mDynamicTree.QueryAABB(aabb, mQueryScratch);
+		AppendEntities(outResults);
+	}
+
+	void RenderBVH::Clear()
+	{
+		mStaticTree.Clear();
+		mDynamicTree.Clear();
+		mProxies.clear();
+		mStaticDirty = false;
+	}
+}
@@ -188,5 +188,36 @@ namespace Borealis
 
 		return false;
 	}
-}
 
+	bool CullAABB(Frustum const& frustum, AABB const& aabb)
+	{
+		return ClassifyAABB(frustum, aabb) == FrustumTest::Outside;
+	}
+
+	FrustumTest ClassifyAABB(Frustum const& frustum, AABB const& aabb)
+	{
+		const glm::vec4* planes[] = {
+			&frustum.leftPlane, &frustum.rightPlane, &frustum.topPlane,
+			&frustum.bottomPlane, &frustum.nearPlane, &frustum.farPlane
+		};
+
+		FrustumTest result = FrustumTest::Inside;
+		for (const glm::vec4* plane : planes)
+		{
+			// Corner furthest along the plane normal, and the one furthest against it
+			glm::vec3 positive{
+				plane->x >= 0.f ? aabb.maxExtent.x : aabb.minExtent.x,
+				plane->y >= 0.f ? aabb.maxExtent.y : aabb.minExtent.y,
+				plane->z >= 0.f ? aabb.maxExtent.z : aabb.minExtent.z };
+			glm::vec3 negative{
+				plane->x >= 0.f ? aabb.minExtent.x : aabb.maxExtent.x,
+				plane->y >= 0.f ? aabb.minExtent.y : aabb.maxExtent.y,
+				plane->z >= 0.f ? aabb.minExtent.z : aabb.maxExtent.z };
+
+			if (glm::dot(glm::vec3(*plane), positive) + plane->w < 0.f) return FrustumTest::Outside;
+			if (glm::dot(glm::vec3(*plane), negative) + plane->w < 0.f) result = FrustumTest::Intersect;
+		}
+
+		return result;
+	}
+}
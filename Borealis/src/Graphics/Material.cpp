@@ -114,23 +114,13 @@ namespace Borealis
         mShader = Shader::GetDefault3DMaterialShader();
         YAML::Node data;
 
-        if (AssetManager::IsPakLoaded())
+        PakAsset pakAsset = AssetManager::ReadFromPak(path);
+
+        MemoryStreamBuffer pakBuffer(pakAsset.View());
+        if (!pakBuffer.empty())
         {
-            try
-            {
-                char* buffer;
-                uint64_t size;
-                std::string subPath = path.filename().string();
-                AssetManager::RetrieveFromPak(std::stoull(subPath), buffer, size);
-                std::string yamlContent(buffer, size);
-                data = YAML::Load(yamlContent);
-                delete[] buffer;
-            }
-            catch(...)
-            {
-                if (!std::filesystem::is_regular_file(path)) return;
-                data = YAML::LoadFile(path.string());
-            }
+            std::istream pakStream(&pakBuffer);
+            data = YAML::Load(pakStream);
         }
         else
         {
@@ -444,6 +434,32 @@ namespace Borealis
         Material material(cachePath/std::to_string(assetMetaData.Handle));
         return MakeRef<Material>(material);
     }
+    std::vector<AssetHandle> Material::GetDependencies(std::filesystem::path const& cachePath, AssetMetaData const& assetMetaData)
+    {
+        std::filesystem::path path = cachePath/std::to_string(assetMetaData.Handle);
+        YAML::Node data;
+
+        PakAsset pakAsset = AssetManager::ReadFromPak(path);
+        MemoryStreamBuffer pakBuffer(pakAsset.View());
+        if (!pakBuffer.empty())
+        {
+            std::istream pakStream(&pakBuffer);
+            data = YAML::Load(pakStream);
+        }
+        else
+        {
+            if (!std::filesystem::is_regular_file(path)) return {};
+            data = YAML::LoadFile(path.string());
+        }
+
+        std::vector<AssetHandle> dependencies;
+        auto textureMaps = data["TextureMaps"];
+        for (auto it = textureMaps.begin(); it != textureMaps.end(); ++it) {
+            dependencies.push_back(it->second.as<uint64_t>());
+        }
+        return dependencies;
+    }
+
     void Material::Reload(AssetMetaData const& assetMetaData, Ref<Asset> const& asset)
     {
         Material material(assetMetaData.CachePath);
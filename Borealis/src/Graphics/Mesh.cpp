@@ -17,6 +17,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include <Core/LoggerSystem.hpp>
 
 #include <Graphics/OpenGL/TextureOpenGLImpl.hpp>
+#include <Graphics/Null/RendererAPINullImpl.hpp>
 
 #define M_PI 3.14159265359
 
@@ -104,14 +105,67 @@ namespace Borealis
 
 	}
 
+	// Debug shapes and the mesh draws below call OpenGL directly, the null backend only counts them
+	static bool RecordNullDraw(uint64_t indexCount)
+	{
+		if (RendererAPI::GetAPI() != RendererAPI::API::Null)
+			return false;
+
+		NullRendererAPI::Record(NullCommand::DrawElements, indexCount);
+		return true;
+	}
+
 	void Mesh::Load(const std::string& path)
 	{
 		BOREALIS_CORE_TRACE("Mesh path is {0}", path);
 	}
 
 	void Mesh::SetupMesh()
+	{
+		PrepareMesh();
+		UploadMesh();
+	}
+
+	void Mesh::PrepareMesh()
 	{
 		ComputeTangents();
+	}
+
+	void Mesh::ReleaseMesh()
+	{
+		if (RendererAPI::GetAPI() == RendererAPI::API::Null)
+		{
+			NullRendererAPI::Record(NullCommand::DestroyResource);
+			return;
+		}
+
+		if (VAO == 0) return;
+
+		glDeleteVertexArrays(1, &VAO);
+		glDeleteBuffers(5, VBOs);
+		glDeleteBuffers(1, &EBO);
+		VAO = EBO = 0;
+		std::fill(std::begin(VBOs), std::end(VBOs), 0u);
+	}
+
+	uint64_t Mesh::GetMemorySize() const
+	{
+		uint64_t bytes = mPositions.size() * sizeof(glm::vec3) + mNormals.size() * sizeof(glm::vec3) +
+			mTexCoords.size() * sizeof(glm::vec2) + mTangent.size() * sizeof(glm::vec3) + mBitangent.size() * sizeof(glm::vec3) +
+			mIndices.size() * sizeof(unsigned int);
+		return bytes * 2;
+	}
+
+	void Mesh::UploadMesh()
+	{
+		if (RendererAPI::GetAPI() == RendererAPI::API::Null)
+		{
+			NullRendererAPI::Record(NullCommand::CreateResource);
+			NullRendererAPI::Record(NullCommand::Upload, mPositions.size() * sizeof(glm::vec3) + mNormals.size() * sizeof(glm::vec3) +
+				mTexCoords.size() * sizeof(glm::vec2) + mTangent.size() * sizeof(glm::vec3) + mBitangent.size() * sizeof(glm::vec3) +
+				mIndices.size() * sizeof(unsigned int));
+			return;
+		}
 
 		glGenVertexArrays(1, &VAO);
 		glGenBuffers(1, &VBOs[0]); // Positions
@@ -173,6 +227,12 @@ namespace Borealis
 			shader->Set("u_EntityID", entityID);
 		}
 
+		if (RecordNullDraw(mIndices.size()))
+		{
+			shader->Unbind();
+			return;
+		}
+
 		glBindVertexArray(VAO);
 
 		if (posOnly)
@@ -197,6 +257,58 @@ namespace Borealis
 		shader->Unbind();
 	}
 
+	void Mesh::DrawInstanced(Ref<Shader> shader, Ref<VertexBuffer> const& instanceBuffer, uint32_t firstInstance, uint32_t instanceCount, bool posOnly)
+	{
+		PROFILE_FUNCTION();
+
+		if (RecordNullDraw(mIndices.size() * instanceCount))
+		{
+			return;
+		}
+
+		glBindVertexArray(VAO);
+
+		if (posOnly)
+		{
+			glEnableVertexAttribArray(0);
+			glDisableVertexAttribArray(1);
+			glDisableVertexAttribArray(2);
+			glDisableVertexAttribArray(3);
+			glDisableVertexAttribArray(4);
+		}
+		else
+		{
+			glEnableVertexAttribArray(0);
+			glEnableVertexAttribArray(1);
+			glEnableVertexAttribArray(2);
+			glEnableVertexAttribArray(3);
+			glEnableVertexAttribArray(4);
+		}
+
+		// GL 4.1 has no base instance, so the attributes are pointed at the first instance instead
+		instanceBuffer->Bind();
+		size_t baseOffset = firstInstance * sizeof(InstanceData);
+		for (uint32_t column = 0; column < 4; ++column)
+		{
+			uint32_t location = InstanceAttributeLocation + column;
+			glEnableVertexAttribArray(location);
+			glVertexAttribPointer(location, 4, GL_FLOAT, GL_FALSE, sizeof(InstanceData), (void*)(baseOffset + offsetof(InstanceData, transform) + sizeof(glm::vec4) * column));
+			glVertexAttribDivisor(location, 1);
+		}
+		glEnableVertexAttribArray(InstanceAttributeLocation + 4);
+		glVertexAttribIPointer(InstanceAttributeLocation + 4, 1, GL_INT, sizeof(InstanceData), (void*)(baseOffset + offsetof(InstanceData, entityID)));
+		glVertexAttribDivisor(InstanceAttributeLocation + 4, 1);
+
+		glDrawElementsInstanced(GL_TRIANGLES, (int)mIndices.size(), GL_UNSIGNED_INT, 0, (int)instanceCount);
+
+		// Leave the instance attributes off so non instanced draws of this VAO are unaffected
+		for (uint32_t location = InstanceAttributeLocation; location <= InstanceAttributeLocation + 4; ++location)
+		{
+			glDisableVertexAttribArray(location);
+		}
+		glBindVertexArray(0);
+	}
+
 	float DistanceSquared(const glm::vec3& a, const glm::vec3& b)
 	{
 		glm::vec3 diff = a - b;
@@ -278,6 +390,7 @@ namespace Borealis
 	void Mesh::DrawQuad()
 	{
 		PROFILE_FUNCTION();
+		if (RecordNullDraw(6)) return;
 		if (QuadVAO == 0)
 		{
 			// Define the vertex positions and texture coordinates for a fullscreen quad
@@ -321,6 +434,7 @@ namespace Borealis
 	void Mesh::DrawQuad(const glm::mat4& transform, glm::vec4 color, bool wireframe, Ref<Shader> shader)
 	{
 		PROFILE_FUNCTION();
+		if (RecordNullDraw(6)) return;
 
 		static unsigned int QuadVAO = 0, QuadVBO = 0, QuadEBO = 0;
 
@@ -410,6 +524,7 @@ namespace Borealis
 	void Mesh::DrawCube(const glm::mat4& transform, glm::vec4 color, bool wireframe, Ref<Shader> shader)
 	{
 		PROFILE_FUNCTION();
+		if (RecordNullDraw(36)) return;
 
 		static unsigned int CubeVAO = 0, CubeVBO = 0, CubeEBO = 0;
 
@@ -495,6 +610,7 @@ namespace Borealis
 	void Mesh::DrawCone(float height, float radius, float angle, const glm::mat4& transform, glm::vec4 color, bool wireframe, Ref<Shader> shader)
 	{
 		PROFILE_FUNCTION();
+		if (RecordNullDraw(0)) return;
 
 		float radians = glm::radians(angle);
 		float radiusIncrease = height * glm::tan(radians);
@@ -604,6 +720,7 @@ namespace Borealis
 	void Mesh::DrawCube(glm::vec3 translation, glm::vec3 minExtent, glm::vec3 maxExtent, glm::vec4 color, bool wireframe, Ref<Shader> shader)
 	{
 		PROFILE_FUNCTION();
+		if (RecordNullDraw(36)) return;
 		if (CubeVAO == 0)
 		{
 			const GLfloat cubeVertices[] = 
@@ -738,6 +855,8 @@ namespace Borealis
 
 	void Mesh::DrawCubeMap()
 	{
+		if (RecordNullDraw(0)) return;
+
 		static unsigned int SphereMapVAO = 0, SphereMapVBO = 0, SphereMapEBO = 0;
 		static unsigned int SphereMapIndexCount = 0;
 
@@ -753,6 +872,7 @@ namespace Borealis
 	void Mesh::DrawSphere(glm::vec3 center, float radius, glm::vec4 color, bool wireframe, Ref<Shader> shader, SphereSides side)
 	{
 		PROFILE_FUNCTION();
+		if (RecordNullDraw(0)) return;
 		static GLuint SphereVAO = 0, SphereVBO = 0, SphereEBO = 0;
 		static int sphereIndexCount = 0;
 		static std::vector<GLuint> fullIndices;
@@ -898,6 +1018,7 @@ namespace Borealis
 	void Mesh::DrawCylinder(glm::vec3 center, float radius, float height, glm::vec4 color, bool wireframe, Ref<Shader> shader)
 	{
 		PROFILE_FUNCTION();
+		if (RecordNullDraw(0)) return;
 		static GLuint CylinderVAO = 0, CylinderVBO = 0, CylinderEBO = 0;
 		const int segments = 16; // Adjust for detail level
 
@@ -22,39 +22,37 @@ namespace Borealis
 {
 	void Model::Draw(const glm::mat4& transform, Ref<Shader> shader, int entityID, bool posOnly)
 	{
-		for (auto mesh : mMeshes)
+		for (auto& mesh : mMeshes)
 		{
 			mesh.Draw(transform, shader, entityID, posOnly);
 		}
 	}
 
-	void Model::LoadModel(std::filesystem::path const& path)
+	void Model::DrawInstanced(Ref<Shader> shader, Ref<VertexBuffer> const& instanceBuffer, uint32_t firstInstance, uint32_t instanceCount, bool posOnly)
 	{
-		std::stringstream inFile;
-		if (AssetManager::IsPakLoaded())
+		for (auto& mesh : mMeshes)
 		{
-			try
-			{
-				std::string subPath = path.filename().string();
-				uint64_t id = std::stoull(subPath);
-				char* buffer;
-				uint64_t size;
-				AssetManager::RetrieveFromPak(id, buffer, size);
-				inFile << std::string(buffer, size);
-				delete[] buffer;
-			}
-			catch (...)
-			{
-				std::ifstream actualFile(path, std::ios::binary);
-				inFile << actualFile.rdbuf();
-				actualFile.close();
-			}
+			mesh.DrawInstanced(shader, instanceBuffer, firstInstance, instanceCount, posOnly);
 		}
-		else
+	}
+
+	void Model::LoadModel(std::filesystem::path const& path)
+	{
+		ReadModel(path);
+		UploadMeshes();
+	}
+
+	void Model::ReadModel(std::filesystem::path const& path)
+	{
+		// Parse the pak asset in place, or stream from disk when the pak does not hold it
+		PakAsset pakAsset = AssetManager::ReadFromPak(path);
+		MemoryStreamBuffer pakBuffer(pakAsset.View());
+		std::ifstream actualFile;
+		std::istream inFile(&pakBuffer);
+		if (pakBuffer.empty())
 		{
-			std::ifstream actualFile(path, std::ios::binary);
-			inFile << actualFile.rdbuf();
-			actualFile.close();
+			actualFile.open(path, std::ios::binary);
+			inFile.rdbuf(actualFile.rdbuf());
 		}
 
 		
@@ -115,7 +113,7 @@ namespace Borealis
 			inFile.read(reinterpret_cast<char*>(mesh.GetTexCoord().data()), vertexCount * sizeof(glm::vec2));
 			inFile.read(reinterpret_cast<char*>(mesh.GetIndices().data()), indexCount * sizeof(uint32_t));
 
-			mesh.SetupMesh();
+			mesh.PrepareMesh();
 
 			mesh.GenerateRitterBoundingSphere();
 			mesh.GenerateAABB();
@@ -125,6 +123,14 @@ namespace Borealis
 		GenerateAABB();
 	}
 
+	void Model::UploadMeshes()
+	{
+		for (Mesh& mesh : mMeshes)
+		{
+			mesh.UploadMesh();
+		}
+	}
+
 	void Model::SaveModel()
 	{
 		//std::ofstream outFile("model.mesh", std::ios::binary);
@@ -230,6 +236,35 @@ namespace Borealis
 		}
 	}
 
+	Ref<Asset> Model::Decode(std::filesystem::path const& cachePath, AssetMetaData const& assetMetaData)
+	{
+		MeshConfig config = GetConfig<MeshConfig>(assetMetaData.Config);
+		if (config.skinMesh)
+		{
+			Ref<SkinnedModel> skinnedModel = MakeRef<SkinnedModel>();
+			skinnedModel->ReadModel(cachePath/std::to_string(assetMetaData.Handle));
+			return skinnedModel;
+		}
+		else
+		{
+			Ref<Model> model = MakeRef<Model>();
+			model->ReadModel(cachePath/std::to_string(assetMetaData.Handle));
+			return model;
+		}
+	}
+
+	void Model::Finalize(AssetMetaData const& assetMetaData, Ref<Asset> const& asset)
+	{
+		if (Ref<SkinnedModel> skinnedModel = std::dynamic_pointer_cast<SkinnedModel>(asset))
+		{
+			skinnedModel->UploadMeshes();
+		}
+		else if (Ref<Model> model = std::dynamic_pointer_cast<Model>(asset))
+		{
+			model->UploadMeshes();
+		}
+	}
+
 	void Model::Reload(AssetMetaData const& assetMetaData, Ref<Asset> asset)
 	{
 		MeshConfig config = GetConfig<MeshConfig>(assetMetaData.Config);
@@ -251,6 +286,24 @@ namespace Borealis
 		}
 	}
 
+	uint64_t Model::GetMemorySize() const
+	{
+		uint64_t bytes = sizeof(Model);
+		for (Mesh const& mesh : mMeshes)
+		{
+			bytes += mesh.GetMemorySize();
+		}
+		return bytes;
+	}
+
+	void Model::Release()
+	{
+		for (Mesh& mesh : mMeshes)
+		{
+			mesh.ReleaseMesh();
+		}
+	}
+
 	void Model::swap(Asset& other)
 	{
 		Model& otherModel = dynamic_cast<Model&>(other);
@@ -0,0 +1,74 @@
+/******************************************************************************
+/*!
+\file       BufferNullImpl.cpp
+\author     Chua Zheng Yang
+\par        email: c.zhengyang\@digipen.edu
+\date       October 17, 2026
+\brief      Defines the headless vertex and element buffers
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#include <BorealisPCH.hpp>
+#include <Graphics/Null/BufferNullImpl.hpp>
+#include <Graphics/Null/RendererAPINullImpl.hpp>
+
+namespace Borealis
+{
+	NullVertexBuffer::NullVertexBuffer(uint32_t size) : mSize(size)
+	{
+		NullRendererAPI::Record(NullCommand::CreateResource);
+	}
+
+	NullVertexBuffer::NullVertexBuffer(float* vertices, uint32_t size) : mSize(size)
+	{
+		NullRendererAPI::Record(NullCommand::CreateResource);
+		NullRendererAPI::Record(NullCommand::Upload, size);
+	}
+
+	NullVertexBuffer::~NullVertexBuffer()
+	{
+		NullRendererAPI::Record(NullCommand::DestroyResource);
+	}
+
+	void NullVertexBuffer::Bind() const
+	{
+		NullRendererAPI::Record(NullCommand::BindBuffer);
+	}
+
+	void NullVertexBuffer::Unbind() const
+	{
+		NullRendererAPI::Record(NullCommand::BindBuffer);
+	}
+
+	void NullVertexBuffer::SetData(const void* data, uint32_t size)
+	{
+		BOREALIS_CORE_ASSERT(size <= mSize, "Vertex buffer overflow");
+		NullRendererAPI::Record(NullCommand::BindBuffer);
+		NullRendererAPI::Record(NullCommand::Upload, size);
+	}
+
+	NullElementBuffer::NullElementBuffer(uint32_t* indices, uint32_t count) : mCount(count)
+	{
+		NullRendererAPI::Record(NullCommand::CreateResource);
+		NullRendererAPI::Record(NullCommand::Upload, count * sizeof(uint32_t));
+	}
+
+	NullElementBuffer::~NullElementBuffer()
+	{
+		NullRendererAPI::Record(NullCommand::DestroyResource);
+	}
+
+	void NullElementBuffer::Bind() const
+	{
+		NullRendererAPI::Record(NullCommand::BindBuffer);
+	}
+
+	void NullElementBuffer::Unbind() const
+	{
+		NullRendererAPI::Record(NullCommand::BindBuffer);
+	}
+}
@@ -0,0 +1,103 @@
+/******************************************************************************
+/*!
+\file       FramebufferNullImpl.cpp
+\author     Chua Zheng Yang
+\par        email: c.zhengyang\@digipen.edu
+\date       October 17, 2026
+\brief      Defines the headless frame buffer
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#include <BorealisPCH.hpp>
+#include <Graphics/Null/FramebufferNullImpl.hpp>
+#include <Graphics/Null/RendererAPINullImpl.hpp>
+
+namespace Borealis
+{
+	NullFrameBuffer::NullFrameBuffer(const FrameBufferProperties& properties) : mProperties(properties)
+	{
+		for (auto const& attachment : mProperties.Attachments.mAttachments)
+		{
+			if (attachment.mTextureFormat == FramebufferTextureFormat::Depth24Stencil8 ||
+				attachment.mTextureFormat == FramebufferTextureFormat::DepthArray)
+			{
+				mDepthAttachment = NullRendererAPI::NextRendererID();
+			}
+			else
+			{
+				mColorAttachments.push_back(NullRendererAPI::NextRendererID());
+			}
+			NullRendererAPI::Record(NullCommand::CreateResource);
+		}
+	}
+
+	NullFrameBuffer::~NullFrameBuffer()
+	{
+		NullRendererAPI::Record(NullCommand::DestroyResource);
+	}
+
+	void NullFrameBuffer::Bind()
+	{
+		NullRendererAPI::Record(NullCommand::BindFrameBuffer);
+		NullRendererAPI::Record(NullCommand::StateChange); // viewport
+	}
+
+	void NullFrameBuffer::Unbind()
+	{
+		NullRendererAPI::Record(NullCommand::BindFrameBuffer);
+	}
+
+	void NullFrameBuffer::BindTexture(uint32_t attachmentIndex, uint32_t textureUnit)
+	{
+		NullRendererAPI::Record(NullCommand::BindTexture);
+	}
+
+	void NullFrameBuffer::BindDepthBuffer(uint32_t textureUnit, bool is3D)
+	{
+		NullRendererAPI::Record(NullCommand::BindTexture);
+	}
+
+	void NullFrameBuffer::Resize(uint32_t width, uint32_t height)
+	{
+		mProperties.Width = width;
+		mProperties.Height = height;
+		NullRendererAPI::Record(NullCommand::CreateResource);
+	}
+
+	int NullFrameBuffer::ReadPixel(uint32_t attachmentIndex, int x, int y)
+	{
+		NullRendererAPI::Record(NullCommand::ReadBack);
+		return -1;
+	}
+
+	void NullFrameBuffer::ClearAttachment(uint32_t attachmentIndex, int value)
+	{
+		NullRendererAPI::Record(NullCommand::Clear);
+	}
+
+	void NullFrameBuffer::ClearAttachment(uint32_t attachmentIndex, glm::vec4 value)
+	{
+		NullRendererAPI::Record(NullCommand::Clear);
+	}
+
+	uint32_t NullFrameBuffer::GetColorAttachmentRendererID(uint32_t index) const
+	{
+		return index < mColorAttachments.size() ? mColorAttachments[index] : 0;
+	}
+
+	void NullFrameBuffer::AttachDepthBuffer(uint32_t index)
+	{
+		NullRendererAPI::Record(NullCommand::BindFrameBuffer);
+		mDepthAttachment = index;
+	}
+
+	void NullFrameBuffer::AttachTextureAttachment(uint32_t textureID, uint32_t index)
+	{
+		NullRendererAPI::Record(NullCommand::BindFrameBuffer);
+		mColorAttachments[index] = textureID;
+	}
+}
@@ -0,0 +1,33 @@
+/******************************************************************************
+/*!
+\file       GraphicsContextNullImpl.cpp
+\author     Chua Zheng Yang
+\par        email: c.zhengyang\@digipen.edu
+\date       October 17, 2026
+\brief      Defines the headless graphics context
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#include <BorealisPCH.hpp>
+#include <Graphics/Null/GraphicsContextNullImpl.hpp>
+#include <Graphics/Null/RendererAPINullImpl.hpp>
+#include <Core/LoggerSystem.hpp>
+
+namespace Borealis
+{
+	void NullContext::Init()
+	{
+		PROFILE_FUNCTION();
+		BOREALIS_CORE_INFO("Null graphics context, running headless");
+	}
+
+	void NullContext::SwapBuffers()
+	{
+		PROFILE_FUNCTION();
+		NullRendererAPI::Record(NullCommand::BindFrameBuffer);
+	}
+}
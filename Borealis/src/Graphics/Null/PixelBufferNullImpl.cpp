@@ -0,0 +1,60 @@
+/******************************************************************************
+/*!
+\file       PixelBufferNullImpl.cpp
+\author     Chan Guo Geng Gordon
+\par        email: g.chan/@digipen.edu
+\date       October 17, 2026
+\brief      Defines the headless pixel buffer
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#include <BorealisPCH.hpp>
+#include <Graphics/Null/PixelBufferNullImpl.hpp>
+#include <Graphics/Null/RendererAPINullImpl.hpp>
+
+namespace Borealis
+{
+	NullPixelBuffer::NullPixelBuffer(PixelBufferProperties const& props) : mProps(props)
+	{
+		NullRendererAPI::Record(NullCommand::CreateResource);
+	}
+
+	void NullPixelBuffer::ReadTexture(uint32_t index)
+	{
+		NullRendererAPI::Record(NullCommand::ReadBack);
+	}
+
+	int NullPixelBuffer::ReadPixel(int x, int y)
+	{
+		NullRendererAPI::Record(NullCommand::ReadBack);
+		return -1;
+	}
+
+	void NullPixelBuffer::BindForRead()
+	{
+		NullRendererAPI::Record(NullCommand::BindBuffer);
+	}
+
+	void NullPixelBuffer::BindForWrite()
+	{
+		NullRendererAPI::Record(NullCommand::BindBuffer);
+	}
+
+	void NullPixelBuffer::Unbind()
+	{
+		NullRendererAPI::Record(NullCommand::BindBuffer);
+	}
+
+	void NullPixelBuffer::Resize(uint32_t width, uint32_t height)
+	{
+		NullRendererAPI::Record(NullCommand::CreateResource);
+	}
+
+	void NullPixelBuffer::SwapBuffers()
+	{
+	}
+}
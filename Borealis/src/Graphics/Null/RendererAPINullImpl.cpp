@@ -0,0 +1,160 @@
+/******************************************************************************
+/*!
+\file       RendererAPINullImpl.cpp
+\author     Chua Zheng Yang
+\par        email: c.zhengyang\@digipen.edu
+\date       October 17, 2026
+\brief      Defines the headless renderer backend
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#include <BorealisPCH.hpp>
+#include "Graphics/Null/RendererAPINullImpl.hpp"
+
+namespace Borealis
+{
+	NullRenderStats NullRendererAPI::sStats{};
+	std::vector<NullCommandRecord> NullRendererAPI::sCommands{};
+	bool NullRendererAPI::sRecording = false;
+	uint32_t NullRendererAPI::sNextRendererID = 1;
+
+	void NullRendererAPI::Record(NullCommand command, uint64_t amount)
+	{
+		switch (command)
+		{
+		case NullCommand::Clear:           ++sStats.clears; break;
+		case NullCommand::DrawElements:    ++sStats.drawCalls; sStats.indices += amount; break;
+		case NullCommand::DrawLines:       ++sStats.drawCalls; sStats.lineVertices += amount; break;
+		case NullCommand::StateChange:     ++sStats.stateChanges; break;
+		case NullCommand::BindShader:      ++sStats.shaderBinds; break;
+		case NullCommand::SetUniform:      ++sStats.uniformSets; break;
+		case NullCommand::BindTexture:     ++sStats.textureBinds; break;
+		case NullCommand::BindBuffer:      ++sStats.bufferBinds; break;
+		case NullCommand::BindFrameBuffer: ++sStats.frameBufferBinds; break;
+		case NullCommand::Upload:          sStats.bytesUploaded += amount; break;
+		case NullCommand::ReadBack:        ++sStats.readBacks; break;
+		case NullCommand::CreateResource:  ++sStats.resourcesCreated; break;
+		case NullCommand::DestroyResource: ++sStats.resourcesDestroyed; break;
+		}
+
+		if (sRecording)
+		{
+			sCommands.push_back({ command, amount });
+		}
+	}
+
+	uint32_t NullRendererAPI::NextRendererID()
+	{
+		return sNextRendererID++;
+	}
+
+	void NullRendererAPI::ResetStats()
+	{
+		sStats = {};
+		sCommands.clear();
+	}
+
+	void NullRendererAPI::Init()
+	{
+		PROFILE_FUNCTION();
+		BOREALIS_CORE_INFO("Null renderer backend, no graphics driver will be used");
+		Record(NullCommand::StateChange);
+	}
+
+	void NullRendererAPI::Clear()
+	{
+		Record(NullCommand::Clear);
+	}
+
+	void NullRendererAPI::ClearStencil()
+	{
+		Record(NullCommand::Clear);
+	}
+
+	void NullRendererAPI::SetClearColor(const float&, const float&, const float&, const float&)
+	{
+		Record(NullCommand::StateChange);
+	}
+
+	void NullRendererAPI::SetClearColor(const glm::vec4&)
+	{
+		Record(NullCommand::StateChange);
+	}
+
+	void NullRendererAPI::SetStencilClear(int)
+	{
+		Record(NullCommand::StateChange);
+	}
+
+	void NullRendererAPI::DrawElements(const Ref<VertexArray>& VAO, uint32_t count)
+	{
+		VAO->Bind();
+		uint32_t indexCount = count ? count : VAO->GetElementBuffer()->GetCount();
+		Record(NullCommand::DrawElements, indexCount);
+	}
+
+	void NullRendererAPI::DrawElementsInstanced(const Ref<VertexArray>& VAO, uint32_t indexCount, uint32_t instanceCount)
+	{
+		VAO->Bind();
+		Record(NullCommand::DrawElements, static_cast<uint64_t>(indexCount) * instanceCount);
+	}
+
+	void NullRendererAPI::DrawLines(const Ref<VertexArray>& VAO, uint32_t vertexCount)
+	{
+		VAO->Bind();
+		Record(NullCommand::DrawLines, vertexCount);
+	}
+
+	void NullRendererAPI::SetViewport(const uint32_t&, const uint32_t&, const uint32_t&, const uint32_t&)
+	{
+		Record(NullCommand::StateChange);
+	}
+
+	void NullRendererAPI::SetLineThickness(const float&)
+	{
+		Record(NullCommand::StateChange);
+	}
+
+	void NullRendererAPI::BindBackBuffer()
+	{
+		Record(NullCommand::BindFrameBuffer);
+	}
+
+	void NullRendererAPI::EnableBlend() { Record(NullCommand::StateChange); }
+	void NullRendererAPI::DisableBlend() { Record(NullCommand::StateChange); }
+	void NullRendererAPI::ConfigureBlendForTransparency(TransparencyStage) { Record(NullCommand::StateChange); }
+	void NullRendererAPI::EnableDepthTest() { Record(NullCommand::StateChange); }
+	void NullRendererAPI::ConfigureDepthFunc(DepthFunc) { Record(NullCommand::StateChange); }
+	void NullRendererAPI::DisableDepthTest() { Record(NullCommand::StateChange); }
+	void NullRendererAPI::SetDepthMask(bool) { Record(NullCommand::StateChange); }
+	void NullRendererAPI::EnableBackFaceCull() { Record(NullCommand::StateChange); }
+	void NullRendererAPI::EnableFrontFaceCull() { Record(NullCommand::StateChange); }
+	void NullRendererAPI::EnableStencilTest() { Record(NullCommand::StateChange); }
+	void NullRendererAPI::ConfigureStencilForHighlight() { Record(NullCommand::StateChange); }
+	void NullRendererAPI::DisableStencilTest() { Record(NullCommand::StateChange); }
+	void NullRendererAPI::EnableWireFrameMode() { Record(NullCommand::StateChange); }
+	void NullRendererAPI::DisableWireFrameMode() { Record(NullCommand::StateChange); }
+	void NullRendererAPI::EnablePolygonOffset() { Record(NullCommand::StateChange); }
+	void NullRendererAPI::SetPolygonOffset(float, float) { Record(NullCommand::StateChange); }
+	void NullRendererAPI::DisablePolygonOffset() { Record(NullCommand::StateChange); }
+	void NullRendererAPI::DisableDrawToSecondaryBuffer() { Record(NullCommand::StateChange); }
+	void NullRendererAPI::EnableDrawToSecondaryBuffer() { Record(NullCommand::StateChange); }
+
+	void NullRendererAPI::ResetTextureBinding()
+	{
+		Record(NullCommand::BindTexture);
+	}
+
+	void NullRendererAPI::IgnoreNextError()
+	{
+	}
+
+	unsigned NullRendererAPI::GetError(std::string const&)
+	{
+		return 0;
+	}
+}
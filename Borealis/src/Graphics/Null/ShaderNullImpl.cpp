@@ -0,0 +1,98 @@
+/******************************************************************************
+/*!
+\file       ShaderNullImpl.cpp
+\author     Chua Zheng Yang
+\par        email: c.zhengyang\@digipen.edu
+\date       October 17, 2026
+\brief      Defines the headless shader
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#include <BorealisPCH.hpp>
+#include <Graphics/Null/ShaderNullImpl.hpp>
+#include <Graphics/Null/RendererAPINullImpl.hpp>
+
+namespace Borealis
+{
+	NullShader::NullShader(const std::string& filepath) : mRendererID(NullRendererAPI::NextRendererID())
+	{
+		size_t lastSlash = filepath.find_last_of("/\\");
+		lastSlash = lastSlash == std::string::npos ? 0 : lastSlash + 1;
+		size_t lastDot = filepath.rfind('.');
+		lastDot = lastDot == std::string::npos ? filepath.size() - lastSlash : lastDot - lastSlash;
+		mName = filepath.substr(lastSlash, lastDot);
+
+		NullRendererAPI::Record(NullCommand::CreateResource);
+	}
+
+	NullShader::NullShader(const std::string& name, const std::string& vertexSource, const std::string& fragmentSource)
+		: mName(name), mRendererID(NullRendererAPI::NextRendererID())
+	{
+		NullRendererAPI::Record(NullCommand::CreateResource);
+	}
+
+	NullShader::~NullShader()
+	{
+		NullRendererAPI::Record(NullCommand::DestroyResource);
+	}
+
+	void NullShader::Bind() const
+	{
+		NullRendererAPI::Record(NullCommand::BindShader);
+	}
+
+	void NullShader::Unbind() const
+	{
+		NullRendererAPI::Record(NullCommand::BindShader);
+	}
+
+	void NullShader::Set(const char* name, const int& value)
+	{
+		NullRendererAPI::Record(NullCommand::SetUniform, sizeof(value));
+	}
+
+	void NullShader::Set(const char* name, const int* values, const uint32_t& count)
+	{
+		NullRendererAPI::Record(NullCommand::SetUniform, count * sizeof(int));
+	}
+
+	void NullShader::Set(const char* name, const float& value)
+	{
+		NullRendererAPI::Record(NullCommand::SetUniform, sizeof(value));
+	}
+
+	void NullShader::Set(const char* name, const glm::vec2& value)
+	{
+		NullRendererAPI::Record(NullCommand::SetUniform, sizeof(value));
+	}
+
+	void NullShader::Set(const char* name, const glm::vec3& value)
+	{
+		NullRendererAPI::Record(NullCommand::SetUniform, sizeof(value));
+	}
+
+	void NullShader::Set(const char* name, const glm::vec4& value)
+	{
+		NullRendererAPI::Record(NullCommand::SetUniform, sizeof(value));
+	}
+
+	void NullShader::Set(const char* name, const glm::mat3& value)
+	{
+		NullRendererAPI::Record(NullCommand::SetUniform, sizeof(value));
+	}
+
+	void NullShader::Set(const char* name, const glm::mat4& value)
+	{
+		NullRendererAPI::Record(NullCommand::SetUniform, sizeof(value));
+	}
+
+	bool NullShader::HasUniform(const char* name)
+	{
+		// No source is compiled, so every uniform is accepted
+		return true;
+	}
+}
@@ -0,0 +1,84 @@
+/******************************************************************************
+/*!
+\file       TextureNullImpl.cpp
+\author     Chua Zheng Yang
+\par        email: c.zhengyang\@digipen.edu
+\date       October 17, 2026
+\brief      Defines the headless 2D and cube map textures
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#include <BorealisPCH.hpp>
+#include <Graphics/Null/TextureNullImpl.hpp>
+#include <Graphics/Null/RendererAPINullImpl.hpp>
+
+namespace Borealis
+{
+	NullTexture2D::NullTexture2D(const std::string& path, std::optional<TextureConfig> textureConfig)
+		: mPath(path), mRendererID(NullRendererAPI::NextRendererID())
+	{
+		NullRendererAPI::Record(NullCommand::CreateResource);
+	}
+
+	NullTexture2D::NullTexture2D(const TextureInfo& textureInfo)
+		: mRendererID(NullRendererAPI::NextRendererID()), mWidth(textureInfo.width), mHeight(textureInfo.height)
+	{
+		NullRendererAPI::Record(NullCommand::CreateResource);
+	}
+
+	NullTexture2D::~NullTexture2D()
+	{
+		NullRendererAPI::Record(NullCommand::DestroyResource);
+	}
+
+	void NullTexture2D::SetData(void* data, uint32_t size)
+	{
+		NullRendererAPI::Record(NullCommand::Upload, size);
+	}
+
+	void NullTexture2D::Bind(uint32_t unit) const
+	{
+		NullRendererAPI::Record(NullCommand::BindTexture);
+	}
+
+	void NullTexture2D::swap(Asset& o)
+	{
+		NullTexture2D& other = dynamic_cast<NullTexture2D&>(o);
+		std::swap(mRendererID, other.mRendererID);
+		std::swap(mWidth, other.mWidth);
+		std::swap(mHeight, other.mHeight);
+		std::swap(mPath, other.mPath);
+	}
+
+	NullTextureCubeMap::NullTextureCubeMap(const std::filesystem::path& path)
+		: mPath(path.string()), mRendererID(NullRendererAPI::NextRendererID())
+	{
+		NullRendererAPI::Record(NullCommand::CreateResource);
+	}
+
+	NullTextureCubeMap::~NullTextureCubeMap()
+	{
+		NullRendererAPI::Record(NullCommand::DestroyResource);
+	}
+
+	void NullTextureCubeMap::SetData(void* data, uint32_t size)
+	{
+		NullRendererAPI::Record(NullCommand::Upload, size);
+	}
+
+	void NullTextureCubeMap::Bind(uint32_t unit) const
+	{
+		NullRendererAPI::Record(NullCommand::BindTexture);
+	}
+
+	void NullTextureCubeMap::swap(Asset& o)
+	{
+		NullTextureCubeMap& other = dynamic_cast<NullTextureCubeMap&>(o);
+		std::swap(mRendererID, other.mRendererID);
+		std::swap(mPath, other.mPath);
+	}
+}
@@ -0,0 +1,46 @@
+/******************************************************************************
+/*!
+\file       UniformBufferObjectNullImpl.cpp
+\author     Chan Guo Geng Gordon
+\par        email: g.chan/@digipen.edu
+\date       October 17, 2026
+\brief      Defines the headless uniform buffer object
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#include <BorealisPCH.hpp>
+#include <Graphics/Null/UniformBufferObjectNullImpl.hpp>
+#include <Graphics/Null/RendererAPINullImpl.hpp>
+
+namespace Borealis
+{
+	UniformBufferObjectNullImpl::UniformBufferObjectNullImpl(uint32_t size, uint32_t binding) : mSize(size)
+	{
+		NullRendererAPI::Record(NullCommand::CreateResource);
+	}
+
+	UniformBufferObjectNullImpl::~UniformBufferObjectNullImpl()
+	{
+		NullRendererAPI::Record(NullCommand::DestroyResource);
+	}
+
+	void UniformBufferObjectNullImpl::SetData(const void* data, uint32_t size, uint32_t offset)
+	{
+		BOREALIS_CORE_ASSERT(offset + size <= mSize, "Uniform buffer overflow");
+		NullRendererAPI::Record(NullCommand::Upload, size);
+	}
+
+	void UniformBufferObjectNullImpl::Bind()
+	{
+		NullRendererAPI::Record(NullCommand::StateChange);
+	}
+
+	void UniformBufferObjectNullImpl::BindToShader(uint32_t shaderID, const char* blockName, uint32_t binding)
+	{
+		NullRendererAPI::Record(NullCommand::StateChange);
+	}
+}
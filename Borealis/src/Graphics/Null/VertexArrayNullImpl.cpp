@@ -0,0 +1,51 @@
+/******************************************************************************
+/*!
+\file       VertexArrayNullImpl.cpp
+\author     Chua Zheng Yang
+\par        email: c.zhengyang\@digipen.edu
+\date       October 17, 2026
+\brief      Defines the headless vertex array
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#include <BorealisPCH.hpp>
+#include <Graphics/Null/VertexArrayNullImpl.hpp>
+#include <Graphics/Null/RendererAPINullImpl.hpp>
+
+namespace Borealis
+{
+	NullVertexArray::NullVertexArray()
+	{
+		NullRendererAPI::Record(NullCommand::CreateResource);
+	}
+
+	NullVertexArray::~NullVertexArray()
+	{
+		NullRendererAPI::Record(NullCommand::DestroyResource);
+	}
+
+	void NullVertexArray::Bind() const
+	{
+		NullRendererAPI::Record(NullCommand::BindBuffer);
+	}
+
+	void NullVertexArray::Unbind() const
+	{
+		NullRendererAPI::Record(NullCommand::BindBuffer);
+	}
+
+	void NullVertexArray::AddVertexBuffer(const Ref<VertexBuffer>& VBO, bool)
+	{
+		BOREALIS_CORE_ASSERT(VBO->GetLayout().GetElements().size(), "Vertex Buffer has no layout!");
+		mVBOs.push_back(VBO);
+	}
+
+	void NullVertexArray::SetElementBuffer(const Ref<ElementBuffer>& EBO)
+	{
+		mEBO = EBO;
+	}
+}
@@ -57,6 +57,12 @@ namespace Borealis
 		glDrawElements(GL_TRIANGLES, indexCount, GL_UNSIGNED_INT, nullptr);
 	}
 
+	void OpenGLRendererAPI::DrawElementsInstanced(const Ref<VertexArray>& VAO, uint32_t indexCount, uint32_t instanceCount)
+	{
+		VAO->Bind();
+		glDrawElementsInstanced(GL_TRIANGLES, indexCount, GL_UNSIGNED_INT, nullptr, instanceCount);
+	}
+
 	void OpenGLRendererAPI::DrawLines(const Ref<VertexArray>& VAO, uint32_t vertexCount)
 	{
 		VAO->Bind();
@@ -144,6 +144,10 @@ namespace Borealis
 
 		PushUniform(name, value);
 	}
+	bool OpenGLShader::HasUniform(const char* name)
+	{
+		return GetUniformLocation(name) != -1;
+	}
 	void OpenGLShader::PushUniform(const char* name, const int& value)
 	{
 		auto location = GetUniformLocation(name);
@@ -23,23 +23,11 @@ namespace Borealis
 		PROFILE_FUNCTION();
 
 		gli::texture Texture;
-		if (AssetManager::IsPakLoaded())
+		// gli parses stored textures straight from the pak mapping
+		PakAsset pakAsset = AssetManager::ReadFromPak(std::filesystem::path(path));
+		if (!pakAsset.empty())
 		{
-			// concat to the last path
-			try
-			{
-				std::string subPath = path.substr(path.find_last_of("/\\") + 1);
-				uint64_t id = std::stoull(subPath);
-				char* buffer;
-				uint64_t size;
-				AssetManager::RetrieveFromPak(id, buffer, size);
-				Texture = gli::load(buffer, size);
-				delete[] buffer;
-			}
-			catch (...)
-			{
-				Texture = gli::load(path);
-			}
+			Texture = gli::load(pakAsset.View().data(), pakAsset.View().size());
 		}
 		else
 		{
@@ -86,6 +74,7 @@ namespace Borealis
 
 		mWidth = Extent.x;
 		mHeight = Extent.y;
+		mMemorySize = Texture.size();
 
 		glGenTextures(1, &mRendererID);
 		glBindTexture(Target, mRendererID);
@@ -121,23 +110,11 @@ namespace Borealis
 	{
 		PROFILE_FUNCTION();
 		gli::texture Texture;
-		if (AssetManager::IsPakLoaded())
+		// gli parses stored textures straight from the pak mapping
+		PakAsset pakAsset = AssetManager::ReadFromPak(std::filesystem::path(path));
+		if (!pakAsset.empty())
 		{
-			// concat to the last path
-			try
-			{
-				std::string subPath = path.substr(path.find_last_of("/\\") + 1);
-				uint64_t id = std::stoull(subPath);
-				char* buffer;
-				uint64_t size;
-				AssetManager::RetrieveFromPak(id, buffer, size);
-				Texture = gli::load(buffer, size);
-				delete[] buffer;
-			}
-			catch(...)
-			{
-				Texture = gli::load(path);
-			}
+			Texture = gli::load(pakAsset.View().data(), pakAsset.View().size());
 		}
 		else
 		{
@@ -192,6 +169,7 @@ namespace Borealis
 
 		mWidth = Extent.x;
 		mHeight = Extent.y;
+		mMemorySize = Texture.size();
 
 		glGenTextures(1, &mRendererID);
 		glBindTexture(Target, mRendererID);
@@ -305,6 +283,7 @@ namespace Borealis
 		glGenTextures(1, &mRendererID);
 		glBindTexture(GL_TEXTURE_2D, mRendererID);
 		glTexImage2D(GL_TEXTURE_2D, 0, mInternalFormat, mWidth, mHeight, 0, mDataFormat, GL_UNSIGNED_BYTE, nullptr);
+		mMemorySize = static_cast<uint64_t>(mWidth) * mHeight * 4;
 
 		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
 		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
@@ -377,6 +356,7 @@ namespace Borealis
 		std::swap(mChannels, other.mChannels);
 		std::swap(mValid, other.mValid);
 		std::swap(mPath, other.mPath);
+		std::swap(mMemorySize, other.mMemorySize);
 	}
 
 
@@ -386,23 +366,11 @@ namespace Borealis
 
 		// Load the texture using gli
 		gli::texture Texture;
-		if (AssetManager::IsPakLoaded())
+		// gli parses stored textures straight from the pak mapping
+		PakAsset pakAsset = AssetManager::ReadFromPak(path);
+		if (!pakAsset.empty())
 		{
-			try
-			{
-				// concat to the last path
-				std::string subPath = path.filename().string();
-				uint64_t id = std::stoull(subPath);
-				char* buffer;
-				uint64_t size;
-				AssetManager::RetrieveFromPak(id, buffer, size);
-				Texture = gli::load(buffer, size);
-				delete[] buffer;
-			}
-			catch (...)
-			{
-				Texture = gli::load(path.string());
-			}
+			Texture = gli::load(pakAsset.View().data(), pakAsset.View().size());
 		}
 		else
 		{
@@ -456,6 +424,7 @@ namespace Borealis
 
 		mWidth = Extent.x;
 		mHeight = Extent.y;
+		mMemorySize = Texture.size();
 
 		glGenTextures(1, &mRendererID);
 		glBindTexture(Target, mRendererID);
@@ -20,7 +20,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 
 namespace Borealis
 {
-	UniformBufferObjectOpenGLImpl::UniformBufferObjectOpenGLImpl(uint32_t size, uint32_t binding)
+	UniformBufferObjectOpenGLImpl::UniformBufferObjectOpenGLImpl(uint32_t size, uint32_t binding) : mBinding(binding)
 	{
 		glGenBuffers(1, &mRendererID);
 		glBindBuffer(GL_UNIFORM_BUFFER, mRendererID);
@@ -41,6 +41,11 @@ namespace Borealis
 		glBindBuffer(GL_UNIFORM_BUFFER, 0);
 	}
 
+	void UniformBufferObjectOpenGLImpl::Bind()
+	{
+		glBindBufferBase(GL_UNIFORM_BUFFER, mBinding, mRendererID);
+	}
+
 	int UniformBufferObjectOpenGLImpl::GetBlockSize(uint32_t shaderID, const char* blockName)
 	{
 		GLuint blockIndex = glGetUniformBlockIndex(shaderID, blockName);
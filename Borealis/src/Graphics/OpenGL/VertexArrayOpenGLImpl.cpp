@@ -61,7 +61,7 @@ namespace Borealis {
 
 		glBindVertexArray(0);
 	}
-	void OpenGLVertexArray::AddVertexBuffer(const Ref<VertexBuffer>& VBO)
+	void OpenGLVertexArray::AddVertexBuffer(const Ref<VertexBuffer>& VBO, bool perInstance)
 	{
 		PROFILE_FUNCTION();
 
@@ -70,7 +70,7 @@ namespace Borealis {
 		glBindVertexArray(mRendererID);
 		VBO->Bind();
 
-		uint32_t index = 0;
+		uint32_t& index = mAttributeIndex;
 		for (const auto& element : VBO->GetLayout())
 		{
 			if (element.mType >= ShaderDataType::Int)
@@ -86,6 +86,7 @@ namespace Borealis {
 				glVertexAttribPointer(index, element.GetComponentCount(), ShaderDataTypeToOpenGLBaseType(element.mType),
 					element.mNormalized ? GL_TRUE : GL_FALSE, VBO->GetLayout().GetStride(), (const void*)element.mOffset);
 			}
+			glVertexAttribDivisor(index, perInstance ? 1 : 0);
 			index++;
 		}
 
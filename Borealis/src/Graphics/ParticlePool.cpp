@@ -0,0 +1,160 @@
+/******************************************************************************
+/*!
+\file       ParticlePool.cpp
+\author     Chan Guo Geng Gordon
+\par        email: g.chan/@digipen.edu
+\date       October 17, 2026
+\brief      Defines the structure-of-arrays storage and update kernels for
+			particle systems
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#include <BorealisPCH.hpp>
+#include <glm/gtc/noise.hpp>
+#include <Graphics/ParticlePool.hpp>
+
+namespace Borealis
+{
+	void ParticlePool::Clear()
+	{
+		posX.clear(); posY.clear(); posZ.clear();
+		velX.clear(); velY.clear(); velZ.clear();
+		life.clear();
+		size.clear();
+		rotation.clear();
+		startColor.clear();
+		color.clear();
+	}
+
+	void ParticlePool::Reserve(uint32_t capacity)
+	{
+		posX.reserve(capacity); posY.reserve(capacity); posZ.reserve(capacity);
+		velX.reserve(capacity); velY.reserve(capacity); velZ.reserve(capacity);
+		life.reserve(capacity);
+		size.reserve(capacity);
+		rotation.reserve(capacity);
+		startColor.reserve(capacity);
+		color.reserve(capacity);
+	}
+
+	uint32_t ParticlePool::Add()
+	{
+		uint32_t index = Size();
+		posX.emplace_back(); posY.emplace_back(); posZ.emplace_back();
+		velX.emplace_back(); velY.emplace_back(); velZ.emplace_back();
+		life.emplace_back(0.f);
+		size.emplace_back(1.f);
+		rotation.emplace_back(1.f, 0.f, 0.f, 0.f);
+		startColor.emplace_back(1.f);
+		color.emplace_back(1.f);
+		return index;
+	}
+
+	void ParticlePool::Remove(uint32_t index)
+	{
+		uint32_t last = Size() - 1;
+		if (index != last)
+		{
+			posX[index] = posX[last]; posY[index] = posY[last]; posZ[index] = posZ[last];
+			velX[index] = velX[last]; velY[index] = velY[last]; velZ[index] = velZ[last];
+			life[index] = life[last];
+			size[index] = size[last];
+			rotation[index] = rotation[last];
+			startColor[index] = startColor[last];
+			color[index] = color[last];
+		}
+
+		posX.pop_back(); posY.pop_back(); posZ.pop_back();
+		velX.pop_back(); velY.pop_back(); velZ.pop_back();
+		life.pop_back();
+		size.pop_back();
+		rotation.pop_back();
+		startColor.pop_back();
+		color.pop_back();
+	}
+
+	void ParticlePool::Age(float dt, float lifeTime)
+	{
+		uint32_t const count = Size();
+		float* __restrict lifePtr = life.data();
+		for (uint32_t i = 0; i < count; ++i)
+		{
+			lifePtr[i] += dt;
+		}
+
+		// walk backwards so the particle moved into a freed slot was already checked
+		for (uint32_t i = count; i-- > 0;)
+		{
+			if (life[i] >= lifeTime)
+			{
+				Remove(i);
+			}
+		}
+	}
+
+	void ParticlePool::Accelerate(glm::vec3 const& acceleration, float dt)
+	{
+		uint32_t const count = Size();
+		float const ax = acceleration.x * dt;
+		float const ay = acceleration.y * dt;
+		float const az = acceleration.z * dt;
+		float* __restrict vx = velX.data();
+		float* __restrict vy = velY.data();
+		float* __restrict vz = velZ.data();
+		for (uint32_t i = 0; i < count; ++i)
+		{
+			vx[i] += ax;
+			vy[i] += ay;
+			vz[i] += az;
+		}
+	}
+
+	void ParticlePool::ApplyNoise(float frequency, float strength, float scroll, float dt)
+	{
+		uint32_t const count = Size();
+		float const scale = strength * dt;
+		for (uint32_t i = 0; i < count; ++i)
+		{
+			// Sample noise for each axis with offsets to decorrelate
+			glm::vec3 noiseInput = glm::vec3(posX[i], posY[i], posZ[i]) * frequency + glm::vec3(scroll);
+			velX[i] += glm::perlin(noiseInput) * scale;
+			velY[i] += glm::perlin(noiseInput + glm::vec3(100.0f, 0.0f, 0.0f)) * scale;
+			velZ[i] += glm::perlin(noiseInput + glm::vec3(200.0f, 0.0f, 0.0f)) * scale;
+		}
+	}
+
+	void ParticlePool::Integrate(float dt)
+	{
+		uint32_t const count = Size();
+		float* __restrict px = posX.data();
+		float* __restrict py = posY.data();
+		float* __restrict pz = posZ.data();
+		float const* __restrict vx = velX.data();
+		float const* __restrict vy = velY.data();
+		float const* __restrict vz = velZ.data();
+		for (uint32_t i = 0; i < count; ++i)
+		{
+			px[i] += vx[i] * dt;
+			py[i] += vy[i] * dt;
+			pz[i] += vz[i] * dt;
+		}
+	}
+
+	void ParticlePool::FadeColor(glm::vec4 const& endColor, float lifeTime)
+	{
+		uint32_t const count = Size();
+		float const invLifeTime = 1.f / lifeTime;
+		float const* __restrict lifePtr = life.data();
+		glm::vec4 const* __restrict start = startColor.data();
+		glm::vec4* __restrict current = color.data();
+		for (uint32_t i = 0; i < count; ++i)
+		{
+			float t = lifePtr[i] * invLifeTime; // Normalized lifetime (0 to 1)
+			current[i] = start[i] + t * (endColor - start[i]);
+		}
+	}
+}
@@ -0,0 +1,162 @@
+/******************************************************************************
+/*!
+\file       ParticleRenderer.cpp
+\author     Chan Guo Geng Gordon
+\par        email: g.chan/@digipen.edu
+\date       October 17, 2026
+\brief      Defines the instanced renderer that draws particle pools directly
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#include <BorealisPCH.hpp>
+#include <Graphics/ParticleRenderer.hpp>
+#include <Graphics/VertexArray.hpp>
+#include <Graphics/Shader.hpp>
+#include <Graphics/RenderCommand.hpp>
+#include <Graphics/UniformBufferObject.hpp>
+#include <Graphics/UBOBindings.hpp>
+
+namespace Borealis
+{
+	struct ParticleCorner
+	{
+		glm::vec2 Corner;
+		glm::vec2 TexCoord;
+	};
+
+	// one per particle, read with a divisor of 1
+	struct ParticleInstance
+	{
+		glm::vec3 Position;
+		glm::vec3 Size;
+		glm::vec4 Rotation; // quaternion as xyzw
+		glm::vec4 Colour;
+	};
+
+	struct ParticleRendererData
+	{
+		static const uint32_t InitialCapacity = 1024;
+
+		Ref<VertexArray> mVAO;
+		Ref<VertexBuffer> mCornerVBO;
+		Ref<ElementBuffer> mEBO;
+		Ref<VertexBuffer> mInstanceVBO;
+		Ref<Shader> mShader;
+
+		std::vector<ParticleInstance> mStaging;
+		uint32_t mCapacity = 0;
+
+		ParticleRenderer::Statistics mStats;
+	};
+
+	static ParticleRendererData* sData;
+
+	static void CreateInstanceBuffer(uint32_t capacity)
+	{
+		sData->mInstanceVBO = VertexBuffer::Create(capacity * sizeof(ParticleInstance));
+		sData->mInstanceVBO->SetLayout({
+			{ ShaderDataType::Float3, "a_Position" },
+			{ ShaderDataType::Float3, "a_Size" },
+			{ ShaderDataType::Float4, "a_Rotation" },
+			{ ShaderDataType::Float4, "a_Colour" }
+			});
+
+		// attribute locations are assigned in order, so the corner buffer goes first
+		sData->mVAO = VertexArray::Create();
+		sData->mVAO->AddVertexBuffer(sData->mCornerVBO);
+		sData->mVAO->AddVertexBuffer(sData->mInstanceVBO, true);
+		sData->mVAO->SetElementBuffer(sData->mEBO);
+
+		sData->mCapacity = capacity;
+	}
+
+	void ParticleRenderer::Init()
+	{
+		PROFILE_FUNCTION();
+
+		sData = new ParticleRendererData();
+
+		// same corners and texture coordinates as the Renderer2D quad
+		ParticleCorner corners[] = {
+			{ { -0.5f, -0.5f }, { 0.0f, 1.0f } },
+			{ {  0.5f, -0.5f }, { 1.0f, 1.0f } },
+			{ {  0.5f,  0.5f }, { 1.0f, 0.0f } },
+			{ { -0.5f,  0.5f }, { 0.0f, 0.0f } }
+		};
+		sData->mCornerVBO = VertexBuffer::Create(reinterpret_cast<float*>(corners), sizeof(corners));
+		sData->mCornerVBO->SetLayout({
+			{ ShaderDataType::Float2, "a_Corner" },
+			{ ShaderDataType::Float2, "a_TexCoord" }
+			});
+
+		uint32_t indices[] = { 0, 1, 2, 2, 3, 0 };
+		sData->mEBO = ElementBuffer::Create(indices, 6);
+
+		CreateInstanceBuffer(ParticleRendererData::InitialCapacity);
+		sData->mStaging.reserve(ParticleRendererData::InitialCapacity);
+
+		sData->mShader = Shader::Create("engineResources/shaders/Renderer3D_Particle.glsl");
+		sData->mShader->Bind();
+		sData->mShader->Set("u_Texture", 0);
+		UniformBufferObject::BindToShader(sData->mShader->GetID(), "Camera", CAMERA_BIND);
+	}
+
+	void ParticleRenderer::Free()
+	{
+		PROFILE_FUNCTION();
+		delete sData;
+		sData = nullptr;
+	}
+
+	void ParticleRenderer::DrawEmitter(ParticlePool const& particles, Ref<Texture2D> const& texture, bool billboard)
+	{
+		PROFILE_FUNCTION();
+
+		uint32_t const count = particles.Size();
+		if (count == 0) return;
+
+		if (count > sData->mCapacity)
+		{
+			uint32_t capacity = sData->mCapacity;
+			while (capacity < count) capacity *= 2;
+			CreateInstanceBuffer(capacity);
+		}
+
+		sData->mStaging.resize(count);
+		ParticleInstance* __restrict out = sData->mStaging.data();
+		for (uint32_t i = 0; i < count; ++i)
+		{
+			glm::quat const& rotation = particles.rotation[i];
+			out[i].Position = { particles.posX[i], particles.posY[i], particles.posZ[i] };
+			out[i].Size = particles.size[i];
+			out[i].Rotation = { rotation.x, rotation.y, rotation.z, rotation.w };
+			out[i].Colour = particles.color[i];
+		}
+
+		uint32_t const bytes = count * sizeof(ParticleInstance);
+		sData->mInstanceVBO->SetData(out, bytes);
+
+		texture->Bind(0);
+		sData->mShader->Bind();
+		sData->mShader->Set("u_Billboard", billboard ? 1 : 0);
+		RenderCommand::DrawElementsInstanced(sData->mVAO, 6, count);
+
+		sData->mStats.DrawCalls++;
+		sData->mStats.ParticleCount += count;
+		sData->mStats.UploadedBytes += bytes;
+	}
+
+	void ParticleRenderer::ResetStats()
+	{
+		sData->mStats = {};
+	}
+
+	ParticleRenderer::Statistics& ParticleRenderer::GetStats()
+	{
+		return sData->mStats;
+	}
+}
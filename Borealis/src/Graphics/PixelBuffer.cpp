@@ -18,6 +18,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include <Core/Core.hpp>
 #include <Graphics/Renderer.hpp>
 #include <Graphics/OpenGL/PixelBufferOpenGLImpl.hpp>
+#include <Graphics/Null/PixelBufferNullImpl.hpp>
 
 namespace Borealis
 {
@@ -27,6 +28,7 @@ namespace Borealis
 		{
 		case RendererAPI::API::None:    BOREALIS_CORE_ASSERT(false, "RendererAPI::None is currently not supported"); return nullptr;
 		case RendererAPI::API::OpenGL:  return MakeRef<OpenGLPixelBuffer>(properties);
+		case RendererAPI::API::Null:    return MakeRef<NullPixelBuffer>(properties);
 		}
 
 		BOREALIS_CORE_ASSERT(false, "Unknown RendererAPI");
@@ -15,10 +15,9 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include <BorealisPCH.hpp>
 #include <Graphics/RenderCommand.hpp>
 #include <Graphics/RendererAPI.hpp>
-#include <Graphics/OpenGL/RendererAPIOpenGLImpl.hpp>
 
 
 namespace Borealis
 {
-	std::unique_ptr<RendererAPI> RenderCommand::sRendererAPI = std::make_unique<OpenGLRendererAPI>();
+	std::unique_ptr<RendererAPI> RenderCommand::sRendererAPI = RendererAPI::Create();
 }
\ No newline at end of file
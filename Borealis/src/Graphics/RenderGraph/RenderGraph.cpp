@@ -21,6 +21,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include <Graphics/Frustum.hpp>
 #include <Graphics/Renderer3D.hpp>
 #include <Graphics/Renderer2D.hpp>
+#include <Graphics/ParticleRenderer.hpp>
 #include <Graphics/RenderCommand.hpp>
 #include <Scene/Components.hpp>
 #include <Scene/SceneManager.hpp>
@@ -28,6 +29,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include <Graphics/PixelBuffer.hpp>
 #include <Graphics/UniformBufferObject.hpp>
 #include <Graphics/UBOBindings.hpp>
+#include <Core/JobSystem.hpp>
 
 //shadows
 #define S_MATERIALSHADOW true
@@ -78,7 +80,6 @@ namespace Borealis
 		CameraData cameraData;
 		Ref<UniformBufferObject> CameraUBO;
 
-		Ref<UniformBufferObject> AnimationUBO;
 
 		Ref<UniformBufferObject> LightsUBO;
 
@@ -100,6 +101,15 @@ namespace Borealis
 		Width = framebuffer->GetProperties().Width;
 		Height = framebuffer->GetProperties().Height;
 	}
+
+	void RenderTargetSource::Refresh()
+	{
+		if (buffer)
+		{
+			Width = buffer->GetProperties().Width;
+			Height = buffer->GetProperties().Height;
+		}
+	}
 	
 	BoolSource::BoolSource(std::string name, bool ref) : mRef(ref)
 	{
@@ -198,6 +208,15 @@ namespace Borealis
 		}
 	}
 
+	void PixelBufferSource::Refresh()
+	{
+		if (buffer)
+		{
+			Width = buffer->GetProperties().Width;
+			Height = buffer->GetProperties().Height;
+		}
+	}
+
 	void PixelBufferSource::ReadTexture(uint32_t index)
 	{
 		buffer->ReadTexture(index);
@@ -228,6 +247,19 @@ namespace Borealis
 		sourceName = name;
 		sourceType = RenderSourceType::Camera;
 
+		Set(camera);
+	}
+
+	CameraSource::CameraSource(std::string name, const Camera& camera, const glm::mat4& transform)
+	{
+		sourceName = name;
+		sourceType = RenderSourceType::Camera;
+
+		Set(camera, transform);
+	}
+
+	void CameraSource::Set(EditorCamera const& camera)
+	{
 		projMtx = camera.GetProjectionMatrix();
 		viewMtx = camera.GetViewMatrix();
 		viewProj = camera.GetViewProjectionMatrix();
@@ -241,11 +273,8 @@ namespace Borealis
 		aspectRatio = camera.GetAspectRatio();
 	}
 
-	CameraSource::CameraSource(std::string name, const Camera& camera, const glm::mat4& transform)
+	void CameraSource::Set(const Camera& camera, const glm::mat4& transform)
 	{
-		sourceName = name;
-		sourceType = RenderSourceType::Camera;
-
 		projMtx = camera.GetProjectionMatrix();
 		viewMtx = glm::inverse(transform);
 		viewProj = camera.GetProjectionMatrix() * glm::inverse(transform);
@@ -289,10 +318,59 @@ namespace Borealis
 		sinkList.push_back(MakeRef<RenderSink>(sink));
 	}
 
+	//========================================================================
+	//RENDER SINK
+	//========================================================================
+	void RenderSink::Resolve(Ref<RenderSource> const& resolved)
+	{
+		source = resolved;
+
+		boolSource = nullptr;
+		intSource = nullptr;
+		vec2IntSource = nullptr;
+		intListSource = nullptr;
+		renderTarget = nullptr;
+		gBuffer = nullptr;
+		pixelBuffer = nullptr;
+		camera = nullptr;
+
+		if (!source) return;
+
+		switch (source->sourceType)
+		{
+		case RenderSourceType::Bool:
+			boolSource = std::static_pointer_cast<BoolSource>(source);
+			break;
+		case RenderSourceType::IntRef:
+			intSource = std::static_pointer_cast<IntSource>(source);
+			break;
+		case RenderSourceType::Vec2Int:
+			vec2IntSource = std::static_pointer_cast<Vec2IntSource>(source);
+			break;
+		case RenderSourceType::IntList:
+			intListSource = std::static_pointer_cast<IntListSource>(source);
+			break;
+		case RenderSourceType::RenderTargetColor:
+			renderTarget = std::static_pointer_cast<RenderTargetSource>(source);
+			break;
+		case RenderSourceType::GBuffer:
+			gBuffer = std::static_pointer_cast<GBufferSource>(source);
+			break;
+		case RenderSourceType::PixelBuffer:
+			pixelBuffer = std::static_pointer_cast<PixelBufferSource>(source);
+			break;
+		case RenderSourceType::Camera:
+			camera = std::static_pointer_cast<CameraSource>(source);
+			break;
+		default:
+			break;
+		}
+	}
+
 	void RenderPass::Bind()
 	{
 		if (shader) shader->Bind();
-		for (auto sink : sinkList)
+		for (auto const& sink : sinkList)
 		{
 			if (sink->source)
 			{
@@ -304,7 +382,7 @@ namespace Borealis
 
 	void RenderPass::Unbind()
 	{
-		for (auto sink : sinkList)
+		for (auto const& sink : sinkList)
 		{
 			if (sink->source)
 			{
@@ -540,66 +618,57 @@ namespace Borealis
 			cubeMap = TextureCubeMap::GetDefaultCubeMap2();
 		}
 
-		for (auto sink : sinkList)
+		for (auto const& sink : sinkList)
 		{
 			if (sink->source->sourceType == RenderSourceType::Camera)
 			{
-				sData->cameraData.ViewProjection = std::dynamic_pointer_cast<CameraSource>(sink->source)->GetViewProj();
-				sData->cameraData.CameraPos = glm::vec4(std::dynamic_pointer_cast<CameraSource>(sink->source)->position,0.f);
+				sData->cameraData.ViewProjection = sink->camera->GetViewProj();
+				sData->cameraData.CameraPos = glm::vec4(sink->camera->position,0.f);
 				sData->CameraUBO->SetData(&sData->cameraData, sizeof(RenderData::CameraData));
-				viewProjMatrix = std::dynamic_pointer_cast<CameraSource>(sink->source)->GetViewProj();
-				editor = std::dynamic_pointer_cast<CameraSource>(sink->source)->editor;
+				viewProjMatrix = sink->camera->GetViewProj();
+				editor = sink->camera->editor;
 
-				camera = std::dynamic_pointer_cast<CameraSource>(sink->source);
+				camera = sink->camera;
 			}
 
 			if (sink->source->sourceType == RenderSourceType::RenderTargetColor)
 			{
 				if(sink->sinkName == "renderTarget")
 				{
-					renderTarget = std::dynamic_pointer_cast<RenderTargetSource>(sink->source);
+					renderTarget = sink->renderTarget;
 					renderTarget->buffer->ClearAttachment(1, -1);
 				}
 
 				if (sink->sinkName == "accumulaionTarget")
 				{
-					accumulaionTarget = std::dynamic_pointer_cast<RenderTargetSource>(sink->source);
+					accumulaionTarget = sink->renderTarget;
 					accumulaionTarget->buffer->ClearAttachment(1, -1);
 				}			
 
 				if (sink->sinkName == "shadowMap")
 				{
-					shadowMap = std::dynamic_pointer_cast<RenderTargetSource>(sink->source);
+					shadowMap = sink->renderTarget;
 				}
 			}
 		}
 
 		Frustum frustum = ComputeFrustum(viewProjMatrix);
+		static std::vector<entt::entity> visibleEntities;
+		visibleEntities.clear();
+		SceneManager::GetActiveScene()->GetRenderBVH().QueryFrustum(frustum, visibleEntities);
+
 		//mesh pass
 		{
 			static Ref<Shader> materialShader = nullptr;
-			auto group = registryPtr->group<>(entt::get<TransformComponent, MeshFilterComponent, MeshRendererComponent>);
-			for (auto& entity : group)
+			auto view = registryPtr->view<TransformComponent, MeshFilterComponent, MeshRendererComponent, ActiveTag>();
+			for (auto entity : visibleEntities)
 			{
-				Entity brEntity = { entity, SceneManager::GetActiveScene().get() };
-				if (!brEntity.IsActive())
-				{
-					continue;
-				}
+				if (!view.contains(entity)) continue;
 
-				auto [transform, meshFilter, meshRenderer] = group.get<TransformComponent, MeshFilterComponent, MeshRendererComponent>(entity);
+				auto [transform, meshFilter, meshRenderer] = view.get<TransformComponent, MeshFilterComponent, MeshRendererComponent>(entity);
 
 				if (!meshFilter.Model || !meshRenderer.Material || !meshRenderer.active) continue;
 
-				BoundingSphere modelBoundingSphere = meshFilter.Model->mBoundingSphere;
-				modelBoundingSphere.Transform(transform.GetGlobalTransform());
-
-
-				if (CullBoundingSphere(frustum, modelBoundingSphere))
-				{
-					continue;
-				}
-
 				if (!materialShader || materialShader != meshRenderer.Material->GetShader())
 				{
 					materialShader = meshRenderer.Material->GetShader();
@@ -617,16 +686,12 @@ namespace Borealis
 		{
 			//Add uniforms to drawInfo, pass it to drawqueue
 			//Add lights and animations to UBO
-			auto group = registryPtr->group<>(entt::get<TransformComponent, SkinnedMeshRendererComponent>);
-			for (auto& entity : group)
+			auto view = registryPtr->view<TransformComponent, SkinnedMeshRendererComponent, ActiveTag>();
+			for (auto entity : visibleEntities)
 			{
-				Entity brEntity = { entity, SceneManager::GetActiveScene().get() };
-				if (!brEntity.IsActive())
-				{
-					continue;
-				}
+				if (!view.contains(entity)) continue;
 
-				auto [transform, skinnedMesh] = group.get<TransformComponent, SkinnedMeshRendererComponent>(entity);
+				auto [transform, skinnedMesh] = view.get<TransformComponent, SkinnedMeshRendererComponent>(entity);
 
 				if (!skinnedMesh.SkinnnedModel || !skinnedMesh.Material) continue;
 
@@ -675,13 +740,6 @@ namespace Borealis
 
 				//Renderer3D::SetLights(materialShader);
 				Renderer3D::DrawSkinnedMesh(transform.GetGlobalTransform(), skinnedMesh, materialShader, (int)entity, skinnedMesh.AnimationIndex);
-
-				if (skinnedMesh.AnimationIndex > 6)
-				{
-					renderTarget->Bind();
-					Renderer3D::End();
-					renderTarget->Unbind();
-				}
 			}
 		}
 
@@ -745,21 +803,21 @@ namespace Borealis
 		Ref<RenderTargetSource> renderTarget = nullptr;
 		bool editor = false;
 
-		for (auto sink : sinkList)
+		for (auto const& sink : sinkList)
 		{
 			if (sink->source->sourceType == RenderSourceType::Camera)
 			{
-				//sData->cameraData.ViewProjection = std::dynamic_pointer_cast<CameraSource>(sink->source)->GetViewProj();
+				//sData->cameraData.ViewProjection = sink->camera->GetViewProj();
 				//sData->CameraUBO->SetData(&sData->cameraData, sizeof(RenderData::CameraData));
-				Renderer2D::Begin(std::dynamic_pointer_cast<CameraSource>(sink->source)->GetViewProj());
-				editor = std::dynamic_pointer_cast<CameraSource>(sink->source)->editor;
+				Renderer2D::Begin(sink->camera->GetViewProj());
+				editor = sink->camera->editor;
 			}
 
 			if (sink->source->sourceType == RenderSourceType::RenderTargetColor)
 			{
 				if (sink->sinkName == "renderTarget")
 				{
-					renderTarget = std::dynamic_pointer_cast<RenderTargetSource>(sink->source);
+					renderTarget = sink->renderTarget;
 				}
 			}
 		}
@@ -780,16 +838,10 @@ namespace Borealis
 			}
 		}
 		{
-			auto group = registryPtr->group<>(entt::get<TransformComponent, CircleRendererComponent>);
-			for (auto& entity : group)
+			auto view = registryPtr->view<TransformComponent, CircleRendererComponent, ActiveTag>();
+			for (auto entity : view)
 			{
-				Entity brEntity = { entity, SceneManager::GetActiveScene().get() };
-				if (!brEntity.IsActive())
-				{
-					continue;
-				}
-
-				auto [transform, circle] = group.get<TransformComponent, CircleRendererComponent>(entity);
+				auto [transform, circle] = view.get<TransformComponent, CircleRendererComponent>(entity);
 				Renderer2D::DrawCircle(transform.GetGlobalTransform(), circle.Colour, circle.thickness, circle.fade, (int)entity);
 			}
 		}
@@ -854,30 +906,26 @@ namespace Borealis
 			if (parent.HasComponent<ParticleSystemComponent>())
 			{
 				ParticleSystemComponent & particleSystem = parent.GetComponent<ParticleSystemComponent>();
-				std::vector<Particle> const& particles = particleSystem.GetParticles();
-				for (Particle const& particle : particles)
+				ParticlePool const& particles = particleSystem.GetParticles();
+				for (uint32_t i = 0; i < particles.Size(); ++i)
 				{
-					if (!particle.isActive)
-					{
-						continue;
-					}
-
-					glm::mat4 transfromP = glm::translate(glm::mat4(1.0f), particle.position) *
-						glm::toMat4(particle.startRotation) *
-						glm::scale(glm::mat4(1.0f), particle.startSize);
+					glm::vec3 position{ particles.posX[i], particles.posY[i], particles.posZ[i] };
+					glm::mat4 transfromP = glm::translate(glm::mat4(1.0f), position) *
+						glm::toMat4(particles.rotation[i]) *
+						glm::scale(glm::mat4(1.0f), particles.size[i]);
 
 					transfromP = canvasTransform * transfromP;
 
 					float tileFactor = 1.f;
 					if (particleSystem.billboard)
 					{
-						tileFactor = particle.startSize[0] * -1;
+						tileFactor = particles.size[i][0] * -1;
 					}
 
 					if (particleSystem.texture)
-						Renderer2D::DrawQuad(transfromP, particleSystem.texture, tileFactor, particle.currentColor, -1, particleSystem.billboard);
+						Renderer2D::DrawQuad(transfromP, particleSystem.texture, tileFactor, particles.color[i], -1, particleSystem.billboard);
 					else
-						Renderer2D::DrawQuad(transfromP, ParticleSystemComponent::GetDefaultParticleTexture(), tileFactor, particle.currentColor, -1, particleSystem.billboard);
+						Renderer2D::DrawQuad(transfromP, ParticleSystemComponent::GetDefaultParticleTexture(), tileFactor, particles.color[i], -1, particleSystem.billboard);
 				}
 			}
 
@@ -983,19 +1031,19 @@ namespace Borealis
 		Ref<RenderTargetSource> renderTarget = nullptr;
 		glm::mat4 viewProjMatrix{};
 
-		for (auto sink : sinkList)
+		for (auto const& sink : sinkList)
 		{
 			if (sink->source->sourceType == RenderSourceType::RenderTargetColor)
 			{
 				if (sink->sinkName == "renderTarget")
 				{
-					renderTarget = std::dynamic_pointer_cast<RenderTargetSource>(sink->source);
+					renderTarget = sink->renderTarget;
 				}
 			}
 
 			if (sink->source->sourceType == RenderSourceType::Camera)
 			{
-				viewProjMatrix = std::dynamic_pointer_cast<CameraSource>(sink->source)->GetViewProj();
+				viewProjMatrix = sink->camera->GetViewProj();
 			}
 		}
 
@@ -1042,7 +1090,7 @@ namespace Borealis
 		shader->Set("u_lightPass", false);
 		Ref<FrameBuffer> gBuffer = nullptr;
 		glm::mat4 viewProjMatrix{};
-		for (auto sink : sinkList)
+		for (auto const& sink : sinkList)
 		{
 			if (sink->source)
 			{
@@ -1050,7 +1098,7 @@ namespace Borealis
 
 				if (sourcePtr->sourceType == RenderSourceType::GBuffer)
 				{
-					gBuffer = std::dynamic_pointer_cast<GBufferSource>(sourcePtr)->buffer;
+					gBuffer = sink->gBuffer->buffer;
 					gBuffer->Bind();
 					RenderCommand::Clear();
 					RenderCommand::SetClearColor({ 0.1f, 0.1f, 0.1f, 1 });
@@ -1063,34 +1111,25 @@ namespace Borealis
 
 				if (sourcePtr->sourceType == RenderSourceType::Camera)
 				{
-					viewProjMatrix = std::dynamic_pointer_cast<CameraSource>(sourcePtr)->GetViewProj();
+					viewProjMatrix = sink->camera->GetViewProj();
 					shader->Set("u_ViewProjection", viewProjMatrix);
 				}
 			}
 		}
 		Frustum frustum = ComputeFrustum(viewProjMatrix);
+		static std::vector<entt::entity> visibleEntities;
+		visibleEntities.clear();
+		SceneManager::GetActiveScene()->GetRenderBVH().QueryFrustum(frustum, visibleEntities);
 
 		{
 			RenderCommand::DisableBlend();
-			auto group = registryPtr->group<>(entt::get<TransformComponent, MeshFilterComponent, MeshRendererComponent>);
-			for (auto& entity : group)
+			auto view = registryPtr->view<TransformComponent, MeshFilterComponent, MeshRendererComponent, ActiveTag>();
+			for (auto entity : visibleEntities)
 			{
-				Entity brEntity = { entity, SceneManager::GetActiveScene().get() };
-				if (!brEntity.IsActive())
-				{
-					continue;
-				}
-				auto [transform, meshFilter, meshRenderer] = group.get<TransformComponent, MeshFilterComponent, MeshRendererComponent>(entity);
-				if (!meshFilter.Model || !meshRenderer.Material || !meshRenderer.active) continue;
-				BoundingSphere modelBoundingSphere = meshFilter.Model->mBoundingSphere;
-				modelBoundingSphere.Transform(transform.GetGlobalTransform());
-
+				if (!view.contains(entity)) continue;
 
-				if (CullBoundingSphere(frustum, modelBoundingSphere))
-				{
-					//BOREALIS_CORE_INFO("Culling entity {}", (int)entity);
-					continue;
-				}
+				auto [transform, meshFilter, meshRenderer] = view.get<TransformComponent, MeshFilterComponent, MeshRendererComponent>(entity);
+				if (!meshFilter.Model || !meshRenderer.Material || !meshRenderer.active) continue;
 
 				Renderer3D::DrawMesh(transform.GetGlobalTransform(), meshFilter, meshRenderer, shader,(int)entity);
 			}
@@ -1114,26 +1153,26 @@ namespace Borealis
 
 		Ref<GBufferSource> gBuffer = nullptr;
 		Ref<FrameBuffer> renderTarget = nullptr;
-		for (auto sink : sinkList)
+		for (auto const& sink : sinkList)
 		{
 			if (sink->source)
 			{
 				auto sourcePtr = sink->source;
 				if (sourcePtr->sourceType == RenderSourceType::GBuffer)
 				{
-					gBuffer = std::dynamic_pointer_cast<GBufferSource>(sourcePtr);
+					gBuffer = sink->gBuffer;
 				}
 
 				if (sourcePtr->sourceType == RenderSourceType::RenderTargetColor)
 				{
-					renderTarget = std::dynamic_pointer_cast<RenderTargetSource>(sourcePtr)->buffer;
+					renderTarget = sink->renderTarget->buffer;
 
 					renderTarget->ClearAttachment(1, -1);
 				}
 
 				if (sourcePtr->sourceType == RenderSourceType::Camera)
 				{
-					glm::mat4 invViewProj = glm::inverse(std::dynamic_pointer_cast<CameraSource>(sourcePtr)->GetViewProj());
+					glm::mat4 invViewProj = glm::inverse(sink->camera->GetViewProj());
 					shader->Set("u_invViewProj", invViewProj);
 				}
 			}
@@ -1207,7 +1246,7 @@ namespace Borealis
 		bool editor = false;
 
 		Ref<CameraSource> camera = nullptr;
-		for (auto sink : sinkList)
+		for (auto const& sink : sinkList)
 		{
 			if (sink->source)
 			{
@@ -1215,7 +1254,7 @@ namespace Borealis
 
 				if (sourcePtr->sourceType == RenderSourceType::RenderTargetColor)
 				{
-					shadowMap = std::dynamic_pointer_cast<RenderTargetSource>(sourcePtr)->buffer;
+					shadowMap = sink->renderTarget->buffer;
 					shadowMap->Bind();
 					RenderCommand::Clear();
 					shadowMap->Unbind();
@@ -1223,11 +1262,11 @@ namespace Borealis
 
 				if (sourcePtr->sourceType == RenderSourceType::Camera)
 				{
-					editor = std::dynamic_pointer_cast<CameraSource>(sourcePtr)->editor;
-					cameraPosition = std::dynamic_pointer_cast<CameraSource>(sourcePtr)->position;
-					viewProjMatrix = std::dynamic_pointer_cast<CameraSource>(sourcePtr)->GetViewProj();
+					editor = sink->camera->editor;
+					cameraPosition = sink->camera->position;
+					viewProjMatrix = sink->camera->GetViewProj();
 
-					camera = std::dynamic_pointer_cast<CameraSource>(sourcePtr);
+					camera = sink->camera;
 				}
 			}
 		}
@@ -1310,34 +1349,26 @@ namespace Borealis
 			shader->Set("shadowPass", true);
 
 			Frustum frustum = ComputeFrustum(lightViewProj);
+			static std::vector<entt::entity> shadowCasters;
+			shadowCasters.clear();
+			SceneManager::GetActiveScene()->GetRenderBVH().QueryFrustum(frustum, shadowCasters);
 
 			if(!directionalLight)
 			{
 				shadowMap->Bind();
 				{
-					auto group = registryPtr->group<>(entt::get<TransformComponent, MeshFilterComponent, MeshRendererComponent>);
-					for (auto& entity : group)
+					auto view = registryPtr->view<TransformComponent, MeshFilterComponent, MeshRendererComponent, ActiveTag>();
+					for (auto entity : shadowCasters)
 					{
-						Entity brEntity = { entity, SceneManager::GetActiveScene().get() };
-						if (!brEntity.IsActive())
-						{
-							continue;
-						}
-						auto [transform, meshFilter, meshRenderer] = group.get<TransformComponent, MeshFilterComponent, MeshRendererComponent>(entity);
+						if (!view.contains(entity)) continue;
+
+						auto [transform, meshFilter, meshRenderer] = view.get<TransformComponent, MeshFilterComponent, MeshRendererComponent>(entity);
 						if (!meshRenderer.active) { continue; }
 
 						if (!meshFilter.Model || !meshRenderer.Material || !meshRenderer.active) continue;
 
 						if (!meshRenderer.castShadow) continue;
 
-						BoundingSphere modelBoundingSphere = meshFilter.Model->mBoundingSphere;
-						modelBoundingSphere.Transform(transform.GetGlobalTransform());
-
-						if (CullBoundingSphere(frustum, modelBoundingSphere))
-						{
-							continue;
-						}
-
 						Renderer3D::DrawMesh(transform.GetGlobalTransform(), meshFilter, meshRenderer, shader, (int)entity);
 					}
 				}
@@ -1371,28 +1402,16 @@ namespace Borealis
 					CSMBuffer->Bind();
 					RenderCommand::Clear();
 
-					auto group = registryPtr->group<>(entt::get<TransformComponent, MeshFilterComponent, MeshRendererComponent>);
-					for (auto& entity : group)
+					auto view = registryPtr->view<TransformComponent, MeshFilterComponent, MeshRendererComponent, ActiveTag>();
+					for (auto entity : shadowCasters)
 					{
-						Entity brEntity = { entity, SceneManager::GetActiveScene().get() };
-						if (!brEntity.IsActive())
-						{
-							continue;
-						}
-						auto [transform, meshFilter, meshRenderer] = group.get<TransformComponent, MeshFilterComponent, MeshRendererComponent>(entity);
+						if (!view.contains(entity)) continue;
+
+						auto [transform, meshFilter, meshRenderer] = view.get<TransformComponent, MeshFilterComponent, MeshRendererComponent>(entity);
 						if (!meshFilter.Model || !meshRenderer.Material || !meshRenderer.active) continue;
 
 						if (!meshRenderer.castShadow) continue;
 
-						BoundingSphere modelBoundingSphere = meshFilter.Model->mBoundingSphere;
-						modelBoundingSphere.Transform(transform.GetGlobalTransform());
-
-
-						if (CullBoundingSphere(frustum, modelBoundingSphere))
-						{
-							//BOREALIS_CORE_INFO("Culling entity {}", (int)entity);
-							continue;
-						}
 						cascade_shadow_shader->Bind();
 						cascade_shadow_shader->Set("u_HasAnimation", false);
 						RenderCommand::EnableFrontFaceCull();
@@ -1441,7 +1460,7 @@ namespace Borealis
 							{
 								cascade_shadow_shader->Bind();
 								cascade_shadow_shader->Set("u_HasAnimation", true);
-								cascade_shadow_shader->Set("u_AnimationIndex", (int)skinMeshFilter.AnimationIndex);
+								cascade_shadow_shader->Set("u_AnimationIndex", Renderer3D::BindAnimationPalette((int)skinMeshFilter.AnimationIndex));
 							}
 						}
 					}
@@ -1474,33 +1493,33 @@ namespace Borealis
 		Ref<BoolSource> viewPortHovered = nullptr;
 		Ref<RenderTargetSource> renderTarget = nullptr;
 
-		for (auto sink : sinkList)
+		for (auto const& sink : sinkList)
 		{
 			if (sink->source->sourceType == RenderSourceType::PixelBuffer)
 			{
-				pixelBuffer = std::dynamic_pointer_cast<PixelBufferSource>(sink->source);
+				pixelBuffer = sink->pixelBuffer;
 			}
 
 			if (sink->source->sourceType == RenderSourceType::IntRef)
 			{
-				entityID = std::dynamic_pointer_cast<IntSource>(sink->source);
+				entityID = sink->intSource;
 			}
 
 			if (sink->source->sourceType == RenderSourceType::Vec2Int)
 			{
-				mouse = std::dynamic_pointer_cast<Vec2IntSource>(sink->source);
+				mouse = sink->vec2IntSource;
 			}
 
 			if (sink->source->sourceType == RenderSourceType::Bool)
 			{
-				viewPortHovered = std::dynamic_pointer_cast<BoolSource>(sink->source);
+				viewPortHovered = sink->boolSource;
 			}
 
 			if (sink->source->sourceType == RenderSourceType::RenderTargetColor)
 			{
 				if (sink->sinkName == "renderTarget")
 				{
-					renderTarget = std::dynamic_pointer_cast<RenderTargetSource>(sink->source);
+					renderTarget = sink->renderTarget;
 				}
 			}
 		}
@@ -1554,30 +1573,30 @@ namespace Borealis
 		Ref<IntListSource> selectedEntities = nullptr;
 		int hoveredEntity = -1;
 
-		for (auto sink : sinkList)
+		for (auto const& sink : sinkList)
 		{
 			if (sink->source->sourceType == RenderSourceType::RenderTargetColor)
 			{
 				if (sink->sinkName == "renderTarget")
 				{
-					renderTarget = std::dynamic_pointer_cast<RenderTargetSource>(sink->source);
+					renderTarget = sink->renderTarget;
 				}
 			}
 
 			if (sink->source->sourceType == RenderSourceType::Camera)
 			{
-				viewProjMatrix = std::dynamic_pointer_cast<CameraSource>(sink->source)->GetViewProj();
-				cameraLookAt = std::dynamic_pointer_cast<CameraSource>(sink->source)->lookAt;
+				viewProjMatrix = sink->camera->GetViewProj();
+				cameraLookAt = sink->camera->lookAt;
 			}
 
 			if (sink->source->sourceType == RenderSourceType::IntList)
 			{
-				selectedEntities = std::dynamic_pointer_cast<IntListSource>(sink->source);
+				selectedEntities = sink->intListSource;
 			}
 
 			if (sink->source->sourceType == RenderSourceType::IntRef)
 			{
-				hoveredEntity = std::dynamic_pointer_cast<IntSource>(sink->source)->mRef;
+				hoveredEntity = sink->intSource->mRef;
 			}
 		}
 
@@ -1687,20 +1706,20 @@ namespace Borealis
 
 		glm::mat4 viewMatrix, projMatrix;
 
-		for (auto sink : sinkList)
+		for (auto const& sink : sinkList)
 		{
 			if (sink->source->sourceType == RenderSourceType::RenderTargetColor)
 			{
 				if (sink->sinkName == "renderTarget")
 				{
-					renderTarget = std::dynamic_pointer_cast<RenderTargetSource>(sink->source);
+					renderTarget = sink->renderTarget;
 				}
 			}
 
 			if (sink->source->sourceType == RenderSourceType::Camera)
 			{
-				viewMatrix = std::dynamic_pointer_cast<CameraSource>(sink->source)->viewMtx;
-				projMatrix = std::dynamic_pointer_cast<CameraSource>(sink->source)->projMtx;
+				viewMatrix = sink->camera->viewMtx;
+				projMatrix = sink->camera->projMtx;
 			}
 		}
 
@@ -1746,13 +1765,13 @@ namespace Borealis
 	{
 		Ref<RenderTargetSource> renderTarget = nullptr;
 
-		for (auto sink : sinkList)
+		for (auto const& sink : sinkList)
 		{
 			if (sink->source->sourceType == RenderSourceType::RenderTargetColor)
 			{
 				if (sink->sinkName == "renderTarget")
 				{
-					renderTarget = std::dynamic_pointer_cast<RenderTargetSource>(sink->source);
+					renderTarget = sink->renderTarget;
 				}
 			}
 		}
@@ -1800,13 +1819,13 @@ namespace Borealis
 	{
 		Ref<RenderTargetSource> renderTarget = nullptr;
 
-		for (auto sink : sinkList)
+		for (auto const& sink : sinkList)
 		{
 			if (sink->source->sourceType == RenderSourceType::RenderTargetColor)
 			{
 				if (sink->sinkName == "renderTarget")
 				{
-					renderTarget = std::dynamic_pointer_cast<RenderTargetSource>(sink->source);
+					renderTarget = sink->renderTarget;
 				}
 			}
 		}
@@ -1854,20 +1873,20 @@ namespace Borealis
 	{
 		Ref<RenderTargetSource> renderTarget = nullptr;
 
-		for (auto sink : sinkList)
+		for (auto const& sink : sinkList)
 		{
 			if (sink->source->sourceType == RenderSourceType::Bool)
 			{
 				if (sink->sinkName == "bloomBool")
 				{
-					if (!std::dynamic_pointer_cast<BoolSource>(sink->source)->mRef) return;
+					if (!sink->boolSource->mRef) return;
 				}
 			}
 			if (sink->source->sourceType == RenderSourceType::RenderTargetColor)
 			{
 				if (sink->sinkName == "renderTarget")
 				{
-					renderTarget = std::dynamic_pointer_cast<RenderTargetSource>(sink->source);
+					renderTarget = sink->renderTarget;
 				}
 			}
 		}
@@ -2008,20 +2027,20 @@ namespace Borealis
 	{
 		Ref<RenderTargetSource> renderTarget = nullptr;
 
-		for (auto sink : sinkList)
+		for (auto const& sink : sinkList)
 		{
 			if (sink->source->sourceType == RenderSourceType::Bool)
 			{
 				if (sink->sinkName == "bloomBool")
 				{
-					if (!std::dynamic_pointer_cast<BoolSource>(sink->source)->mRef) return;
+					if (!sink->boolSource->mRef) return;
 				}
 			}
 			if (sink->source->sourceType == RenderSourceType::RenderTargetColor)
 			{
 				if (sink->sinkName == "renderTarget")
 				{
-					renderTarget = std::dynamic_pointer_cast<RenderTargetSource>(sink->source);
+					renderTarget = sink->renderTarget;
 				}
 			}
 		}
@@ -2079,18 +2098,18 @@ namespace Borealis
 		Ref<RenderTargetSource> renderSource = nullptr;
 
 
-		for (auto sink : sinkList)
+		for (auto const& sink : sinkList)
 		{
 			if (sink->source->sourceType == RenderSourceType::RenderTargetColor)
 			{
 				if (sink->sinkName == "renderTarget")
 				{
-					renderTarget = std::dynamic_pointer_cast<RenderTargetSource>(sink->source);
+					renderTarget = sink->renderTarget;
 				}
 
 				if (sink->sinkName == "renderSource")
 				{
-					renderSource = std::dynamic_pointer_cast<RenderTargetSource>(sink->source);
+					renderSource = sink->renderTarget;
 				}
 			}
 		}
@@ -2123,20 +2142,20 @@ namespace Borealis
 
 		glm::mat4 viewProjMatrix;
 
-		for (auto sink : sinkList)
+		for (auto const& sink : sinkList)
 		{
 			if (sink->source->sourceType == RenderSourceType::RenderTargetColor)
 			{
 				if (sink->sinkName == "renderTarget")
 				{
-					renderTarget = std::dynamic_pointer_cast<RenderTargetSource>(sink->source);
+					renderTarget = sink->renderTarget;
 				}
 			}
 
 			if (sink->source->sourceType == RenderSourceType::Camera)
 			{
-				viewProjMatrix = std::dynamic_pointer_cast<CameraSource>(sink->source)->GetViewProj();
-				cameraLookAt = std::dynamic_pointer_cast<CameraSource>(sink->source)->lookAt;
+				viewProjMatrix = sink->camera->GetViewProj();
+				cameraLookAt = sink->camera->lookAt;
 			}
 		}
 
@@ -2189,7 +2208,7 @@ namespace Borealis
 					if (brEntity.HasComponent<AnimatorComponent>())
 					{
 						shader->Bind();
-						shader->Set("u_AnimationIndex", (int)meshFilter.AnimationIndex);
+						shader->Set("u_AnimationIndex", Renderer3D::BindAnimationPalette((int)meshFilter.AnimationIndex));
 						shader->Set("u_HasAnimation", true);
 						shader->Unbind();
 					}
@@ -2225,7 +2244,7 @@ namespace Borealis
 					if (brEntity.HasComponent<AnimatorComponent>())
 					{
 						shader->Bind();
-						shader->Set("u_AnimationIndex", (int)meshFilter.AnimationIndex);
+						shader->Set("u_AnimationIndex", Renderer3D::BindAnimationPalette((int)meshFilter.AnimationIndex));
 						shader->Set("u_HasAnimation", true);
 						shader->Unbind();
 					}
@@ -2269,19 +2288,19 @@ namespace Borealis
 		Ref<RenderTargetSource> renderTarget = nullptr;
 		glm::mat4 viewProjMatrix{};
 
-		for (auto sink : sinkList)
+		for (auto const& sink : sinkList)
 		{
 			if (sink->source->sourceType == RenderSourceType::RenderTargetColor)
 			{
 				if (sink->sinkName == "renderTarget")
 				{
-					renderTarget = std::dynamic_pointer_cast<RenderTargetSource>(sink->source);
+					renderTarget = sink->renderTarget;
 				}
 			}
 
 			if (sink->source->sourceType == RenderSourceType::Camera)
 			{
-				viewProjMatrix = std::dynamic_pointer_cast<CameraSource>(sink->source)->GetViewProj();
+				viewProjMatrix = sink->camera->GetViewProj();
 			}
 		}
 
@@ -2405,22 +2424,22 @@ namespace Borealis
 		Ref<RenderTargetSource> renderTarget = nullptr;
 		Ref<RenderTargetSource> runTimeRenderTarget = nullptr;
 
-		for (auto sink : sinkList)
+		for (auto const& sink : sinkList)
 		{
 			if (sink->source->sourceType == RenderSourceType::Camera)
 			{
-				Renderer2D::Begin(std::dynamic_pointer_cast<CameraSource>(sink->source)->GetViewProj());
+				Renderer2D::Begin(sink->camera->GetViewProj());
 			}
 
 			if (sink->source->sourceType == RenderSourceType::RenderTargetColor)
 			{
 				if (sink->sinkName == "renderTarget")
 				{
-					renderTarget = std::dynamic_pointer_cast<RenderTargetSource>(sink->source);
+					renderTarget = sink->renderTarget;
 				}
 				if (sink->sinkName == "runTimeRenderTarget")
 				{
-					runTimeRenderTarget = std::dynamic_pointer_cast<RenderTargetSource>(sink->source);
+					runTimeRenderTarget = sink->renderTarget;
 				}
 			}
 		}
@@ -2479,30 +2498,30 @@ namespace Borealis
 		bool editor = false;
 		bool showWireFrame = false;
 
-		for (auto sink : sinkList)
+		for (auto const& sink : sinkList)
 		{
 			if (sink->source->sourceType == RenderSourceType::RenderTargetColor)
 			{
 				if (sink->sinkName == "renderTarget")
 				{
-					renderTarget = std::dynamic_pointer_cast<RenderTargetSource>(sink->source);
+					renderTarget = sink->renderTarget;
 				}
 
 				if (sink->sinkName == "accumulaionTarget")
 				{
-					accumulaionTarget = std::dynamic_pointer_cast<RenderTargetSource>(sink->source);
+					accumulaionTarget = sink->renderTarget;
 					//accumulaionTarget->buffer->ClearAttachment(1, -1);
 				}
 			}
 
 			if (sink->source->sourceType == RenderSourceType::Camera)
 			{
-				editor = std::dynamic_pointer_cast<CameraSource>(sink->source)->editor;
+				editor = sink->camera->editor;
 			}
 
 			if (sink->source->sourceType == RenderSourceType::Bool)
 			{
-				showWireFrame = std::dynamic_pointer_cast<BoolSource>(sink->source)->mRef;
+				showWireFrame = sink->boolSource->mRef;
 			}
 		}
 
@@ -2524,8 +2543,6 @@ namespace Borealis
 		accumulaionTarget->buffer->ClearAttachment(0, { 0.f,0.f,0.f,0.f });
 		accumulaionTarget->buffer->ClearAttachment(2, glm::vec4(1.f));
 
-		Renderer2D::Begin(glm::mat4{});
-
 		for (auto& entity : group)
 		{
 			Entity brEntity = { entity, SceneManager::GetActiveScene().get() };
@@ -2534,31 +2551,11 @@ namespace Borealis
 				continue;
 			}
 
-			auto particleSystem = brEntity.GetComponent<ParticleSystemComponent>();
+			auto& particleSystem = brEntity.GetComponent<ParticleSystemComponent>();
 			
-			std::vector<Particle> const& particles = particleSystem.GetParticles();
-			for (Particle const& particle : particles)
-			{
-				if (!particle.isActive)
-				{
-					continue;
-				}
-
-				glm::mat4 transfrom = glm::translate(glm::mat4(1.0f), particle.position) *
-					glm::toMat4(particle.startRotation) *
-					glm::scale(glm::mat4(1.0f), particle.startSize);
-
-				float tileFactor = 1.f;
-				if (particleSystem.billboard) 
-				{
-					tileFactor = particle.startSize[0] * -1;
-				}
-
-				if (particleSystem.texture)
-					Renderer2D::DrawQuad(transfrom, particleSystem.texture, tileFactor, particle.currentColor, -1, particleSystem.billboard);
-				else
-					Renderer2D::DrawQuad(transfrom, ParticleSystemComponent::GetDefaultParticleTexture(), tileFactor, particle.currentColor, -1, particleSystem.billboard);
-			}
+			ParticleRenderer::DrawEmitter(particleSystem.GetParticles(),
+				particleSystem.texture ? particleSystem.texture : ParticleSystemComponent::GetDefaultParticleTexture(),
+				particleSystem.billboard);
 
 			if (!showWireFrame || !editor) continue;
 			if (particleSystem.emitterShape == EmitterShape::Quad)
@@ -2625,7 +2622,6 @@ namespace Borealis
 			}
 		}
 
-		Renderer2D::EndParticles();
 		accumulaionTarget->Unbind();
 
 		RenderCommand::ResetTextureBinding();
@@ -2759,8 +2755,6 @@ namespace Borealis
 			sData = std::make_unique<RenderData>();
 			sData->CameraUBO = UniformBufferObject::Create(sizeof(RenderData::CameraData), CAMERA_BIND);
 
-			sData->AnimationUBO = UniformBufferObject::Create(sizeof(glm::mat4) * 128 * 6, ANIMATION_BIND);
-
 			sData->LightsUBO = UniformBufferObject::Create(sizeof(LightUBO) * 32 + sizeof(int), LIGHTING_BIND);
 
 			sData->SceneRenderUBO = UniformBufferObject::Create(sizeof(RenderGraph::SceneRenderConfigUBO), SCENE_RENDER_BIND);
@@ -2775,6 +2769,26 @@ namespace Borealis
 		return *this;
 	}
 
+	bool RenderPassConfig::operator==(RenderPassConfig const& other) const
+	{
+		if (mType != other.mType || mPassName != other.mPassName || mSinkLinkageList.size() != other.mSinkLinkageList.size())
+			return false;
+
+		for (size_t i = 0; i < mSinkLinkageList.size(); ++i)
+		{
+			if (mSinkLinkageList[i].sinkName != other.mSinkLinkageList[i].sinkName ||
+				mSinkLinkageList[i].sourceName != other.mSinkLinkageList[i].sourceName)
+				return false;
+		}
+
+		return true;
+	}
+
+	bool RenderGraphConfig::operator==(RenderGraphConfig const& other) const
+	{
+		return globalRenderSourceList == other.globalRenderSourceList && passesConfigList == other.passesConfigList;
+	}
+
 	void RenderGraphConfig::AddPass(RenderPassConfig renderPassConfig)
 	{
 		passesConfigList.push_back(renderPassConfig);
@@ -2793,6 +2807,88 @@ namespace Borealis
 	{
 		renderPassList.clear();
 		globalSource.clear();
+		mPersistentSources.clear();
+		mDirty = true;
+	}
+
+	void RenderGraph::EvaluateAnimations(std::vector<AnimationJob>& jobs, std::vector<glm::mat4>& palette, float dt, uint32_t grainSize)
+	{
+		// Every stage of an animator only touches that animator and its palette slot, so
+		// one job runs them all back to back and the frame has a single join
+		JobSystem::ParallelFor(static_cast<uint32_t>(jobs.size()), [&jobs, &palette, dt](uint32_t begin, uint32_t end)
+			{
+				PROFILE_SCOPE("Animation::Evaluate");
+				for (uint32_t i = begin; i < end; ++i)
+				{
+					AnimationJob& job = jobs[i];
+					Animator& animator = *job.animator;
+					job.posed = animator.AdvanceTime(dt);
+					if (job.posed)
+					{
+						animator.SamplePose();
+						animator.BlendPose();
+						animator.LocalToModel();
+						animator.BuildPalette();
+					}
+
+					// Jobs that were not posed still copy last frame's palette into their slot
+					if (job.paletteSlot < 0) continue;
+					auto const& transforms = animator.GetFinalBoneMatrices();
+					std::copy_n(transforms.begin(), MAX_BONES, palette.begin() + static_cast<size_t>(job.paletteSlot) * MAX_BONES);
+				}
+			}, grainSize);
+	}
+
+	RenderGraph::AnimationBenchmark RenderGraph::BenchmarkAnimations(entt::registry& registry, uint32_t instances, uint32_t frames)
+	{
+		PROFILE_FUNCTION();
+
+		AnimationBenchmark result;
+		AnimatorComponent const* source = nullptr;
+		for (auto [entity, animatorComponent] : registry.view<AnimatorComponent>().each())
+		{
+			if (animatorComponent.animation)
+			{
+				source = &animatorComponent;
+				break;
+			}
+		}
+		if (!source || instances == 0 || frames == 0)
+		{
+			return result;
+		}
+
+		// Each copy starts at a different time so the characters are not in lockstep
+		std::vector<Animator> animators(instances, source->animator);
+		std::vector<AnimationJob> jobs(instances);
+		for (uint32_t i = 0; i < instances; ++i)
+		{
+			animators[i].SetLoop(true);
+			animators[i].PlayAnimation(source->animation);
+			animators[i].UpdateAnimation(0.013f * i);
+			jobs[i] = { &animators[i], static_cast<int>(i), false };
+		}
+		std::vector<glm::mat4> palette(static_cast<size_t>(instances) * MAX_BONES);
+
+		float const dt = 1.f / 60.f;
+		uint32_t maxThreads = JobSystem::GetThreadCount() + 1;
+		for (uint32_t threads = 1; threads <= maxThreads; ++threads)
+		{
+			// One range per thread caps how many threads a stage can use
+			uint32_t grainSize = (instances + threads - 1) / threads;
+			EvaluateAnimations(jobs, palette, dt, grainSize);
+
+			auto start = std::chrono::high_resolution_clock::now();
+			for (uint32_t frame = 0; frame < frames; ++frame)
+			{
+				EvaluateAnimations(jobs, palette, dt, grainSize);
+			}
+			std::chrono::duration<double, std::milli> elapsed = std::chrono::high_resolution_clock::now() - start;
+			result.frameMilliseconds.push_back(elapsed.count() / frames);
+		}
+
+		result.instances = instances;
+		return result;
 	}
 
 	void RenderGraph::Update(float dt)
@@ -2800,8 +2896,10 @@ namespace Borealis
 		//set light ubo
 
 		{
+			PROFILE_SCOPE("RenderGraph::UpdateAnimations");
 			entt::basic_group group = registryPtr->group<>(entt::get<TransformComponent, SkinnedMeshRendererComponent>);
 			int animationCount = 0;
+			mAnimationJobs.clear();
 			for (auto& entity : group)
 			{
 				Entity brEntity = { entity, SceneManager::GetActiveScene().get() };
@@ -2830,18 +2928,25 @@ namespace Borealis
 						animatorComponent.animator.SetLoop(animatorComponent.loop);
 						animatorComponent.animator.SetSpeed(animatorComponent.speed);
 
-						animatorComponent.animator.UpdateAnimation(dt);
-
-						if (skinnedMesh.SkinnnedModel->mAnimation && animationCount < MAX_ANIMATION_PER_UBO)
+						int paletteSlot = -1;
+						if (skinnedMesh.SkinnnedModel->mAnimation)
 						{
-							auto const& transforms = animatorComponent.animator.GetFinalBoneMatrices();
-							sData->AnimationUBO->SetData(transforms.data(), 128 * sizeof(glm::mat4), 128 * sizeof(glm::mat4) * animationCount);
-							animationCount++;
-							skinnedMesh.AnimationIndex = animationCount - 1;
+							paletteSlot = animationCount++;
+							skinnedMesh.AnimationIndex = paletteSlot;
 						}
+						mAnimationJobs.push_back({ &animatorComponent.animator, paletteSlot, false });
 					}
 				}
 			}
+
+			// asset binding happened above, each job only touches its own animator and palette slot
+			mAnimationPalette.resize(static_cast<size_t>(animationCount) * MAX_BONES);
+			EvaluateAnimations(mAnimationJobs, mAnimationPalette, dt);
+
+			if (animationCount > 0)
+			{
+				Renderer3D::SetAnimationPalettes(mAnimationPalette.data(), static_cast<uint32_t>(animationCount));
+			}
 		}
 
 		RenderCommand::GetError("Here");
@@ -2886,9 +2991,12 @@ namespace Borealis
 			}
 		}
 
-		//particles
+		//particles, emitter transforms are resolved here since the transform
+		//cache is not thread safe, then each system updates on its own job
 		{
+			PROFILE_SCOPE("RenderGraph::UpdateParticles");
 			entt::basic_group group = registryPtr->group<>(entt::get<TransformComponent, ParticleSystemComponent>);
+			mParticleJobs.clear();
 			for (auto& entity : group)
 			{
 				auto entityBR = Entity{ entity, SceneManager::GetActiveScene().get() };
@@ -2897,8 +3005,25 @@ namespace Borealis
 					continue;
 				}
 				auto [transform, particleSystemComponent] = group.get<TransformComponent, ParticleSystemComponent>(entity);
-				particleSystemComponent.Update(transform, dt);
+				if (!particleSystemComponent.isActive)
+				{
+					continue;
+				}
+
+				ParticleEmitterTransform emitter;
+				emitter.position = transform.GetGlobalTranslate();
+				emitter.orientation = glm::quat(glm::radians(transform.GetGlobalRotation()));
+				emitter.scale = transform.GetGlobalScale();
+				mParticleJobs.push_back({ &particleSystemComponent, emitter });
 			}
+
+			JobSystem::ParallelFor(static_cast<uint32_t>(mParticleJobs.size()), [this, dt](uint32_t begin, uint32_t end)
+				{
+					for (uint32_t i = begin; i < end; ++i)
+					{
+						mParticleJobs[i].system->Update(mParticleJobs[i].emitter, dt);
+					}
+				});
 		}
 
 		sData->SceneRenderUBO->SetData(&sceneRenderConfig.ubo, sizeof(SceneRenderConfigUBO));
@@ -2913,39 +3038,45 @@ namespace Borealis
 
 	void RenderGraph::Execute()
 	{
-		for (auto pass : renderPassList) 
+		Compile();
+
+		for (auto const& source : globalSource)
 		{
-			bool skipPass = false;
-			for (auto sink : pass->sinkList) 
-			{
-				if (!sink->source) 
-				{
-					//skiping pass rn, not good, do more error checks
-					sink->source = FindSource(sink->sourceName);
-					if (!sink->source)
-					{
-						skipPass = true;
-						break;
-					}
-				}
-			}
-			if (skipPass) continue;
+			source->Refresh();
+		}
+
+		for (auto const& pass : renderPassList) 
+		{
+			//a pass with a missing source was already found when compiling
+			if (!pass->resolved) continue;
 			pass->Execute();
 		}
 
 		Renderer2D::ClearDrawQueue();
+
+		mLastFrameStats = mFrameStats;
+		mFrameStats = {};
 	}
 
-	void RenderGraph::SetConfig(RenderGraphConfig renderGraphConfig)
+	void RenderGraph::SetConfig(RenderGraphConfig const& renderGraphConfig)
 	{
+		if (mRenderGraphConfig == renderGraphConfig) return;
+
 		mRenderGraphConfig = renderGraphConfig;
+		mDirty = true;
 	}
 
-	void RenderGraph::Finalize()
+	void RenderGraph::Compile()
 	{
-		for (auto const& globalSource : mRenderGraphConfig.globalRenderSourceList)
+		if (!mDirty) return;
+
+		PROFILE_FUNCTION();
+
+		renderPassList.clear();
+		globalSource = mPersistentSources;
+		for (auto const& configSource : mRenderGraphConfig.globalRenderSourceList)
 		{
-			SetGlobalSource(globalSource);
+			globalSource.push_back(configSource);
 		}
 
 		for (auto const& passesConfig : mRenderGraphConfig.passesConfigList)
@@ -2979,11 +3110,94 @@ namespace Borealis
 				break;
 			}
 		}
+
+		SortPasses();
+
+		//passes are in dependency order, so a sink reading another pass's
+		//output finds it already resolved
+		for (auto const& pass : renderPassList)
+		{
+			pass->resolved = true;
+			for (auto const& sink : pass->sinkList)
+			{
+				sink->Resolve(FindSource(sink->sourceName));
+				if (!sink->source)
+				{
+					pass->resolved = false;
+				}
+			}
+		}
+
+		++mFrameStats.compiles;
+		mDirty = false;
+	}
+
+	void RenderGraph::SortPasses()
+	{
+		size_t const passCount = renderPassList.size();
+
+		std::unordered_map<std::string, size_t> producer;
+		for (size_t i = 0; i < passCount; ++i)
+		{
+			for (auto const& sink : renderPassList[i]->sinkList)
+			{
+				producer.emplace(sink->outputName, i);
+			}
+		}
+
+		std::vector<std::vector<size_t>> dependents(passCount);
+		std::vector<uint32_t> inDegree(passCount, 0);
+		for (size_t i = 0; i < passCount; ++i)
+		{
+			for (auto const& sink : renderPassList[i]->sinkList)
+			{
+				auto it = producer.find(sink->sourceName);
+				if (it == producer.end() || it->second == i) continue;
+
+				dependents[it->second].push_back(i);
+				++inDegree[i];
+			}
+		}
+
+		//Kahn's algorithm, always taking the earliest ready pass so that
+		//independent passes keep the order they were configured in
+		std::vector<Ref<RenderPass>> sorted;
+		sorted.reserve(passCount);
+		std::vector<bool> emitted(passCount, false);
+		while (sorted.size() < passCount)
+		{
+			size_t next = passCount;
+			for (size_t i = 0; i < passCount; ++i)
+			{
+				if (!emitted[i] && inDegree[i] == 0)
+				{
+					next = i;
+					break;
+				}
+			}
+
+			if (next == passCount)
+			{
+				BOREALIS_CORE_WARN("RenderGraph: cycle between passes, using configured order");
+				return;
+			}
+
+			emitted[next] = true;
+			sorted.push_back(renderPassList[next]);
+			for (size_t dependent : dependents[next])
+			{
+				--inDegree[dependent];
+			}
+		}
+
+		renderPassList = std::move(sorted);
 	}
 
-	Ref<RenderSource> RenderGraph::FindSource(std::string sourceName)
+	Ref<RenderSource> RenderGraph::FindSource(std::string const& sourceName)
 	{
-		for (auto global : globalSource) 
+		++mFrameStats.sourceLookups;
+
+		for (auto const& global : globalSource) 
 		{
 			if (global->sourceName == sourceName) 
 			{
@@ -2991,9 +3205,9 @@ namespace Borealis
 			}
 		}
 
-		for (auto pass : renderPassList) 
+		for (auto const& pass : renderPassList) 
 		{
-			for (auto sink : pass->sinkList) 
+			for (auto const& sink : pass->sinkList) 
 			{
 				if (sink->outputName == sourceName) 
 				{
@@ -3044,6 +3258,8 @@ namespace Borealis
 			renderPass->SetSinkLinkage(sinkLinkage.sinkName, sinkLinkage.sourceName);
 		}
 
+		++mFrameStats.passAllocations;
+		mFrameStats.sinkAllocations += static_cast<uint32_t>(renderPassConfig.mSinkLinkageList.size());
 		AddPass(renderPass);
 	}
 
@@ -3084,7 +3300,7 @@ namespace Borealis
 			break;
 		}
 
-		Ref<EntityPass> entityPass = std::dynamic_pointer_cast<EntityPass>(renderPass);
+		Ref<EntityPass> entityPass = std::static_pointer_cast<EntityPass>(renderPass);
 		entityPass->SetEntityRegistry(*registryPtr);
 
 		for (auto const& sinkLinkage : renderPassConfig.mSinkLinkageList)
@@ -3092,17 +3308,48 @@ namespace Borealis
 			renderPass->SetSinkLinkage(sinkLinkage.sinkName, sinkLinkage.sourceName);
 		}
 
+		++mFrameStats.passAllocations;
+		mFrameStats.sinkAllocations += static_cast<uint32_t>(renderPassConfig.mSinkLinkageList.size());
 		AddPass(renderPass);
 	}
 
 	void RenderGraph::SetGlobalSource(Ref<RenderSource> source)
 	{
-		globalSource.push_back(source);
+		for (auto& persistent : mPersistentSources)
+		{
+			if (persistent->sourceName == source->sourceName)
+			{
+				if (persistent != source)
+				{
+					persistent = source;
+					mDirty = true;
+				}
+				return;
+			}
+		}
+
+		mPersistentSources.push_back(source);
+		mDirty = true;
+	}
+
+	void RenderGraph::RemoveGlobalSource(std::string const& sourceName)
+	{
+		auto it = std::find_if(mPersistentSources.begin(), mPersistentSources.end(),
+			[&sourceName](Ref<RenderSource> const& source) { return source->sourceName == sourceName; });
+
+		if (it != mPersistentSources.end())
+		{
+			mPersistentSources.erase(it);
+			mDirty = true;
+		}
 	}
 
 	void RenderGraph::SetEntityRegistry(entt::registry& registry)
 	{
+		if (registryPtr == &registry) return;
+
 		registryPtr = &registry;
+		mDirty = true;
 	}
 
 	void RenderGraph::SetFinalSink(std::string sinkName, std::string sourceName)
@@ -18,6 +18,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include <Graphics/OpenGL/ShaderOpenGLImpl.hpp>
 #include <Graphics/Renderer2D.hpp>
 #include <Graphics/Renderer3D.hpp>
+#include <Graphics/ParticleRenderer.hpp>
 
 namespace Borealis
 {
@@ -29,10 +30,12 @@ namespace Borealis
 		 RenderCommand::Init();
 		 Renderer2D::Init();
 		 Renderer3D::Init();
+		 ParticleRenderer::Init();
 	 }
 	 void Renderer::Free()
 	 {
 		 Renderer2D::Free();
+		 ParticleRenderer::Free();
 	 }
 	 void Renderer::Begin(OrthographicCamera& camera)
 	 {
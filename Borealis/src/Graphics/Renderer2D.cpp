@@ -339,10 +339,6 @@ namespace Borealis
 		Flush();
 
 	}
-	void Renderer2D::EndParticles()
-	{
-		FlushParticles();
-	}
 	void Renderer2D::Flush()
 	{
 		PROFILE_FUNCTION();
@@ -389,23 +385,6 @@ namespace Borealis
 		}
 	}
 
-	void Renderer2D::FlushParticles()
-	{
-		if (sData->QuadIndexCount)
-		{
-			uint32_t size = (uint32_t)((uint8_t*)sData->QuadBufferPtr - (uint8_t*)sData->QuadBufferBase);
-			sData->mQuadVBO->SetData(sData->QuadBufferBase, size);
-			for (uint32_t i = 0; i < sData->TextureSlotIndex; i++)
-			{
-				sData->TextureSlots[i]->Bind(i);
-			}
-			sData->mQuadShader->Bind();
-			sData->mQuadShader->Set("u_Transparent", true);
-			RenderCommand::DrawElements(sData->mQuadVAO, sData->QuadIndexCount);
-			sData->mStats.DrawCalls++;
-		}
-	}
-
 	static void FlushReset()
 	{
 		Renderer2D::End();
@@ -19,6 +19,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include <Graphics/RenderCommand.hpp>
 #include <Graphics/UniformBufferObject.hpp>
 #include <Graphics/UBOBindings.hpp>
+#include <Graphics/Buffer.hpp>
 
 namespace Borealis
 {
@@ -27,6 +28,11 @@ namespace Borealis
 		Ref<Shader> mModelShader;
 		Ref<Shader> mCommonShader;
 		Ref<UniformBufferObject> mMaterialsUBO;
+		std::vector<Ref<UniformBufferObject>> mAnimationUBOs; // MAX_ANIMATION_PER_UBO palettes each, only grows
+		int mBoundAnimationUBO = 0;
+		Ref<VertexBuffer> mInstanceBuffer;
+		uint32_t mInstanceCapacity = 0;
+		glm::mat4 mViewProj{ 1.f };
 	};
 
 	static std::unique_ptr<Renderer3DData> s3dData;
@@ -43,6 +49,7 @@ namespace Borealis
 		BOREALIS_CORE_INFO("Material UBO data cpu size, {}", sizeof(MaterialUBOData) * 128);
 
 		s3dData->mMaterialsUBO = UniformBufferObject::Create(sizeof(MaterialUBOData) * 128, MATERIAL_ARRAY_BIND);
+		s3dData->mAnimationUBOs.push_back(UniformBufferObject::Create(sizeof(glm::mat4) * MAX_BONES * MAX_ANIMATION_PER_UBO, ANIMATION_BIND));
 
 		UniformBufferObject::BindToShader(s3dData->mModelShader->GetID(), "Camera", CAMERA_BIND);
 		UniformBufferObject::BindToShader(s3dData->mCommonShader->GetID(), "Camera", CAMERA_BIND);
@@ -78,143 +85,288 @@ namespace Borealis
 		//	shader->Bind();
 		//	shader->Set("u_ViewProjection", viewProj);
 		//}
+		s3dData->mViewProj = viewProj;
 		mLightEngine.Begin();
 	}
 
-	bool DrawCallComparator(const Renderer3D::DrawCall& a, const Renderer3D::DrawCall& b) {
-		if (a.shaderID != b.shaderID)
-			return a.shaderID->GetID() < b.shaderID->GetID();
-		if (a.materialHash != b.materialHash)
-			return a.materialHash < b.materialHash;
-		return a.entityID < b.entityID; // Fallback for stable sorting
-	}
-
-	void Renderer3D::End(bool posOnly)
+	// Bit layout of Renderer3D::DrawKey, most significant first
+	static constexpr uint64_t PassShift = 62;
+	static constexpr uint64_t ShaderShift = 48;
+	static constexpr uint64_t MaterialShift = 34;
+	static constexpr uint64_t MeshShift = 18;
+	static constexpr uint64_t ShaderMask = 0x3FFF;
+	static constexpr uint64_t MaterialMask = 0x3FFF;
+	static constexpr uint64_t MeshMask = 0xFFFF;
+	static constexpr uint64_t DepthMask = 0x3FFFF;
+
+	/*!***********************************************************************
+		\brief
+			Stable LSD radix sort on the 64 bit keys, one byte per pass. Passes
+			where every key has the same byte are skipped, so keys that only
+			differ in a few fields sort in a few passes.
+	*************************************************************************/
+	static void RadixSort(std::vector<Renderer3D::DrawKey>& keys, std::vector<Renderer3D::DrawKey>& scratch)
 	{
-		std::sort(drawQueue.begin(), drawQueue.end(), DrawCallComparator);
+		PROFILE_FUNCTION();
 
-		UpdateMaterialUBO();
+		size_t count = keys.size();
+		if (count < 2) return;
+		scratch.resize(count);
 
-		for (DrawCall const& drawCall : drawQueue)
+		std::array<std::array<uint32_t, 256>, 8> histograms{};
+		for (Renderer3D::DrawKey const& drawKey : keys)
 		{
-			drawCall.shaderID->Bind();
-			drawCall.shaderID->Set("materialIndex", materialMap[drawCall.materialHash]->GetIndex());
-			drawCall.shaderID->Set("u_HasAnimation", false);
-			drawCall.shaderID->Set("u_Transparent", false);
-
-			auto const& textureMap = materialMap[drawCall.materialHash]->GetTextureMaps();
-
-			int textureUnit = 3;
-
-			if (textureMap.contains(Material::Albedo))
-			{
-				drawCall.shaderID->Set("albedoMap", textureUnit);
-				textureMap.at(Material::Albedo)->Bind(textureUnit);
-				textureUnit++;
-			}
-			if (textureMap.contains(Material::NormalMap))
-			{
-				drawCall.shaderID->Set("normalMap", textureUnit);
-				textureMap.at(Material::NormalMap)->Bind(textureUnit);
-				textureUnit++;
-			}
-			if (textureMap.contains(Material::Emission))
+			for (int pass = 0; pass < 8; ++pass)
 			{
-				drawCall.shaderID->Set("emissionMap", textureUnit);
-				textureMap.at(Material::Emission)->Bind(textureUnit);
-				textureUnit++;
+				++histograms[pass][(drawKey.key >> (pass * 8)) & 0xFF];
 			}
-			if (textureMap.contains(Material::Metallic))
+		}
+
+		Renderer3D::DrawKey* src = keys.data();
+		Renderer3D::DrawKey* dst = scratch.data();
+		for (int pass = 0; pass < 8; ++pass)
+		{
+			std::array<uint32_t, 256>& histogram = histograms[pass];
+			int shift = pass * 8;
+			if (histogram[(src[0].key >> shift) & 0xFF] == count) continue;
+
+			uint32_t offset = 0;
+			for (uint32_t& bucket : histogram)
 			{
-				drawCall.shaderID->Set("metallicMap", textureUnit);
-				textureMap.at(Material::Metallic)->Bind(textureUnit);
-				textureUnit++;
+				uint32_t bucketCount = bucket;
+				bucket = offset;
+				offset += bucketCount;
 			}
 
-			if (std::holds_alternative<Ref<Model>>(drawCall.model))
+			for (size_t i = 0; i < count; ++i)
 			{
-				std::get<Ref<Model>>(drawCall.model)->Draw(drawCall.transform, drawCall.shaderID, drawCall.entityID, posOnly);
+				dst[histogram[(src[i].key >> shift) & 0xFF]++] = src[i];
 			}
-			else
-			{
-				if (drawCall.drawData.hasAnimation)
-				{
-					drawCall.shaderID->Set("u_HasAnimation", true);
-					drawCall.shaderID->Set("u_AnimationIndex", drawCall.drawData.animationIndex);
-				}
+			std::swap(src, dst);
+		}
 
-				std::get<Ref<SkinnedModel>>(drawCall.model)->Draw(drawCall.transform, drawCall.shaderID, drawCall.entityID);
-			}
+		if (src != keys.data())
+		{
+			keys.swap(scratch);
+		}
+	}
+
+	static void BindMaterial(Shader& shader, Material& material, int textureUnit)
+	{
+		shader.Set("materialIndex", material.GetIndex());
 
-			RenderCommand::ResetTextureBinding();
+		auto const& textureMap = material.GetTextureMaps();
+
+		if (textureMap.contains(Material::Albedo))
+		{
+			shader.Set("albedoMap", textureUnit);
+			textureMap.at(Material::Albedo)->Bind(textureUnit);
+			textureUnit++;
 		}
+		if (textureMap.contains(Material::NormalMap))
+		{
+			shader.Set("normalMap", textureUnit);
+			textureMap.at(Material::NormalMap)->Bind(textureUnit);
+			textureUnit++;
+		}
+		if (textureMap.contains(Material::Emission))
+		{
+			shader.Set("emissionMap", textureUnit);
+			textureMap.at(Material::Emission)->Bind(textureUnit);
+			textureUnit++;
+		}
+		if (textureMap.contains(Material::Metallic))
+		{
+			shader.Set("metallicMap", textureUnit);
+			textureMap.at(Material::Metallic)->Bind(textureUnit);
+			textureUnit++;
+		}
+	}
 
-		drawQueue.clear();
+	uint64_t Renderer3D::MakeSortKey(DrawCall const& drawCall)
+	{
+		bool skinned = std::holds_alternative<Ref<SkinnedModel>>(drawCall.model);
+		void const* mesh = skinned ? static_cast<void const*>(std::get<Ref<SkinnedModel>>(drawCall.model).get())
+			: static_cast<void const*>(std::get<Ref<Model>>(drawCall.model).get());
+		auto meshSlot = meshSlots.try_emplace(mesh, static_cast<uint32_t>(meshSlots.size())).first->second;
+
+		// View depth of the origin, positive floats compare the same as their bit patterns
+		float depth = std::max((s3dData->mViewProj * drawCall.transform[3]).w, 0.f);
+		uint32_t depthBits;
+		std::memcpy(&depthBits, &depth, sizeof(depthBits));
+
+		uint64_t key = 0;
+		key |= static_cast<uint64_t>(skinned ? 1 : 0) << PassShift;
+		key |= (static_cast<uint64_t>(drawCall.shaderID->GetID()) & ShaderMask) << ShaderShift;
+		key |= (static_cast<uint64_t>(drawCall.material->GetIndex()) & MaterialMask) << MaterialShift;
+		key |= (static_cast<uint64_t>(meshSlot) & MeshMask) << MeshShift;
+		key |= static_cast<uint64_t>(depthBits >> 13) & DepthMask;
+		return key;
 	}
 
-	void Renderer3D::RenderTransparentObjects(Ref<TextureCubeMap> const& cubeMap)
+	void Renderer3D::SubmitDrawQueue(std::vector<DrawCall> const& queue, bool posOnly, bool transparent, int firstTextureUnit)
 	{
-		std::sort(drawQueueTransparent.begin(), drawQueueTransparent.end(), DrawCallComparator);
+		PROFILE_FUNCTION();
 
-		UpdateMaterialUBO();
+		if (queue.empty()) return;
+
+		meshSlots.clear();
+		drawKeys.resize(queue.size());
+		for (uint32_t i = 0; i < queue.size(); ++i)
+		{
+			drawKeys[i] = { MakeSortKey(queue[i]), i };
+		}
+		RadixSort(drawKeys, drawKeysScratch);
+
+		// Instance i of the buffer belongs to the i-th draw in sorted order, so a run of draws is a contiguous range
+		instanceData.resize(queue.size());
+		for (size_t i = 0; i < drawKeys.size(); ++i)
+		{
+			DrawCall const& drawCall = queue[drawKeys[i].index];
+			instanceData[i].transform = drawCall.transform;
+			instanceData[i].entityID = static_cast<int>(drawCall.entityID);
+		}
 
-		for (DrawCall const& drawCall : drawQueueTransparent)
+		if (!s3dData->mInstanceBuffer || s3dData->mInstanceCapacity < instanceData.size())
 		{
-			drawCall.shaderID->Bind();
-			drawCall.shaderID->Set("materialIndex", materialMap[drawCall.materialHash]->GetIndex());
-			drawCall.shaderID->Set("u_HasAnimation", false);
-			drawCall.shaderID->Set("u_Transparent", true);
+			s3dData->mInstanceCapacity = std::max(static_cast<uint32_t>(instanceData.size()), s3dData->mInstanceCapacity * 2);
+			s3dData->mInstanceBuffer = VertexBuffer::Create(s3dData->mInstanceCapacity * sizeof(InstanceData));
+		}
+		s3dData->mInstanceBuffer->SetData(instanceData.data(), static_cast<uint32_t>(instanceData.size() * sizeof(InstanceData)));
 
-			auto const& textureMap = materialMap[drawCall.materialHash]->GetTextureMaps();
+		Shader* currentShader = nullptr;
+		Material* currentMaterial = nullptr;
+		bool shaderBound = false;
+		bool supportsInstancing = false;
+		bool instancedSet = false;
 
-			int textureUnit = 2;
+		size_t runStart = 0;
+		while (runStart < drawKeys.size())
+		{
+			DrawCall const& drawCall = queue[drawKeys[runStart].index];
+			bool skinned = std::holds_alternative<Ref<SkinnedModel>>(drawCall.model);
 
-			if (textureMap.contains(Material::Albedo))
+			// Consecutive static draws of the same model with the same shader and material become one instanced draw
+			size_t runEnd = runStart + 1;
+			if (!skinned)
 			{
-				drawCall.shaderID->Set("albedoMap", textureUnit);
-				textureMap.at(Material::Albedo)->Bind(textureUnit);
-				textureUnit++;
+				while (runEnd < drawKeys.size())
+				{
+					DrawCall const& next = queue[drawKeys[runEnd].index];
+					if (!std::holds_alternative<Ref<Model>>(next.model) || std::get<Ref<Model>>(next.model) != std::get<Ref<Model>>(drawCall.model) ||
+						next.shaderID != drawCall.shaderID || next.material != drawCall.material)
+					{
+						break;
+					}
+					++runEnd;
+				}
 			}
-			if (textureMap.contains(Material::NormalMap))
+
+			if (drawCall.shaderID.get() != currentShader)
 			{
-				drawCall.shaderID->Set("normalMap", textureUnit);
-				textureMap.at(Material::NormalMap)->Bind(textureUnit);
-				textureUnit++;
+				if (currentShader && instancedSet)
+				{
+					currentShader->Bind();
+					currentShader->Set("u_Instanced", false);
+				}
+
+				currentShader = drawCall.shaderID.get();
+				currentShader->Bind();
+				currentShader->Set("u_HasAnimation", false);
+				currentShader->Set("u_Transparent", transparent);
+				shaderBound = true;
+				supportsInstancing = currentShader->HasUniform("u_Instanced");
+				instancedSet = false;
+				currentMaterial = nullptr;
 			}
-			if (textureMap.contains(Material::Specular))
+			else if (!shaderBound)
 			{
-				drawCall.shaderID->Set("emissionMap", textureUnit);
-				textureMap.at(Material::Emission)->Bind(textureUnit);
-				textureUnit++;
+				currentShader->Bind();
+				shaderBound = true;
 			}
-			if (textureMap.contains(Material::Metallic))
+
+			if (drawCall.material.get() != currentMaterial)
 			{
-				drawCall.shaderID->Set("metallicMap", textureUnit);
-				textureMap.at(Material::Metallic)->Bind(textureUnit);
-				textureUnit++;
+				currentMaterial = drawCall.material.get();
+				BindMaterial(*currentShader, *currentMaterial, firstTextureUnit);
 			}
 
-			//cubeMap->Bind(7);
-			//drawCall.shaderID->Set("u_cubeMap", 7);
-			//textureUnit++;
-
-			if (std::holds_alternative<Ref<Model>>(drawCall.model))
+			if (!skinned)
 			{
-				std::get<Ref<Model>>(drawCall.model)->Draw(drawCall.transform, drawCall.shaderID, drawCall.entityID);
+				Ref<Model> const& model = std::get<Ref<Model>>(drawCall.model);
+				if (supportsInstancing)
+				{
+					if (!instancedSet)
+					{
+						currentShader->Set("u_Instanced", true);
+						instancedSet = true;
+					}
+					model->DrawInstanced(drawCall.shaderID, s3dData->mInstanceBuffer, static_cast<uint32_t>(runStart), static_cast<uint32_t>(runEnd - runStart), posOnly);
+				}
+				else
+				{
+					for (size_t i = runStart; i < runEnd; ++i)
+					{
+						DrawCall const& instance = queue[drawKeys[i].index];
+						model->Draw(instance.transform, instance.shaderID, instance.entityID, posOnly);
+					}
+					shaderBound = false; // Mesh::Draw unbinds the shader
+				}
 			}
 			else
 			{
+				if (instancedSet)
+				{
+					currentShader->Set("u_Instanced", false);
+					instancedSet = false;
+				}
+
 				if (drawCall.drawData.hasAnimation)
 				{
-					drawCall.shaderID->Set("u_HasAnimation", true);
-					drawCall.shaderID->Set("u_AnimationIndex", drawCall.drawData.animationIndex);
+					currentShader->Set("u_HasAnimation", true);
+					currentShader->Set("u_AnimationIndex", BindAnimationPalette(drawCall.drawData.animationIndex));
 				}
 
 				std::get<Ref<SkinnedModel>>(drawCall.model)->Draw(drawCall.transform, drawCall.shaderID, drawCall.entityID);
+
+				if (drawCall.drawData.hasAnimation)
+				{
+					currentShader->Set("u_HasAnimation", false);
+				}
 			}
-			RenderCommand::ResetTextureBinding();
+
+			runStart = runEnd;
 		}
 
+		// Direct draws with these shaders outside the queue expect u_Instanced to be off
+		if (currentShader && instancedSet)
+		{
+			currentShader->Bind();
+			currentShader->Set("u_Instanced", false);
+		}
+
+		RenderCommand::ResetTextureBinding();
+	}
+
+	void Renderer3D::End(bool posOnly)
+	{
+		PROFILE_FUNCTION();
+
+		UpdateMaterialUBO();
+		SubmitDrawQueue(drawQueue, posOnly, false, 3);
+		drawQueue.clear();
+	}
+
+	void Renderer3D::RenderTransparentObjects(Ref<TextureCubeMap> const& cubeMap)
+	{
+		PROFILE_FUNCTION();
+
+		UpdateMaterialUBO();
+
+		//cubeMap->Bind(7);
+		//drawCall.shaderID->Set("u_cubeMap", 7);
+
+		SubmitDrawQueue(drawQueueTransparent, false, true, 2);
 		drawQueueTransparent.clear();
 		//mLightEngine.Begin();//clear vector
 	}
@@ -344,6 +496,46 @@ namespace Borealis
 		return mGlobalWireFrame;
 	}
 
+	void Renderer3D::SetAnimationPalettes(glm::mat4 const* palettes, uint32_t count)
+	{
+		uint32_t const paletteSize = sizeof(glm::mat4) * MAX_BONES;
+		for (uint32_t first = 0, ubo = 0; first < count; first += MAX_ANIMATION_PER_UBO, ++ubo)
+		{
+			if (ubo == s3dData->mAnimationUBOs.size())
+			{
+				s3dData->mAnimationUBOs.push_back(UniformBufferObject::Create(paletteSize * MAX_ANIMATION_PER_UBO, ANIMATION_BIND));
+			}
+
+			uint32_t palettesInUBO = std::min<uint32_t>(count - first, MAX_ANIMATION_PER_UBO);
+			s3dData->mAnimationUBOs[ubo]->SetData(palettes + static_cast<size_t>(first) * MAX_BONES, palettesInUBO * paletteSize, 0);
+		}
+
+		// Creating a UBO binds it, put the first one back
+		s3dData->mAnimationUBOs[0]->Bind();
+		s3dData->mBoundAnimationUBO = 0;
+	}
+
+	int Renderer3D::BindAnimationPalette(int slot)
+	{
+		if (slot < 0)
+		{
+			return 0;
+		}
+
+		int ubo = slot / MAX_ANIMATION_PER_UBO;
+		if (ubo >= static_cast<int>(s3dData->mAnimationUBOs.size()))
+		{
+			return 0;
+		}
+
+		if (ubo != s3dData->mBoundAnimationUBO)
+		{
+			s3dData->mAnimationUBOs[ubo]->Bind();
+			s3dData->mBoundAnimationUBO = ubo;
+		}
+		return slot % MAX_ANIMATION_PER_UBO;
+	}
+
 	void Renderer3D::UpdateMaterialUBO()
 	{
 		if (mNewMaterialAdded)
@@ -466,24 +658,15 @@ namespace Borealis
 
 	void Renderer3D::AddToDrawQueue(std::variant<Ref<Model>, Ref<SkinnedModel>> model, Ref<Shader> shaderID, Ref<Material> materialHash, uint32_t entityID, glm::mat4 const& transform, std::optional<DrawData> drawData)
 	{
-		if(!materialMap.contains(materialHash->hash))
+		auto [materialIt, inserted] = materialMap.try_emplace(materialHash->hash, materialHash);
+		if (inserted)
 		{
-			materialMap.insert({ materialHash->hash, materialHash });
 			mNewMaterialAdded = true;
 		}
-		if(drawData.has_value())
-		{
-			if(materialHash->isTransparent)
-				drawQueueTransparent.push_back({ model, shaderID, materialHash->hash, entityID, transform, drawData.value() });
-			else
-				drawQueue.push_back({ model, shaderID, materialHash->hash, entityID, transform, drawData.value() });
-		}
-		else
-		{
-			if (materialHash->isTransparent)
-				drawQueueTransparent.push_back({ model, shaderID, materialHash->hash, entityID, transform });
-			else
-				drawQueue.push_back({ model, shaderID, materialHash->hash, entityID, transform });
-		}
+
+		// Draws keep the material that owns the UBO index for this hash
+		Ref<Material> const& material = materialIt->second;
+		std::vector<DrawCall>& queue = materialHash->isTransparent ? drawQueueTransparent : drawQueue;
+		queue.push_back({ model, shaderID, material, entityID, transform, drawData.value_or(DrawData{}) });
 	}
 }
\ No newline at end of file
@@ -14,8 +14,22 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 
 #include <BorealisPCH.hpp>
 #include <Graphics/RendererAPI.hpp>
+#include <Graphics/OpenGL/RendererAPIOpenGLImpl.hpp>
+#include <Graphics/Null/RendererAPINullImpl.hpp>
 
 namespace Borealis
 {
 	RendererAPI::API RendererAPI::sAPI = RendererAPI::API::OpenGL;
+
+	Scope<RendererAPI> RendererAPI::Create()
+	{
+		switch (sAPI)
+		{
+		case API::None: BOREALIS_CORE_ASSERT(false, "RendererAPI::None is not supported"); return nullptr;
+		case API::OpenGL: return MakeScope<OpenGLRendererAPI>();
+		case API::Null: return MakeScope<NullRendererAPI>();
+		}
+		BOREALIS_CORE_ASSERT(false, "Unknown RendererAPI");
+		return nullptr;
+	}
 }
\ No newline at end of file
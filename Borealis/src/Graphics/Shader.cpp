@@ -17,6 +17,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include <Graphics/Shader.hpp>
 #include <Graphics/Renderer.hpp>
 #include <Graphics/OpenGL/ShaderOpenGLImpl.hpp>
+#include <Graphics/Null/ShaderNullImpl.hpp>
 #include <Graphics/UniformBufferObject.hpp>
 #include <Graphics/OpenGL/UniformBufferObjectOpenGLImpl.hpp>
 #include <Graphics/UBOBindings.hpp>
@@ -38,7 +39,10 @@ namespace Borealis
 			UniformBufferObject::BindToShader(s_material3dShader->GetID(), "AnimationUBO", ANIMATION_BIND);
 			UniformBufferObject::BindToShader(s_material3dShader->GetID(), "SceneRenderUBO", SCENE_RENDER_BIND);
 
-			BOREALIS_CORE_INFO("Animation UBO size : {} bytes", UniformBufferObjectOpenGLImpl::GetBlockSize(s_material3dShader->GetID(), "AnimationUBO"));
+			if (Renderer::GetAPI() == RendererAPI::API::OpenGL)
+			{
+				BOREALIS_CORE_INFO("Animation UBO size : {} bytes", UniformBufferObjectOpenGLImpl::GetBlockSize(s_material3dShader->GetID(), "AnimationUBO"));
+			}
 		}
 		return s_material3dShader;
 	}
@@ -49,6 +53,7 @@ namespace Borealis
 		{
 		case RendererAPI::API::None: BOREALIS_CORE_ASSERT(false, "RendererAPI::None is not supported"); return nullptr;
 		case RendererAPI::API::OpenGL: return MakeRef<OpenGLShader>(filepath);
+		case RendererAPI::API::Null: return MakeRef<NullShader>(filepath);
 		}
 		BOREALIS_CORE_ASSERT(false, "Unknown RendererAPI");
 		return nullptr;
@@ -60,6 +65,7 @@ namespace Borealis
 		{
 		case RendererAPI::API::None: BOREALIS_CORE_ASSERT(false, "RendererAPI::None is not supported"); return nullptr;
 		case RendererAPI::API::OpenGL: return MakeRef<OpenGLShader>(name, vertexSrc, fragmentSrc);
+		case RendererAPI::API::Null: return MakeRef<NullShader>(name, vertexSrc, fragmentSrc);
 		}
 		BOREALIS_CORE_ASSERT(false, "Unknown RendererAPI");
 		return nullptr;
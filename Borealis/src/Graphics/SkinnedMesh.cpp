@@ -15,6 +15,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include <BorealisPCH.hpp>
 #include "Graphics/SkinnedMesh.hpp"
 #include <Graphics/OpenGL/TextureOpenGLImpl.hpp>
+#include <Graphics/Null/RendererAPINullImpl.hpp>
 
 namespace Borealis
 {
@@ -72,14 +73,59 @@ namespace Borealis
 		//	glEnableVertexAttribArray(4);
 		//}
 
+		if (RendererAPI::GetAPI() == RendererAPI::API::Null)
+		{
+			NullRendererAPI::Record(NullCommand::BindBuffer);
+			NullRendererAPI::Record(NullCommand::DrawElements, mIndices.size());
+			return;
+		}
+
 		glBindVertexArray(VAO);
 		glDrawElements(GL_TRIANGLES, (int)mIndices.size(), GL_UNSIGNED_INT, 0);
 		glBindVertexArray(0);
 	}
 
 	void SkinnedMesh::SetupMesh()
+	{
+		PrepareMesh();
+		UploadMesh();
+	}
+
+	void SkinnedMesh::PrepareMesh()
 	{
 		ComputeTangents();
+	}
+
+	void SkinnedMesh::ReleaseMesh()
+	{
+		if (RendererAPI::GetAPI() == RendererAPI::API::Null)
+		{
+			NullRendererAPI::Record(NullCommand::DestroyResource);
+			return;
+		}
+
+		if (VAO == 0) return;
+
+		glDeleteVertexArrays(1, &VAO);
+		glDeleteBuffers(1, &VBO);
+		glDeleteBuffers(1, &EBO);
+		VAO = VBO = EBO = 0;
+	}
+
+	uint64_t SkinnedMesh::GetMemorySize() const
+	{
+		return (mVertices.size() * sizeof(SkinnedVertex) + mIndices.size() * sizeof(unsigned int)) * 2;
+	}
+
+	void SkinnedMesh::UploadMesh()
+	{
+		if (RendererAPI::GetAPI() == RendererAPI::API::Null)
+		{
+			NullRendererAPI::Record(NullCommand::CreateResource);
+			NullRendererAPI::Record(NullCommand::Upload, mVertices.size() * sizeof(SkinnedVertex) + mIndices.size() * sizeof(unsigned int));
+			return;
+		}
+
 		glGenVertexArrays(1, &VAO);
 		glGenBuffers(1, &VBO);
 		glGenBuffers(1, &EBO);
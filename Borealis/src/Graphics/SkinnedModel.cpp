@@ -28,31 +28,21 @@ namespace Borealis
 
 	void SkinnedModel::LoadModel(std::filesystem::path const& path)
 	{
-		std::stringstream inFile;
-		if (AssetManager::IsPakLoaded())
-		{
-			try
-			{
-				std::string subPath = path.filename().string();
-				uint64_t id = std::stoull(subPath);
-				char* buffer;
-				uint64_t size;
-				AssetManager::RetrieveFromPak(id, buffer, size);
-				inFile << std::string(buffer, size);
-				delete[] buffer;
-			}
-			catch (...)
-			{
-				std::ifstream actualFile(path, std::ios::binary);
-				inFile << actualFile.rdbuf();
-				actualFile.close();
-			}
-		}
-		else
+		ReadModel(path);
+		UploadMeshes();
+	}
+
+	void SkinnedModel::ReadModel(std::filesystem::path const& path)
+	{
+		// Parse the pak asset in place, or stream from disk when the pak does not hold it
+		PakAsset pakAsset = AssetManager::ReadFromPak(path);
+		MemoryStreamBuffer pakBuffer(pakAsset.View());
+		std::ifstream actualFile;
+		std::istream inFile(&pakBuffer);
+		if (pakBuffer.empty())
 		{
-			std::ifstream actualFile(path, std::ios::binary);
-			inFile << actualFile.rdbuf();
-			actualFile.close();
+			actualFile.open(path, std::ios::binary);
+			inFile.rdbuf(actualFile.rdbuf());
 		}
 
 
@@ -106,7 +96,7 @@ namespace Borealis
 
 			mesh.GetIndices() = oldIndices;
 
-			mesh.SetupMesh();
+			mesh.PrepareMesh();
 		}
 
 		// Load bone data map
@@ -133,6 +123,36 @@ namespace Borealis
 
 		// Load bone counter
 		inFile.read(reinterpret_cast<char*>(&mBoneCounter), sizeof(mBoneCounter));
+
+		GenerateAABB();
+	}
+
+	void SkinnedModel::UploadMeshes()
+	{
+		for (SkinnedMesh& mesh : mMeshes)
+		{
+			mesh.UploadMesh();
+		}
+	}
+
+	void SkinnedModel::GenerateAABB()
+	{
+		if (mMeshes.empty()) return;
+
+		glm::vec3 minExtent(std::numeric_limits<float>::max());
+		glm::vec3 maxExtent(std::numeric_limits<float>::lowest());
+		for (SkinnedMesh& mesh : mMeshes)
+		{
+			for (SkinnedVertex const& vertex : mesh.GetVertices())
+			{
+				minExtent = glm::min(minExtent, vertex.Position);
+				maxExtent = glm::max(maxExtent, vertex.Position);
+			}
+		}
+
+		// Animated poses can extend past the bind pose, pad by a quarter of the size
+		glm::vec3 padding = (maxExtent - minExtent) * 0.25f;
+		mAABB = { minExtent - padding, maxExtent + padding };
 	}
 
 	void SkinnedModel::AssignAnimation(Ref<Animation> animation)
@@ -140,7 +160,7 @@ namespace Borealis
 		for (int i{}; i < animation->mBones.size(); ++i)
 		{
 			Bone& bone = animation->mBones[i];
-			std::string boneName = bone.GetBoneName();
+			std::string const& boneName = bone.GetBoneName();
 
 			if (mBoneDataMap.find(boneName) == mBoneDataMap.end())
 			{
@@ -148,7 +168,7 @@ namespace Borealis
 			}
 		}
 
-		animation->mBoneDataMap = mBoneDataMap;
+		animation->BindSkeleton(mBoneDataMap);
 
 		mAnimation = animation;
 	}
@@ -197,6 +217,24 @@ namespace Borealis
 		outFile.close();
 	}
 
+	uint64_t SkinnedModel::GetMemorySize() const
+	{
+		uint64_t bytes = sizeof(SkinnedModel) + mBoneDataMap.size() * sizeof(BoneData);
+		for (SkinnedMesh const& mesh : mMeshes)
+		{
+			bytes += mesh.GetMemorySize();
+		}
+		return bytes;
+	}
+
+	void SkinnedModel::Release()
+	{
+		for (SkinnedMesh& mesh : mMeshes)
+		{
+			mesh.ReleaseMesh();
+		}
+	}
+
 	void SkinnedModel::swap(Asset& o)
 	{
 		SkinnedModel& other = dynamic_cast<SkinnedModel&>(o);
@@ -204,6 +242,7 @@ namespace Borealis
 		std::swap(mBoneDataMap, other.mBoneDataMap);
 		std::swap(mBoneCounter, other.mBoneCounter);
 		std::swap(mAnimation, other.mAnimation);
+		std::swap(mAABB, other.mAABB);
 	}
 
 	
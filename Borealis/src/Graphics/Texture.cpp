@@ -15,6 +15,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include <Graphics/Texture.hpp>
 #include <Graphics/Renderer.hpp>
 #include <Graphics/OpenGL/TextureOpenGLImpl.hpp>
+#include <Graphics/Null/TextureNullImpl.hpp>
 namespace Borealis
 {
 	Ref<Texture2D> Texture2D::mDefault = nullptr;
@@ -33,6 +34,9 @@ namespace Borealis
 					texture = nullptr;
 				}
 				break;
+			case RendererAPI::API::Null:
+				texture = MakeRef<NullTexture2D>(textureInfo);
+				break;
 		}
 		if (!texture)
 		{
@@ -56,6 +60,9 @@ namespace Borealis
 				texture = nullptr;
 			}
 			break;
+		case RendererAPI::API::Null:
+			texture = MakeRef<NullTexture2D>(path, textureConfig);
+			break;
 		}
 		if(!texture)
 		{
@@ -87,6 +94,8 @@ namespace Borealis
 				texture = nullptr;
 			}
 			break;
+		case RendererAPI::API::Null:
+			break;
 		}
 		if (!texture)
 		{
@@ -115,11 +124,16 @@ namespace Borealis
 		{
 		case RendererAPI::API::None: BOREALIS_CORE_ASSERT(false, "RendererAPI::None is not supported");
 		case RendererAPI::API::OpenGL:
+		{
 			OpenGLTexture2D& original = dynamic_cast<OpenGLTexture2D&>(*this);
 			OpenGLTexture2D& other = dynamic_cast<OpenGLTexture2D&>(o);
 			original.swap(other);
 			break;
 		}
+		case RendererAPI::API::Null:
+			dynamic_cast<NullTexture2D&>(*this).swap(o);
+			break;
+		}
 	}
 
 	//void Texture2D::Reload(AssetMetaData const& assetMetaData)
@@ -141,6 +155,9 @@ namespace Borealis
 				texture = nullptr;
 			}
 			break;
+		case RendererAPI::API::Null:
+			texture = MakeRef<NullTextureCubeMap>(path);
+			break;
 		}
 		return texture;
 
@@ -180,10 +197,15 @@ namespace Borealis
 		{
 		case RendererAPI::API::None: BOREALIS_CORE_ASSERT(false, "RendererAPI::None is not supported"); break;
 		case RendererAPI::API::OpenGL:
+		{
 			TextureCubeMap& self = dynamic_cast<TextureCubeMap&>(*this);
 			TextureCubeMap& other = dynamic_cast<TextureCubeMap&>(o);
 			self.swap(other);
 			break;
 		}
+		case RendererAPI::API::Null:
+			dynamic_cast<NullTextureCubeMap&>(*this).swap(o);
+			break;
+		}
 	}
 }
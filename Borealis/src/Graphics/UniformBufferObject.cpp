@@ -17,6 +17,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include <Graphics/UniformBufferObject.hpp>
 #include <Graphics/Renderer.hpp>
 #include <Graphics/OpenGL/UniformBufferObjectOpenGLImpl.hpp>
+#include <Graphics/Null/UniformBufferObjectNullImpl.hpp>
 
 namespace Borealis
 {
@@ -26,6 +27,7 @@ namespace Borealis
 		{
 		case RendererAPI::API::None: BOREALIS_CORE_ASSERT(false, "No render api");
 		case RendererAPI::API::OpenGL: return MakeRef<UniformBufferObjectOpenGLImpl>(size, binding);
+		case RendererAPI::API::Null: return MakeRef<UniformBufferObjectNullImpl>(size, binding);
 		}
 
 		BOREALIS_CORE_ASSERT(false, "Unknown API");
@@ -38,6 +40,7 @@ namespace Borealis
 		{
 		case RendererAPI::API::None: BOREALIS_CORE_ASSERT(false, "No render api");
 		case RendererAPI::API::OpenGL:UniformBufferObjectOpenGLImpl::BindToShader(shaderID, blockName, binding); return;
+		case RendererAPI::API::Null:UniformBufferObjectNullImpl::BindToShader(shaderID, blockName, binding); return;
 		}
 	}
 }
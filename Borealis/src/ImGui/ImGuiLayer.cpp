@@ -66,7 +66,8 @@ namespace Borealis
 		io.ConfigFlags |= ImGuiConfigFlags_NavEnableKeyboard;     // Enable Keyboard Controls
 		io.ConfigFlags |= ImGuiConfigFlags_NavEnableGamepad;      // Enable Gamepad Controls
 		io.ConfigFlags |= ImGuiConfigFlags_DockingEnable;         // Enable Docking
-		io.ConfigFlags |= ImGuiConfigFlags_ViewportsEnable;       // Enable Multi-Viewport / Platform Windows
+		if (RendererAPI::GetAPI() != RendererAPI::API::Null)
+			io.ConfigFlags |= ImGuiConfigFlags_ViewportsEnable;   // Enable Multi-Viewport / Platform Windows
 		//io.ConfigViewportsNoAutoMerge = true;
 		//io.ConfigViewportsNoTaskBarIcon = true;
 
@@ -98,8 +99,17 @@ namespace Borealis
 
 
 		// Setup Platform/Renderer backends
-		ImGui_ImplGlfw_InitForOpenGL(window, true);
-		ImGui_ImplOpenGL3_Init("#version 410");
+		if (RendererAPI::GetAPI() == RendererAPI::API::Null)
+		{
+			// No renderer backend when headless, the UI is still built every frame but never drawn
+			ImGui_ImplGlfw_InitForOther(window, true);
+			io.Fonts->Build();
+		}
+		else
+		{
+			ImGui_ImplGlfw_InitForOpenGL(window, true);
+			ImGui_ImplOpenGL3_Init("#version 410");
+		}
 
 		auto& imGuizmoStyle = ImGuizmo::GetStyle();
 
@@ -137,7 +147,8 @@ namespace Borealis
 	{
 		PROFILE_FUNCTION();
 
-		ImGui_ImplOpenGL3_Shutdown();
+		if (RendererAPI::GetAPI() != RendererAPI::API::Null)
+			ImGui_ImplOpenGL3_Shutdown();
 		ImGui_ImplGlfw_Shutdown();
 		ImGui::DestroyContext();
 	}
@@ -146,7 +157,8 @@ namespace Borealis
 	{
 		PROFILE_FUNCTION();
 
-		ImGui_ImplOpenGL3_NewFrame();
+		if (RendererAPI::GetAPI() != RendererAPI::API::Null)
+			ImGui_ImplOpenGL3_NewFrame();
 		ImGui_ImplGlfw_NewFrame();
 		ImGui::NewFrame();
 		ImGuizmo::BeginFrame();
@@ -161,7 +173,8 @@ namespace Borealis
 		io.DisplaySize = ImVec2(static_cast<float>(app.GetWindow()->GetWidth()), static_cast<float>(app.GetWindow()->GetHeight()));
 
 		ImGui::Render();
-		ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+		if (RendererAPI::GetAPI() != RendererAPI::API::Null)
+			ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
 		RenderCommand::GetError({});
 
 		if (io.ConfigFlags & ImGuiConfigFlags_ViewportsEnable)
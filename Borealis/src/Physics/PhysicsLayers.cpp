@@ -0,0 +1,126 @@
+/******************************************************************************/
+/*!
+\file		PhysicsLayers.cpp
+\author 	Benjamin Lee Zhi Yuan
+\par    	email: benjaminzhiyuan.lee\@digipen.edu
+\date   	October 17, 2026
+\brief		Defines the project layer collision matrix and its mapping onto
+			Jolt object and broadphase layers
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#include "BorealisPCH.hpp"
+#include <Physics/PhysicsLayers.hpp>
+
+namespace Borealis
+{
+	uint32_t PhysicsLayers::sCollisionMasks[PhysicsLayers::LayerCount] = {
+		AllLayers, AllLayers, AllLayers, AllLayers, AllLayers, AllLayers, AllLayers, AllLayers,
+		AllLayers, AllLayers, AllLayers, AllLayers, AllLayers, AllLayers, AllLayers, AllLayers,
+		AllLayers, AllLayers, AllLayers, AllLayers, AllLayers, AllLayers, AllLayers, AllLayers,
+		AllLayers, AllLayers, AllLayers, AllLayers, AllLayers, AllLayers, AllLayers, AllLayers
+	};
+	uint32_t PhysicsLayers::sDebrisMask = 0;
+
+	namespace
+	{
+		constexpr uint32_t CategoryBit(BroadPhaseCategory category)
+		{
+			return 1u << static_cast<uint32_t>(category);
+		}
+
+		// Row per category of the categories it can touch, kept symmetric
+		constexpr uint32_t sCategoryMasks[static_cast<uint32_t>(BroadPhaseCategory::Count)] = {
+			// Static: nothing static is ever tested against itself
+			CategoryBit(BroadPhaseCategory::Moving) | CategoryBit(BroadPhaseCategory::Debris) |
+			CategoryBit(BroadPhaseCategory::Trigger) | CategoryBit(BroadPhaseCategory::Character),
+			// Moving
+			CategoryBit(BroadPhaseCategory::Static) | CategoryBit(BroadPhaseCategory::Moving) | CategoryBit(BroadPhaseCategory::Debris) |
+			CategoryBit(BroadPhaseCategory::Trigger) | CategoryBit(BroadPhaseCategory::Character),
+			// Debris: stacks on itself and still raises triggers, only characters ignore it
+			CategoryBit(BroadPhaseCategory::Static) | CategoryBit(BroadPhaseCategory::Moving) | CategoryBit(BroadPhaseCategory::Debris) |
+			CategoryBit(BroadPhaseCategory::Trigger),
+			// Trigger: sensors report static and debris bodies as before the split
+			CategoryBit(BroadPhaseCategory::Static) | CategoryBit(BroadPhaseCategory::Moving) | CategoryBit(BroadPhaseCategory::Debris) |
+			CategoryBit(BroadPhaseCategory::Character),
+			// Character
+			CategoryBit(BroadPhaseCategory::Static) | CategoryBit(BroadPhaseCategory::Moving) |
+			CategoryBit(BroadPhaseCategory::Trigger) | CategoryBit(BroadPhaseCategory::Character)
+		};
+	}
+
+	void PhysicsLayers::Reset()
+	{
+		for (uint32_t& mask : sCollisionMasks)
+		{
+			mask = AllLayers;
+		}
+		sDebrisMask = 0;
+	}
+
+	void PhysicsLayers::SetCollision(uint32_t layerA, uint32_t layerB, bool collide)
+	{
+		if (layerA >= LayerCount || layerB >= LayerCount) return;
+
+		if (collide)
+		{
+			sCollisionMasks[layerA] |= 1u << layerB;
+			sCollisionMasks[layerB] |= 1u << layerA;
+		}
+		else
+		{
+			sCollisionMasks[layerA] &= ~(1u << layerB);
+			sCollisionMasks[layerB] &= ~(1u << layerA);
+		}
+	}
+
+	bool PhysicsLayers::GetCollision(uint32_t layerA, uint32_t layerB)
+	{
+		if (layerA >= LayerCount || layerB >= LayerCount) return false;
+		return (sCollisionMasks[layerA] & (1u << layerB)) != 0;
+	}
+
+	void PhysicsLayers::SetCollisionMask(uint32_t layer, uint32_t mask)
+	{
+		if (layer >= LayerCount) return;
+
+		for (uint32_t other = 0; other < LayerCount; ++other)
+		{
+			SetCollision(layer, other, (mask & (1u << other)) != 0);
+		}
+	}
+
+	uint32_t PhysicsLayers::GetCollisionMask(uint32_t layer)
+	{
+		return layer < LayerCount ? sCollisionMasks[layer] : 0;
+	}
+
+	bool PhysicsLayers::CategoriesCollide(BroadPhaseCategory a, BroadPhaseCategory b)
+	{
+		if (a >= BroadPhaseCategory::Count || b >= BroadPhaseCategory::Count) return false;
+		return (sCategoryMasks[static_cast<uint32_t>(a)] & CategoryBit(b)) != 0;
+	}
+
+	bool PhysicsLayers::ShouldCollide(uint16_t objectLayerA, uint16_t objectLayerB)
+	{
+		return CategoriesCollide(ToCategory(objectLayerA), ToCategory(objectLayerB))
+			&& (sCollisionMasks[ToLayer(objectLayerA)] & (1u << ToLayer(objectLayerB))) != 0;
+	}
+
+	const char* PhysicsLayers::GetCategoryName(BroadPhaseCategory category)
+	{
+		switch (category)
+		{
+		case BroadPhaseCategory::Static:	return "STATIC";
+		case BroadPhaseCategory::Moving:	return "MOVING";
+		case BroadPhaseCategory::Debris:	return "DEBRIS";
+		case BroadPhaseCategory::Trigger:	return "TRIGGER";
+		case BroadPhaseCategory::Character:	return "CHARACTER";
+		default:							return "INVALID";
+		}
+	}
+}
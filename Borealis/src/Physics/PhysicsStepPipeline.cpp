@@ -0,0 +1,262 @@
+/******************************************************************************/
+/*!
+\file		PhysicsStepPipeline.cpp
+\author 	Benjamin Lee Zhi Yuan
+\par    	email: benjaminzhiyuan.lee\@digipen.edu
+\date   	October 17, 2026
+\brief		Defines the pipeline that runs one fixed physics step between the
+			scene and Jolt
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#include "BorealisPCH.hpp"
+#include <chrono>
+#include <Physics/PhysicsStepPipeline.hpp>
+#include <Scene/Scene.hpp>
+#include <Scene/Entity.hpp>
+#include <Core/JobSystem.hpp>
+
+namespace Borealis
+{
+	namespace
+	{
+		using StageClock = std::chrono::high_resolution_clock;
+
+		/*!***********************************************************************
+			\brief
+				Adds the time since start to total and sends it to the profiler
+				as a plot
+		*************************************************************************/
+		void RecordStage(const char* plotName, StageClock::time_point start, float& total)
+		{
+			float ms = std::chrono::duration<float, std::milli>(StageClock::now() - start).count();
+			total += ms;
+			if (TracyProfiler::g_EnableProfiler)
+			{
+				TracyProfiler::recordPlot(plotName, ms);
+			}
+		}
+	}
+
+	void PhysicsStepPipeline::Step(Scene& scene, float dt)
+	{
+		PROFILE_FUNCTION();
+
+		auto start = StageClock::now();
+		Gather(scene);
+		RecordStage("Physics Gather (ms)", start, mTimings.gatherMs);
+
+		start = StageClock::now();
+		Push(dt);
+		RecordStage("Physics Push (ms)", start, mTimings.pushMs);
+
+		start = StageClock::now();
+		Simulate(dt);
+		RecordStage("Physics Simulate (ms)", start, mTimings.simulateMs);
+
+		start = StageClock::now();
+		Pull(scene);
+		RecordStage("Physics Pull (ms)", start, mTimings.pullMs);
+
+		++mTimings.steps;
+	}
+
+	template<typename Collider, typename... Earlier>
+	void PhysicsStepPipeline::GatherBodies(Scene& scene)
+	{
+		auto group = scene.mRegistry.group<>(entt::get<TransformComponent, Collider, RigidbodyComponent>);
+		for (auto entity : group)
+		{
+			auto [transform, collider] = group.template get<TransformComponent, Collider>(entity);
+			Entity brEntity{ entity, &scene };
+			if (!brEntity.IsActive())
+			{
+				// Resend once the entity is active again
+				collider.syncedWorldVersion = UINT32_MAX;
+				continue;
+			}
+
+			uint32_t const bodyIndex = PhysicsSystem::GetBodyIndex(collider.bodyID);
+			if (bodyIndex >= mBodyLookup.size())
+			{
+				mBodyLookup.resize(bodyIndex + 1);
+			}
+			mBodyLookup[bodyIndex] = static_cast<uint32_t>(mBodies.size());
+
+			// Only one job may write a transform, an entity with a character or an earlier body defers this one
+			bool const shared = scene.mRegistry.template any_of<CharacterControllerComponent, Earlier...>(entity);
+			mBodies.push_back({ &transform, &collider, shared });
+		}
+	}
+
+	void PhysicsStepPipeline::Gather(Scene& scene)
+	{
+		PROFILE_SCOPE("PhysicsStepPipeline::Gather");
+
+		// Push reads world matrices from every job, none of them may be stale
+		scene.UpdateTransformHierarchy();
+
+		mBodies.clear();
+		GatherBodies<BoxColliderComponent>(scene);
+		GatherBodies<SphereColliderComponent, BoxColliderComponent>(scene);
+		GatherBodies<CapsuleColliderComponent, BoxColliderComponent, SphereColliderComponent>(scene);
+		GatherBodies<CylinderColliderComponent, BoxColliderComponent, SphereColliderComponent, CapsuleColliderComponent>(scene);
+
+		mCharacters.clear();
+		auto characterGroup = scene.mRegistry.group<>(entt::get<TransformComponent, CharacterControllerComponent>);
+		for (auto entity : characterGroup)
+		{
+			Entity brEntity{ entity, &scene };
+			if (brEntity.IsActive())
+			{
+				auto [transform, character] = characterGroup.get<TransformComponent, CharacterControllerComponent>(entity);
+				mCharacters.push_back({ &transform, &character });
+			}
+		}
+
+		mTimings.bodies = static_cast<uint32_t>(mBodies.size());
+	}
+
+	void PhysicsStepPipeline::Push(float dt)
+	{
+		PROFILE_SCOPE("PhysicsStepPipeline::Push");
+
+		uint32_t const characterCount = static_cast<uint32_t>(mCharacters.size());
+		uint32_t const bodyCount = static_cast<uint32_t>(mBodies.size());
+		mBodySyncs.resize(bodyCount);
+		mBodyChanged.resize(bodyCount);
+
+		// Characters first, then bodies, all in one index space so there is a single join
+		JobSystem::ParallelFor(characterCount + bodyCount, [this, characterCount, dt](uint32_t begin, uint32_t end)
+			{
+				for (uint32_t i = begin; i < end; ++i)
+				{
+					if (i < characterCount)
+					{
+						CharacterEntry const& entry = mCharacters[i];
+						PhysicsSystem::PushCharacterTransform(*entry.character, entry.transform->Translate, entry.transform->Rotation);
+						PhysicsSystem::HandleInput(dt, *entry.character);
+						continue;
+					}
+
+					uint32_t const b = i - characterCount;
+					TransformComponent& transform = *mBodies[b].transform;
+					ColliderComponent& collider = *mBodies[b].collider;
+
+					// Only bodies whose world matrix or movement type changed since they were last synced are pushed
+					MovementType movement = collider.rigidBody ? collider.rigidBody->movement : MovementType::Static;
+					bool movementChanged = movement != collider.syncedMovement;
+					mBodyChanged[b] = transform.mWorldVersion != collider.syncedWorldVersion || movementChanged;
+					if (!mBodyChanged[b])
+					{
+						continue;
+					}
+
+					glm::vec4 center = transform.mCachedWorld * glm::vec4(collider.center, 1.0f);
+					mBodySyncs[b] = { collider.bodyID, glm::vec3(center), glm::quat(glm::radians(transform.Rotation)), movement, movementChanged };
+					collider.syncedWorldVersion = transform.mWorldVersion;
+					collider.syncedMovement = movement;
+				}
+			}, mGrainSize);
+
+		for (CharacterEntry const& entry : mCharacters)
+		{
+			PhysicsSystem::PrePhysicsUpdate(dt, entry.character->controller);
+		}
+
+		uint32_t changed = 0;
+		for (uint32_t b = 0; b < bodyCount; ++b)
+		{
+			if (mBodyChanged[b])
+			{
+				mBodySyncs[changed++] = mBodySyncs[b];
+			}
+		}
+		mBodySyncs.resize(changed);
+		PhysicsSystem::PushTransforms(mBodySyncs);
+
+		mTimings.pushedBodies = changed;
+	}
+
+	void PhysicsStepPipeline::Simulate(float dt)
+	{
+		PROFILE_SCOPE("PhysicsStepPipeline::Simulate");
+		PhysicsSystem::Update(dt);
+	}
+
+	void PhysicsStepPipeline::Pull(Scene& scene)
+	{
+		PROFILE_SCOPE("PhysicsStepPipeline::Pull");
+
+		// Sleeping bodies did not move
+		PhysicsSystem::GetActiveBodies(mActiveBodies);
+
+		uint32_t const characterCount = static_cast<uint32_t>(mCharacters.size());
+		uint32_t const activeCount = static_cast<uint32_t>(mActiveBodies.size());
+		mPulledBodies.resize(activeCount);
+
+		JobSystem::ParallelFor(characterCount + activeCount, [this, characterCount](uint32_t begin, uint32_t end)
+			{
+				for (uint32_t i = begin; i < end; ++i)
+				{
+					if (i < characterCount)
+					{
+						CharacterEntry const& entry = mCharacters[i];
+						PhysicsSystem::PullCharacterTransform(*entry.character, entry.transform->Translate, entry.transform->Rotation);
+						continue;
+					}
+
+					// Character inner bodies and bodies of inactive entities were not gathered
+					uint32_t const a = i - characterCount;
+					unsigned int const bodyID = mActiveBodies[a];
+					uint32_t const bodyIndex = PhysicsSystem::GetBodyIndex(bodyID);
+					mPulledBodies[a] = { nullptr, nullptr, false };
+					if (bodyIndex >= mBodyLookup.size() || mBodyLookup[bodyIndex] >= mBodies.size())
+					{
+						continue;
+					}
+
+					BodyEntry const& entry = mBodies[mBodyLookup[bodyIndex]];
+					if (entry.collider->bodyID != bodyID)
+					{
+						continue;
+					}
+
+					if (!entry.shared)
+					{
+						PhysicsSystem::PullTransform(*entry.collider, *entry.transform);
+					}
+					mPulledBodies[a] = entry;
+				}
+			}, mGrainSize);
+
+		// Entities with more than one body or a character are written by one thread at a time
+		for (BodyEntry const& entry : mPulledBodies)
+		{
+			if (entry.collider && entry.shared)
+			{
+				PhysicsSystem::PullTransform(*entry.collider, *entry.transform);
+			}
+		}
+
+		// Propagate pulled body transforms to their children
+		scene.UpdateTransformHierarchy();
+
+		// What was pulled already matches the body, do not push it back next step
+		uint32_t pulled = 0;
+		for (BodyEntry const& entry : mPulledBodies)
+		{
+			if (entry.collider)
+			{
+				entry.collider->syncedWorldVersion = entry.transform->mWorldVersion;
+				++pulled;
+			}
+		}
+
+		mTimings.pulledBodies = pulled;
+	}
+}
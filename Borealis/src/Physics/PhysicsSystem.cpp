@@ -22,6 +22,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include <mutex>
 
 #include <Physics/PhysicsSystem.hpp>
+#include <Physics/PhysicsLayers.hpp>
 #include <Core/Utils.hpp>
 #include <Jolt/Jolt.h>
 #include <Scene/Entity.hpp>
@@ -50,6 +51,9 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include <Jolt/Physics/Collision/Shape/ScaledShape.h>
 #include <Jolt/Physics/Collision/RayCast.h>
 #include <Jolt/Physics/Collision/CastResult.h>
+#include <Jolt/Physics/Collision/ShapeCast.h>
+#include <Jolt/Physics/Collision/CollideShape.h>
+#include <Jolt/Physics/Collision/CollisionCollectorImpl.h>
 #include <Jolt/Renderer/DebugRendererSimple.h>
 
 #include <Graphics/Renderer2D.hpp>
@@ -63,9 +67,6 @@ using namespace std;
 using namespace JPH;
 using namespace JPH::literals;
 
-static std::mutex persistMutex;
-static std::mutex enterMutex;
-static std::mutex exitMutex;
 static std::mutex bodyMutex;
 static std::mutex characterMutex;
 
@@ -97,16 +98,8 @@ static bool AssertFailedImpl(const char* inExpression, const char* inMessage, co
 
 #endif // JPH_ENABLE_ASSERTS
 
-// Layer that objects can be in, determines which other objects it can collide with
-// Typically you at least want to have 1 layer for moving bodies and 1 layer for static bodies, but you can have more
-// layers if you want. E.g. you could have a layer for high detail collision (which is not used by the physics simulation
-// but only if you do collision testing).
-namespace Layers
-{
-	static constexpr ObjectLayer NON_MOVING = 0;
-	static constexpr ObjectLayer MOVING = 31;
-	static constexpr ObjectLayer NUM_LAYERS = 32;
-};
+// Object layers are the entity layer packed with the broadphase category it is placed in, see PhysicsLayers.
+// Pairs are filtered by category first, then by the project layer collision matrix.
 
 /// Class that determines if two object layers can collide
 class ObjectLayerPairFilterImpl : public ObjectLayerPairFilter
@@ -114,71 +107,35 @@ class ObjectLayerPairFilterImpl : public ObjectLayerPairFilter
 public:
 	virtual bool					ShouldCollide(ObjectLayer inObject1, ObjectLayer inObject2) const override
 	{
-		switch (inObject1)
-		{
-		case Layers::NON_MOVING:
-			return inObject2 == Layers::MOVING; // Non moving only collides with moving
-		case Layers::MOVING:
-			return true; // Moving collides with everything
-		default:
-			return true;
-		}
+		return Borealis::PhysicsLayers::ShouldCollide(inObject1, inObject2);
 	}
 };
 
-// Each broadphase layer results in a separate bounding volume tree in the broad phase. You at least want to have
-// a layer for non-moving and moving objects to avoid having to update a tree full of static objects every frame.
-// You can have a 1-on-1 mapping between object layers and broadphase layers (like in this case) but if you have
-// many object layers you'll be creating many broad phase trees, which is not efficient. If you want to fine tune
-// your broadphase layers define JPH_TRACK_BROADPHASE_STATS and look at the stats reported on the TTY.
-namespace BroadPhaseLayers
-{
-	static constexpr BroadPhaseLayer NON_MOVING(0);
-	static constexpr BroadPhaseLayer MOVING(1);
-	static constexpr uint NUM_LAYERS(2);
-};
-
+// Each broadphase layer results in a separate bounding volume tree in the broad phase. There is one tree per
+// category, so static geometry is never refitted, and debris, triggers and characters are only tested against
+// the trees they can actually touch.
 // BroadPhaseLayerInterface implementation
 // This defines a mapping between object and broadphase layers.
 class BPLayerInterfaceImpl final : public BroadPhaseLayerInterface
 {
 public:
-	BPLayerInterfaceImpl()
-	{
-		// Create a mapping table from object to broad phase layer
-		mObjectToBroadPhase[Layers::NON_MOVING] = BroadPhaseLayers::NON_MOVING;
-		for (int i = 1; i < 31; i++)
-		{
-			mObjectToBroadPhase[i] = BroadPhaseLayers::MOVING;
-		}
-		mObjectToBroadPhase[Layers::MOVING] = BroadPhaseLayers::MOVING;
-	}
-
 	virtual uint					GetNumBroadPhaseLayers() const override
 	{
-		return BroadPhaseLayers::NUM_LAYERS;
+		return static_cast<uint>(Borealis::BroadPhaseCategory::Count);
 	}
 
 	virtual BroadPhaseLayer			GetBroadPhaseLayer(ObjectLayer inLayer) const override
 	{
-		JPH_ASSERT(inLayer < Layers::NUM_LAYERS);
-		return mObjectToBroadPhase[inLayer];
+		JPH_ASSERT(inLayer < Borealis::PhysicsLayers::ObjectLayerCount);
+		return BroadPhaseLayer(static_cast<BroadPhaseLayer::Type>(Borealis::PhysicsLayers::ToCategory(inLayer)));
 	}
 
 #if defined(JPH_EXTERNAL_PROFILE) || defined(JPH_PROFILE_ENABLED)
 	virtual const char* GetBroadPhaseLayerName(BroadPhaseLayer inLayer) const override
 	{
-		switch ((BroadPhaseLayer::Type)inLayer)
-		{
-		case (BroadPhaseLayer::Type)BroadPhaseLayers::NON_MOVING:	return "NON_MOVING";
-		case (BroadPhaseLayer::Type)BroadPhaseLayers::MOVING:		return "MOVING";
-		default:													JPH_ASSERT(false); return "INVALID";
-		}
+		return Borealis::PhysicsLayers::GetCategoryName(static_cast<Borealis::BroadPhaseCategory>((BroadPhaseLayer::Type)inLayer));
 	}
 #endif // JPH_EXTERNAL_PROFILE || JPH_PROFILE_ENABLED
-
-private:
-	BroadPhaseLayer					mObjectToBroadPhase[Layers::NUM_LAYERS];
 };
 
 /// Class that determines if an object layer can collide with a broadphase layer
@@ -187,15 +144,9 @@ class ObjectVsBroadPhaseLayerFilterImpl : public ObjectVsBroadPhaseLayerFilter
 public:
 	virtual bool ShouldCollide(ObjectLayer inLayer1, BroadPhaseLayer inLayer2) const override
 	{
-		switch (inLayer1)
-		{
-		case Layers::NON_MOVING:
-			return inLayer2 == BroadPhaseLayers::MOVING;
-		case Layers::MOVING:
-			return true;
-		default:
-			return true;
-		}
+		// A layer with an empty matrix row does not need to walk any tree
+		return Borealis::PhysicsLayers::GetCollisionMask(Borealis::PhysicsLayers::ToLayer(inLayer1)) != 0
+			&& Borealis::PhysicsLayers::CategoriesCollide(Borealis::PhysicsLayers::ToCategory(inLayer1), static_cast<Borealis::BroadPhaseCategory>((BroadPhaseLayer::Type)inLayer2));
 	}
 };
 
@@ -276,96 +227,146 @@ namespace Borealis
 		ObjectLayerPairFilterImpl* object_vs_object_layer_filter;
 		MyContactListener* contact_listener;
 		MyBodyActivationListener* body_activation_listener;
-
-		std::queue<CollisionPair> onCollisionPairAddedQueue;
-		std::queue<CollisionPair> onCollisionPairRemovedQueue;
-		std::queue<CollisionPair> onCollisionPairPersistedQueue;
-
-		std::queue<CollisionPair> onTriggerPairAddedQueue;
-		std::queue<CollisionPair> onTriggerPairRemovedQueue;
-		std::queue<CollisionPair> onTriggerPairPersistedQueue;
 	};
 
 	static PhysicsSystemData sPhysicsData;
 	static unordered_map<unsigned int, Borealis::UUID> bodyIDMapUUID;
 	static unordered_map<unsigned int, bool> bodySensorMap;
 
-	void MyContactListener::OnContactAdded(const Body& inBody1, const Body& inBody2, const ContactManifold& inManifold, ContactSettings& ioSettings)
+	// Body user data holds the entity handle plus one, zero is a body without an entity
+	static uint64 EntityToUserData(Entity entity)
 	{
-		std::lock_guard<std::mutex>lock(enterMutex);
-		if (inBody1.IsSensor() || inBody2.IsSensor())
-		{
-			sPhysicsData.onTriggerPairAddedQueue.push({ PhysicsSystem::BodyIDToUUID(inBody1.GetID().GetIndexAndSequenceNumber()), PhysicsSystem::BodyIDToUUID(inBody2.GetID().GetIndexAndSequenceNumber()) });
-		}
-		else
-		{
-			sPhysicsData.onCollisionPairAddedQueue.push({ PhysicsSystem::BodyIDToUUID(inBody1.GetID().GetIndexAndSequenceNumber()), PhysicsSystem::BodyIDToUUID(inBody2.GetID().GetIndexAndSequenceNumber()) });
-		}
+		return static_cast<uint64>(static_cast<uint32_t>(entity)) + 1;
 	}
 
-	void MyContactListener::OnContactPersisted(const Body& inBody1, const Body& inBody2, const ContactManifold& inManifold, ContactSettings& ioSettings)
+	// Layer used in the collision matrix, the lowest layer the entity is on
+	static uint32_t EntityPhysicsLayer(Entity entity)
 	{
-		std::lock_guard<std::mutex>lock(persistMutex);
+		Bitset32 layer = entity.GetComponent<TagComponent>().mLayer;
+		return layer.any() ? layer.toUint16() : 0;
+	}
 
-		if (inBody1.IsSensor() || inBody2.IsSensor())
+	// Picks the broadphase tree of a body from what it is and how it moves
+	static ObjectLayer BodyObjectLayer(uint32_t layer, bool isTrigger, MovementType movement)
+	{
+		BroadPhaseCategory category = BroadPhaseCategory::Moving;
+		if (isTrigger)
 		{
-			sPhysicsData.onTriggerPairPersistedQueue.push({ PhysicsSystem::BodyIDToUUID(inBody1.GetID().GetIndexAndSequenceNumber()), PhysicsSystem::BodyIDToUUID(inBody2.GetID().GetIndexAndSequenceNumber()) });
+			category = BroadPhaseCategory::Trigger;
 		}
-		else
+		else if (movement == MovementType::Static)
+		{
+			category = BroadPhaseCategory::Static;
+		}
+		else if (movement == MovementType::Dynamic && PhysicsLayers::IsDebrisLayer(layer))
 		{
-			sPhysicsData.onCollisionPairPersistedQueue.push({ PhysicsSystem::BodyIDToUUID(inBody1.GetID().GetIndexAndSequenceNumber()), PhysicsSystem::BodyIDToUUID(inBody2.GetID().GetIndexAndSequenceNumber()) });
+			category = BroadPhaseCategory::Debris;
 		}
+		return PhysicsLayers::ToObjectLayer(layer, category);
 	}
 
-	void MyContactListener::OnContactRemoved(const SubShapeIDPair& inSubShapePair)
+	// Moves a body to the tree matching its new movement type, triggers stay in theirs
+	static void UpdateBodyObjectLayer(BodyInterface& bodyInterface, BodyID id, MovementType movement)
 	{
-		std::lock_guard<std::mutex>lock(exitMutex);
+		ObjectLayer const current = bodyInterface.GetObjectLayer(id);
+		if (PhysicsLayers::ToCategory(current) == BroadPhaseCategory::Trigger) return;
 
-		if (PhysicsSystem::BodyIDToIsSensor(inSubShapePair.GetBody1ID().GetIndexAndSequenceNumber()) || PhysicsSystem::BodyIDToIsSensor(inSubShapePair.GetBody2ID().GetIndexAndSequenceNumber()))
-		{
-			sPhysicsData.onTriggerPairRemovedQueue.push({ PhysicsSystem::BodyIDToUUID(inSubShapePair.GetBody1ID().GetIndexAndSequenceNumber()), PhysicsSystem::BodyIDToUUID(inSubShapePair.GetBody2ID().GetIndexAndSequenceNumber()) });
-		}
-		else
+		ObjectLayer const wanted = BodyObjectLayer(PhysicsLayers::ToLayer(current), false, movement);
+		if (wanted != current)
 		{
-			sPhysicsData.onCollisionPairRemovedQueue.push({ PhysicsSystem::BodyIDToUUID(inSubShapePair.GetBody1ID().GetIndexAndSequenceNumber()), PhysicsSystem::BodyIDToUUID(inSubShapePair.GetBody2ID().GetIndexAndSequenceNumber()) });
+			bodyInterface.SetObjectLayer(id, wanted);
 		}
-		
 	}
 
-	std::queue<CollisionPair>& PhysicsSystem::GetCollisionEnterQueue() {return sPhysicsData.onCollisionPairAddedQueue; }
-	std::queue<CollisionPair>& PhysicsSystem::GetCollisionPersistQueue() { return sPhysicsData.onCollisionPairPersistedQueue; }
-	std::queue<CollisionPair>& PhysicsSystem::GetCollisionExitQueue() { return sPhysicsData.onCollisionPairRemovedQueue; }
+	struct ContactRecord
+	{
+		uint32_t entity1;
+		uint32_t entity2;
+		ContactEventType type;
+	};
 
-	std::queue<CollisionPair>& PhysicsSystem::GetTriggerEnterQueue() { return sPhysicsData.onTriggerPairAddedQueue; }
-	std::queue<CollisionPair>& PhysicsSystem::GetTriggerPersistQueue() { return sPhysicsData.onTriggerPairPersistedQueue; }
-	std::queue<CollisionPair>& PhysicsSystem::GetTriggerExitQueue() { return sPhysicsData.onTriggerPairRemovedQueue; }
+	// Contacts are appended to a buffer owned by the reporting thread, so the
+	// callbacks never wait on each other. The mutex is only taken the first
+	// time a thread reports a contact.
+	struct ContactBuffer
+	{
+		std::vector<ContactRecord> records;
+	};
 
-	void PhysicsSystem::EndScene()
+	static std::vector<std::unique_ptr<ContactBuffer>> sContactBuffers;
+	static std::mutex sContactBufferMutex;
+	static uint32_t sContactBufferGeneration = 1; // bumped by EndScene, threads register a new buffer after it
+	static std::vector<ContactEvent> sContactEvents;
+
+	static ContactBuffer& GetThreadContactBuffer()
 	{
-		while (!sPhysicsData.onCollisionPairAddedQueue.empty())
-		{
-			sPhysicsData.onCollisionPairAddedQueue.pop();
-		}
-		while (!sPhysicsData.onCollisionPairPersistedQueue.empty())
-		{
-			sPhysicsData.onCollisionPairPersistedQueue.pop();
-		}
-		while (!sPhysicsData.onCollisionPairRemovedQueue.empty())
-		{
-			sPhysicsData.onCollisionPairRemovedQueue.pop();
-		}
-		while (!sPhysicsData.onTriggerPairAddedQueue.empty())
-		{
-			sPhysicsData.onTriggerPairAddedQueue.pop();
-		}
-		while (!sPhysicsData.onTriggerPairPersistedQueue.empty())
+		thread_local ContactBuffer* buffer = nullptr;
+		thread_local uint32_t generation = 0;
+		if (generation != sContactBufferGeneration)
 		{
-			sPhysicsData.onTriggerPairPersistedQueue.pop();
+			std::lock_guard<std::mutex> lock(sContactBufferMutex);
+			sContactBuffers.push_back(std::make_unique<ContactBuffer>());
+			buffer = sContactBuffers.back().get();
+			generation = sContactBufferGeneration;
 		}
-		while (!sPhysicsData.onTriggerPairRemovedQueue.empty())
+		return *buffer;
+	}
+
+	static void RecordContact(uint64 userData1, uint64 userData2, ContactEventType type)
+	{
+		if (userData1 == 0 || userData2 == 0) return;
+		GetThreadContactBuffer().records.push_back({ static_cast<uint32_t>(userData1 - 1), static_cast<uint32_t>(userData2 - 1), type });
+	}
+
+	void MyContactListener::OnContactAdded(const Body& inBody1, const Body& inBody2, const ContactManifold& inManifold, ContactSettings& ioSettings)
+	{
+		bool trigger = inBody1.IsSensor() || inBody2.IsSensor();
+		RecordContact(inBody1.GetUserData(), inBody2.GetUserData(), trigger ? ContactEventType::TriggerEnter : ContactEventType::CollisionEnter);
+	}
+
+	void MyContactListener::OnContactPersisted(const Body& inBody1, const Body& inBody2, const ContactManifold& inManifold, ContactSettings& ioSettings)
+	{
+		bool trigger = inBody1.IsSensor() || inBody2.IsSensor();
+		RecordContact(inBody1.GetUserData(), inBody2.GetUserData(), trigger ? ContactEventType::TriggerStay : ContactEventType::CollisionStay);
+	}
+
+	void MyContactListener::OnContactRemoved(const SubShapeIDPair& inSubShapePair)
+	{
+		// Bodies are locked by the caller, a destroyed body has no entity left to notify
+		BodyLockInterfaceNoLock const& lockInterface = sPhysicsData.mSystem->GetBodyLockInterfaceNoLock();
+		Body const* body1 = lockInterface.TryGetBody(inSubShapePair.GetBody1ID());
+		Body const* body2 = lockInterface.TryGetBody(inSubShapePair.GetBody2ID());
+		if (!body1 || !body2) return;
+
+		bool trigger = body1->IsSensor() || body2->IsSensor();
+		RecordContact(body1->GetUserData(), body2->GetUserData(), trigger ? ContactEventType::TriggerExit : ContactEventType::CollisionExit);
+	}
+
+	std::vector<ContactEvent> const& PhysicsSystem::CollectContactEvents()
+	{
+		PROFILE_FUNCTION();
+
+		sContactEvents.clear();
+		for (auto& buffer : sContactBuffers)
 		{
-			sPhysicsData.onTriggerPairRemovedQueue.pop();
+			for (ContactRecord const& record : buffer->records)
+			{
+				sContactEvents.push_back({ record.entity1, record.entity2, record.type });
+				sContactEvents.push_back({ record.entity2, record.entity1, record.type });
+			}
+			buffer->records.clear();
 		}
+
+		std::sort(sContactEvents.begin(), sContactEvents.end());
+		sContactEvents.erase(std::unique(sContactEvents.begin(), sContactEvents.end()), sContactEvents.end());
+		return sContactEvents;
+	}
+
+	void PhysicsSystem::EndScene()
+	{
+		sContactBuffers.clear();
+		sContactEvents.clear();
+		++sContactBufferGeneration;
 		bodyIDMapUUID.clear();
 		bodySensorMap.clear();
 	}
@@ -494,6 +495,7 @@ namespace Borealis
 				sPhysicsData.body_interface->SetMotionType((BodyID)collider.bodyID, EMotionType::Dynamic, EActivation::Activate);
 
 			}
+			UpdateBodyObjectLayer(*sPhysicsData.body_interface, (BodyID)collider.bodyID, rigidbody->movement);
 		}
 	}
 
@@ -510,7 +512,13 @@ namespace Borealis
 		glm::quat rotation = glm::quat(newRotation.GetW(), newRotation.GetX(), newRotation.GetY(), newRotation.GetZ());
 		// Convert quaternion to Euler angles (quat to vec3) in degrees
 		glm::vec3 newRotate = glm::degrees(glm::eulerAngles(rotation));  // Euler angles in degrees
-		glm::vec3 newScale = transform.GetGlobalScale();
+		// Taken from the world matrix cached before the step, GetGlobalScale would refresh
+		// the parent chain while other bodies are being pulled into it
+		glm::vec3 cachedTranslate(0.f);
+		glm::vec3 cachedRotation(0.f);
+		glm::vec3 newScale(1.f);
+		glm::mat4 cachedWorld = transform.mCachedWorld;
+		Math::MatrixDecomposition(&cachedWorld, &cachedTranslate, &cachedRotation, &newScale);
 
 		glm::mat4 rotationMatrix = glm::mat4(glm::quat(glm::radians(newRotate)));
 		glm::mat4 translationMatrix = glm::mat4(1.f);
@@ -531,8 +539,9 @@ namespace Borealis
 		}
 		else
 		{
+			// Cached world is read so bodies can be pulled in parallel, the hierarchy is refreshed before the step
 			auto parentEntity = SceneManager::GetActiveScene()->GetEntityByUUID(transform.ParentID);
-			auto parentTransform = parentEntity.GetComponent<TransformComponent>().GetGlobalTransform();
+			auto const& parentTransform = parentEntity.GetComponent<TransformComponent>().mCachedWorld;
 		
 				auto localTransform = glm::inverse(parentTransform) * newTransform;
 				Math::MatrixDecomposition(&localTransform, &transform.Translate, &transform.Rotation, &transform.Scale);
@@ -541,6 +550,63 @@ namespace Borealis
 		}
 	}
 
+	// Reused by PushTransforms, grows to the largest batch and stays there
+	static std::vector<BodyID> sBodiesToActivate;
+
+	void PhysicsSystem::PushTransforms(std::vector<BodyTransform> const& bodies)
+	{
+		PROFILE_FUNCTION();
+
+		BodyInterface& bodyInterface = *sPhysicsData.body_interface;
+		sBodiesToActivate.clear();
+
+		for (BodyTransform const& body : bodies)
+		{
+			BodyID const id(body.bodyID);
+			if (!bodyInterface.IsAdded(id)) continue;
+
+			if (body.movementChanged)
+			{
+				EMotionType motionType = EMotionType::Static;
+				if (body.movement == MovementType::Dynamic) motionType = EMotionType::Dynamic;
+				else if (body.movement == MovementType::Kinematic) motionType = EMotionType::Kinematic;
+				bodyInterface.SetMotionType(id, motionType, EActivation::DontActivate);
+				UpdateBodyObjectLayer(bodyInterface, id, body.movement);
+			}
+
+			JPH::RVec3 const position(body.position.x, body.position.y, body.position.z);
+			if (body.movement == MovementType::Kinematic)
+			{
+				// Kinematic bodies keep their simulated rotation, same as PushTransform
+				bodyInterface.SetPosition(id, position, EActivation::DontActivate);
+			}
+			else
+			{
+				JPH::Quat const rotation(body.rotation.x, body.rotation.y, body.rotation.z, body.rotation.w);
+				bodyInterface.SetPositionAndRotationWhenChanged(id, position, rotation, EActivation::DontActivate);
+			}
+
+			sBodiesToActivate.push_back(id);
+		}
+
+		// Static bodies are skipped by Jolt
+		if (!sBodiesToActivate.empty())
+		{
+			bodyInterface.ActivateBodies(sBodiesToActivate.data(), static_cast<int>(sBodiesToActivate.size()));
+		}
+	}
+
+	void PhysicsSystem::GetActiveBodies(std::vector<unsigned int>& bodyIDs)
+	{
+		bodyIDs.clear();
+		uint32_t const count = sPhysicsData.mSystem->GetNumActiveBodies(EBodyType::RigidBody);
+		BodyID const* active = sPhysicsData.mSystem->GetActiveBodiesUnsafe(EBodyType::RigidBody);
+		for (uint32_t i = 0; i < count; ++i)
+		{
+			bodyIDs.push_back(active[i].GetIndexAndSequenceNumber());
+		}
+	}
+
 	void PhysicsSystem::PushCharacterTransform(CharacterControllerComponent& character, glm::vec3 position, glm::vec3 rotation)
 	{
 		// Convert position (glm::vec3 to Jolt's RVec3)
@@ -625,12 +691,20 @@ namespace Borealis
 
 	UUID PhysicsSystem::BodyIDToUUID(unsigned int bodyID)
 	{
-		return bodyIDMapUUID[bodyID];
+		// Lookup only, this is called from the contact listener and step jobs
+		auto iter = bodyIDMapUUID.find(bodyID);
+		return iter != bodyIDMapUUID.end() ? iter->second : UUID(0);
 	}
 
 	bool PhysicsSystem::BodyIDToIsSensor(unsigned int bodyID)
 	{
-		return bodySensorMap[bodyID];
+		auto iter = bodySensorMap.find(bodyID);
+		return iter != bodySensorMap.end() && iter->second;
+	}
+
+	uint32_t PhysicsSystem::GetBodyIndex(unsigned int bodyID)
+	{
+		return BodyID(bodyID).GetIndex();
 	}
 
 	void PhysicsSystem::SetActive(unsigned int bodyID)
@@ -874,11 +948,11 @@ namespace Borealis
 		settings.mShape = shape;
 		settings.mInnerBodyShape = shape;
 		Entity BrEntity = SceneManager::GetActiveScene()->GetEntityByUUID(entityID);
-		settings.mInnerBodyLayer = BrEntity.GetComponent<TagComponent>().mLayer.toUint16();
+		settings.mInnerBodyLayer = PhysicsLayers::ToObjectLayer(EntityPhysicsLayer(BrEntity), BroadPhaseCategory::Character);
 		settings.SetEmbedded();
 
 		std::lock_guard<std::mutex>lock(characterMutex);
-		character.controller = new CharacterVirtual(&settings, RVec3(transform.Translate.x, transform.Translate.y,transform.Translate.z), Quat::sIdentity(), sPhysicsData.mSystem);
+		character.controller = new CharacterVirtual(&settings, RVec3(transform.Translate.x, transform.Translate.y,transform.Translate.z), Quat::sIdentity(), EntityToUserData(BrEntity), sPhysicsData.mSystem);
 		bodyIDMapUUID[reinterpret_cast<CharacterVirtual*>(character.controller)->GetInnerBodyID().GetIndexAndSequenceNumber()] = entityID;
 		bodySensorMap[reinterpret_cast<CharacterVirtual*>(character.controller)->GetInnerBodyID().GetIndexAndSequenceNumber()] = false;
 	}
@@ -902,12 +976,15 @@ namespace Borealis
 		else
 			update_settings.mWalkStairsStepUp = mCharacter->GetUp() * update_settings.mWalkStairsStepUp.Length();
 
+		// Sweep only the trees and layers the character's inner body collides with
+		ObjectLayer const layer = sPhysicsData.body_interface->GetObjectLayer(mCharacter->GetInnerBodyID());
+
 		// Update the character position
 		mCharacter->ExtendedUpdate(dt,
 			-mCharacter->GetUp() * sPhysicsData.mSystem->GetGravity().Length(),
 			update_settings,
-			{},
-			{},
+			sPhysicsData.mSystem->GetDefaultBroadPhaseLayerFilter(layer),
+			sPhysicsData.mSystem->GetDefaultLayerFilter(layer),
 			{ },
 			{ },
 			*sPhysicsData.temp_allocator);
@@ -1031,7 +1108,7 @@ namespace Borealis
 
 			for (int index : bitset.ToBitsList())
 			{
-				if (index == inLayer)
+				if (index == static_cast<int>(PhysicsLayers::ToLayer(inLayer)))
 				{
 					return true;
 				}
@@ -1043,8 +1120,16 @@ namespace Borealis
 	};
 	
 
+	// Normalising a zero direction gives NaN, which Jolt does not reject
+	static bool IsCastDirection(glm::vec3 const& direction)
+	{
+		constexpr float epsilon = 1e-12f;
+		return glm::dot(direction, direction) >= epsilon;
+	}
+
 	bool PhysicsSystem::RayCast(glm::vec3 origin, glm::vec3 direction, float maxDistance, Bitset32 LayerMask)
 	{
+		if (!IsCastDirection(direction)) return false;
 		direction = glm::normalize(direction);
 		direction *= maxDistance; //set distance of ray
 		RRayCast ray{ Vec3(origin.x, origin.y, origin.z), Vec3(direction.x, direction.y, direction.z) };
@@ -1066,6 +1151,7 @@ namespace Borealis
 
 	bool PhysicsSystem::RayCast(glm::vec3 origin, glm::vec3 direction, RaycastHit* hitInfo, float maxDistance, Bitset32 LayerMask)
 	{
+		if (!IsCastDirection(direction)) return false;
 		direction = glm::normalize(direction);
 		direction *= maxDistance; //set distance of ray
 		RRayCast ray{ Vec3(origin.x, origin.y, origin.z), Vec3(direction.x, direction.y, direction.z) };
@@ -1115,6 +1201,7 @@ namespace Borealis
 
 	std::vector<RaycastHit> PhysicsSystem::RayCastAll(glm::vec3 origin, glm::vec3 direction, float maxDistance, Bitset32 LayerMask)
 	{
+		if (!IsCastDirection(direction)) return {};
 		direction = glm::normalize(direction);
 		direction *= maxDistance;
 		RayCollector collector;
@@ -1151,6 +1238,237 @@ namespace Borealis
 		return output;
 	}
 
+	// Bit test instead of ObjectLayerFilterImpl's list walk, it runs for every candidate body of every query
+	class LayerMaskFilter : public ObjectLayerFilter
+	{
+	public:
+		explicit LayerMaskFilter(uint32_t mask) : mMask(mask) {}
+
+		bool ShouldCollide(ObjectLayer inLayer) const override
+		{
+			return mMask == 0 || (mMask & (1u << PhysicsLayers::ToLayer(inLayer))) != 0;
+		}
+	private:
+		uint32_t mMask;
+	};
+
+	// Writes overlapping bodies straight into the caller's slots, once per body
+	class OverlapCollector : public CollideShapeCollector
+	{
+	public:
+		OverlapCollector(uint64_t* ids, uint32_t capacity) : mIDs(ids), mCapacity(capacity) {}
+
+		void AddHit(const ResultType& inResult) override
+		{
+			UUID id = PhysicsSystem::BodyIDToUUID(inResult.mBodyID2.GetIndexAndSequenceNumber());
+			if (std::find(mIDs, mIDs + mCount, static_cast<uint64_t>(id)) != mIDs + mCount) return;
+
+			mIDs[mCount++] = id;
+			if (mCount == mCapacity)
+			{
+				ForceEarlyOut();
+			}
+		}
+
+		uint32_t mCount = 0;
+	private:
+		uint64_t* mIDs;
+		uint32_t mCapacity;
+	};
+
+	static RMat44 QueryTransform(PhysicsQuery const& query)
+	{
+		glm::quat rotation = glm::quat(glm::radians(query.rotation));
+		return RMat44::sRotationTranslation(Quat(rotation.x, rotation.y, rotation.z, rotation.w), RVec3(query.origin.x, query.origin.y, query.origin.z));
+	}
+
+	/*!***********************************************************************
+		\brief
+			Builds the query shape on the stack and calls function with it,
+			nothing is allocated per query
+	*************************************************************************/
+	template<typename Function>
+	static void WithQueryShape(PhysicsQuery const& query, Function const& function)
+	{
+		switch (query.shape)
+		{
+		case QueryShape::Sphere:
+		{
+			SphereShape sphere(std::max(query.extents.x, 0.001f));
+			sphere.SetEmbedded();
+			function(sphere);
+			break;
+		}
+		case QueryShape::Box:
+		{
+			Vec3 halfExtent(std::max(query.extents.x, 0.001f), std::max(query.extents.y, 0.001f), std::max(query.extents.z, 0.001f));
+			BoxShape box(halfExtent, std::min(cDefaultConvexRadius, halfExtent.ReduceMin()));
+			box.SetEmbedded();
+			function(box);
+			break;
+		}
+		case QueryShape::Capsule:
+		{
+			CapsuleShape capsule(std::max(query.extents.y, 0.001f), std::max(query.extents.x, 0.001f));
+			capsule.SetEmbedded();
+			function(capsule);
+			break;
+		}
+		default:
+			break;
+		}
+	}
+
+	/*!***********************************************************************
+		\brief
+			Splits [0, count) into ranges and runs them on the physics job
+			system, the calling thread waits for all of them
+	*************************************************************************/
+	static void RunQueryJobs(uint32_t count, std::function<void(uint32_t, uint32_t)> const& job)
+	{
+		constexpr uint32_t grainSize = 16;
+		uint32_t const maxRanges = std::max(1, sPhysicsData.job_system->GetMaxConcurrency()) * 4;
+		uint32_t const rangeCount = std::min((count + grainSize - 1) / grainSize, maxRanges);
+		if (rangeCount <= 1)
+		{
+			job(0, count);
+			return;
+		}
+
+		uint32_t const rangeSize = (count + rangeCount - 1) / rangeCount;
+		JPH::JobSystem::Barrier* barrier = sPhysicsData.job_system->CreateBarrier();
+		for (uint32_t begin = 0; begin < count; begin += rangeSize)
+		{
+			uint32_t end = std::min(begin + rangeSize, count);
+			barrier->AddJob(sPhysicsData.job_system->CreateJob("PhysicsQueryBatch", JPH::Color::sCyan, [&job, begin, end]() { job(begin, end); }));
+		}
+		sPhysicsData.job_system->WaitForJobs(barrier);
+		sPhysicsData.job_system->DestroyBarrier(barrier);
+	}
+
+	static bool CastQuery(PhysicsQuery const& query, RaycastHit& hit)
+	{
+		if (!IsCastDirection(query.direction)) return false;
+		auto& narrowPhaseQuery = sPhysicsData.mSystem->GetNarrowPhaseQuery();
+		LayerMaskFilter layerFilter(query.layerMask);
+		glm::vec3 direction = glm::normalize(query.direction);
+		glm::vec3 displacement = direction * query.maxDistance;
+
+		if (query.shape == QueryShape::Ray)
+		{
+			RRayCast ray{ RVec3(query.origin.x, query.origin.y, query.origin.z), Vec3(displacement.x, displacement.y, displacement.z) };
+			RayCastResult result;
+			if (!narrowPhaseQuery.CastRay(ray, result, {}, layerFilter))
+			{
+				return false;
+			}
+
+			hit.colliderID = result.mBodyID.GetIndexAndSequenceNumber();
+			hit.ID = PhysicsSystem::BodyIDToUUID(hit.colliderID);
+			hit.distance = query.maxDistance * result.mFraction;
+			hit.point = query.origin + direction * hit.distance;
+			JPH::BodyLockRead lock(sPhysicsData.mSystem->GetBodyLockInterface(), result.mBodyID);
+			if (lock.Succeeded())
+			{
+				Vec3 normal = lock.GetBody().GetWorldSpaceSurfaceNormal(result.mSubShapeID2, ray.GetPointOnRay(result.mFraction));
+				hit.normal = { normal.GetX(), normal.GetY(), normal.GetZ() };
+			}
+			return true;
+		}
+
+		ClosestHitCollisionCollector<CastShapeCollector> collector;
+		WithQueryShape(query, [&](Shape const& shape)
+			{
+				RShapeCast cast(&shape, Vec3::sReplicate(1.f), QueryTransform(query), Vec3(displacement.x, displacement.y, displacement.z));
+				narrowPhaseQuery.CastShape(cast, ShapeCastSettings(), RVec3::sZero(), collector, {}, layerFilter);
+			});
+		if (!collector.HadHit())
+		{
+			return false;
+		}
+
+		ShapeCastResult const& result = collector.mHit;
+		Vec3 normal = -result.mPenetrationAxis.NormalizedOr(Vec3::sZero());
+		hit.colliderID = result.mBodyID2.GetIndexAndSequenceNumber();
+		hit.ID = PhysicsSystem::BodyIDToUUID(hit.colliderID);
+		hit.distance = query.maxDistance * result.mFraction;
+		hit.normal = { normal.GetX(), normal.GetY(), normal.GetZ() };
+		hit.point = { result.mContactPointOn2.GetX(), result.mContactPointOn2.GetY(), result.mContactPointOn2.GetZ() };
+		return true;
+	}
+
+	/*!***********************************************************************
+		\brief
+			Casts every query in parallel and hands each result, hit or miss,
+			to store along with its index
+	*************************************************************************/
+	template <typename Store>
+	static uint32_t RunCastJobs(PhysicsQuery const* queries, uint32_t count, Store const& store)
+	{
+		std::atomic<uint32_t> hitCount = 0;
+		RunQueryJobs(count, [queries, &store, &hitCount](uint32_t begin, uint32_t end)
+			{
+				uint32_t rangeHits = 0;
+				for (uint32_t i = begin; i < end; ++i)
+				{
+					RaycastHit hit{};
+					if (queries[i].maxDistance > 0.f && CastQuery(queries[i], hit))
+					{
+						++rangeHits;
+					}
+					store(i, hit);
+				}
+				hitCount += rangeHits;
+			});
+		return hitCount;
+	}
+
+	uint32_t PhysicsSystem::CastBatch(PhysicsQuery const* queries, uint32_t count, RaycastHit* hits)
+	{
+		PROFILE_FUNCTION();
+
+		return RunCastJobs(queries, count, [hits](uint32_t i, RaycastHit const& hit) { hits[i] = hit; });
+	}
+
+	uint32_t PhysicsSystem::CastBatch(PhysicsQuery const* queries, uint32_t count, uint64_t* IDs, float* distances, glm::vec3* normals, glm::vec3* points)
+	{
+		PROFILE_FUNCTION();
+
+		return RunCastJobs(queries, count, [IDs, distances, normals, points](uint32_t i, RaycastHit const& hit)
+			{
+				IDs[i] = hit.ID;
+				distances[i] = hit.distance;
+				normals[i] = hit.normal;
+				points[i] = hit.point;
+			});
+	}
+
+	void PhysicsSystem::OverlapBatch(PhysicsQuery const* queries, uint32_t count, uint64_t* hitIDs, uint32_t maxHitsPerQuery, uint32_t* hitCounts)
+	{
+		PROFILE_FUNCTION();
+
+		RunQueryJobs(count, [queries, hitIDs, maxHitsPerQuery, hitCounts](uint32_t begin, uint32_t end)
+			{
+				auto& narrowPhaseQuery = sPhysicsData.mSystem->GetNarrowPhaseQuery();
+				for (uint32_t i = begin; i < end; ++i)
+				{
+					hitCounts[i] = 0;
+					PhysicsQuery const& query = queries[i];
+					if (query.shape == QueryShape::Ray || maxHitsPerQuery == 0)
+					{
+						continue;
+					}
+
+					OverlapCollector collector(hitIDs + static_cast<size_t>(i) * maxHitsPerQuery, maxHitsPerQuery);
+					WithQueryShape(query, [&](Shape const& shape)
+						{
+							narrowPhaseQuery.CollideShape(&shape, Vec3::sReplicate(1.f), QueryTransform(query), CollideShapeSettings(), RVec3::sZero(), collector, {}, LayerMaskFilter(query.layerMask));
+						});
+					hitCounts[i] = collector.mCount;
+				}
+			});
+	}
+
 	void PhysicsSystem::UpdateScale(ColliderComponent& collider, TransformComponent& transform)
 	{
 		ShapeRefC shape;
@@ -1271,14 +1589,17 @@ namespace Borealis
 
 		auto brEntity = SceneManager::GetActiveScene()->GetEntityByUUID(entityID);
 		auto rotation = transform.GetGlobalRotation();
-		auto tagComponent = brEntity.GetComponent<TagComponent>();
 
 		glm::quat quatRot = glm::quat(glm::radians(rotation));  // Assuming Rotation is in degrees
 
 		// Convert glm::quat to Jolt's Quat (JPH::Quat)
 		JPH::Quat newRotation = JPH::Quat(quatRot.x, quatRot.y, quatRot.z, quatRot.w);
 
-		BodyCreationSettings body_settings(shape, RVec3(actualCenter.x, actualCenter.y, actualCenter.z), newRotation, EMotionType::Static, Layers::MOVING);
+		MovementType const movement = rigidbody ? rigidbody->movement : MovementType::Static;
+		BodyCreationSettings body_settings(shape, RVec3(actualCenter.x, actualCenter.y, actualCenter.z), newRotation, EMotionType::Static,
+			BodyObjectLayer(EntityPhysicsLayer(brEntity), collider.isTrigger, movement));
+		body_settings.mIsSensor = collider.isTrigger;
+		body_settings.mUserData = EntityToUserData(brEntity);
 
 		if (rigidbody)
 		{
@@ -1293,7 +1614,6 @@ namespace Borealis
 			{
 				body_settings.mMotionType = EMotionType::Static;
 			}
-			body_settings.mObjectLayer = tagComponent.mLayer.toUint16();
 			body_settings.mAllowDynamicOrKinematic = true;
 			body_settings.mFriction = rigidbody->friction;
 			body_settings.mRestitution = rigidbody->bounciness;
@@ -1302,7 +1622,6 @@ namespace Borealis
 		else
 		{
 			body_settings.mMotionType = EMotionType::Static;
-			body_settings.mObjectLayer = tagComponent.mLayer.toUint16();
 		}
 
 		// Create the actual rigid body
@@ -1317,18 +1636,12 @@ namespace Borealis
 
 		// Store the BodyID in the RigidBodyComponent
 		collider.bodyID = body->GetID().GetIndexAndSequenceNumber();
+		collider.syncedWorldVersion = UINT32_MAX;
+		collider.syncedMovement = rigidbody ? rigidbody->movement : MovementType::Static;
 
 		std::lock_guard<std::mutex>lock(bodyMutex);
 
-		if (collider.isTrigger)
-		{
-			body->SetIsSensor(true);
-			bodySensorMap[collider.bodyID] = true;
-		}
-		else
-		{
-			bodySensorMap[collider.bodyID] = false;
-		}
+		bodySensorMap[collider.bodyID] = collider.isTrigger;
 
 		bodyIDMapUUID[collider.bodyID] = entityID;
 	}
@@ -16,6 +16,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include <entt.hpp>
 #include <rttr/registration>
 #include <Scene/ComponentRegistry.hpp>
+#include <Scene/PropertyAccessor.hpp>
 #include <Core/LoggerSystem.hpp>
 
 using namespace rttr;
@@ -478,46 +479,28 @@ void Borealis::ComponentRegistry::SetPropertyInternal(const std::string& propert
 
 
 #ifndef RegisterCopyPropertyFunction
+// Plain data members are copied in place through the accessor cache, only the rest goes through rttr variants
 #define RegisterCopyPropertyFunction(datatype) \
     void ComponentRegistry::CopyPropertyInternal(const std::string& propertyName, const datatype& src, const datatype& destination) \
     { \
-        auto t = type::get(src); \
-		property prop = t.get_property(propertyName); \
-		auto propType = prop.get_type(); \
-		bool success = true; \
-        switch (componentTypes[propType]) \
+        auto const& accessors = PropertyAccessorCache::Get<datatype>(); \
+        auto accessor = std::find_if(accessors.begin(), accessors.end(), \
+            [&propertyName](PropertyAccessor const& candidate) { return candidate.name == propertyName; }); \
+        if (accessor == accessors.end()) \
         { \
-			case dataTypes::INT: \
-				success = prop.set_value(destination, prop.get_value(src).get_value<int>()); \
-				break; \
-			case dataTypes::FLOAT: \
-				success = prop.set_value(destination, prop.get_value(src).get_value<float>()); \
-				break; \
-			case dataTypes::BOOL: \
-				success = prop.set_value(destination, prop.get_value(src).get_value<bool>()); \
-				break; \
-			case dataTypes::STRING: \
-				success = prop.set_value(destination, prop.get_value(src).get_value<std::string>()); \
-				break; \
-			case dataTypes::VEC2: \
-				success = prop.set_value(destination, prop.get_value(src).get_value<glm::vec2>()); \
-				break; \
-			case dataTypes::VEC3: \
-				success = prop.set_value(destination, prop.get_value(src).get_value<glm::vec3>()); \
-				break; \
-			case dataTypes::VEC4: \
-				success = prop.set_value(destination, prop.get_value(src).get_value<glm::vec4>()); \
-				break; \
-			case dataTypes::MAT4: \
-				success = prop.set_value(destination, prop.get_value(src).get_value<glm::mat4>()); \
-				break; \
-			default: \
-				BOREALIS_CORE_ASSERT(false, "Invalid data type being reflected"); \
-		} \
-        if (!success) \
+            BOREALIS_CORE_WARN("Failed to set property value"); \
+            return; \
+        } \
+        if (accessor->IsDirect()) \
         { \
-			BOREALIS_CORE_WARN("Failed to set property value"); \
-		}    \
+            accessor->Copy(const_cast<datatype*>(&destination), &src); \
+            return; \
+        } \
+        rttr::variant value = accessor->property.get_value(src); \
+        if (!value.is_valid() || !accessor->property.set_value(destination, value)) \
+        { \
+            BOREALIS_CORE_WARN("Failed to set property value"); \
+        } \
     } \
 
 #endif
@@ -18,29 +18,65 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include <Scene/Components.hpp>
 #include <Core/Utils.hpp>
 
-#include <glm/gtc/noise.hpp>
-
 namespace Borealis
 {
 	glm::mat4 TransformComponent::GetGlobalTransform()
 	{
-		std::stack<UUID> parentList;
-		UUID currID = ParentID;
-		while (currID != 0)
+		if (IsLocalChanged())
+		{
+			SetDirty();
+		}
+
+		// Moving a transform through SetDirty marks all of its children, and
+		// UpdateTransformHierarchy catches ancestors whose TRS was written directly
+		if (!mWorldDirty)
 		{
-			parentList.push(currID); // CBA
-			currID = SceneManager::GetActiveScene()->GetEntityByUUID(currID).GetComponent<TransformComponent>().ParentID;
+			return mCachedWorld;
 		}
-		glm::mat4 globalTransform(1.f);
 
-		while (parentList.size() > 0)
+		if (ParentID != 0)
+		{
+			// Parents are refreshed first, so only the changed part of the chain is recomputed
+			auto& parentTC = GetScene()->GetEntityByUUID(ParentID).GetComponent<TransformComponent>();
+			glm::mat4 parentWorld = parentTC.GetGlobalTransform();
+			RefreshWorldTransform(parentWorld, parentTC.mWorldVersion);
+		}
+		else
 		{
-			auto& tc = SceneManager::GetActiveScene()->GetEntityByUUID(parentList.top()).GetComponent<TransformComponent>();
-			glm::mat4 localTransform = tc.GetTransform();
-			globalTransform = globalTransform * localTransform;
-			parentList.pop();
+			RefreshWorldTransform(glm::mat4(1.f), 0);
 		}
-		return globalTransform * GetTransform();
+		return mCachedWorld;
+	}
+
+	void TransformComponent::SetDirty()
+	{
+		// Children of a dirty transform are always dirty, no need to walk further
+		if (mWorldDirty)
+			return;
+
+		mWorldDirty = true;
+		Scene* scene = GetScene();
+		for (auto childID : ChildrenID)
+		{
+			scene->GetEntityByUUID(childID).GetComponent<TransformComponent>().SetDirty();
+		}
+	}
+
+	void TransformComponent::RefreshWorldTransform(glm::mat4 const& parentWorld, uint32_t parentVersion)
+	{
+		mCachedTranslate = Translate;
+		mCachedRotation = Rotation;
+		mCachedScale = Scale;
+		mCachedParentID = ParentID;
+		mCachedParentVersion = parentVersion;
+		mCachedWorld = parentWorld * GetTransform();
+		mWorldDirty = false;
+		++mWorldVersion;
+	}
+
+	Scene* TransformComponent::GetScene() const
+	{
+		return mOwner.scene ? mOwner.scene : SceneManager::GetActiveScene().get();
 	}
 
 	glm::vec3 TransformComponent::GetGlobalTranslate()
@@ -83,7 +119,7 @@ namespace Borealis
 	{
 		if (ParentID != 0)
 		{
-			Entity parent = SceneManager::GetActiveScene()->GetEntityByUUID(ParentID);
+			Entity parent = GetScene()->GetEntityByUUID(ParentID);
 			glm::mat4 parentInverse = glm::inverse(parent.GetComponent<TransformComponent>().GetGlobalTransform());
 			glm::mat4 childRelativeTransform = parentInverse * transform;
 			Math::MatrixDecomposition(&childRelativeTransform, &Translate, &Rotation, &Scale);
@@ -92,6 +128,7 @@ namespace Borealis
 		{
 			Math::MatrixDecomposition(&transform , &Translate, &Rotation, &Scale);
 		}
+		SetDirty();
 	}
 
 	 void TransformComponent::SetParent(Entity entity, Entity parent)
@@ -101,6 +138,8 @@ namespace Borealis
 		ParentID = parent.GetUUID();
 		SetGlobalTransform(globalMat);
 		parent.GetComponent<TransformComponent>().ChildrenID.push_back(entity.GetUUID());
+		SetDirty();
+		GetScene()->RefreshActiveInHierarchy(entity);
 	}
 
 	 void TransformComponent::ResetParent(Entity entity)
@@ -110,13 +149,15 @@ namespace Borealis
 
 		if (ParentID != 0)
 		{
-			auto parent = SceneManager::GetActiveScene()->GetEntityByUUID(ParentID);
+			auto parent = GetScene()->GetEntityByUUID(ParentID);
 			auto& parentTC = parent.GetComponent<TransformComponent>();
 			auto pos = std::find(parentTC.ChildrenID.begin(), parentTC.ChildrenID.end(), entity.GetUUID());
 			parentTC.ChildrenID.erase(pos);
 		}
 
 		ParentID = 0;
+		SetDirty();
+		GetScene()->RefreshActiveInHierarchy(entity);
 	}
 
 	 int TransformComponent::GetHierarchyLayer(Entity entity)
@@ -127,7 +168,7 @@ namespace Borealis
 			 return entity.GetComponent<TagComponent>().mHierarchyLayer;
 		 else
 		 {
-			 auto parent = SceneManager::GetActiveScene()->GetEntityByUUID(ParentID);
+			 auto parent = GetScene()->GetEntityByUUID(ParentID);
 			 auto& parentTC = parent.GetComponent<TransformComponent>();
 			auto pos = std::find(parentTC.ChildrenID.begin(), parentTC.ChildrenID.end(), entity.GetUUID());
 			return (int)std::distance(parentTC.ChildrenID.begin(), pos) + 1;
@@ -189,11 +230,11 @@ namespace Borealis
 
 	 void ParticleSystemComponent::Init()
 	 {
-		 mParticlesCount = 0;
 		 Accumulator = 0.f;
 		 Timer = 0.f;
-		 mParticles.resize(maxParticles);
-		 mDeadParticles.resize(maxParticles);
+		 mParticles.Clear();
+		 // Sized once for a full emitter, spawning never reallocates the arrays after this
+		 mParticles.Reserve(maxParticles);
 	 }
 
 	 void ParticleSystemComponent::Start()
@@ -203,8 +244,6 @@ namespace Borealis
 
 		 Timer = 0.f;
 		 Accumulator = 0.f;
-		 mDeadParticlesCount = 0;
-		 mDeadParticles.clear();
 
 		 isActive = true;
 	 }
@@ -216,17 +255,10 @@ namespace Borealis
 
 		 isActive = false;
 
-		 for (auto& particle : mParticles)
-		 {
-			 particle.isActive = false;
-		 }
-		 mParticles.resize(maxParticles);
-		 mDeadParticles.resize(maxParticles);
-		 mParticlesCount = 0;
-		 mDeadParticlesCount = 0;
+		 mParticles.Clear();
 	 }
 
-	 void ParticleSystemComponent::Update(TransformComponent& transform, float dt)
+	 void ParticleSystemComponent::Update(ParticleEmitterTransform const& emitter, float dt)
 	 {
 		 if (!isActive)
 			 return;
@@ -239,82 +271,59 @@ namespace Borealis
 		 if (!durationExpired)
 		 {
 			 Accumulator += dt * rateOverTime;
-			 if (mParticlesCount > 100000000)
-			 {
-				 mParticlesCount = 0;
-			 }
-			 while (mParticlesCount < maxParticles && Accumulator >= 1.f)
+
+			 uint32_t alive = mParticles.Size();
+			 uint32_t room = maxParticles > alive ? maxParticles - alive : 0;
+			 uint32_t spawnCount = Accumulator >= 1.f ? std::min(static_cast<uint32_t>(Accumulator), room) : 0;
+
+			 if (spawnCount > 0)
 			 {
-				 Accumulator -= 1.f;
-				 if (mDeadParticlesCount > 0)
-				 {
-					 SpawnParticle(transform, *mDeadParticles[mDeadParticlesCount - 1]);
-					 mDeadParticlesCount--;
-					 mParticlesCount++;
-				 }
-				 else
+				 Accumulator -= static_cast<float>(spawnCount);
+
+				 // shared by every particle spawned this frame
+				 glm::quat rotationA = glm::quat(glm::radians(startRotation));
+				 glm::quat rotationB = glm::quat(glm::radians(startRotation2));
+
+				 for (uint32_t i = 0; i < spawnCount; ++i)
 				 {
-					 SpawnParticle(transform, mParticles[mParticlesCount]);
-					 mParticlesCount++;
+					 SpawnParticle(emitter, rotationA, rotationB);
 				 }
 			 }
 		 }
 
-		 for (Particle& particle : mParticles)
+		 mParticles.Age(dt, startLifeTime);
+
+		 if (gravityModifer != 0.f)
 		 {
-			 if (!particle.isActive) continue;
-			 particle.life += dt;
+			 mParticles.Accelerate(gravity * gravityModifer, dt);
+		 }
 
-			 if (particle.life >= startLifeTime)
-			 {
-				 particle.isActive = false;
-				 mDeadParticles[mDeadParticlesCount] = &particle;
-				 mDeadParticlesCount++;
-				 mParticlesCount--;
-				 continue;
-			 }
-			 glm::vec3 effectiveGravity = gravity * gravityModifer;
-			 particle.startVelocity += effectiveGravity * dt;
-
-			 if (useNoise) {
-				 // Compute noise input based on position and time
-				 glm::vec3 noiseInput = particle.position * noiseFrequency;
-				 noiseInput += glm::vec3(Timer * noiseScrollSpeed);
-
-				 // Sample noise for each axis with offsets to decorrelate
-				 glm::vec3 noise;
-				 noise.x = glm::perlin(noiseInput + glm::vec3(0.0, 0.0, 0.0));
-				 noise.y = glm::perlin(noiseInput + glm::vec3(100.0, 0.0, 0.0));
-				 noise.z = glm::perlin(noiseInput + glm::vec3(200.0, 0.0, 0.0));
-
-				 // Calculate acceleration and update velocity
-				 glm::vec3 acceleration = noise * noiseStrength;
-				 particle.startVelocity += acceleration * dt;
-			 }
+		 if (useNoise)
+		 {
+			 mParticles.ApplyNoise(noiseFrequency, noiseStrength, Timer * noiseScrollSpeed, dt);
+		 }
 
-			 particle.position += particle.startVelocity * dt;
+		 mParticles.Integrate(dt);
 
-			 if (endColorBool)
-			 {
-				 float t = particle.life / startLifeTime; // Normalized lifetime (0 to 1)
-				 particle.currentColor = particle.startColor + t * (endColor - particle.startColor);
-			 }
+		 if (endColorBool)
+		 {
+			 mParticles.FadeColor(endColor, startLifeTime);
 		 }
 
-		 if (durationExpired && mParticlesCount == 0)
+		 if (durationExpired && mParticles.Empty())
 		 {
 			 isActive = false;
 		 }
 	 }
 
-	 std::vector<Particle> const& ParticleSystemComponent::GetParticles()
+	 ParticlePool const& ParticleSystemComponent::GetParticles() const
 	 {
 		 return mParticles;
 	 }
 
-	 uint32_t ParticleSystemComponent::GetParticlesCount()
+	 uint32_t ParticleSystemComponent::GetParticlesCount() const
 	 {
-		 return mParticlesCount;
+		 return mParticles.Size();
 	 }
 
 	 Ref<Texture2D> ParticleSystemComponent::GetDefaultParticleTexture()
@@ -331,36 +340,27 @@ namespace Borealis
 		 Init();
 	 }
 
-	 float RandomRange(float min, float max) {
-		 return min + static_cast<float>(rand()) / (static_cast<float>(RAND_MAX / (max - min)));
-	 }
-
-	 void ParticleSystemComponent::SpawnParticle(TransformComponent& transform, Particle& particle)
+	 void ParticleSystemComponent::SpawnParticle(ParticleEmitterTransform const& emitter, glm::quat const& startRotationA, glm::quat const& startRotationB)
 	 {
-		 particle.isActive = true;
-
-		 // Get emitter world position
-		 glm::vec3 emitterPos = transform.GetGlobalTranslate();
+		 uint32_t index = mParticles.Add();
 
-		 // Convert emitter rotation (Euler to Quaternion)
-		 glm::vec3 rotation = transform.GetGlobalRotation();
-		 rotation = glm::radians(rotation);
-		 glm::quat orientation = glm::quat(rotation);
+		 glm::vec3 position{ 0.f };
+		 glm::vec3 velocity{ 0.f };
 
 		 if (emitterShape == EmitterShape::Cone)
 		 {
-			 float randomAngle = static_cast<float>(rand()) / RAND_MAX * glm::two_pi<float>();
-			 float randomRadius = radius * glm::sqrt(static_cast<float>(rand()) / RAND_MAX);
+			 float randomAngle = mRandom.Next01() * glm::two_pi<float>();
+			 float randomRadius = radius * glm::sqrt(mRandom.Next01());
 			 glm::vec3 spawnOffset = glm::vec3(
 				 randomRadius * glm::cos(randomAngle),
 				 0.0f,
 				 randomRadius * glm::sin(randomAngle)
 			 );
-			 particle.position = emitterPos + (orientation * spawnOffset);
+			 position = emitter.position + (emitter.orientation * spawnOffset);
 
 			 float coneAngle = glm::radians(angle);
-			 float u = static_cast<float>(rand()) / RAND_MAX;
-			 float v = static_cast<float>(rand()) / RAND_MAX;
+			 float u = mRandom.Next01();
+			 float v = mRandom.Next01();
 			 float theta = v * 2.0f * glm::pi<float>();
 			 float phi = glm::acos(1.0f - u * (1.0f - glm::cos(coneAngle)));
 			 glm::vec3 direction = glm::vec3(
@@ -368,52 +368,45 @@ namespace Borealis
 				 glm::cos(phi),
 				 glm::sin(phi) * glm::sin(theta)
 			 );
-			 glm::vec3 finalDirection = glm::normalize(orientation * direction);
+			 glm::vec3 finalDirection = glm::normalize(emitter.orientation * direction);
 
-			 particle.startVelocity = startSpeed * finalDirection;
+			 velocity = startSpeed * finalDirection;
 		 }
 		 else if (emitterShape == EmitterShape::Quad)
 		 {
-			 float randX = static_cast<float>(rand()) / RAND_MAX;
-			 float randZ = static_cast<float>(rand()) / RAND_MAX;
-			 float halfWidth = transform.GetGlobalScale().x * 0.5f;
-			 float halfHeight = transform.GetGlobalScale().y * 0.5f;
+			 float randX = mRandom.Next01();
+			 float randZ = mRandom.Next01();
 
 			 glm::vec3 spawnOffset = glm::vec3(
-				 (randX - 0.5f) * transform.GetGlobalScale().x,
+				 (randX - 0.5f) * emitter.scale.x,
 				 0.0f,                    
-				 (randZ - 0.5f) * transform.GetGlobalScale().y
+				 (randZ - 0.5f) * emitter.scale.y
 			 );
 
-			 particle.position = emitterPos + (orientation * spawnOffset);
+			 position = emitter.position + (emitter.orientation * spawnOffset);
 
-			 glm::vec3 quadNormal = orientation * glm::vec3(0.0f, 1.0f, 0.0f); 
+			 glm::vec3 quadNormal = emitter.orientation * glm::vec3(0.0f, 1.0f, 0.0f); 
 
 			 glm::vec3 finalDirection = glm::normalize(quadNormal);
 
-			 particle.startVelocity = startSpeed * finalDirection;
+			 velocity = startSpeed * finalDirection;
 		 }
 		 else if (emitterShape == EmitterShape::Box)
 		 {
-			 glm::vec3 boxScale = transform.GetGlobalScale();
-			 float halfWidth = boxScale.x * 0.5f;
-			 float halfHeight = boxScale.y * 0.5f;
-			 float halfDepth = boxScale.z * 0.5f;
-
-			 float randX = static_cast<float>(rand()) / RAND_MAX;
-			 float randY = static_cast<float>(rand()) / RAND_MAX;
-			 float randZ = static_cast<float>(rand()) / RAND_MAX;
+			 float randX = mRandom.Next01();
+			 float randY = mRandom.Next01();
+			 float randZ = mRandom.Next01();
 
 			 glm::vec3 spawnOffset = glm::vec3(
-				 (randX - 0.5f) * boxScale.x,
-				 (randY - 0.5f) * boxScale.y,
-				 (randZ - 0.5f) * boxScale.z 
+				 (randX - 0.5f) * emitter.scale.x,
+				 (randY - 0.5f) * emitter.scale.y,
+				 (randZ - 0.5f) * emitter.scale.z 
 			 );
 
-			 particle.position = emitterPos + (orientation * spawnOffset);
+			 position = emitter.position + (emitter.orientation * spawnOffset);
 
-			 float theta = static_cast<float>(rand()) / RAND_MAX * glm::two_pi<float>();
-			 float phi = glm::acos(1.0f - 2.0f * static_cast<float>(rand()) / RAND_MAX);
+			 float theta = mRandom.Next01() * glm::two_pi<float>();
+			 float phi = glm::acos(1.0f - 2.0f * mRandom.Next01());
 
 			 glm::vec3 direction = glm::vec3(
 				 glm::sin(phi) * glm::cos(theta),
@@ -421,43 +414,47 @@ namespace Borealis
 				 glm::cos(phi)
 			 );
 
-			 glm::vec3 finalDirection = glm::normalize(orientation * direction);
-			 particle.startVelocity = startSpeed * finalDirection;
+			 glm::vec3 finalDirection = glm::normalize(emitter.orientation * direction);
+			 velocity = startSpeed * finalDirection;
 		 }
 
+		 mParticles.posX[index] = position.x;
+		 mParticles.posY[index] = position.y;
+		 mParticles.posZ[index] = position.z;
+		 mParticles.velX[index] = velocity.x;
+		 mParticles.velY[index] = velocity.y;
+		 mParticles.velZ[index] = velocity.z;
+
 		 if (randomStartColor)
 		 {
-			 float colorLerp = static_cast<float>(rand()) / RAND_MAX;
-			 particle.startColor = glm::mix(startColor, startColor2, colorLerp);
+			 mParticles.startColor[index] = glm::mix(startColor, startColor2, mRandom.Next01());
 		 }
 		 else
 		 {
-			 particle.startColor = startColor;
+			 mParticles.startColor[index] = startColor;
 		 }
 
-		 particle.currentColor = startColor;
+		 mParticles.color[index] = startColor;
 
 		 if (randomStartSize)
 		 {
-			 float sizeLerp = static_cast<float>(rand()) / RAND_MAX;
-			 particle.startSize = glm::mix(startSize, startSize2, sizeLerp);
+			 mParticles.size[index] = glm::mix(startSize, startSize2, mRandom.Next01());
 		 }
 		 else
 		 {
-			 particle.startSize = startSize;
+			 mParticles.size[index] = startSize;
 		 }
 
 		 if (randomStartRotation)
 		 {
-			 float sizeLerp = static_cast<float>(rand()) / RAND_MAX;
-			 particle.startRotation = glm::mix(glm::quat(glm::radians(startRotation)), glm::quat(glm::radians(startRotation2)), sizeLerp);
+			 mParticles.rotation[index] = glm::mix(startRotationA, startRotationB, mRandom.Next01());
 		 }
 		 else
 		 {
-			 particle.startRotation = glm::quat(glm::radians(startRotation));
+			 mParticles.rotation[index] = startRotationA;
 		 }
 
-		 particle.life = 0.0f;
+		 mParticles.life[index] = 0.0f;
 	 }
 
 }
@@ -0,0 +1,167 @@
+/******************************************************************************
+/*!
+\file       PropertyAccessor.cpp
+\author     Chua Zheng Yang
+\par        email: c.zhengyang\@digipen.edu
+\date       October 17, 2026
+\brief      Implements the per component cache of reflected properties
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#include <BorealisPCH.hpp>
+#include <memory>
+#include <Scene/PropertyAccessor.hpp>
+#include <Assets/Asset.hpp>
+#include <Core/BitSet32.hpp>
+#include <Core/UUID.hpp>
+
+namespace Borealis
+{
+	namespace
+	{
+		/*!***********************************************************************
+			\brief
+				Whether a block of bytes changed anywhere but inside a window
+		*************************************************************************/
+		bool ChangedOutside(char const* before, char const* after, size_t size, size_t offset, size_t length)
+		{
+			return std::memcmp(before, after, offset) != 0 ||
+				std::memcmp(before + offset + length, after + offset + length, size - offset - length) != 0;
+		}
+
+		/*!***********************************************************************
+			\brief
+				Finds the member a property writes to by setting two values
+				through it and looking for the bytes that took them
+			\param[in] prop
+				The property
+			\param[in] object
+				Scratch component the property belongs to
+			\param[in] size
+				Size of the component
+			\param[in] first, second
+				Values to write, they must differ
+			\return
+				Offset of the member, NoOffset when the property is not a plain
+				member or its setter touches anything else
+		*************************************************************************/
+		template<typename T>
+		uint32_t FindOffset(rttr::property const& prop, rttr::instance const& instance, char* object, size_t size, T const& first, T const& second)
+		{
+			static_assert(std::is_trivially_copyable_v<T>);
+
+			std::vector<char> before(object, object + size);
+			if (!prop.set_value(instance, first)) return PropertyAccessor::NoOffset;
+			std::vector<char> afterFirst(object, object + size);
+			if (!prop.set_value(instance, second)) return PropertyAccessor::NoOffset;
+			std::vector<char> afterSecond(object, object + size);
+
+			// A getter that converts what the setter stored cannot be read in place
+			rttr::variant read = prop.get_value(instance);
+			if (!read.is_type<T>() || std::memcmp(&read.get_value<T>(), &second, sizeof(T)) != 0) return PropertyAccessor::NoOffset;
+
+			for (size_t offset = 0; offset + sizeof(T) <= size; offset += alignof(T))
+			{
+				if (std::memcmp(afterFirst.data() + offset, &first, sizeof(T)) != 0) continue;
+				if (std::memcmp(afterSecond.data() + offset, &second, sizeof(T)) != 0) continue;
+				if (ChangedOutside(before.data(), afterFirst.data(), size, offset, sizeof(T))) continue;
+				if (ChangedOutside(afterFirst.data(), afterSecond.data(), size, offset, sizeof(T))) continue;
+				return static_cast<uint32_t>(offset);
+			}
+			return PropertyAccessor::NoOffset;
+		}
+
+		/*!***********************************************************************
+			\brief
+				Looks for the offset of a property of one of the kinds that are
+				plain values, other kinds are left without one
+		*************************************************************************/
+		void ProbeOffset(PropertyAccessor& accessor, rttr::instance const& instance, char* object, size_t size)
+		{
+			auto probe = [&](auto const& first, auto const& second)
+			{
+				accessor.offset = FindOffset(accessor.property, instance, object, size, first, second);
+				if (accessor.IsDirect()) accessor.size = static_cast<uint32_t>(sizeof(first));
+			};
+
+			switch (accessor.kind)
+			{
+			case ScenePropertyKind::Int:	probe(0x12345678, -0x76543210);	break;
+			case ScenePropertyKind::Float:	probe(1234.5f, -8765.25f);	break;
+			case ScenePropertyKind::Bool:	probe(true, false);	break;
+			case ScenePropertyKind::UInt8:	probe(static_cast<unsigned char>(0x5A), static_cast<unsigned char>(0xA5));	break;
+			case ScenePropertyKind::Int8:	probe(static_cast<char>(0x5A), static_cast<char>(0x25));	break;
+			case ScenePropertyKind::UInt16:	probe(static_cast<unsigned short>(0x1234), static_cast<unsigned short>(0xFEDC));	break;
+			case ScenePropertyKind::Int16:	probe(static_cast<short>(0x1234), static_cast<short>(-0x0EDC));	break;
+			case ScenePropertyKind::UInt32:	probe(0x12345678u, 0xFEDCBA98u);	break;
+			case ScenePropertyKind::Int64:	probe(0x0123456789ABCDEFll, -0x0EDCBA9876543210ll);	break;
+			case ScenePropertyKind::UInt64:	probe(0x0123456789ABCDEFull, 0xFEDCBA9876543210ull);	break;
+			case ScenePropertyKind::UUID:	probe(UUID(0x0123456789ABCDEFull), UUID(0xFEDCBA9876543210ull));	break;
+			case ScenePropertyKind::Double:	probe(1234.5, -8765.25);	break;
+			case ScenePropertyKind::Vec2:	probe(glm::vec2(1.5f, -2.25f), glm::vec2(-3.5f, 4.75f));	break;
+			case ScenePropertyKind::Vec3:	probe(glm::vec3(1.5f, -2.25f, 3.125f), glm::vec3(-3.5f, 4.75f, -5.625f));	break;
+			case ScenePropertyKind::Vec4:	probe(glm::vec4(1.5f, -2.25f, 3.125f, -4.5f), glm::vec4(-3.5f, 4.75f, -5.625f, 6.5f));	break;
+			case ScenePropertyKind::Bitset:	probe(Bitset32(0x12345678u), Bitset32(0xFEDCBA98u));	break;
+			default:						break;
+			}
+		}
+	}
+
+	ScenePropertyKind PropertyAccessorCache::GetKind(rttr::type const& type)
+	{
+		if (type.is_enumeration()) return ScenePropertyKind::Enum;
+		if (type == rttr::type::get<int>()) return ScenePropertyKind::Int;
+		if (type == rttr::type::get<float>()) return ScenePropertyKind::Float;
+		if (type == rttr::type::get<bool>()) return ScenePropertyKind::Bool;
+		if (type == rttr::type::get<std::string>()) return ScenePropertyKind::String;
+		if (type == rttr::type::get<unsigned char>()) return ScenePropertyKind::UInt8;
+		if (type == rttr::type::get<char>()) return ScenePropertyKind::Int8;
+		if (type == rttr::type::get<unsigned short>()) return ScenePropertyKind::UInt16;
+		if (type == rttr::type::get<short>()) return ScenePropertyKind::Int16;
+		if (type == rttr::type::get<unsigned>()) return ScenePropertyKind::UInt32;
+		if (type == rttr::type::get<long long>()) return ScenePropertyKind::Int64;
+		if (type == rttr::type::get<unsigned long long>()) return ScenePropertyKind::UInt64;
+		if (type == rttr::type::get<UUID>()) return ScenePropertyKind::UUID;
+		if (type == rttr::type::get<double>()) return ScenePropertyKind::Double;
+		if (type == rttr::type::get<glm::vec2>()) return ScenePropertyKind::Vec2;
+		if (type == rttr::type::get<glm::vec3>()) return ScenePropertyKind::Vec3;
+		if (type == rttr::type::get<Bitset32>()) return ScenePropertyKind::Bitset;
+		if (type == rttr::type::get<glm::vec4>()) return ScenePropertyKind::Vec4;
+		if (type == rttr::type::get<std::unordered_set<UUID>>()) return ScenePropertyKind::UUIDSet;
+		if (type == rttr::type::get<std::vector<UUID>>()) return ScenePropertyKind::UUIDList;
+		if (type == rttr::type::get<std::unordered_set<std::string>>()) return ScenePropertyKind::StringSet;
+		if (type.get_wrapped_type().is_valid() && type.get_wrapped_type().is_derived_from<Asset>()) return ScenePropertyKind::Asset;
+		if (type.is_class() && type.is_valid()) return ScenePropertyKind::Class;
+		return ScenePropertyKind::Unsupported;
+	}
+
+	std::vector<PropertyAccessor> PropertyAccessorCache::Build(rttr::type const& type, Probe const& probe)
+	{
+		PROFILE_FUNCTION();
+
+		// One scratch component for every property, zeroed so padding compares equal
+		std::unique_ptr<char[]> buffer(new char[probe.size + probe.alignment]);
+		void* memory = buffer.get();
+		size_t space = probe.size + probe.alignment;
+		char* object = static_cast<char*>(std::align(probe.alignment, probe.size, memory, space));
+		std::memset(object, 0, probe.size);
+		probe.construct(object);
+		rttr::instance instance = probe.instance(object);
+
+		std::vector<PropertyAccessor> accessors;
+		for (auto& prop : type.get_properties())
+		{
+			PropertyAccessor& accessor = accessors.emplace_back(prop);
+			accessor.name = prop.get_name().to_string();
+			accessor.kind = GetKind(prop.get_type());
+			ProbeOffset(accessor, instance, object, probe.size);
+		}
+
+		probe.destroy(object);
+		return accessors;
+	}
+}
@@ -20,6 +20,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include <Scene/Components.hpp>
 #include <Scripting/ScriptInstance.hpp>
 #include <Scripting/ScriptingUtils.hpp>
+#include <Scripting/ManagedObjectCache.hpp>
 #include <Graphics/Renderer2D.hpp>
 #include <Graphics/Renderer3D.hpp>
 #include <Core/LoggerSystem.hpp>
@@ -36,6 +37,13 @@ namespace Borealis
 {
 	Scene::Scene(std::string name, std::string path) : mName(name), mScenePath(path)
 	{
+		// Copies from other scenes or snapshots arrive here too, not only through Entity::AddComponent
+		mRegistry.on_construct<TransformComponent>().connect<&Scene::OnTransformConstructed>(*this);
+	}
+
+	void Scene::OnTransformConstructed(entt::registry& registry, entt::entity entity)
+	{
+		registry.get<TransformComponent>(entity).mOwner.scene = this;
 	}
 
 	Scene::~Scene()
@@ -47,41 +55,26 @@ namespace Borealis
 	{
 		//2D pass
 		{
-			auto group = mRegistry.group<>(entt::get<TransformComponent, SpriteRendererComponent>);
-			for (auto& entity : group)
+			auto view = mRegistry.view<TransformComponent, SpriteRendererComponent, ActiveTag>();
+			for (auto entity : view)
 			{
-				auto entityBR = Entity{ entity, this };
-				if (!entityBR.IsActive())
-				{
-					continue;
-				}
-				auto [transform, sprite] = group.get<TransformComponent, SpriteRendererComponent>(entity);
+				auto [transform, sprite] = view.get<TransformComponent, SpriteRendererComponent>(entity);
 				Renderer2D::DrawSprite(transform.GetGlobalTransform(), sprite, (int)entity);
 			}
 		}
 		{
-			auto group = mRegistry.group<>(entt::get<TransformComponent, CircleRendererComponent>);
-			for (auto& entity : group)
+			auto view = mRegistry.view<TransformComponent, CircleRendererComponent, ActiveTag>();
+			for (auto entity : view)
 			{
-				auto entityBR = Entity{ entity, this };
-				if (!entityBR.IsActive())
-				{
-					continue;
-				}
-				auto [transform, circle] = group.get<TransformComponent, CircleRendererComponent>(entity);
+				auto [transform, circle] = view.get<TransformComponent, CircleRendererComponent>(entity);
 				Renderer2D::DrawCircle(transform.GetGlobalTransform(), circle.Colour, circle.thickness, circle.fade, (int)entity);
 			}
 		}
 		{
-			auto group = mRegistry.group<>(entt::get<TransformComponent, TextComponent>);
-			for (auto& entity : group)
+			auto view = mRegistry.view<TransformComponent, TextComponent, ActiveTag>();
+			for (auto entity : view)
 			{
-				auto entityBR = Entity{ entity, this };
-				if (!entityBR.IsActive())
-				{
-					continue;
-				}
-				auto [transform, text] = group.get<TransformComponent, TextComponent>(entity);
+				auto [transform, text] = view.get<TransformComponent, TextComponent>(entity);
 				Renderer2D::DrawString(text.text, text.font, transform, (int)entity, 1, { 1,1,1,1 }, text.align == TextComponent::TextAlign::Left ? false : true, text.outline, text.width);
 			}
 		}
@@ -117,16 +110,10 @@ namespace Borealis
 			}
 		}
 		{
-			auto group = mRegistry.group<>(entt::get<TransformComponent, MeshFilterComponent, MeshRendererComponent>);
-			for (auto& entity : group)
+			auto view = mRegistry.view<TransformComponent, MeshFilterComponent, MeshRendererComponent, ActiveTag>();
+			for (auto entity : view)
 			{
-				auto entityBR = Entity{ entity, this };
-				if (!entityBR.IsActive())
-				{
-					continue;
-				}
-				auto [transform, meshFilter, meshRenderer] = group.get<TransformComponent, MeshFilterComponent, MeshRendererComponent>(entity);
-				auto groupLight = mRegistry.group<>(entt::get<TransformComponent, LightComponent>);
+				auto [transform, meshFilter, meshRenderer] = view.get<TransformComponent, MeshFilterComponent, MeshRendererComponent>(entity);
 
 				Renderer3D::DrawMesh(transform.GetGlobalTransform(), meshFilter, meshRenderer, (int)entity);
 			}
@@ -137,6 +124,7 @@ namespace Borealis
 	void Scene::UpdateRuntime(float dt)
 	{
 		dt *= TimeManager::GetTimeScale();
+		UpdateActiveHierarchy();
 		if (hasRuntimeStarted)
 		{
 			{
@@ -197,7 +185,7 @@ namespace Borealis
 				auto& scriptComponent = view.get<ScriptComponent>(entity);
 				for (auto& [name, script] : scriptComponent.mScripts)
 				{
-					if (script->IsActive())
+					if (script->HasMethod(ScriptMethod::Update) && script->IsActive())
 					{
 						script->Update();
 					}
@@ -241,7 +229,7 @@ namespace Borealis
 				auto& scriptComponent = view.get<ScriptComponent>(entity);
 				for (auto& [name, script] : scriptComponent.mScripts)
 				{
-					if (script->IsActive())
+					if (timeStep > 0 && script->HasMethod(ScriptMethod::FixedUpdate) && script->IsActive())
 					{
 						for (int i = 0; i < timeStep; i++)
 							script->FixedUpdate();
@@ -253,467 +241,12 @@ namespace Borealis
 			// Physics Simulation here
 			//------------------------
 
-			// thread the push operation maybe next time. TODO
 			{
-				/*unsigned numThread = std::thread::hardware_concurrency();
-				size_t maxSize = physicsGroup.size();
-				size_t chunkSize = (maxSize + numThread - 1) / numThread;
-				std::vector<std::thread> threads;
-
-				for (unsigned i = 0; i < numThread; i++)
-				{
-					size_t start = i * chunkSize;
-					size_t end = (i + 1) * chunkSize;
-					if (end > maxSize)
-						end = maxSize;
-					threads.emplace_back([start, end, &physicsGroup, this]()
-						{
-							for (auto entity : physicsGroup)
-							{
-								Entity brEntity{ entity, this };
-								if (!brEntity.IsActive())
-								{
-									continue;
-								}
-								auto [transform, rigidbody] = physicsGroup.get<TransformComponent, RigidBodyComponent>(entity);
-								PhysicsSystem::PushTransform(rigidbody, transform, brEntity);
-							}
-						});
-				}
-
-				for (auto& thread : threads)
-				{
-					thread.join();
-				}*/
-
-				auto boxGroup = mRegistry.group<>(entt::get<TransformComponent, BoxColliderComponent, RigidbodyComponent>);
-
-				auto characterGroup = mRegistry.group<>(entt::get<TransformComponent, CharacterControllerComponent>);
-				auto sphereGroup = mRegistry.group<>(entt::get<TransformComponent, SphereColliderComponent, RigidbodyComponent>);
-				auto cylinderGroup = mRegistry.group<>(entt::get<TransformComponent, CylinderColliderComponent, RigidbodyComponent>);
-				auto capsuleGroup = mRegistry.group<>(entt::get<TransformComponent, CapsuleColliderComponent, RigidbodyComponent>);
-
 				for (int i = 0; i < timeStep; i++)
 				{
-					PhysicsSystem::StartJobQueue();
-					for (auto entity : characterGroup)
-					{
-						Entity brEntity{ entity, this };
-						if (!brEntity.IsActive())
-						{
-							continue;
-						}
+					mPhysicsStep.Step(*this, fixedTimeStep);
 
-						auto jobFunction = [this, entity, characterGroup, fixedTimeStep]()
-							{
-								auto [transform, character] = characterGroup.get<TransformComponent, CharacterControllerComponent>(entity);
-								PhysicsSystem::PushCharacterTransform(character, transform.Translate, transform.Rotation);
-								PhysicsSystem::HandleInput(fixedTimeStep, character);
-							};
-
-						// Push the job into the job queue
-						std::string jobName = "PushCharacterTransform_" + (std::to_string(brEntity.GetUUID())); // Create a unique job name
-						PhysicsSystem::PushJob(jobName, jobFunction);  // No dependencies in this case
-
-					}
-					PhysicsSystem::EndJobQueue();
-
-					PhysicsSystem::StartJobQueue();
-					for (auto entity : characterGroup)
-					{
-						Entity brEntity{ entity, this };
-						if (!brEntity.IsActive())
-						{
-							continue;
-						}
-						auto [transform, character] = characterGroup.get<TransformComponent, CharacterControllerComponent>(entity);
-						PhysicsSystem::PrePhysicsUpdate(fixedTimeStep, character.controller);
-					}
-					PhysicsSystem::EndJobQueue();
-
-					PhysicsSystem::StartJobQueue();
-					for (auto entity : characterGroup)
-					{
-						Entity brEntity{ entity, this };
-						if (!brEntity.IsActive())
-						{
-							continue;
-						}
-
-						auto jobFunction = [this, entity, characterGroup]()
-							{
-								auto [transform, character] = characterGroup.get<TransformComponent, CharacterControllerComponent>(entity);
-								PhysicsSystem::PullCharacterTransform(character, transform.Translate, transform.Rotation);
-							};
-
-						// Push the job into the job queue
-						std::string jobName = "PullCharacterTransform_" + (std::to_string(brEntity.GetUUID())); // Create a unique job name
-						PhysicsSystem::PushJob(jobName, jobFunction);  // No dependencies in this case
-					}
-					PhysicsSystem::EndJobQueue();
-
-					PhysicsSystem::StartJobQueue();
-					for (auto entity : boxGroup)
-					{
-						Entity brEntity{ entity, this };
-						if (!brEntity.IsActive())
-						{
-							continue;
-						}
-
-						auto jobFunction = [this, entity, boxGroup]()
-							{
-								auto [transform, box, rigidbody] = boxGroup.get<TransformComponent, BoxColliderComponent, RigidbodyComponent>(entity);
-								PhysicsSystem::PushTransform(box, transform, box.rigidBody);
-							};
-
-						// Push the job into the job queue
-						std::string jobName = "PushBoxTransform_" + (std::to_string(brEntity.GetUUID())); // Create a unique job name
-						PhysicsSystem::PushJob(jobName, jobFunction);  // No dependencies in this case
-
-
-					}
-
-					for (auto entity : sphereGroup)
-					{
-						Entity brEntity{ entity, this };
-						if (!brEntity.IsActive())
-						{
-							continue;
-						}
-
-						auto jobFunction = [this, entity, sphereGroup]()
-							{
-								auto [transform, sphere, rigidbody] = sphereGroup.get<TransformComponent, SphereColliderComponent, RigidbodyComponent>(entity);
-								PhysicsSystem::PushTransform(sphere, transform, sphere.rigidBody);
-							};
-
-						// Push the job into the job queue
-						std::string jobName = "PushSphereTransform_" + (std::to_string(brEntity.GetUUID())); // Create a unique job name
-						PhysicsSystem::PushJob(jobName, jobFunction);  // No dependencies in this case
-					}
-
-					for (auto entity : capsuleGroup)
-					{
-						Entity brEntity{ entity, this };
-						if (!brEntity.IsActive())
-						{
-							continue;
-						}
-
-						auto jobFunction = [this, entity, capsuleGroup]()
-							{
-								auto [transform, capsule, rigidbody] = capsuleGroup.get<TransformComponent, CapsuleColliderComponent, RigidbodyComponent>(entity);
-								PhysicsSystem::PushTransform(capsule, transform, capsule.rigidBody);
-							};
-
-						// Push the job into the job queue
-						std::string jobName = "PushCapsuleTransform_" + (std::to_string(brEntity.GetUUID())); // Create a unique job name
-						PhysicsSystem::PushJob(jobName, jobFunction);  // No dependencies in this case
-
-					}
-
-					for (auto entity : cylinderGroup)
-					{
-						Entity brEntity{ entity, this };
-						if (!brEntity.IsActive())
-						{
-							continue;
-						}
-
-						auto jobFunction = [this, entity, cylinderGroup]()
-							{
-								auto [transform, cylinder, rigidbody] = cylinderGroup.get<TransformComponent, CylinderColliderComponent, RigidbodyComponent>(entity);
-								PhysicsSystem::PushTransform(cylinder, transform, cylinder.rigidBody);
-							};
-
-						// Push the job into the job queue
-						std::string jobName = "PushCylinderTransform_" + (std::to_string(brEntity.GetUUID())); // Create a unique job name
-						PhysicsSystem::PushJob(jobName, jobFunction);  // No dependencies in this case
-
-					}
-					PhysicsSystem::EndJobQueue();
-
-
-					PhysicsSystem::Update(fixedTimeStep);
-
-					// Set entity values to Jolt transform.
-					PhysicsSystem::StartJobQueue();
-					for (auto entity : boxGroup)
-					{
-						Entity brEntity{ entity, this };
-						if (!brEntity.IsActive())
-						{
-							continue;
-						}
-
-						auto jobFunction = [this, entity, boxGroup]()
-							{
-								auto [transform, box, rigidbody] = boxGroup.get<TransformComponent, BoxColliderComponent, RigidbodyComponent>(entity);
-								PhysicsSystem::PullTransform(box, transform);
-							};
-
-						// Push the job into the job queue
-						std::string jobName = "PullBoxTransform_" + (std::to_string(brEntity.GetUUID())); // Create a unique job name
-						PhysicsSystem::PushJob(jobName, jobFunction);  // No dependencies in this case
-					}
-
-					for (auto entity : capsuleGroup)
-					{
-						Entity brEntity{ entity, this };
-						if (!brEntity.IsActive())
-						{
-							continue;
-						}
-
-						auto jobFunction = [this, entity, capsuleGroup]()
-							{
-								auto [transform, capsule, rigidbody] = capsuleGroup.get<TransformComponent, CapsuleColliderComponent, RigidbodyComponent>(entity);
-								PhysicsSystem::PullTransform(capsule, transform);
-							};
-
-						// Push the job into the job queue
-						std::string jobName = "PullCapsuleTransform_" + (std::to_string(brEntity.GetUUID())); // Create a unique job name
-						PhysicsSystem::PushJob(jobName, jobFunction);  // No dependencies in this case
-					}
-					for (auto entity : sphereGroup)
-					{
-						Entity brEntity{ entity, this };
-						if (!brEntity.IsActive())
-						{
-							continue;
-						}
-
-						auto jobFunction = [this, entity, sphereGroup]()
-							{
-								auto [transform, sphere, rigidbody] = sphereGroup.get<TransformComponent, SphereColliderComponent, RigidbodyComponent>(entity);
-								PhysicsSystem::PullTransform(sphere, transform);
-							};
-
-						// Push the job into the job queue
-						std::string jobName = "PullSphereTransform_" + (std::to_string(brEntity.GetUUID())); // Create a unique job name
-						PhysicsSystem::PushJob(jobName, jobFunction);  // No dependencies in this case
-
-					}
-
-					for (auto entity : cylinderGroup)
-					{
-						Entity brEntity{ entity, this };
-						if (!brEntity.IsActive())
-						{
-							continue;
-						}
-
-						auto jobFunction = [this, entity, cylinderGroup]()
-							{
-								auto [transform, cylinder, rigidbody] = cylinderGroup.get<TransformComponent, CylinderColliderComponent, RigidbodyComponent>(entity);
-								PhysicsSystem::PullTransform(cylinder, transform);
-							};
-
-						// Push the job into the job queue
-						std::string jobName = "PullCylinderTransform_" + (std::to_string(brEntity.GetUUID())); // Create a unique job name
-						PhysicsSystem::PushJob(jobName, jobFunction);  // No dependencies in this case
-
-					}
-
-					PhysicsSystem::EndJobQueue();
-
-					while (!PhysicsSystem::GetCollisionEnterQueue().empty())
-					{
-						auto collisionPair = PhysicsSystem::GetCollisionEnterQueue().front();
-						PhysicsSystem::GetCollisionEnterQueue().pop();
-						Entity entity1 = GetEntityByUUID(collisionPair.first);
-						Entity entity2 = GetEntityByUUID(collisionPair.second);
-						if (!entity1.IsValid()) continue;
-						if (!entity2.IsValid()) continue;
-						if (!entity1.IsActive()) continue;
-						if (!entity2.IsActive()) continue;
-						if (entity1.HasComponent<ScriptComponent>())
-						{
-							auto& scriptComponent1 = entity1.GetComponent<ScriptComponent>();
-							for (auto& [name, script] : scriptComponent1.mScripts)
-							{
-
-								script->OnCollisionEnter(entity2.GetComponent<IDComponent>().ID);
-
-							}
-						}
-
-						if (entity2.HasComponent<ScriptComponent>())
-						{
-							auto& scriptComponent2 = entity2.GetComponent<ScriptComponent>();
-							for (auto& [name, script] : scriptComponent2.mScripts)
-							{
-
-								script->OnCollisionEnter(entity1.GetComponent<IDComponent>().ID);
-
-							}
-						}
-					}
-
-
-					while (!PhysicsSystem::GetCollisionPersistQueue().empty())
-					{
-						auto collisionPair = PhysicsSystem::GetCollisionPersistQueue().front();
-						PhysicsSystem::GetCollisionPersistQueue().pop();
-						Entity entity1 = GetEntityByUUID(collisionPair.first);
-						Entity entity2 = GetEntityByUUID(collisionPair.second);
-						if (!entity1.IsValid()) continue;
-						if (!entity2.IsValid()) continue;
-						if (!entity1.IsActive()) continue;
-						if (!entity2.IsActive()) continue;
-						if (entity1.HasComponent<ScriptComponent>())
-						{
-							auto& scriptComponent1 = entity1.GetComponent<ScriptComponent>();
-							for (auto& [name, script] : scriptComponent1.mScripts)
-							{
-								script->OnCollisionStay(entity2.GetComponent<IDComponent>().ID);
-							}
-						}
-						if (entity2.HasComponent<ScriptComponent>())
-						{
-							auto& scriptComponent2 = entity2.GetComponent<ScriptComponent>();
-							for (auto& [name, script] : scriptComponent2.mScripts)
-							{
-
-								script->OnCollisionStay(entity1.GetComponent<IDComponent>().ID);
-
-							}
-						}
-					}
-
-					while (!PhysicsSystem::GetCollisionExitQueue().empty())
-					{
-						auto collisionPair = PhysicsSystem::GetCollisionExitQueue().front();
-						PhysicsSystem::GetCollisionExitQueue().pop();
-						Entity entity1 = GetEntityByUUID(collisionPair.first);
-						Entity entity2 = GetEntityByUUID(collisionPair.second);
-						if (!entity1.IsValid()) continue;
-						if (!entity2.IsValid()) continue;
-						if (!entity1.IsActive()) continue;
-						if (!entity2.IsActive()) continue;
-						if (entity1.HasComponent<ScriptComponent>())
-						{
-							auto& scriptComponent1 = entity1.GetComponent<ScriptComponent>();
-							for (auto& [name, script] : scriptComponent1.mScripts)
-							{
-
-								script->OnCollisionExit(entity2.GetComponent<IDComponent>().ID);
-
-							}
-						}
-
-						if (entity2.HasComponent<ScriptComponent>())
-						{
-							auto& scriptComponent2 = entity2.GetComponent<ScriptComponent>();
-							for (auto& [name, script] : scriptComponent2.mScripts)
-							{
-
-								script->OnCollisionExit(entity1.GetComponent<IDComponent>().ID);
-
-							}
-						}
-					}
-
-
-					while (!PhysicsSystem::GetTriggerEnterQueue().empty())
-					{
-						auto collisionPair = PhysicsSystem::GetTriggerEnterQueue().front();
-						PhysicsSystem::GetTriggerEnterQueue().pop();
-						Entity entity1 = GetEntityByUUID(collisionPair.first);
-						Entity entity2 = GetEntityByUUID(collisionPair.second);
-						if (!entity1.IsValid()) continue;
-						if (!entity2.IsValid()) continue;
-						if (!entity1.IsActive()) continue;
-						if (!entity2.IsActive()) continue;
-
-
-						if (entity1.HasComponent<ScriptComponent>())
-						{
-							auto& scriptComponent1 = entity1.GetComponent<ScriptComponent>();
-							for (auto& [name, script] : scriptComponent1.mScripts)
-							{
-
-								script->OnTriggerEnter(collisionPair.second);
-
-							}
-						}
-
-						if (entity2.HasComponent<ScriptComponent>())
-						{
-							auto& scriptComponent2 = entity2.GetComponent<ScriptComponent>();
-							for (auto& [name, script] : scriptComponent2.mScripts)
-							{
-
-								script->OnTriggerEnter(collisionPair.first);
-
-							}
-						}
-					}
-
-
-					while (!PhysicsSystem::GetTriggerPersistQueue().empty())
-					{
-						auto collisionPair = PhysicsSystem::GetTriggerPersistQueue().front();
-						PhysicsSystem::GetTriggerPersistQueue().pop();
-						Entity entity1 = GetEntityByUUID(collisionPair.first);
-						Entity entity2 = GetEntityByUUID(collisionPair.second);
-						if (!entity1.IsValid()) continue;
-						if (!entity2.IsValid()) continue;
-						if (!entity1.IsActive()) continue;
-						if (!entity2.IsActive()) continue;
-						if (entity1.HasComponent<ScriptComponent>())
-						{
-							auto& scriptComponent1 = entity1.GetComponent<ScriptComponent>();
-							for (auto& [name, script] : scriptComponent1.mScripts)
-							{
-								script->OnTriggerStay(entity2.GetComponent<IDComponent>().ID);
-							}
-						}
-						if (entity2.HasComponent<ScriptComponent>())
-						{
-							auto& scriptComponent2 = entity2.GetComponent<ScriptComponent>();
-							for (auto& [name, script] : scriptComponent2.mScripts)
-							{
-
-								script->OnTriggerStay(entity1.GetComponent<IDComponent>().ID);
-
-							}
-						}
-					}
-
-					while (!PhysicsSystem::GetTriggerExitQueue().empty())
-					{
-						auto collisionPair = PhysicsSystem::GetTriggerExitQueue().front();
-						PhysicsSystem::GetTriggerExitQueue().pop();
-						Entity entity1 = GetEntityByUUID(collisionPair.first);
-						Entity entity2 = GetEntityByUUID(collisionPair.second);
-						if (!entity1.IsValid()) continue;
-						if (!entity2.IsValid()) continue;
-						if (!entity1.IsActive()) continue;
-						if (!entity2.IsActive()) continue;
-						if (entity1.HasComponent<ScriptComponent>())
-						{
-							auto& scriptComponent1 = entity1.GetComponent<ScriptComponent>();
-							for (auto& [name, script] : scriptComponent1.mScripts)
-							{
-
-								script->OnTriggerExit(entity2.GetComponent<IDComponent>().ID);
-
-							}
-						}
-
-						if (entity2.HasComponent<ScriptComponent>())
-						{
-							auto& scriptComponent2 = entity2.GetComponent<ScriptComponent>();
-							for (auto& [name, script] : scriptComponent2.mScripts)
-							{
-
-								script->OnTriggerExit(entity1.GetComponent<IDComponent>().ID);
-
-							}
-						}
-					}
+					DispatchContactEvents();
 				}
 
 
@@ -730,7 +263,7 @@ namespace Borealis
 					auto& scriptComponent = view.get<ScriptComponent>(entity);
 					for (auto& [name, script] : scriptComponent.mScripts)
 					{
-						if (script->IsActive())
+						if (script->HasMethod(ScriptMethod::LateUpdate) && script->IsActive())
 						{
 							script->LateUpdate();
 						}
@@ -856,7 +389,7 @@ namespace Borealis
 		return mPixelBuffer;
 	}
 
-	void Scene::SetRenderGraphConfig(RenderGraphConfig renderGraphConfig)
+	void Scene::SetRenderGraphConfig(RenderGraphConfig const& renderGraphConfig)
 	{
 		mRenderGraph.SetConfig(renderGraphConfig);
 	}
@@ -869,6 +402,11 @@ namespace Borealis
 	void Scene::ClearRenderGraph()
 	{
 		mRenderGraph.Init();
+		mRunTimeCameraSource = nullptr;
+		if (mViewportFrameBuffer)
+		{
+			RegisterRenderSources();
+		}
 	}
 
 	RenderGraph::SceneRenderConfig& Scene::GetSceneRenderConfig()
@@ -876,6 +414,11 @@ namespace Borealis
 		return mRenderGraph.sceneRenderConfig;
 	}
 
+	RenderGraph::RebuildStats const& Scene::GetRenderGraphStats() const
+	{
+		return mRenderGraph.GetLastFrameStats();
+	}
+
 	void Scene::SetRunTimeRenderPass()
 	{
 		mRenderConfig = RenderGraphConfig();
@@ -996,11 +539,214 @@ namespace Borealis
 			FrameBufferProperties propsCompositeFBO{ 1280, 720, false };
 			propsCompositeFBO.Attachments = { FramebufferTextureFormat::RGBA16F,FramebufferTextureFormat::RedInteger };
 			mCompositeFBO = FrameBuffer::Create(propsAccumulaionFBO);
+
+			RegisterRenderSources();
+		}
+	}
+
+	void Scene::RegisterRenderSources()
+	{
+		mRenderGraph.SetGlobalSource(MakeRef<RenderTargetSource>("EditorBuffer", mViewportFrameBuffer));
+		mRenderGraph.SetGlobalSource(MakeRef<GBufferSource>("gBuffer", mGFrameBuffer));
+		mRenderGraph.SetGlobalSource(MakeRef<RenderTargetSource>("ShadowMapBuffer", mShadowMapBuffer));
+		mRenderGraph.SetGlobalSource(MakeRef<PixelBufferSource>("PixelBuffer", mPixelBuffer));
+		mRenderGraph.SetGlobalSource(MakeRef<RenderTargetSource>("opaqueBuffer", mOpaqueFBO));
+		mRenderGraph.SetGlobalSource(MakeRef<RenderTargetSource>("accumulaionBuffer", mAccumulaionFBO));
+		mRenderGraph.SetGlobalSource(MakeRef<RenderTargetSource>("compositeBuffer", mCompositeFBO));
+
+		//added to the graph only while there is a primary camera
+		mRunTimeBufferSource = MakeRef<RenderTargetSource>("RunTimeBuffer", mRuntimeFrameBuffer);
+	}
+
+	void Scene::UpdateTransformHierarchy()
+	{
+		static const glm::mat4 identity(1.f);
+
+		auto view = mRegistry.view<TransformComponent>();
+		mTransformStack.clear();
+		for (auto entity : view)
+		{
+			if (view.get<TransformComponent>(entity).ParentID == 0)
+			{
+				mTransformStack.push_back({ entity, nullptr });
+			}
+		}
+
+		// Depth first walk, a parent is always refreshed before its children are pushed
+		while (!mTransformStack.empty())
+		{
+			TransformStackEntry current = mTransformStack.back();
+			mTransformStack.pop_back();
+
+			auto& transform = view.get<TransformComponent>(current.entity);
+			TransformComponent const* parent = current.parent;
+			uint32_t parentVersion = parent ? parent->mWorldVersion : 0;
+			if (transform.mWorldDirty || transform.IsLocalChanged() || transform.mCachedParentVersion != parentVersion)
+			{
+				transform.RefreshWorldTransform(parent ? parent->mCachedWorld : identity, parentVersion);
+			}
+
+			for (auto childID : transform.ChildrenID)
+			{
+				auto iter = mEntityMap.find(childID);
+				if (iter == mEntityMap.end())
+					continue;
+				mTransformStack.push_back({ iter->second, &transform });
+			}
+		}
+	}
+
+	void Scene::SetActiveInHierarchy(entt::entity entity, bool active)
+	{
+		auto& tag = mRegistry.get<TagComponent>(entity);
+		tag.mActiveInHierarchy = active;
+
+		auto& activeStorage = mRegistry.storage<ActiveTag>();
+		if (active && !activeStorage.contains(entity))
+		{
+			activeStorage.emplace(entity);
+		}
+		else if (!active && activeStorage.contains(entity))
+		{
+			activeStorage.erase(entity);
+		}
+	}
+
+	void Scene::PropagateActiveInHierarchy()
+	{
+		while (!mActiveStack.empty())
+		{
+			auto [entity, parentActive] = mActiveStack.back();
+			mActiveStack.pop_back();
+
+			bool active = parentActive && mRegistry.get<TagComponent>(entity).active;
+			SetActiveInHierarchy(entity, active);
+
+			for (auto childID : mRegistry.get<TransformComponent>(entity).ChildrenID)
+			{
+				auto iter = mEntityMap.find(childID);
+				if (iter == mEntityMap.end())
+					continue;
+				mActiveStack.push_back({ iter->second, active });
+			}
+		}
+	}
+
+	void Scene::RefreshActiveInHierarchy(Entity entity)
+	{
+		bool parentActive = true;
+		UUID parentID = entity.GetComponent<TransformComponent>().ParentID;
+		if (parentID != 0)
+		{
+			auto iter = mEntityMap.find(parentID);
+			if (iter != mEntityMap.end())
+				parentActive = mRegistry.get<TagComponent>(iter->second).mActiveInHierarchy;
+		}
+
+		mActiveStack.clear();
+		mActiveStack.push_back({ entity, parentActive });
+		PropagateActiveInHierarchy();
+	}
+
+	void Scene::UpdateActiveHierarchy()
+	{
+		// SetActive and SetParent keep the cache up to date as they go
+		if (!mActiveHierarchyDirty)
+			return;
+
+		PROFILE_FUNCTION();
+
+		mActiveHierarchyDirty = false;
+		auto view = mRegistry.view<TransformComponent, TagComponent>();
+		mActiveStack.clear();
+		for (auto entity : view)
+		{
+			if (view.get<TransformComponent>(entity).ParentID == 0)
+			{
+				mActiveStack.push_back({ entity, true });
+			}
+		}
+		PropagateActiveInHierarchy();
+	}
+
+	Scene::ActiveHierarchyBenchmark Scene::BenchmarkActiveHierarchy(uint32_t entities, uint32_t depth, uint32_t passes)
+	{
+		PROFILE_FUNCTION();
+
+		ActiveHierarchyBenchmark result;
+		if (entities == 0 || depth == 0 || passes == 0)
+			return result;
+
+		Scene scene("ActiveHierarchyBenchmark");
+		std::vector<Entity> created;
+		created.reserve(entities);
+		for (uint32_t i = 0; i < entities; ++i)
+		{
+			Entity entity = scene.CreateEntityWithUUID("Benchmark", i + 1);
+			if (i % depth != 0)
+			{
+				entity.GetComponent<TransformComponent>().SetParent(entity, created.back());
+			}
+			created.push_back(entity);
+		}
+
+		// IsActive before the cache, one map lookup per ancestor
+		auto isActiveRecursive = [&scene](Entity entity)
+		{
+			while (entity.GetComponent<TagComponent>().active)
+			{
+				UUID parentID = entity.GetComponent<TransformComponent>().ParentID;
+				if (parentID == 0)
+					return true;
+				entity = scene.GetEntityByUUID(parentID);
+			}
+			return false;
+		};
+
+		uint64_t activeCount = 0;
+		auto start = std::chrono::high_resolution_clock::now();
+		for (uint32_t pass = 0; pass < passes; ++pass)
+		{
+			for (Entity entity : created)
+				activeCount += isActiveRecursive(entity);
+		}
+		std::chrono::duration<double, std::milli> elapsed = std::chrono::high_resolution_clock::now() - start;
+		result.recursiveMilliseconds = elapsed.count() / passes;
+
+		start = std::chrono::high_resolution_clock::now();
+		for (uint32_t pass = 0; pass < passes; ++pass)
+		{
+			for (Entity entity : created)
+				activeCount += entity.IsActive();
+		}
+		elapsed = std::chrono::high_resolution_clock::now() - start;
+		result.cachedMilliseconds = elapsed.count() / passes;
+
+		start = std::chrono::high_resolution_clock::now();
+		for (uint32_t pass = 0; pass < passes; ++pass)
+		{
+			for (uint32_t root = 0; root < entities; root += depth)
+			{
+				created[root].SetActive(false);
+				created[root].SetActive(true);
+			}
 		}
+		elapsed = std::chrono::high_resolution_clock::now() - start;
+		result.refreshMilliseconds = elapsed.count() / passes;
+
+		// Keeps the lookups from being optimised away
+		BOREALIS_CORE_TRACE("Active hierarchy benchmark counted {0} active lookups", activeCount);
+
+		result.entities = entities;
+		return result;
 	}
 
 	void Scene::UpdateEditor(float dt, EditorCamera& camera)
 	{
+		UpdateActiveHierarchy();
+		UpdateTransformHierarchy();
+		mRenderBVH.Update(mRegistry);
+
 		Renderer3D::Begin(camera);
 		Render3DPass();
 		Renderer3D::End();
@@ -1013,6 +759,9 @@ namespace Borealis
 	void Scene::UpdateRenderer(float dt)
 	{
 		CreateBuffers();
+		UpdateActiveHierarchy();
+		UpdateTransformHierarchy();
+		mRenderBVH.Update(mRegistry);
 
 		Camera* mainCamera = nullptr; // camera not found
 		glm::mat4 mainCameratransform(1.f);
@@ -1035,44 +784,32 @@ namespace Borealis
 			}
 		}
 
-		mRenderGraph.Init();
-
-		RenderTargetSource editorBuffer("EditorBuffer", mViewportFrameBuffer);
-		mRenderGraph.SetGlobalSource(MakeRef<RenderTargetSource>(editorBuffer));
-
-		GBufferSource gBufferSource("gBuffer", mGFrameBuffer);
-		mRenderGraph.SetGlobalSource(MakeRef<GBufferSource>(gBufferSource));
-
-		RenderTargetSource shadowMapBuffer("ShadowMapBuffer", mShadowMapBuffer);
-		mRenderGraph.SetGlobalSource(MakeRef<RenderTargetSource>(shadowMapBuffer));
-
-		PixelBufferSource pixelBuffer("PixelBuffer", mPixelBuffer);
-		mRenderGraph.SetGlobalSource(MakeRef<PixelBufferSource>(pixelBuffer));
-
-		RenderTargetSource opaqueBuffer("opaqueBuffer", mOpaqueFBO);
-		mRenderGraph.SetGlobalSource(MakeRef<RenderTargetSource>(opaqueBuffer));
-
-		RenderTargetSource accumulaionBuffer("accumulaionBuffer", mAccumulaionFBO);
-		mRenderGraph.SetGlobalSource(MakeRef<RenderTargetSource>(accumulaionBuffer));
-
-		RenderTargetSource compositeBuffer("compositeBuffer", mCompositeFBO);
-		mRenderGraph.SetGlobalSource(MakeRef<RenderTargetSource>(compositeBuffer));
-
-		//PixelBufferSource nullPixelBuffer("NullPixelBuffer", nullptr);
-		//mRenderGraph.SetGlobalSource(MakeRef<PixelBufferSource>(nullPixelBuffer));
-
+		//sources persist across frames, only the camera is updated in place.
+		//gaining or losing the primary camera changes the graph's sources and
+		//causes one recompile
 		if (mainCamera)
 		{
-			RenderTargetSource runtimeBuffer("RunTimeBuffer", mRuntimeFrameBuffer);
-			mRenderGraph.SetGlobalSource(MakeRef<RenderTargetSource>(runtimeBuffer));
-
-			CameraSource runTimeCameraSource("RunTimeCamera", *mainCamera, mainCameratransform);
-			mRenderGraph.SetGlobalSource(MakeRef<CameraSource>(runTimeCameraSource));
+			if (mRunTimeCameraSource)
+			{
+				mRunTimeCameraSource->Set(*mainCamera, mainCameratransform);
+			}
+			else
+			{
+				mRunTimeCameraSource = MakeRef<CameraSource>("RunTimeCamera", *mainCamera, mainCameratransform);
+				mRenderGraph.SetGlobalSource(mRunTimeBufferSource);
+				mRenderGraph.SetGlobalSource(mRunTimeCameraSource);
+			}
+		}
+		else if (mRunTimeCameraSource)
+		{
+			mRenderGraph.RemoveGlobalSource("RunTimeBuffer");
+			mRenderGraph.RemoveGlobalSource("RunTimeCamera");
+			mRunTimeCameraSource = nullptr;
 		}
 
 		mRenderGraph.SetEntityRegistry(mRegistry);
 
-		mRenderGraph.Finalize();
+		mRenderGraph.Compile();
 
 		mRenderGraph.SetFinalSink("BackBuffer", "Render2D.renderTarget"); //do i need it for immediate mode?
 
@@ -1091,6 +828,7 @@ namespace Borealis
 		entity.AddComponent<IDComponent>(id);
 		name == "" ? entity.AddComponent<TagComponent>("unnamedEntity" + std::to_string(unnamedID++)) : entity.AddComponent<TagComponent>(name);
 		entity.AddComponent<TransformComponent>();
+		mRegistry.emplace<ActiveTag>(entity);
 		mEntityMap[id] = entity;
 		return entity;
 	}
@@ -1101,9 +839,66 @@ namespace Borealis
 		entity.AddComponent<IDComponent>(UUID);
 		name == "" ? entity.AddComponent<TagComponent>("unnamedEntity" + std::to_string(unnamedID++)) : entity.AddComponent<TagComponent>(name);
 		entity.AddComponent<TransformComponent>();
+		mRegistry.emplace<ActiveTag>(entity);
 		mEntityMap[UUID] = entity;
 		return entity;
 	}
+	void Scene::DispatchContactEvents()
+	{
+		PROFILE_FUNCTION();
+
+		// Events arrive grouped per receiver, so each receiver is resolved once
+		auto const& events = PhysicsSystem::CollectContactEvents();
+		size_t begin = 0;
+		while (begin < events.size())
+		{
+			size_t end = begin + 1;
+			while (end < events.size() && events[end].receiver == events[begin].receiver)
+			{
+				++end;
+			}
+
+			entt::entity receiver = static_cast<entt::entity>(events[begin].receiver);
+			if (!mRegistry.valid(receiver) || !mRegistry.all_of<ScriptComponent>(receiver) || !Entity{ receiver, this }.IsActive())
+			{
+				begin = end;
+				continue;
+			}
+
+			for (size_t i = begin; i < end; ++i)
+			{
+				// Scripts may destroy entities while their events are delivered
+				entt::entity other = static_cast<entt::entity>(events[i].other);
+				if (!mRegistry.valid(receiver) || !mRegistry.valid(other) || !Entity{ other, this }.IsActive())
+				{
+					continue;
+				}
+
+				UUID otherID = mRegistry.get<IDComponent>(other).ID;
+				auto& scriptComponent = mRegistry.get<ScriptComponent>(receiver);
+				for (auto& [name, script] : scriptComponent.mScripts)
+				{
+					switch (events[i].type)
+					{
+					case ContactEventType::CollisionEnter: script->OnCollisionEnter(otherID); break;
+					case ContactEventType::CollisionStay: script->OnCollisionStay(otherID); break;
+					case ContactEventType::CollisionExit: script->OnCollisionExit(otherID); break;
+					case ContactEventType::TriggerEnter: script->OnTriggerEnter(otherID); break;
+					case ContactEventType::TriggerStay: script->OnTriggerStay(otherID); break;
+					case ContactEventType::TriggerExit: script->OnTriggerExit(otherID); break;
+					}
+				}
+			}
+
+			begin = end;
+		}
+	}
+
+	PhysicsStepPipeline& Scene::GetPhysicsStepPipeline()
+	{
+		return mPhysicsStep;
+	}
+
 	Entity Scene::GetEntityByUUID(UUID uuid)
 	{
 		if (mEntityMap.find(uuid) != mEntityMap.end())
@@ -1153,6 +948,7 @@ namespace Borealis
 			DestroyEntity(childEntity);
 		}
 		entity.GetComponent<TransformComponent>().ResetParent(entity);
+		ManagedObjectCache::Remove(entity.GetUUID());
 		mEntityMap.erase(entity.GetUUID());
 		mRegistry.destroy(entity);
 	}
@@ -1258,6 +1054,8 @@ namespace Borealis
 			GetEntityByUUID(newChildID).GetComponent<TransformComponent>().ParentID = newEntity.GetUUID();
 		}
 
+		// The copied tag carries the original's cached state
+		RefreshActiveInHierarchy(newEntity);
 		return newEntity.GetUUID();
 	}
 
@@ -1426,6 +1224,12 @@ namespace Borealis
 		}
 	}
 
+	void Scene::CloneScriptInstances(entt::registry& source)
+	{
+		mRegistry.clear<ScriptComponent>();
+		CopyComponent<ScriptComponent>(mRegistry, source, mEntityMap);
+	}
+
 	Ref<Scene> Scene::Copy(const Ref<Scene>& other)
 	{
 		Ref<Scene> newScene = MakeRef<Scene>();
@@ -1780,6 +1584,8 @@ namespace Borealis
 		{
 			auto [transform, psystem] = particleSystemGroup.get<TransformComponent, ParticleSystemComponent>(entity);
 			psystem.Init();
+			// One emitter per entity
+			psystem.mRandom.Seed(mRegistry.get<IDComponent>(entity).ID, 0);
 		}
 	}
 
@@ -1832,15 +1638,10 @@ namespace Borealis
 		}
 
 		PhysicsSystem::EndScene();
-		PhysicsSystem::GetCollisionEnterQueue() = std::queue<CollisionPair>();
-		PhysicsSystem::GetCollisionPersistQueue() = std::queue<CollisionPair>();
-		PhysicsSystem::GetCollisionExitQueue() = std::queue<CollisionPair>();
-		PhysicsSystem::GetTriggerEnterQueue() = std::queue<CollisionPair>();
-		PhysicsSystem::GetTriggerPersistQueue() = std::queue<CollisionPair>();
-		PhysicsSystem::GetTriggerExitQueue() = std::queue<CollisionPair>();
 		PhysicsSystem::Free();
 
 		LayerList::resetEntities();
+		ManagedObjectCache::Clear();
 		AudioEngine::StopAllChannels();
 	}
 
@@ -2109,6 +1910,7 @@ namespace Borealis
 	template<>
 	void Scene::OnComponentAdded<ParticleSystemComponent>(Entity entity, ParticleSystemComponent& component)
 	{
+		component.mRandom.Seed(entity.GetUUID(), 0);
 
 	}
 
@@ -0,0 +1,766 @@
+/******************************************************************************
+/*!
+\file       SceneBinary.cpp
+\author     Chua Zheng Yang
+\par        email: c.zhengyang\@digipen.edu
+\date       October 17, 2026
+\brief      Defines the binary scene writer and the reader the runtime loads
+			it through
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#include "BorealisPCH.hpp"
+#include <cstring>
+#include <yaml-cpp/yaml.h>
+#include <Scene/SceneBinary.hpp>
+#include <Scene/Components.hpp>
+#include <Assets/AssetManager.hpp>
+#include <Core/Bitset32.hpp>
+
+namespace Borealis
+{
+	namespace
+	{
+		constexpr uint32_t MaxSchemaDepth = 16;
+
+		rttr::string_view ToName(std::string_view name)
+		{
+			return rttr::string_view(name.data(), name.size());
+		}
+
+		class StringTable
+		{
+		public:
+			uint32_t Intern(std::string const& string)
+			{
+				auto [it, inserted] = mIndices.try_emplace(string, static_cast<uint32_t>(mStrings.size()));
+				if (inserted)
+				{
+					mStrings.push_back(string);
+				}
+				return it->second;
+			}
+
+			std::string const& Get(uint32_t index) const { return mStrings[index]; }
+			std::vector<std::string> const& GetStrings() const { return mStrings; }
+
+		private:
+			std::unordered_map<std::string, uint32_t> mIndices;
+			std::vector<std::string> mStrings;
+		};
+
+		template<typename T>
+		void Put(std::string& out, T const& value)
+		{
+			out.append(reinterpret_cast<const char*>(&value), sizeof(T));
+		}
+
+		/*!***********************************************************************
+			\brief
+				Same test DeserialiseProperty applies before it reads a value
+		*************************************************************************/
+		bool IsPresent(YAML::Node const& node)
+		{
+			return node && node.IsDefined() && !(node.IsMap() && node.size() == 0);
+		}
+
+		void BuildSchema(rttr::type const& type, std::vector<ScenePropertySchema>& schema, StringTable& strings, uint32_t depth = 0)
+		{
+			for (auto& prop : type.get_properties())
+			{
+				ScenePropertySchema property;
+				property.kind = PropertyAccessorCache::GetKind(prop.get_type());
+				if (property.kind == ScenePropertyKind::Unsupported)
+				{
+					continue;
+				}
+
+				if (property.kind == ScenePropertyKind::Class)
+				{
+					// Classes with nothing to store are written as empty maps, which are never read back
+					if (depth + 1 < MaxSchemaDepth)
+					{
+						BuildSchema(prop.get_type(), property.nested, strings, depth + 1);
+					}
+					if (property.nested.empty())
+					{
+						continue;
+					}
+				}
+
+				property.name = strings.Intern(prop.get_name().to_string());
+				schema.push_back(std::move(property));
+			}
+		}
+
+		void WriteSchema(std::string& out, std::vector<ScenePropertySchema> const& schema)
+		{
+			Put(out, static_cast<uint32_t>(schema.size()));
+			for (ScenePropertySchema const& property : schema)
+			{
+				Put(out, property.name);
+				Put(out, property.kind);
+				if (property.kind == ScenePropertyKind::Class)
+				{
+					WriteSchema(out, property.nested);
+				}
+			}
+		}
+
+		template<typename T>
+		void PutFloats(std::string& out, YAML::Node const& node)
+		{
+			T value{};
+			for (int i = 0; i < T::length(); ++i)
+			{
+				value[i] = node[i].as<float>();
+			}
+			Put(out, value);
+		}
+
+		/*!***********************************************************************
+			\brief
+				Converts one YAML value, read the way DeserialiseProperty reads
+				it, into its stored form
+		*************************************************************************/
+		void WriteValue(std::string& out, ScenePropertySchema const& schema, YAML::Node const& node, StringTable& strings)
+		{
+			switch (schema.kind)
+			{
+			case ScenePropertyKind::Enum:
+			case ScenePropertyKind::String:	Put(out, strings.Intern(node.as<std::string>())); break;
+			case ScenePropertyKind::Int:	Put(out, static_cast<int32_t>(node.as<int>())); break;
+			case ScenePropertyKind::Float:	Put(out, node.as<float>()); break;
+			case ScenePropertyKind::Bool:	Put(out, static_cast<uint8_t>(node.as<bool>())); break;
+			case ScenePropertyKind::UInt8:	Put(out, static_cast<uint8_t>(node.as<unsigned>())); break;
+			case ScenePropertyKind::Int8:	Put(out, static_cast<int8_t>(node.as<int>())); break;
+			case ScenePropertyKind::UInt16:	Put(out, static_cast<uint16_t>(node.as<unsigned>())); break;
+			case ScenePropertyKind::Int16:	Put(out, static_cast<int16_t>(node.as<int>())); break;
+			case ScenePropertyKind::UInt32:
+			case ScenePropertyKind::Bitset:	Put(out, static_cast<uint32_t>(node.as<unsigned>())); break;
+			case ScenePropertyKind::Int64:	Put(out, static_cast<int64_t>(node.as<long long>())); break;
+			case ScenePropertyKind::UInt64:
+			case ScenePropertyKind::UUID:
+			case ScenePropertyKind::Asset:	Put(out, static_cast<uint64_t>(node.as<unsigned long long>())); break;
+			case ScenePropertyKind::Double:	Put(out, node.as<double>()); break;
+			case ScenePropertyKind::Vec2:	PutFloats<glm::vec2>(out, node); break;
+			case ScenePropertyKind::Vec3:	PutFloats<glm::vec3>(out, node); break;
+			case ScenePropertyKind::Vec4:	PutFloats<glm::vec4>(out, node); break;
+			case ScenePropertyKind::UUIDSet:
+			case ScenePropertyKind::UUIDList:
+			{
+				// Written as a map that repeats the "UUID" key
+				std::vector<uint64_t> ids;
+				for (auto it = node.begin(); it != node.end(); ++it)
+				{
+					ids.push_back(it->second.as<uint64_t>());
+				}
+				Put(out, static_cast<uint32_t>(ids.size()));
+				out.append(reinterpret_cast<const char*>(ids.data()), ids.size() * sizeof(uint64_t));
+				break;
+			}
+			case ScenePropertyKind::StringSet:
+			{
+				Put(out, static_cast<uint32_t>(node.size()));
+				for (YAML::Node const& string : node)
+				{
+					Put(out, strings.Intern(string.as<std::string>()));
+				}
+				break;
+			}
+			case ScenePropertyKind::Class:
+			{
+				for (ScenePropertySchema const& nested : schema.nested)
+				{
+					YAML::Node const& value = node[strings.Get(nested.name)];
+					uint8_t present = IsPresent(value);
+					Put(out, present);
+					if (present)
+					{
+						WriteValue(out, nested, value, strings);
+					}
+				}
+				break;
+			}
+			default:
+				break;
+			}
+		}
+
+		struct TableBuilder
+		{
+			uint32_t name = 0;
+			std::vector<ScenePropertySchema> schema;
+			std::vector<uint32_t> entities;
+			std::vector<YAML::Node> rows;
+		};
+
+		void WriteTable(std::string& out, TableBuilder const& table, StringTable& strings)
+		{
+			Put(out, table.name);
+			Put(out, static_cast<uint32_t>(table.entities.size()));
+			WriteSchema(out, table.schema);
+			out.append(reinterpret_cast<const char*>(table.entities.data()), table.entities.size() * sizeof(uint32_t));
+
+			std::string columns;
+			std::string presence;
+			for (ScenePropertySchema const& property : table.schema)
+			{
+				std::string const& name = strings.Get(property.name);
+				presence.assign((table.rows.size() + 7) / 8, '\0');
+				size_t const presenceOffset = columns.size();
+				columns += presence;
+
+				for (size_t row = 0; row < table.rows.size(); ++row)
+				{
+					YAML::Node const& value = table.rows[row][name];
+					if (IsPresent(value))
+					{
+						columns[presenceOffset + row / 8] |= static_cast<char>(1 << (row % 8));
+						WriteValue(columns, property, value, strings);
+					}
+				}
+			}
+
+			Put(out, static_cast<uint64_t>(columns.size()));
+			out += columns;
+		}
+
+		class Cursor
+		{
+		public:
+			explicit Cursor(std::string_view data) : mData(data) {}
+
+			template<typename T>
+			bool Read(T& value)
+			{
+				if (mFailed || Remaining() < sizeof(T))
+				{
+					mFailed = true;
+					return false;
+				}
+				std::memcpy(&value, mData.data() + mOffset, sizeof(T));
+				mOffset += sizeof(T);
+				return true;
+			}
+
+			bool ReadBytes(size_t size, std::string_view& bytes)
+			{
+				if (mFailed || Remaining() < size)
+				{
+					mFailed = true;
+					return false;
+				}
+				bytes = mData.substr(mOffset, size);
+				mOffset += size;
+				return true;
+			}
+
+			/*!***********************************************************************
+				\brief
+					Reads a uint32 count of elements of the given size, failing
+					when there are not that many bytes left
+			*************************************************************************/
+			bool ReadCount(uint32_t& count, size_t elementSize)
+			{
+				if (!Read(count) || Remaining() / elementSize < count)
+				{
+					mFailed = true;
+					return false;
+				}
+				return true;
+			}
+
+			template<typename T>
+			bool ReadArray(uint32_t count, std::vector<T>& values)
+			{
+				std::string_view bytes;
+				if (!ReadBytes(static_cast<size_t>(count) * sizeof(T), bytes))
+				{
+					return false;
+				}
+				values.resize(count);
+				std::memcpy(values.data(), bytes.data(), bytes.size());
+				return true;
+			}
+
+			size_t Remaining() const { return mData.size() - mOffset; }
+			bool Failed() const { return mFailed; }
+
+		private:
+			std::string_view mData;
+			size_t mOffset = 0;
+			bool mFailed = false;
+		};
+
+		bool ReadSchema(Cursor& cursor, std::vector<ScenePropertySchema>& schema, size_t stringCount, uint32_t depth = 0)
+		{
+			uint32_t count = 0;
+			if (depth >= MaxSchemaDepth || !cursor.ReadCount(count, sizeof(uint32_t) + sizeof(ScenePropertyKind)))
+			{
+				return false;
+			}
+
+			schema.resize(count);
+			for (ScenePropertySchema& property : schema)
+			{
+				if (!cursor.Read(property.name) || !cursor.Read(property.kind) ||
+					property.name >= stringCount || property.kind > ScenePropertyKind::Class)
+				{
+					return false;
+				}
+				if (property.kind == ScenePropertyKind::Class && !ReadSchema(cursor, property.nested, stringCount, depth + 1))
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+
+		/*!***********************************************************************
+			\brief
+				Reads a stored value and sets it when prop is not null
+		*************************************************************************/
+		template<typename Stored, typename Value = Stored>
+		void ReadScalar(Cursor& cursor, rttr::property const* prop, ReflectionInstance& instance)
+		{
+			Stored stored{};
+			if (cursor.Read(stored) && prop)
+			{
+				prop->set_value(instance, static_cast<Value>(stored));
+			}
+		}
+
+		/*!***********************************************************************
+			\brief
+				Reads a stored value straight into the member the accessor
+				points at
+		*************************************************************************/
+		template<typename Stored, typename Value = Stored>
+		void ReadInPlace(Cursor& cursor, PropertyAccessor const& accessor, void* object)
+		{
+			Stored stored{};
+			if (cursor.Read(stored))
+			{
+				accessor.Set(object, static_cast<Value>(stored));
+			}
+		}
+
+		/*!***********************************************************************
+			\brief
+				Reads one value of a property with a direct accessor, the kinds
+				ReadScalar handles
+		*************************************************************************/
+		void ReadDirect(Cursor& cursor, PropertyAccessor const& accessor, void* object)
+		{
+			switch (accessor.kind)
+			{
+			case ScenePropertyKind::Int:	ReadInPlace<int32_t, int>(cursor, accessor, object); break;
+			case ScenePropertyKind::Float:	ReadInPlace<float>(cursor, accessor, object); break;
+			case ScenePropertyKind::Bool:	ReadInPlace<uint8_t, bool>(cursor, accessor, object); break;
+			case ScenePropertyKind::UInt8:	ReadInPlace<uint8_t, unsigned char>(cursor, accessor, object); break;
+			case ScenePropertyKind::Int8:	ReadInPlace<int8_t, char>(cursor, accessor, object); break;
+			case ScenePropertyKind::UInt16:	ReadInPlace<uint16_t, unsigned short>(cursor, accessor, object); break;
+			case ScenePropertyKind::Int16:	ReadInPlace<int16_t, short>(cursor, accessor, object); break;
+			case ScenePropertyKind::UInt32:	ReadInPlace<uint32_t, unsigned>(cursor, accessor, object); break;
+			case ScenePropertyKind::Int64:	ReadInPlace<int64_t, long long>(cursor, accessor, object); break;
+			case ScenePropertyKind::UInt64:	ReadInPlace<uint64_t, unsigned long long>(cursor, accessor, object); break;
+			case ScenePropertyKind::UUID:	ReadInPlace<uint64_t, UUID>(cursor, accessor, object); break;
+			case ScenePropertyKind::Double:	ReadInPlace<double>(cursor, accessor, object); break;
+			case ScenePropertyKind::Vec2:	ReadInPlace<glm::vec2>(cursor, accessor, object); break;
+			case ScenePropertyKind::Vec3:	ReadInPlace<glm::vec3>(cursor, accessor, object); break;
+			case ScenePropertyKind::Vec4:	ReadInPlace<glm::vec4>(cursor, accessor, object); break;
+			case ScenePropertyKind::Bitset:	ReadInPlace<uint32_t, Bitset32>(cursor, accessor, object); break;
+			default: break;
+			}
+		}
+
+		void SetAsset(rttr::property const& prop, ReflectionInstance& instance, uint64_t handle)
+		{
+			// The asset types DeserialiseProperty restores
+			rttr::type type = prop.get_type();
+			if (type == rttr::type::get<Ref<Model>>()) prop.set_value(instance, rttr::variant(AssetManager::GetAsset<Model>(handle)));
+			else if (type == rttr::type::get<Ref<SkinnedModel>>()) prop.set_value(instance, rttr::variant(AssetManager::GetAsset<SkinnedModel>(handle)));
+			else if (type == rttr::type::get<Ref<Animation>>()) prop.set_value(instance, rttr::variant(AssetManager::GetAsset<Animation>(handle)));
+			else if (type == rttr::type::get<Ref<Material>>()) prop.set_value(instance, rttr::variant(AssetManager::GetAsset<Material>(handle)));
+			else if (type == rttr::type::get<Ref<Texture2D>>()) prop.set_value(instance, rttr::variant(AssetManager::GetAsset<Texture2D>(handle)));
+			else if (type == rttr::type::get<Ref<BehaviourTreeData>>()) prop.set_value(instance, rttr::variant(AssetManager::GetAsset<BehaviourTreeData>(handle)));
+		}
+
+		/*!***********************************************************************
+			\brief
+				Reads one value. It is only set when prop is not null and the
+				property is still stored the way the scene was written
+		*************************************************************************/
+		void ReadProperty(Cursor& cursor, ScenePropertySchema const& schema, rttr::property const* prop, ReflectionInstance& instance,
+			std::vector<std::string_view> const& strings)
+		{
+			if (prop && (!prop->is_valid() || PropertyAccessorCache::GetKind(prop->get_type()) != schema.kind))
+			{
+				prop = nullptr;
+			}
+
+			switch (schema.kind)
+			{
+			case ScenePropertyKind::Int:	ReadScalar<int32_t, int>(cursor, prop, instance); break;
+			case ScenePropertyKind::Float:	ReadScalar<float>(cursor, prop, instance); break;
+			case ScenePropertyKind::Bool:	ReadScalar<uint8_t, bool>(cursor, prop, instance); break;
+			case ScenePropertyKind::UInt8:	ReadScalar<uint8_t, unsigned char>(cursor, prop, instance); break;
+			case ScenePropertyKind::Int8:	ReadScalar<int8_t, char>(cursor, prop, instance); break;
+			case ScenePropertyKind::UInt16:	ReadScalar<uint16_t, unsigned short>(cursor, prop, instance); break;
+			case ScenePropertyKind::Int16:	ReadScalar<int16_t, short>(cursor, prop, instance); break;
+			case ScenePropertyKind::UInt32:	ReadScalar<uint32_t, unsigned>(cursor, prop, instance); break;
+			case ScenePropertyKind::Int64:	ReadScalar<int64_t, long long>(cursor, prop, instance); break;
+			case ScenePropertyKind::UInt64:	ReadScalar<uint64_t, unsigned long long>(cursor, prop, instance); break;
+			case ScenePropertyKind::UUID:	ReadScalar<uint64_t, UUID>(cursor, prop, instance); break;
+			case ScenePropertyKind::Double:	ReadScalar<double>(cursor, prop, instance); break;
+			case ScenePropertyKind::Vec2:	ReadScalar<glm::vec2>(cursor, prop, instance); break;
+			case ScenePropertyKind::Vec3:	ReadScalar<glm::vec3>(cursor, prop, instance); break;
+			case ScenePropertyKind::Vec4:	ReadScalar<glm::vec4>(cursor, prop, instance); break;
+			case ScenePropertyKind::Bitset:	ReadScalar<uint32_t, Bitset32>(cursor, prop, instance); break;
+			case ScenePropertyKind::Enum:
+			case ScenePropertyKind::String:
+			{
+				uint32_t index = 0;
+				if (cursor.Read(index) && prop && index < strings.size())
+				{
+					if (schema.kind == ScenePropertyKind::Enum)
+					{
+						prop->set_value(instance, prop->get_type().get_enumeration().name_to_value(ToName(strings[index])));
+					}
+					else
+					{
+						prop->set_value(instance, std::string(strings[index]));
+					}
+				}
+				break;
+			}
+			case ScenePropertyKind::UUIDSet:
+			case ScenePropertyKind::UUIDList:
+			{
+				uint32_t count = 0;
+				std::vector<uint64_t> ids;
+				if (cursor.ReadCount(count, sizeof(uint64_t)) && cursor.ReadArray(count, ids) && prop)
+				{
+					if (schema.kind == ScenePropertyKind::UUIDSet)
+					{
+						prop->set_value(instance, std::unordered_set<UUID>(ids.begin(), ids.end()));
+					}
+					else
+					{
+						prop->set_value(instance, std::vector<UUID>(ids.begin(), ids.end()));
+					}
+				}
+				break;
+			}
+			case ScenePropertyKind::StringSet:
+			{
+				uint32_t count = 0;
+				std::vector<uint32_t> indices;
+				if (cursor.ReadCount(count, sizeof(uint32_t)) && cursor.ReadArray(count, indices) && prop)
+				{
+					std::unordered_set<std::string> set;
+					for (uint32_t index : indices)
+					{
+						if (index < strings.size())
+						{
+							set.emplace(strings[index]);
+						}
+					}
+					prop->set_value(instance, set);
+				}
+				break;
+			}
+			case ScenePropertyKind::Asset:
+			{
+				uint64_t handle = 0;
+				if (cursor.Read(handle) && prop && handle)
+				{
+					SetAsset(*prop, instance, handle);
+				}
+				break;
+			}
+			case ScenePropertyKind::Class:
+			{
+				rttr::variant value = prop ? prop->get_value(instance) : rttr::variant();
+				ReflectionInstance nestedInstance(value);
+				bool const apply = prop && nestedInstance.is_valid();
+
+				for (ScenePropertySchema const& nested : schema.nested)
+				{
+					uint8_t present = 0;
+					if (!cursor.Read(present) || !present)
+					{
+						continue;
+					}
+
+					if (apply)
+					{
+						rttr::property nestedProp = prop->get_type().get_property(ToName(strings[nested.name]));
+						ReadProperty(cursor, nested, &nestedProp, nestedInstance, strings);
+					}
+					else
+					{
+						ReadProperty(cursor, nested, nullptr, nestedInstance, strings);
+					}
+				}
+
+				if (apply)
+				{
+					prop->set_value(instance, value);
+				}
+				break;
+			}
+			default:
+				break;
+			}
+		}
+	}
+
+	bool SceneBinary::IsBinary(std::string_view data)
+	{
+		uint32_t magic = 0;
+		if (data.size() < sizeof(SceneBinaryHeader))
+		{
+			return false;
+		}
+		std::memcpy(&magic, data.data(), sizeof(magic));
+		return magic == SceneBinaryHeader::Magic;
+	}
+
+	bool SceneBinary::Write(YAML::Node const& scene, std::vector<uint64_t> const& assetHandles, std::string& out)
+	{
+		if (!scene["Scene"])
+		{
+			return false;
+		}
+
+		try
+		{
+			StringTable strings;
+			SceneBinaryHeader header;
+			header.sceneName = strings.Intern(scene["Scene"].as<std::string>());
+
+			if (YAML::Node renderSettings = scene["RenderSettings"])
+			{
+				header.hasRenderSettings = 1;
+				header.bloom = renderSettings["BloomBool"].as<bool>();
+				header.bloomThreshold = renderSettings["BloomThreshold"].as<float>();
+				header.bloomScale = renderSettings["BloomScale"].as<float>();
+				header.bloomKnee = renderSettings["BloomKnee"].as<float>();
+				header.exposure = renderSettings["Exposure"].as<float>();
+			}
+
+			// Group every entity's components into one table per component type
+			std::vector<uint64_t> entityIDs;
+			std::vector<TableBuilder> tables;
+			std::unordered_map<std::string, size_t> tableIndices;
+			std::string scripts;
+			for (YAML::Node const& entity : scene["Entities"])
+			{
+				uint32_t const entityIndex = static_cast<uint32_t>(entityIDs.size());
+				entityIDs.push_back(entity["EntityID"].as<uint64_t>());
+
+				for (auto it = entity.begin(); it != entity.end(); ++it)
+				{
+					std::string key = it->first.as<std::string>();
+					if (key == "EntityID")
+					{
+						continue;
+					}
+
+					if (key == "ScriptComponent")
+					{
+						YAML::Emitter emitter;
+						emitter << it->second;
+						Put(scripts, entityIndex);
+						Put(scripts, strings.Intern(emitter.c_str()));
+						++header.scriptCount;
+						continue;
+					}
+
+					auto [table, inserted] = tableIndices.try_emplace(key, tables.size());
+					if (inserted)
+					{
+						TableBuilder& builder = tables.emplace_back();
+						builder.name = strings.Intern(key);
+						rttr::type type = rttr::type::get_by_name(key);
+						if (type.is_valid())
+						{
+							BuildSchema(type, builder.schema, strings);
+						}
+					}
+					tables[table->second].entities.push_back(entityIndex);
+					tables[table->second].rows.push_back(it->second);
+				}
+			}
+
+			std::string tableBytes;
+			for (TableBuilder const& table : tables)
+			{
+				WriteTable(tableBytes, table, strings);
+			}
+
+			header.stringCount = static_cast<uint32_t>(strings.GetStrings().size());
+			header.entityCount = static_cast<uint32_t>(entityIDs.size());
+			header.assetCount = static_cast<uint32_t>(assetHandles.size());
+			header.tableCount = static_cast<uint32_t>(tables.size());
+
+			out.clear();
+			Put(out, header);
+			for (std::string const& string : strings.GetStrings())
+			{
+				Put(out, static_cast<uint32_t>(string.size()));
+				out += string;
+			}
+			out.append(reinterpret_cast<const char*>(entityIDs.data()), entityIDs.size() * sizeof(uint64_t));
+			out.append(reinterpret_cast<const char*>(assetHandles.data()), assetHandles.size() * sizeof(uint64_t));
+			out += tableBytes;
+			out += scripts;
+		}
+		catch (YAML::Exception const& e)
+		{
+			BOREALIS_CORE_ERROR("Failed to convert scene to binary: {}", e.what());
+			return false;
+		}
+
+		return true;
+	}
+
+	bool SceneBinaryReader::Open()
+	{
+		Cursor cursor(mData);
+		if (!cursor.Read(mHeader) || mHeader.magic != SceneBinaryHeader::Magic || mHeader.version != SceneBinaryHeader::Version)
+		{
+			return false;
+		}
+
+		if (cursor.Remaining() / sizeof(uint32_t) < mHeader.stringCount)
+		{
+			return false;
+		}
+		mStrings.resize(mHeader.stringCount);
+		for (std::string_view& string : mStrings)
+		{
+			uint32_t size = 0;
+			if (!cursor.Read(size) || !cursor.ReadBytes(size, string))
+			{
+				return false;
+			}
+		}
+
+		if (mHeader.sceneName >= mStrings.size() ||
+			!cursor.ReadArray(mHeader.entityCount, mEntityIDs) ||
+			!cursor.ReadArray(mHeader.assetCount, mAssetHandles))
+		{
+			return false;
+		}
+
+		if (cursor.Remaining() / (3 * sizeof(uint32_t)) < mHeader.tableCount)
+		{
+			return false;
+		}
+		mTables.resize(mHeader.tableCount);
+		for (SceneComponentTable& table : mTables)
+		{
+			uint32_t name = 0;
+			uint32_t rows = 0;
+			uint64_t columnBytes = 0;
+			if (!cursor.Read(name) || name >= mStrings.size() || !cursor.Read(rows) ||
+				!ReadSchema(cursor, table.schema, mStrings.size()) || !cursor.ReadArray(rows, table.entities) ||
+				!cursor.Read(columnBytes) || columnBytes > cursor.Remaining() || !cursor.ReadBytes(static_cast<size_t>(columnBytes), table.columns))
+			{
+				return false;
+			}
+			table.name = mStrings[name];
+
+			for (uint32_t entity : table.entities)
+			{
+				if (entity >= mHeader.entityCount)
+				{
+					return false;
+				}
+			}
+		}
+
+		if (cursor.Remaining() / (2 * sizeof(uint32_t)) < mHeader.scriptCount)
+		{
+			return false;
+		}
+		mScripts.resize(mHeader.scriptCount);
+		for (SceneBinaryScript& script : mScripts)
+		{
+			uint32_t source = 0;
+			if (!cursor.Read(script.entity) || !cursor.Read(source) || script.entity >= mHeader.entityCount || source >= mStrings.size())
+			{
+				return false;
+			}
+			script.source = mStrings[source];
+		}
+
+		return !cursor.Failed();
+	}
+
+	SceneComponentTable const* SceneBinaryReader::FindTable(std::string_view name) const
+	{
+		for (SceneComponentTable const& table : mTables)
+		{
+			if (table.name == name)
+			{
+				return &table;
+			}
+		}
+		return nullptr;
+	}
+
+	bool SceneBinaryReader::ReadColumns(SceneComponentTable const& table, rttr::type const& type, std::vector<PropertyAccessor> const& accessors,
+		std::span<ReflectionInstance> instances, std::span<void* const> objects) const
+	{
+		if (instances.size() != table.entities.size() || objects.size() != table.entities.size())
+		{
+			return false;
+		}
+
+		Cursor cursor(table.columns);
+		size_t const rows = instances.size();
+		for (ScenePropertySchema const& column : table.schema)
+		{
+			std::string_view presence;
+			if (!cursor.ReadBytes((rows + 7) / 8, presence))
+			{
+				return false;
+			}
+
+			// Plain members stored the way the scene was written are read in place
+			std::string_view name = mStrings[column.name];
+			auto accessor = std::find_if(accessors.begin(), accessors.end(), [name](PropertyAccessor const& a) { return a.name == name; });
+			if (accessor != accessors.end() && accessor->IsDirect() && accessor->kind == column.kind)
+			{
+				for (size_t row = 0; row < rows; ++row)
+				{
+					if (presence[row / 8] & (1 << (row % 8)))
+					{
+						ReadDirect(cursor, *accessor, objects[row]);
+					}
+				}
+				continue;
+			}
+
+			// Looked up once per column rather than once per entity
+			rttr::property prop = type.get_property(ToName(name));
+			for (size_t row = 0; row < rows; ++row)
+			{
+				if (presence[row / 8] & (1 << (row % 8)))
+				{
+					ReadProperty(cursor, column, &prop, instances[row], mStrings);
+				}
+			}
+		}
+
+		return !cursor.Failed();
+	}
+}
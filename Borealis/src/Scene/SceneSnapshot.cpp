@@ -0,0 +1,188 @@
+/******************************************************************************
+/*!
+\file       SceneSnapshot.cpp
+\author     Chua Zheng Yang
+\par        email: c.zhengyang\@digipen.edu
+\date       October 17, 2026
+\brief      Implements the snapshot of a scene's registry that play mode is
+			entered from and restored to
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#include <BorealisPCH.hpp>
+#include <Scene/SceneSnapshot.hpp>
+#include <Scene/Scene.hpp>
+#include <Scene/Components.hpp>
+#include <Core/LoggerSystem.hpp>
+
+namespace Borealis
+{
+	template<typename... Components>
+	std::unordered_map<entt::id_type, SceneSnapshot::ComponentType> SceneSnapshot::MakeComponentTypes()
+	{
+		return { { entt::type_hash<Components>::value(), MakeComponentType<Components>() }... };
+	}
+
+	std::unordered_map<entt::id_type, SceneSnapshot::ComponentType>& SceneSnapshot::GetComponentTypes()
+	{
+		// Every component the engine puts in a scene registry, other modules register their own
+		static std::unordered_map<entt::id_type, ComponentType> componentTypes = MakeComponentTypes<
+			IDComponent,
+			TagComponent,
+			ActiveTag,
+			TransformComponent,
+			SpriteRendererComponent,
+			CircleRendererComponent,
+			CameraComponent,
+			NativeScriptComponent,
+			MeshFilterComponent,
+			MeshRendererComponent,
+			SkinnedMeshRendererComponent,
+			AnimatorComponent,
+			UIAnimatorComponent,
+			RigidbodyComponent,
+			BoxColliderComponent,
+			SphereColliderComponent,
+			CapsuleColliderComponent,
+			CylinderColliderComponent,
+			ColliderComponent,
+			CharacterControllerComponent,
+			LightComponent,
+			TextComponent,
+			ScriptComponent,
+			AudioSourceComponent,
+			AudioListenerComponent,
+			BehaviourTreeComponent,
+			OutLineComponent,
+			CanvasComponent,
+			CanvasRendererComponent,
+			ParticleSystemComponent,
+			ButtonComponent>();
+		return componentTypes;
+	}
+
+	void SceneSnapshot::Capture(Scene& scene)
+	{
+		PROFILE_FUNCTION();
+
+		Clear();
+		entt::registry& registry = scene.mRegistry;
+
+		for (auto [entity] : registry.storage<entt::entity>().each())
+		{
+			mRegistry.create(entity);
+		}
+
+		auto& componentTypes = GetComponentTypes();
+		for (auto& [id, componentType] : componentTypes)
+		{
+			componentType.copy(mRegistry, registry);
+		}
+
+		// Anything else in the registry would silently keep its play mode state after Restore
+		for (auto [id, storage] : registry.storage())
+		{
+			if (!storage.empty() && storage.type() != entt::type_id<entt::entity>() && !componentTypes.contains(id))
+			{
+				BOREALIS_CORE_WARN("SceneSnapshot: {} is not registered, play mode will not restore it", storage.type().name());
+			}
+		}
+
+		mEntityMap = scene.mEntityMap;
+		mName = scene.mName;
+		mScenePath = scene.mScenePath;
+		mViewportWidth = scene.mViewportWidth;
+		mViewportHeight = scene.mViewportHeight;
+		mRenderConfig = scene.mRenderGraph.sceneRenderConfig;
+		mValid = true;
+	}
+
+	void SceneSnapshot::Restore(Scene& scene)
+	{
+		PROFILE_FUNCTION();
+
+		if (!mValid) return;
+		entt::registry& registry = scene.mRegistry;
+
+		// Drop what play created first, so every captured identifier is free again
+		std::vector<entt::entity> created;
+		for (auto [entity] : registry.storage<entt::entity>().each())
+		{
+			if (!mRegistry.valid(entity)) created.push_back(entity);
+		}
+		registry.destroy(created.begin(), created.end());
+
+		for (auto [entity] : mRegistry.storage<entt::entity>().each())
+		{
+			if (registry.valid(entity)) continue;
+
+			[[maybe_unused]] entt::entity restored = registry.create(entity);
+			BOREALIS_CORE_ASSERT(restored == entity, "Snapshot entity could not be restored under its identifier");
+		}
+		for (auto& [id, componentType] : GetComponentTypes())
+		{
+			componentType.copy(registry, mRegistry);
+		}
+
+		scene.mEntityMap = mEntityMap;
+		scene.mName = mName;
+		scene.mScenePath = mScenePath;
+		scene.mViewportWidth = mViewportWidth;
+		scene.mViewportHeight = mViewportHeight;
+		scene.mRenderGraph.sceneRenderConfig = mRenderConfig;
+
+		// Its nodes refer to renderables as they were at the end of play
+		scene.mRenderBVH.Clear();
+		scene.MarkActiveHierarchyDirty();
+	}
+
+	SceneSnapshotDiff SceneSnapshot::Diff(Scene& scene)
+	{
+		PROFILE_FUNCTION();
+
+		SceneSnapshotDiff diff;
+		if (!mValid) return diff;
+		entt::registry& registry = scene.mRegistry;
+
+		for (auto [entity, id] : registry.storage<IDComponent>().each())
+		{
+			if (!mRegistry.valid(entity)) diff.created.push_back(id.ID);
+		}
+
+		auto& capturedTransforms = mRegistry.storage<TransformComponent>();
+		auto& transforms = registry.storage<TransformComponent>();
+		for (auto [entity, id] : mRegistry.storage<IDComponent>().each())
+		{
+			if (!registry.valid(entity))
+			{
+				diff.destroyed.push_back(id.ID);
+				continue;
+			}
+
+			if (!capturedTransforms.contains(entity) || !transforms.contains(entity)) continue;
+			TransformComponent const& before = capturedTransforms.get(entity);
+			TransformComponent const& after = transforms.get(entity);
+			if (before.Translate != after.Translate || before.Rotation != after.Rotation || before.Scale != after.Scale)
+				diff.moved.push_back(id.ID);
+		}
+
+		for (auto& [id, componentType] : GetComponentTypes())
+		{
+			componentType.diff(registry, mRegistry, diff);
+		}
+		return diff;
+	}
+
+	void SceneSnapshot::Clear()
+	{
+		mRegistry = entt::registry{};
+		mEntityMap.clear();
+		mName.clear();
+		mScenePath.clear();
+		mValid = false;
+	}
+}
@@ -32,10 +32,168 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include <Core/Project.hpp>
 #include <Audio/AudioEngine.hpp>
 #include <Core/Utils.hpp>
+#include <Scene/SceneBinary.hpp>
 #include <openssl/evp.h>
+#include <charconv>
 namespace Borealis
 {
 
+	namespace
+	{
+		using BenchmarkClock = std::chrono::high_resolution_clock;
+
+		struct BenchmarkTimes
+		{
+			BenchmarkClock::duration reflectedAccess{};
+			BenchmarkClock::duration cachedAccess{};
+			BenchmarkClock::duration reflectedSerialise{};
+			BenchmarkClock::duration cachedSerialise{};
+		};
+
+		double PerSecond(uint64_t count, BenchmarkClock::duration elapsed)
+		{
+			double seconds = std::chrono::duration<double>(elapsed).count();
+			return seconds > 0.0 ? static_cast<double>(count) / seconds : 0.0;
+		}
+
+		/*!***********************************************************************
+			\brief
+				Folds every byte of a value into the checksum, so neither path
+				can skip reading the whole value
+		*************************************************************************/
+		uint64_t FoldBytes(void const* data, size_t size)
+		{
+			uint64_t sum = 0;
+			unsigned char const* bytes = static_cast<unsigned char const*>(data);
+			for (size_t i = 0; i < size; ++i) sum += bytes[i];
+			return sum;
+		}
+
+		template<typename T>
+		uint64_t FoldValue(rttr::variant const& value)
+		{
+			return FoldBytes(&value.get_value<T>(), sizeof(T));
+		}
+
+		/*!***********************************************************************
+			\brief
+				Folds a value read through rttr, the plain kinds byte by byte
+				like a direct read, anything else by whether it was read
+		*************************************************************************/
+		uint64_t FoldVariant(rttr::variant const& value, ScenePropertyKind kind)
+		{
+			switch (kind)
+			{
+			case ScenePropertyKind::Int:	return FoldValue<int>(value);
+			case ScenePropertyKind::Float:	return FoldValue<float>(value);
+			case ScenePropertyKind::Bool:	return FoldValue<bool>(value);
+			case ScenePropertyKind::UInt8:	return FoldValue<unsigned char>(value);
+			case ScenePropertyKind::Int8:	return FoldValue<char>(value);
+			case ScenePropertyKind::UInt16:	return FoldValue<unsigned short>(value);
+			case ScenePropertyKind::Int16:	return FoldValue<short>(value);
+			case ScenePropertyKind::UInt32:	return FoldValue<unsigned>(value);
+			case ScenePropertyKind::Int64:	return FoldValue<long long>(value);
+			case ScenePropertyKind::UInt64:	return FoldValue<unsigned long long>(value);
+			case ScenePropertyKind::UUID:	return FoldValue<UUID>(value);
+			case ScenePropertyKind::Double:	return FoldValue<double>(value);
+			case ScenePropertyKind::Vec2:	return FoldValue<glm::vec2>(value);
+			case ScenePropertyKind::Vec3:	return FoldValue<glm::vec3>(value);
+			case ScenePropertyKind::Vec4:	return FoldValue<glm::vec4>(value);
+			case ScenePropertyKind::Bitset:	return FoldValue<Bitset32>(value);
+			default:						return value.is_valid();
+			}
+		}
+
+		/*!***********************************************************************
+			\brief
+				Runs both paths over every component of one type
+			\return
+				Properties of the type in the scene
+		*************************************************************************/
+		template<typename Component>
+		uint64_t BenchmarkComponent(entt::registry& registry, uint32_t passes, BenchmarkTimes& times, uint64_t& sink)
+		{
+			auto& storage = registry.storage<Component>();
+			if (storage.empty()) return 0;
+			auto const& accessors = PropertyAccessorCache::Get<Component>();
+
+			auto start = BenchmarkClock::now();
+			for (uint32_t pass = 0; pass < passes; ++pass)
+			{
+				for (Component& component : storage)
+				{
+					// Accessors list the properties in the same order, only their kind is used
+					ReflectionInstance rInstance(component);
+					size_t index = 0;
+					for (auto& prop : rInstance.get_type().get_properties())
+					{
+						sink += FoldVariant(prop.get_value(rInstance), accessors[index++].kind);
+					}
+				}
+			}
+			times.reflectedAccess += BenchmarkClock::now() - start;
+
+			start = BenchmarkClock::now();
+			for (uint32_t pass = 0; pass < passes; ++pass)
+			{
+				for (Component& component : storage)
+				{
+					ReflectionInstance rInstance(component);
+					for (PropertyAccessor const& accessor : accessors)
+					{
+						if (accessor.IsDirect())
+						{
+							sink += FoldBytes(reinterpret_cast<char const*>(&component) + accessor.offset, accessor.size);
+						}
+						else
+						{
+							sink += FoldVariant(accessor.property.get_value(rInstance), accessor.kind);
+						}
+					}
+				}
+			}
+			times.cachedAccess += BenchmarkClock::now() - start;
+
+			start = BenchmarkClock::now();
+			for (uint32_t pass = 0; pass < passes; ++pass)
+			{
+				YAML::Emitter out;
+				out << YAML::BeginSeq;
+				for (Component& component : storage)
+				{
+					ReflectionInstance rInstance(component);
+					out << YAML::BeginMap << YAML::Key << rInstance.get_type().get_name().to_string() << YAML::BeginMap;
+					for (auto prop : rInstance.get_type().get_properties())
+					{
+						SerializeProperty(out, prop, rInstance);
+					}
+					out << YAML::EndMap << YAML::EndMap;
+				}
+				out << YAML::EndSeq;
+				sink += out.size();
+			}
+			times.reflectedSerialise += BenchmarkClock::now() - start;
+
+			start = BenchmarkClock::now();
+			for (uint32_t pass = 0; pass < passes; ++pass)
+			{
+				YAML::Emitter out;
+				out << YAML::BeginSeq;
+				for (Component& component : storage)
+				{
+					out << YAML::BeginMap;
+					SerializeComponent(out, component);
+					out << YAML::EndMap;
+				}
+				out << YAML::EndSeq;
+				sink += out.size();
+			}
+			times.cachedSerialise += BenchmarkClock::now() - start;
+
+			return accessors.size() * storage.size();
+		}
+	}
+
 	struct ScriptInitialData
 	{
 		Ref<ScriptInstance> scriptInstance;
@@ -910,6 +1068,206 @@ namespace Borealis
 	}
 
 
+	void Serialiser::DeserialiseScriptComponent(YAML::Node const& scriptComponent, Entity& entity)
+	{
+		auto& sc = entity.AddComponent<ScriptComponent>();
+		for (const auto& script : scriptComponent)
+		{
+			std::string scriptName = script.first.as<std::string>();
+			auto scriptInstance = MakeRef<ScriptInstance>(ScriptingSystem::GetScriptClass(scriptName));
+			scriptInstance->Init(entity.GetUUID()); // Initialise the script instance (set the entity reference
+			sc.AddScript(scriptName, scriptInstance);
+
+			const YAML::Node& fields = script.second;
+			if (fields) {
+				for (const auto& field : fields) {
+
+
+					// Each field will have a name and a corresponding node
+					std::string fieldName = field.first.as<std::string>();
+					const YAML::Node& fieldData = field.second;
+					fieldData["Type"].as<std::string>();
+
+
+					if (scriptInstance->GetScriptClass()->mFields.find(fieldName) == scriptInstance->GetScriptClass()->mFields.end())
+					{
+						BOREALIS_CORE_WARN("Field not in script", fieldName, scriptName);
+						continue;
+					}
+					ScriptField scriptField = scriptInstance->GetScriptClass()->mFields[fieldName];
+
+					if ((scriptField.isPrivate() && !scriptField.hasSerializeField(scriptInstance->GetMonoClass()) || scriptField.hasHideInInspector(scriptInstance->GetMonoClass())))
+					{
+						continue;
+					}
+
+					if (fieldData["Type"].as<std::string>() == "AudioClip")
+					{
+						std::string data = fieldData["Data"].as<std::string>();
+						MonoObject* field = nullptr;
+						InitAudioObject(field, AudioEngine::StringToGuid(data), fieldData["Type"].as<std::string>());
+						scriptInstance->SetFieldValue(fieldName, field);
+						
+						continue;
+					}
+
+
+					if (fieldData["Type"].as<std::string>() == "GameObject")
+					{
+						uint64_t data = fieldData["Data"].as<uint64_t>();
+
+						if (sEntityList.find(data) == sEntityList.end())
+						{
+							continue;
+						}
+						MonoObject* field = nullptr;
+						InitGameObject(field, data, fieldData["Type"].as<std::string>());
+						scriptInstance->SetFieldValue(fieldName, field);
+						continue;
+					}
+
+					if (fieldData["Type"].as<std::string>() == "MonoBehaviour")
+					{
+						uint64_t data = fieldData["Data"].as<uint64_t>();
+						if (sEntityList.find(data) == sEntityList.end())
+						{
+							continue;
+						}
+						scriptQueue.push({ scriptInstance, data, fieldName });
+						continue;
+					}
+
+					if (fieldData["Type"].as<std::string>() == "Bool")
+					{
+						bool data = fieldData["Data"].as<bool>();
+						scriptInstance->SetFieldValue(fieldName, &data);
+						continue;
+					}
+
+					if (fieldData["Type"].as<std::string>() == "Float")
+					{
+						float data = fieldData["Data"].as<float>();
+						scriptInstance->SetFieldValue(fieldName, &data);
+						continue;
+					}
+
+					if (fieldData["Type"].as<std::string>() == "Int")
+					{
+						int data = fieldData["Data"].as<int>();
+						scriptInstance->SetFieldValue(fieldName, &data);
+						continue;
+					}
+
+					if (fieldData["Type"].as<std::string>() == "String")
+					{
+						std::string data = fieldData["Data"].as<std::string>();
+						scriptInstance->SetFieldValue(fieldName, &data);
+						continue;
+					}
+
+					if (fieldData["Type"].as<std::string>() == "Vector2")
+					{
+						glm::vec2 data = fieldData["Data"].as<glm::vec2>();
+						scriptInstance->SetFieldValue(fieldName, &data);
+						continue;
+					}
+
+					if (fieldData["Type"].as<std::string>() == "Vector3")
+					{
+						glm::vec3 data = fieldData["Data"].as<glm::vec3>();
+						scriptInstance->SetFieldValue(fieldName, &data);
+						continue;
+					}
+
+					if (fieldData["Type"].as<std::string>() == "Vector4")
+					{
+						glm::vec4 data = fieldData["Data"].as<glm::vec4>();
+						scriptInstance->SetFieldValue(fieldName, &data);
+						continue;
+					}
+
+					if (fieldData["Type"].as<std::string>() == "UChar")
+					{
+						unsigned char data = static_cast<unsigned char>(fieldData["Data"].as<unsigned>());
+						scriptInstance->SetFieldValue(fieldName, &data);
+						continue;
+					}
+
+					if (fieldData["Type"].as<std::string>() == "Char")
+					{
+						char data = fieldData["Data"].as<char>();
+						scriptInstance->SetFieldValue(fieldName, &data);
+						continue;
+					}
+
+					if (fieldData["Type"].as<std::string>() == "UShort")
+					{
+						unsigned short data = fieldData["Data"].as<unsigned short>();
+						scriptInstance->SetFieldValue(fieldName, &data);
+						continue;
+					}
+
+					if (fieldData["Type"].as<std::string>() == "Short")
+					{
+						short data = fieldData["Data"].as<short>();
+						scriptInstance->SetFieldValue(fieldName, &data);
+						continue;
+					}
+
+					if (fieldData["Type"].as<std::string>() == "UInt")
+					{
+						unsigned data = fieldData["Data"].as<unsigned>();
+						scriptInstance->SetFieldValue(fieldName, &data);
+						continue;
+					}
+
+					if (fieldData["Type"].as<std::string>() == "Long")
+					{
+						long long data = fieldData["Data"].as<long long>();
+						scriptInstance->SetFieldValue(fieldName, &data);
+						continue;
+					}
+
+					if (fieldData["Type"].as<std::string>() == "ULong")
+					{
+						unsigned long long data = fieldData["Data"].as<unsigned long long>();
+						scriptInstance->SetFieldValue(fieldName, &data);
+						continue;
+					}
+
+					if (fieldData["Type"].as<std::string>() == "Double")
+					{
+						double data = fieldData["Data"].as<double>();
+						scriptInstance->SetFieldValue(fieldName, &data);
+						continue;
+					}
+
+					if (scriptInstance->GetScriptClass()->mFields[fieldName].isAssetField())
+					{
+						uint64_t data = fieldData["Data"].as<uint64_t>();
+						MonoObject* field = nullptr;
+						InitGameObject(field, data, fieldData["Type"].as<std::string>());
+						scriptInstance->SetFieldValue(fieldName, field);
+						continue;
+					}
+
+					if (scriptInstance->GetScriptClass()->mFields[fieldName].isNativeComponent())
+					{
+						uint64_t data = fieldData["Data"].as<uint64_t>();
+						if (sEntityList.find(data) == sEntityList.end())
+						{
+							continue;
+						}
+						MonoObject* field = nullptr;
+						InitGameObject(field, data, fieldData["Type"].as<std::string>());
+						scriptInstance->SetFieldValue(fieldName, field);
+						continue;
+					}
+				}
+			}
+		}
+	}
+
 	entt::entity Serialiser::DeserialiseEntity(YAML::detail::iterator_value& entity, entt::registry& registry, UUID& uuid)
 	{
 
@@ -952,202 +1310,7 @@ namespace Borealis
 		auto scriptComponent = entity["ScriptComponent"];
 		if (scriptComponent)
 		{
-			auto& sc = BorealisEntity.AddComponent<ScriptComponent>();
-			for (const auto& script : scriptComponent)
-			{
-				std::string scriptName = script.first.as<std::string>();
-				auto scriptInstance = MakeRef<ScriptInstance>(ScriptingSystem::GetScriptClass(scriptName));
-				scriptInstance->Init(BorealisEntity.GetUUID()); // Initialise the script instance (set the entity reference
-				sc.AddScript(scriptName, scriptInstance);
-
-				const YAML::Node& fields = script.second;
-				if (fields) {
-					for (const auto& field : fields) {
-
-
-						// Each field will have a name and a corresponding node
-						std::string fieldName = field.first.as<std::string>();
-						const YAML::Node& fieldData = field.second;
-						fieldData["Type"].as<std::string>();
-
-
-						if (scriptInstance->GetScriptClass()->mFields.find(fieldName) == scriptInstance->GetScriptClass()->mFields.end())
-						{
-							BOREALIS_CORE_WARN("Field not in script", fieldName, scriptName);
-							continue;
-						}
-						ScriptField scriptField = scriptInstance->GetScriptClass()->mFields[fieldName];
-
-						if ((scriptField.isPrivate() && !scriptField.hasSerializeField(scriptInstance->GetMonoClass()) || scriptField.hasHideInInspector(scriptInstance->GetMonoClass())))
-						{
-							continue;
-						}
-
-						if (fieldData["Type"].as<std::string>() == "AudioClip")
-						{
-							std::string data = fieldData["Data"].as<std::string>();
-							MonoObject* field = nullptr;
-							InitAudioObject(field, AudioEngine::StringToGuid(data), fieldData["Type"].as<std::string>());
-							scriptInstance->SetFieldValue(fieldName, field);
-							
-							continue;
-						}
-
-
-						if (fieldData["Type"].as<std::string>() == "GameObject")
-						{
-							uint64_t data = fieldData["Data"].as<uint64_t>();
-
-							if (sEntityList.find(data) == sEntityList.end())
-							{
-								continue;
-							}
-							MonoObject* field = nullptr;
-							InitGameObject(field, data, fieldData["Type"].as<std::string>());
-							scriptInstance->SetFieldValue(fieldName, field);
-							continue;
-						}
-
-						if (fieldData["Type"].as<std::string>() == "MonoBehaviour")
-						{
-							uint64_t data = fieldData["Data"].as<uint64_t>();
-							if (sEntityList.find(data) == sEntityList.end())
-							{
-								continue;
-							}
-							scriptQueue.push({ scriptInstance, data, fieldName });
-							continue;
-						}
-
-						if (fieldData["Type"].as<std::string>() == "Bool")
-						{
-							bool data = fieldData["Data"].as<bool>();
-							scriptInstance->SetFieldValue(fieldName, &data);
-							continue;
-						}
-
-						if (fieldData["Type"].as<std::string>() == "Float")
-						{
-							float data = fieldData["Data"].as<float>();
-							scriptInstance->SetFieldValue(fieldName, &data);
-							continue;
-						}
-
-						if (fieldData["Type"].as<std::string>() == "Int")
-						{
-							int data = fieldData["Data"].as<int>();
-							scriptInstance->SetFieldValue(fieldName, &data);
-							continue;
-						}
-
-						if (fieldData["Type"].as<std::string>() == "String")
-						{
-							std::string data = fieldData["Data"].as<std::string>();
-							scriptInstance->SetFieldValue(fieldName, &data);
-							continue;
-						}
-
-						if (fieldData["Type"].as<std::string>() == "Vector2")
-						{
-							glm::vec2 data = fieldData["Data"].as<glm::vec2>();
-							scriptInstance->SetFieldValue(fieldName, &data);
-							continue;
-						}
-
-						if (fieldData["Type"].as<std::string>() == "Vector3")
-						{
-							glm::vec3 data = fieldData["Data"].as<glm::vec3>();
-							scriptInstance->SetFieldValue(fieldName, &data);
-							continue;
-						}
-
-						if (fieldData["Type"].as<std::string>() == "Vector4")
-						{
-							glm::vec4 data = fieldData["Data"].as<glm::vec4>();
-							scriptInstance->SetFieldValue(fieldName, &data);
-							continue;
-						}
-
-						if (fieldData["Type"].as<std::string>() == "UChar")
-						{
-							unsigned char data = static_cast<unsigned char>(fieldData["Data"].as<unsigned>());
-							scriptInstance->SetFieldValue(fieldName, &data);
-							continue;
-						}
-
-						if (fieldData["Type"].as<std::string>() == "Char")
-						{
-							char data = fieldData["Data"].as<char>();
-							scriptInstance->SetFieldValue(fieldName, &data);
-							continue;
-						}
-
-						if (fieldData["Type"].as<std::string>() == "UShort")
-						{
-							unsigned short data = fieldData["Data"].as<unsigned short>();
-							scriptInstance->SetFieldValue(fieldName, &data);
-							continue;
-						}
-
-						if (fieldData["Type"].as<std::string>() == "Short")
-						{
-							short data = fieldData["Data"].as<short>();
-							scriptInstance->SetFieldValue(fieldName, &data);
-							continue;
-						}
-
-						if (fieldData["Type"].as<std::string>() == "UInt")
-						{
-							unsigned data = fieldData["Data"].as<unsigned>();
-							scriptInstance->SetFieldValue(fieldName, &data);
-							continue;
-						}
-
-						if (fieldData["Type"].as<std::string>() == "Long")
-						{
-							long long data = fieldData["Data"].as<long long>();
-							scriptInstance->SetFieldValue(fieldName, &data);
-							continue;
-						}
-
-						if (fieldData["Type"].as<std::string>() == "ULong")
-						{
-							unsigned long long data = fieldData["Data"].as<unsigned long long>();
-							scriptInstance->SetFieldValue(fieldName, &data);
-							continue;
-						}
-
-						if (fieldData["Type"].as<std::string>() == "Double")
-						{
-							double data = fieldData["Data"].as<double>();
-							scriptInstance->SetFieldValue(fieldName, &data);
-							continue;
-						}
-
-						if (scriptInstance->GetScriptClass()->mFields[fieldName].isAssetField())
-						{
-							uint64_t data = fieldData["Data"].as<uint64_t>();
-							MonoObject* field = nullptr;
-							InitGameObject(field, data, fieldData["Type"].as<std::string>());
-							scriptInstance->SetFieldValue(fieldName, field);
-							continue;
-						}
-
-						if (scriptInstance->GetScriptClass()->mFields[fieldName].isNativeComponent())
-						{
-							uint64_t data = fieldData["Data"].as<uint64_t>();
-							if (sEntityList.find(data) == sEntityList.end())
-							{
-								continue;
-							}
-							MonoObject* field = nullptr;
-							InitGameObject(field, data, fieldData["Type"].as<std::string>());
-							scriptInstance->SetFieldValue(fieldName, field);
-							continue;
-						}
-					}
-				}
-			}
+			DeserialiseScriptComponent(scriptComponent, BorealisEntity);
 		}
 		return loadedEntity;
 	}
@@ -1193,10 +1356,44 @@ namespace Borealis
 		return true;
 	}
 
+	/*!***********************************************************************
+		\brief
+			Collects every scalar that reads as an asset handle. Anything else
+			that parses, such as entity ids, is filtered out by the registry
+	*************************************************************************/
+	static void CollectAssetHandles(YAML::Node const& node, std::vector<AssetHandle>& handles)
+	{
+		if (node.IsScalar())
+		{
+			std::string const& scalar = node.Scalar();
+			uint64_t handle = 0;
+			auto [end, error] = std::from_chars(scalar.data(), scalar.data() + scalar.size(), handle);
+			if (error == std::errc() && end == scalar.data() + scalar.size() && handle != 0)
+			{
+				handles.push_back(handle);
+			}
+		}
+		else if (node.IsMap())
+		{
+			for (auto it = node.begin(); it != node.end(); ++it)
+			{
+				CollectAssetHandles(it->second, handles);
+			}
+		}
+		else if (node.IsSequence())
+		{
+			for (YAML::Node const& child : node)
+			{
+				CollectAssetHandles(child, handles);
+			}
+		}
+	}
+
 	bool Serialiser::DeserialiseScene(const std::string& filepath, bool encrypt)
 	{
 		std::stringstream ss;
 		TagList::Clear();
+		mScene->MarkActiveHierarchyDirty();
 
 		if (encrypt)
 		{
@@ -1206,13 +1403,24 @@ namespace Borealis
 		}
 		else
 		{
-			std::ifstream inStream(filepath);
+			std::ifstream inStream(filepath, std::ios::binary);
 			ss << inStream.rdbuf();
 			inStream.close();
 		}
 		
+		// Builds ship the binary form, the editor keeps working on YAML
+		std::string contents = ss.str();
+		if (SceneBinary::IsBinary(contents))
+		{
+			if (!DeserialiseSceneBinary(contents))
+			{
+				BOREALIS_CORE_ERROR("Invalid binary scene file: {}", filepath);
+				return false;
+			}
+			return true;
+		}
 
-		YAML::Node data = YAML::Load(ss.str());
+		YAML::Node data = YAML::Load(contents);
 		if (!data["Scene"])
 		{
 			BOREALIS_CORE_ERROR("Scene not found in file: {}", filepath);
@@ -1221,6 +1429,13 @@ namespace Borealis
 
 		std::string sceneName = data["Scene"].as<std::string>();
 		BOREALIS_CORE_INFO("Deserialising scene: {}", sceneName);
+
+		// Stream every referenced asset in parallel, components then pick them up as they are ready or wait on them.
+		// They stay pinned while the scene is loaded so budgets never evict them
+		std::vector<AssetHandle> assetHandles;
+		CollectAssetHandles(data["Entities"], assetHandles);
+		Project::GetEditorAssetsManager()->PinSceneAssets(assetHandles);
+		Project::GetEditorAssetsManager()->PrefetchAssets(assetHandles);
 		// Deserialise scene info such as viewport sizes
 		mScene->ResizeViewport(1920, 1080);
 		auto entities = data["Entities"];
@@ -1243,20 +1458,40 @@ namespace Borealis
 				mScene->mEntityMap[uuid] = DeserialiseEntity(entity, mScene->GetRegistry(), *reinterpret_cast<UUID*>(&uuid));
 				Entity entity2(mScene->mEntityMap[uuid], mScene.get());
 			}
-			while (!scriptQueue.empty())
-			{
-				auto& scriptData = scriptQueue.front();
-				Entity targetEntity = mScene->GetEntityByUUID(scriptData.targetUUID);
-				auto& scriptComponent = targetEntity.GetComponent<ScriptComponent>();
-				auto script = scriptComponent.mScripts.find(scriptData.scriptInstance->GetScriptClass()->mFields[scriptData.scriptFieldName].mFieldClassName());
-				scriptData.scriptInstance->SetFieldValue(scriptData.scriptFieldName, script->second->GetInstance());
-				scriptQueue.pop();
-			}
+			ResolveScriptReferences();
 		}
 
 		sEntityList.clear();
+		RemoveInvalidChildren();
 
-		// Delete invalid children
+		auto renderSettings = data["RenderSettings"];
+		if (renderSettings)
+		{
+			mScene->GetSceneRenderConfig().bloom = renderSettings["BloomBool"].as<bool>();
+			mScene->GetSceneRenderConfig().ubo.threshold = renderSettings["BloomThreshold"].as<float>();
+			mScene->GetSceneRenderConfig().ubo.bloomScale = renderSettings["BloomScale"].as<float>();
+			mScene->GetSceneRenderConfig().ubo.knee = renderSettings["BloomKnee"].as<float>();
+			mScene->GetSceneRenderConfig().ubo.exposure = renderSettings["Exposure"].as<float>();
+		}
+
+		return true;
+	}
+
+	void Serialiser::ResolveScriptReferences()
+	{
+		while (!scriptQueue.empty())
+		{
+			auto& scriptData = scriptQueue.front();
+			Entity targetEntity = mScene->GetEntityByUUID(scriptData.targetUUID);
+			auto& scriptComponent = targetEntity.GetComponent<ScriptComponent>();
+			auto script = scriptComponent.mScripts.find(scriptData.scriptInstance->GetScriptClass()->mFields[scriptData.scriptFieldName].mFieldClassName());
+			scriptData.scriptInstance->SetFieldValue(scriptData.scriptFieldName, script->second->GetInstance());
+			scriptQueue.pop();
+		}
+	}
+
+	void Serialiser::RemoveInvalidChildren()
+	{
 		for (auto[id, entity] : mScene->mEntityMap)
 		{
 			auto& transform = mScene->GetRegistry().get<TransformComponent>(entity);
@@ -1276,15 +1511,197 @@ namespace Borealis
 				transform.ChildrenID.erase(transform.ChildrenID.begin() + *iterator);
 			}
 		}
+	}
 
-		auto renderSettings = data["RenderSettings"];
-		if (renderSettings)
+	PropertyBenchmark Serialiser::BenchmarkProperties(Scene& scene, uint32_t passes)
+	{
+		PROFILE_FUNCTION();
+
+		entt::registry& registry = scene.GetRegistry();
+		BenchmarkTimes times;
+		uint64_t sink = 0;
+
+		PropertyBenchmark result;
+		result.properties += BenchmarkComponent<TransformComponent>(registry, passes, times, sink);
+		result.properties += BenchmarkComponent<SpriteRendererComponent>(registry, passes, times, sink);
+		result.properties += BenchmarkComponent<CircleRendererComponent>(registry, passes, times, sink);
+		result.properties += BenchmarkComponent<CameraComponent>(registry, passes, times, sink);
+		result.properties += BenchmarkComponent<MeshRendererComponent>(registry, passes, times, sink);
+		result.properties += BenchmarkComponent<RigidbodyComponent>(registry, passes, times, sink);
+		result.properties += BenchmarkComponent<LightComponent>(registry, passes, times, sink);
+		result.properties += BenchmarkComponent<TextComponent>(registry, passes, times, sink);
+		result.properties += BenchmarkComponent<AudioSourceComponent>(registry, passes, times, sink);
+		result.properties += BenchmarkComponent<BoxColliderComponent>(registry, passes, times, sink);
+		result.properties += BenchmarkComponent<SphereColliderComponent>(registry, passes, times, sink);
+		result.properties += BenchmarkComponent<CapsuleColliderComponent>(registry, passes, times, sink);
+		result.properties += BenchmarkComponent<CylinderColliderComponent>(registry, passes, times, sink);
+		result.properties += BenchmarkComponent<CharacterControllerComponent>(registry, passes, times, sink);
+		result.properties += BenchmarkComponent<OutLineComponent>(registry, passes, times, sink);
+		result.properties += BenchmarkComponent<CanvasComponent>(registry, passes, times, sink);
+		result.properties += BenchmarkComponent<CanvasRendererComponent>(registry, passes, times, sink);
+		result.properties += BenchmarkComponent<ParticleSystemComponent>(registry, passes, times, sink);
+		result.properties += BenchmarkComponent<ButtonComponent>(registry, passes, times, sink);
+
+		uint64_t total = result.properties * passes;
+		result.reflectedAccess = PerSecond(total, times.reflectedAccess);
+		result.cachedAccess = PerSecond(total, times.cachedAccess);
+		result.reflectedSerialise = PerSecond(total, times.reflectedSerialise);
+		result.cachedSerialise = PerSecond(total, times.cachedSerialise);
+
+		// Keeps the reads from being optimised away
+		BOREALIS_CORE_TRACE("Property benchmark checksum {0}", sink);
+		return result;
+	}
+
+	bool Serialiser::BuildSceneBinary(const std::string& filepath, std::string& out)
+	{
+		std::ifstream inStream(filepath, std::ios::binary);
+		if (!inStream)
 		{
-			mScene->GetSceneRenderConfig().bloom = renderSettings["BloomBool"].as<bool>();
-			mScene->GetSceneRenderConfig().ubo.threshold = renderSettings["BloomThreshold"].as<float>();
-			mScene->GetSceneRenderConfig().ubo.bloomScale = renderSettings["BloomScale"].as<float>();
-			mScene->GetSceneRenderConfig().ubo.knee = renderSettings["BloomKnee"].as<float>();
-			mScene->GetSceneRenderConfig().ubo.exposure = renderSettings["Exposure"].as<float>();
+			return false;
+		}
+		std::stringstream ss;
+		ss << inStream.rdbuf();
+
+		YAML::Node data = YAML::Load(ss.str());
+		std::vector<AssetHandle> assetHandles;
+		CollectAssetHandles(data["Entities"], assetHandles);
+		std::vector<uint64_t> handles(assetHandles.begin(), assetHandles.end());
+		return SceneBinary::Write(data, handles, out);
+	}
+
+	template<typename Component>
+	void Serialiser::DeserialiseComponentTable(SceneBinaryReader const& reader, std::vector<entt::entity> const& entities)
+	{
+		auto type = rttr::type::get<Component>();
+		SceneComponentTable const* table = reader.FindTable(type.get_name().to_string());
+		if (!table)
+		{
+			return;
+		}
+
+		std::vector<entt::entity> owners(table->entities.size());
+		for (size_t row = 0; row < owners.size(); ++row)
+		{
+			owners[row] = entities[table->entities[row]];
+		}
+
+		entt::registry& registry = mScene->GetRegistry();
+		auto& storage = registry.storage<Component>();
+		storage.reserve(storage.size() + owners.size());
+		registry.insert<Component>(owners.begin(), owners.end());
+
+		std::vector<ReflectionInstance> instances;
+		std::vector<void*> objects;
+		instances.reserve(owners.size());
+		objects.reserve(owners.size());
+		for (entt::entity owner : owners)
+		{
+			Component& component = storage.get(owner);
+			mScene->OnComponentAdded(Entity(owner, mScene.get()), component);
+			instances.emplace_back(component);
+			objects.push_back(&component);
+		}
+
+		if (!reader.ReadColumns(*table, type, PropertyAccessorCache::Get<Component>(), instances, objects))
+		{
+			BOREALIS_CORE_WARN("Truncated {} table in binary scene", type.get_name().to_string());
+		}
+	}
+
+	bool Serialiser::DeserialiseSceneBinary(std::string_view data)
+	{
+		PROFILE_FUNCTION();
+
+		SceneBinaryReader reader(data);
+		if (!reader.Open())
+		{
+			return false;
+		}
+
+		BOREALIS_CORE_INFO("Deserialising scene: {}", reader.GetSceneName());
+
+		std::vector<AssetHandle> assetHandles(reader.GetAssetHandles().begin(), reader.GetAssetHandles().end());
+		Project::GetEditorAssetsManager()->PinSceneAssets(assetHandles);
+		Project::GetEditorAssetsManager()->PrefetchAssets(assetHandles);
+		mScene->ResizeViewport(1920, 1080);
+
+		// Entity indices in the file map onto one range of registry entities
+		entt::registry& registry = mScene->GetRegistry();
+		std::vector<entt::entity> entities(reader.GetEntityCount());
+		registry.create(entities.begin(), entities.end());
+
+		std::vector<IDComponent> ids;
+		ids.reserve(entities.size());
+		for (uint32_t index = 0; index < entities.size(); ++index)
+		{
+			uint64_t uuid = reader.GetEntityID(index);
+			ids.emplace_back(uuid);
+			sEntityList.insert(uuid);
+			mScene->mEntityMap[uuid] = entities[index];
+		}
+		registry.storage<IDComponent>().reserve(registry.storage<IDComponent>().size() + ids.size());
+		registry.insert<IDComponent>(entities.begin(), entities.end(), ids.begin());
+
+		// Same order as DeserialiseEntity, so add hooks see the components they expect
+		DeserialiseComponentTable<TagComponent>(reader, entities);
+		DeserialiseComponentTable<TransformComponent>(reader, entities);
+		DeserialiseComponentTable<SpriteRendererComponent>(reader, entities);
+		DeserialiseComponentTable<CircleRendererComponent>(reader, entities);
+		DeserialiseComponentTable<CameraComponent>(reader, entities);
+		DeserialiseComponentTable<MeshFilterComponent>(reader, entities);
+		DeserialiseComponentTable<MeshRendererComponent>(reader, entities);
+		DeserialiseComponentTable<RigidbodyComponent>(reader, entities);
+		DeserialiseComponentTable<LightComponent>(reader, entities);
+		DeserialiseComponentTable<CharacterControllerComponent>(reader, entities);
+		DeserialiseComponentTable<AudioSourceComponent>(reader, entities);
+		DeserialiseComponentTable<AudioListenerComponent>(reader, entities);
+		DeserialiseComponentTable<TextComponent>(reader, entities);
+		DeserialiseComponentTable<SkinnedMeshRendererComponent>(reader, entities);
+		DeserialiseComponentTable<AnimatorComponent>(reader, entities);
+		DeserialiseComponentTable<OutLineComponent>(reader, entities);
+		DeserialiseComponentTable<CanvasComponent>(reader, entities);
+		DeserialiseComponentTable<CanvasRendererComponent>(reader, entities);
+		DeserialiseComponentTable<ParticleSystemComponent>(reader, entities);
+		DeserialiseComponentTable<BoxColliderComponent>(reader, entities);
+		DeserialiseComponentTable<SphereColliderComponent>(reader, entities);
+		DeserialiseComponentTable<CapsuleColliderComponent>(reader, entities);
+		DeserialiseComponentTable<CylinderColliderComponent>(reader, entities);
+		DeserialiseComponentTable<BehaviourTreeComponent>(reader, entities);
+		DeserialiseComponentTable<ButtonComponent>(reader, entities);
+		DeserialiseComponentTable<UIAnimatorComponent>(reader, entities);
+
+		for (uint32_t index = 0; index < entities.size(); ++index)
+		{
+			if (auto* tag = registry.try_get<TagComponent>(entities[index]))
+			{
+				TagList::AddEntity(tag->Tag, ids[index].ID);
+			}
+			if (auto* particleSystem = registry.try_get<ParticleSystemComponent>(entities[index]))
+			{
+				particleSystem->Init();
+			}
+		}
+
+		// Script fields go through mono, so they are kept in the YAML form
+		for (SceneBinaryScript const& script : reader.GetScripts())
+		{
+			Entity entity(entities[script.entity], mScene.get());
+			DeserialiseScriptComponent(YAML::Load(std::string(script.source)), entity);
+		}
+		ResolveScriptReferences();
+
+		sEntityList.clear();
+		RemoveInvalidChildren();
+
+		SceneBinaryHeader const& header = reader.GetHeader();
+		if (header.hasRenderSettings)
+		{
+			mScene->GetSceneRenderConfig().bloom = header.bloom != 0;
+			mScene->GetSceneRenderConfig().ubo.threshold = header.bloomThreshold;
+			mScene->GetSceneRenderConfig().ubo.bloomScale = header.bloomScale;
+			mScene->GetSceneRenderConfig().ubo.knee = header.bloomKnee;
+			mScene->GetSceneRenderConfig().ubo.exposure = header.exposure;
 		}
 
 		return true;
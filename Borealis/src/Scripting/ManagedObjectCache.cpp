@@ -0,0 +1,81 @@
+/******************************************************************************
+/*!
+\file       ManagedObjectCache.cpp
+\author     Chua Zheng Yang
+\par        email: c.zhengyang\@digipen.edu
+\date       October 17, 2026
+\brief      Implements the cache of managed entity wrappers handed to scripts
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#include <BorealisPCH.hpp>
+#include <mono/metadata/object.h>
+#include <mono/metadata/appdomain.h>
+#include <Scripting/ManagedObjectCache.hpp>
+#include <Scripting/ScriptingUtils.hpp>
+
+namespace Borealis
+{
+	std::unordered_map<UUID, std::vector<ManagedObjectCache::CachedObject>> ManagedObjectCache::mObjects;
+
+	MonoObject* ManagedObjectCache::GetWrapper(UUID id, std::string_view className)
+	{
+		std::vector<CachedObject>& wrappers = mObjects[id];
+		for (CachedObject const& wrapper : wrappers)
+		{
+			if (wrapper.className == className)
+			{
+				return mono_gchandle_get_target(wrapper.handle);
+			}
+		}
+
+		// Held by a normal handle rather than pinned, the GC may still move it
+		MonoObject* object = nullptr;
+		InitGameObject(object, id, std::string(className), false);
+		wrappers.push_back({ std::string(className), mono_gchandle_new(object, false) });
+		return object;
+	}
+
+	uint32_t ManagedObjectCache::FillWrapperArray(MonoArray* destination, std::vector<UUID> const& ids, std::string_view className)
+	{
+		// The caller owns the array, nothing managed is allocated once every wrapper exists
+		uintptr_t const capacity = destination ? mono_array_length(destination) : 0;
+		uintptr_t const count = std::min<uintptr_t>(ids.size(), capacity);
+		for (uintptr_t i = 0; i < count; ++i)
+		{
+			mono_array_setref(destination, i, GetWrapper(ids[i], className));
+		}
+		return static_cast<uint32_t>(ids.size());
+	}
+
+	void ManagedObjectCache::Remove(UUID id)
+	{
+		auto it = mObjects.find(id);
+		if (it == mObjects.end())
+		{
+			return;
+		}
+
+		for (CachedObject const& wrapper : it->second)
+		{
+			mono_gchandle_free(wrapper.handle);
+		}
+		mObjects.erase(it);
+	}
+
+	void ManagedObjectCache::Clear()
+	{
+		for (auto& [id, wrappers] : mObjects)
+		{
+			for (CachedObject const& wrapper : wrappers)
+			{
+				mono_gchandle_free(wrapper.handle);
+			}
+		}
+		mObjects.clear();
+	}
+}
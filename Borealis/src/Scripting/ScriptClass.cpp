@@ -93,6 +93,38 @@ namespace Borealis
 		return mono_runtime_invoke(method, instance, params, nullptr);
 	}
 
+	void ScriptClass::ResolveMethods()
+	{
+		// Same order as ScriptMethod
+		static constexpr const char* methodNames[] =
+		{
+			"Awake", "Start", "Update", "LateUpdate", "FixedUpdate", "OnEnable", "OnDisable", "OnDestroy",
+			"OnApplicationQuit", "OnApplicationPause", "OnApplicationFocus", "OnGUI", "OnDrawGizmos",
+			"OnDrawGizmosSelected", "OnValidate", "Reset", "OnBecameVisible", "OnBecameInvisible", "OnPreCull",
+			"OnPreRender", "OnPostRender", "OnRenderObject", "OnWillRenderObject", "OnRenderImage",
+			"OnAudioFilterRead", "OnParticleCollision", "OnJointBreak", "OnAnimatorMove", "OnAnimatorIK",
+			"OnCollisionEnter", "OnCollisionExit", "OnCollisionStay", "OnTriggerEnter", "OnTriggerExit", "OnTriggerStay"
+		};
+		static_assert(std::size(methodNames) == static_cast<size_t>(ScriptMethod::Count));
+
+		mMethodThunks.fill(nullptr);
+		if (!mMonoClass)
+		{
+			return;
+		}
+
+		for (size_t i = 0; i < mMethodThunks.size(); ++i)
+		{
+			int paramCount = i >= static_cast<size_t>(ScriptMethod::OnCollisionEnter) ? 1 : 0;
+			// Only methods the class itself declares, as the name lookup did before
+			MonoMethod* method = mono_class_get_method_from_name(mMonoClass, methodNames[i], paramCount);
+			if (method)
+			{
+				mMethodThunks[i] = mono_method_get_unmanaged_thunk(method);
+			}
+		}
+	}
+
 	MonoClass* ScriptClass::GetMonoClass() const
 	{
 		return mMonoClass;
@@ -17,6 +17,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include <Scripting/ScriptInstance.hpp>
 #include <Scripting/ScriptingUtils.hpp>
 #include <Scripting/ScriptingSystem.hpp>
+#include <Scripting/ManagedObjectCache.hpp>
 #include <mono/metadata/object.h>
 #include <mono/jit/jit.h>
 
@@ -265,68 +266,69 @@ namespace Borealis
 		return ScriptingSystem::GetEnabled(shared_from_this());
 	}
 
-#ifdef _DEB
+#ifdef _WIN32
+#define MONO_THUNK_CALL __stdcall
+#else
+#define MONO_THUNK_CALL
+#endif
+
+	// Signatures of the unmanaged thunks, the instance first and the exception out last
+	using MonoBehaviourThunk = void (MONO_THUNK_CALL*)(MonoObject*, MonoException**);
+	using MonoBehaviourCollisionThunk = void (MONO_THUNK_CALL*)(MonoObject*, MonoObject*, MonoException**);
+
+	/*!***********************************************************************
+		\brief
+			Logs an exception a script method threw, in every configuration
+	*************************************************************************/
+	static void ReportException(MonoException* exception, ScriptClass const& scriptClass, const char* methodName)
+	{
+		MonoObject* toStringException = nullptr;
+		MonoString* description = mono_object_to_string(reinterpret_cast<MonoObject*>(exception), &toStringException);
+		if (!description || toStringException)
+		{
+			BOREALIS_CORE_ERROR("{0}.{1} threw an exception", scriptClass.GetKlassName(), methodName);
+			mono_print_unhandled_exception(reinterpret_cast<MonoObject*>(exception));
+			return;
+		}
+
+		char* text = mono_string_to_utf8(description);
+		BOREALIS_CORE_ERROR("{0}.{1} threw {2}", scriptClass.GetKlassName(), methodName, text);
+		mono_free(text);
+	}
+
 #define DefineMonoBehaviourMethod(methodName) \
 	void ScriptInstance::methodName() \
 	{\
-		if (mScriptClass->GetMethod( #methodName, 0) == nullptr) \
+		auto thunk = reinterpret_cast<MonoBehaviourThunk>(mScriptClass->GetMethodThunk(ScriptMethod::methodName)); \
+		if (thunk == nullptr) \
 		{ \
 			return; \
 		} \
-		MonoObject* exception = nullptr; \
-		mono_runtime_invoke(mScriptClass->GetMethod(#methodName, 0), GetInstance(), nullptr, &exception); \
+		MonoException* exception = nullptr; \
+		thunk(GetInstance(), &exception); \
 		if (exception) \
 		{ \
-			mono_print_unhandled_exception(exception); \
+			ReportException(exception, *mScriptClass, #methodName); \
 		} \
 	}\
 
 #define DefineMonoBehaviourCollision(methodName) \
 	void ScriptInstance::methodName(UUID colliderID) \
 	{\
-		if (mScriptClass->GetMethod(#methodName, 1) == nullptr) \
+		auto thunk = reinterpret_cast<MonoBehaviourCollisionThunk>(mScriptClass->GetMethodThunk(ScriptMethod::methodName)); \
+		if (thunk == nullptr || colliderID == 0) \
 		{ \
 			return; \
 		} \
-		MonoObject* collider; \
-		InitGameObject(collider, colliderID, "Collider", false); \
-		void* params[1]; \
-		params[0] = collider; \
-		MonoObject* exception = nullptr; \
-		mono_runtime_invoke(mScriptClass->GetMethod(#methodName, 1), GetInstance(), params, &exception); \
+		MonoObject* collider = ManagedObjectCache::GetWrapper(colliderID, "Collider"); \
+		MonoException* exception = nullptr; \
+		thunk(GetInstance(), collider, &exception); \
 		if (exception) \
 		{ \
-			mono_print_unhandled_exception(exception); \
-		} \
-	}\
-
-
-#else
-#define DefineMonoBehaviourMethod(methodName) \
-	void ScriptInstance::methodName() \
-	{\
-		if (mScriptClass->GetMethod(#methodName, 0) == nullptr) \
-		{ \
-			return; \
+			ReportException(exception, *mScriptClass, #methodName); \
 		} \
-		mono_runtime_invoke(mScriptClass->GetMethod(#methodName, 0), GetInstance(), nullptr, nullptr); \
 	}\
 
-#define DefineMonoBehaviourCollision(methodName) \
-	void ScriptInstance::methodName(UUID colliderID) \
-	{\
-		if (mScriptClass->GetMethod(#methodName, 1) == nullptr || colliderID == 0) \
-		{ \
-			return; \
-		} \
-		MonoObject* collider; \
-		InitGameObject(collider, colliderID, "Collider", false); \
-		void* params[1]; \
-		params[0] = collider; \
-		mono_runtime_invoke(mScriptClass->GetMethod(#methodName, 1), GetInstance(), params, nullptr); \
-	}\
-
-#endif
 
 	DefineMonoBehaviourMethod(Awake);
 	DefineMonoBehaviourMethod(Start);
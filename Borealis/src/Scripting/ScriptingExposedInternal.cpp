@@ -17,6 +17,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include <Scripting/ScriptingSystem.hpp>
 #include <Scripting/ScriptInstance.hpp>
 #include <Scripting/ScriptingUtils.hpp>
+#include <Scripting/ManagedObjectCache.hpp>
 #include <Scene/SceneManager.hpp>
 #include <Core/UUID.hpp>
 #include <Core/LoggerSystem.hpp>
@@ -163,6 +164,8 @@ namespace Borealis
 
 		BOREALIS_ADD_INTERNAL_CALL(Physics_Raycast);
 		BOREALIS_ADD_INTERNAL_CALL(Physics_RaycastAll);
+		BOREALIS_ADD_INTERNAL_CALL(Physics_CastBatch);
+		BOREALIS_ADD_INTERNAL_CALL(Physics_OverlapBatch);
 
 		BOREALIS_ADD_INTERNAL_CALL(CharacterController_Move);
 		BOREALIS_ADD_INTERNAL_CALL(CharacterController_Jump);
@@ -323,7 +326,7 @@ namespace Borealis
 		auto entity = SceneManager::GetActiveScene()->GetEntityByUUID(*outEntityID);
 		if (entity)
 		{
-			entity.GetComponent<TagComponent>().active = value;
+			entity.SetActive(value);
 		}
 
 		if (value)
@@ -532,7 +535,7 @@ namespace Borealis
 		BOREALIS_CORE_ASSERT(scene, "Scene is null");
 		Entity entity = scene->GetEntityByUUID(entityID);
 		BOREALIS_CORE_ASSERT(entity, "Entity is null");
-		entity.GetComponent<TagComponent>().active = *active;
+		entity.SetActive(*active);
 
 		if (*active)
 		{
@@ -656,33 +659,25 @@ namespace Borealis
 		}
 		*ID = 0;
 	}
-	void Entity_GetEntitiesFromLayer(int32_t layerNum, MonoArray** objectArray)
+	int Entity_GetEntitiesFromLayer(int32_t layerNum, MonoArray* objectArray)
 	{
 		std::unordered_set<UUID> entities;
-		bool output = LayerList::getEntitiesAtLayer(layerNum, &entities);
-		*objectArray = mono_array_new(mono_domain_get(), mono_get_object_class(), entities.size());
-		int counter = 0;
-		for (auto id : entities)
-		{
-			MonoObject* obj;
-			InitGameObject(obj, id, "GameObject");
-			mono_array_set(*objectArray, MonoObject*, counter++, obj);
-		}
+		LayerList::getEntitiesAtLayer(layerNum, &entities);
+		// Sorted so a layer fills the array in the same order however the set iterates
+		std::vector<UUID> ids(entities.begin(), entities.end());
+		std::sort(ids.begin(), ids.end());
+		return static_cast<int>(ManagedObjectCache::FillWrapperArray(objectArray, ids, "GameObject"));
 	}
-	void Entity_GetEntitiesFromTag(MonoString* tag, MonoArray** objectArray)
+	int Entity_GetEntitiesFromTag(MonoString* tag, MonoArray* objectArray)
 	{
 		char* message = mono_string_to_utf8(tag);
 		std::string entityTag = message;
+		mono_free(message);
 		auto List = TagList::getEntitiesAtTag(entityTag);
 
-		*objectArray = mono_array_new(mono_domain_get(), mono_get_object_class(), List.size());
-		int counter = 0;
-		for (auto id : List)
-		{
-			MonoObject* obj;
-			InitGameObject(obj, id, "GameObject");
-			mono_array_set(*objectArray, MonoObject*, counter++, obj);
-		}
+		std::vector<UUID> ids(List.begin(), List.end());
+		std::sort(ids.begin(), ids.end());
+		return static_cast<int>(ManagedObjectCache::FillWrapperArray(objectArray, ids, "GameObject"));
 	}
 	glm::vec3 Input_GetMousePosition()
 	{
@@ -840,7 +835,9 @@ namespace Borealis
 		BOREALIS_CORE_ASSERT(scene, "Scene is null");
 		Entity entity = scene->GetEntityByUUID(uuid);
 		BOREALIS_CORE_ASSERT(entity, "Entity is null");
-		entity.GetComponent<TransformComponent>().Translate = *translation;
+		auto& tc = entity.GetComponent<TransformComponent>();
+		tc.Translate = *translation;
+		tc.SetDirty();
 	}
 	void TransformComponent_GetLocalRotation(UUID uuid, glm::vec3* outRotation)
 	{
@@ -857,7 +854,9 @@ namespace Borealis
 		BOREALIS_CORE_ASSERT(scene, "Scene is null");
 		Entity entity = scene->GetEntityByUUID(uuid);
 		BOREALIS_CORE_ASSERT(entity, "Entity is null");
-		entity.GetComponent<TransformComponent>().Rotation = *rotation;
+		auto& tc = entity.GetComponent<TransformComponent>();
+		tc.Rotation = *rotation;
+		tc.SetDirty();
 	}
 	void TransformComponent_GetLocalScale(UUID uuid, glm::vec3* outScale)
 	{
@@ -873,7 +872,9 @@ namespace Borealis
 		BOREALIS_CORE_ASSERT(scene, "Scene is null");
 		Entity entity = scene->GetEntityByUUID(uuid);
 		BOREALIS_CORE_ASSERT(entity, "Entity is null");
-		entity.GetComponent<TransformComponent>().Scale = *scale;
+		auto& tc = entity.GetComponent<TransformComponent>();
+		tc.Scale = *scale;
+		tc.SetDirty();
 	}
 
 	void TransformComponent_GetParentID(UUID uuid, UUID* parentID)
@@ -1720,6 +1721,40 @@ namespace Borealis
 			point_data[i] = results[i].point;
 		}
 	}
+
+	static_assert(sizeof(PhysicsQuery) == 60, "PhysicsQuery must match Borealis.PhysicsQuery in the script core");
+
+	int Physics_CastBatch(MonoArray* queries, int count, MonoArray* entityIDs, MonoArray* distances, MonoArray* normals, MonoArray* points)
+	{
+		// Never read or write past the smallest of the caller's arrays
+		uintptr_t capacity = std::min({ mono_array_length(queries), mono_array_length(entityIDs), mono_array_length(distances), mono_array_length(normals), mono_array_length(points) });
+		// Clamped as a signed value, a negative count from C# must not wrap to the whole array
+		uint32_t queryCount = static_cast<uint32_t>(std::clamp<int64_t>(count, 0, static_cast<int64_t>(capacity)));
+		if (queryCount == 0) return 0;
+
+		// Hits go straight into the caller's arrays, nothing is shared between calls
+		PhysicsQuery const* query_data = (PhysicsQuery const*)mono_array_addr_with_size(queries, sizeof(PhysicsQuery), 0);
+		uint64_t* ID_data = (uint64_t*)mono_array_addr_with_size(entityIDs, sizeof(uint64_t), 0);
+		float* distance_data = (float*)mono_array_addr_with_size(distances, sizeof(float), 0);
+		glm::vec3* normal_data = (glm::vec3*)mono_array_addr_with_size(normals, sizeof(glm::vec3), 0);
+		glm::vec3* point_data = (glm::vec3*)mono_array_addr_with_size(points, sizeof(glm::vec3), 0);
+		return static_cast<int>(PhysicsSystem::CastBatch(query_data, queryCount, ID_data, distance_data, normal_data, point_data));
+	}
+
+	void Physics_OverlapBatch(MonoArray* queries, int count, MonoArray* entityIDs, int maxHitsPerQuery, MonoArray* hitCounts)
+	{
+		if (maxHitsPerQuery <= 0) return;
+		uintptr_t capacity = std::min({ mono_array_length(queries), mono_array_length(hitCounts), mono_array_length(entityIDs) / maxHitsPerQuery });
+		// Clamped as a signed value, a negative count from C# must not wrap to the whole array
+		uint32_t queryCount = static_cast<uint32_t>(std::clamp<int64_t>(count, 0, static_cast<int64_t>(capacity)));
+		if (queryCount == 0) return;
+
+		PhysicsQuery const* query_data = (PhysicsQuery const*)mono_array_addr_with_size(queries, sizeof(PhysicsQuery), 0);
+		uint64_t* ID_data = (uint64_t*)mono_array_addr_with_size(entityIDs, sizeof(uint64_t), 0);
+		uint32_t* count_data = (uint32_t*)mono_array_addr_with_size(hitCounts, sizeof(uint32_t), 0);
+		PhysicsSystem::OverlapBatch(query_data, queryCount, ID_data, static_cast<uint32_t>(maxHitsPerQuery), count_data);
+	}
+
 	void CharacterController_Move(uint64_t id, glm::vec3* motion)
 	{
 		Entity entity = SceneManager::GetActiveScene()->GetEntityByUUID(id);
@@ -19,10 +19,13 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include <mono/metadata/assembly.h>
 #include <mono/metadata/metadata.h>
 #include <mono/metadata/threads.h>
+#include <mono/metadata/mono-gc.h>
+#include <mono/metadata/profiler.h>
 #include <Scripting/ScriptingSystem.hpp>
 #include <Scripting/ScriptingUtils.hpp>
 #include <Scripting/ScriptingExposedInternal.hpp>
 #include <Scripting/ScriptInstance.hpp>
+#include <Scripting/ManagedObjectCache.hpp>
 #include <Core/Core.hpp>
 #include <Core/LoggerSystem.hpp>
 #include <Scene/SceneManager.hpp>
@@ -31,8 +34,15 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include <AI/BehaviourTree/BehaviourNode.hpp>
 #include <AI/BehaviourTree/BTreeFactory.hpp>
 #include <mutex>
+#include <atomic>
 #include <Core/Project.hpp>
 
+// State handed to the Mono profiler callbacks, Mono names the type
+struct _MonoProfiler
+{
+	std::atomic<uint64_t> mAllocations = 0;
+};
+
 namespace Borealis
 {
 
@@ -46,6 +56,7 @@ namespace Borealis
 		MonoDomain* mRootDomain = nullptr;
 		MonoDomain* mAppDomain = nullptr;
 		MonoAssembly* mRoslynAssembly = nullptr;
+		MonoClassField* mEnabledField = nullptr; // Behaviour.enabled, looked up again after every core assembly load
 		MonoAssembly* mScriptAssembly = nullptr;
 		std::vector <std::string> mCSharpList;
 	};
@@ -53,6 +64,15 @@ namespace Borealis
 
 	static ScriptingSystemData* sData;
 
+#ifdef BOREALIS_MANAGED_ALLOCATION_PROFILER
+	static MonoProfiler sProfiler;
+
+	static void OnManagedAllocation(MonoProfiler* profiler, MonoObject*)
+	{
+		profiler->mAllocations.fetch_add(1, std::memory_order_relaxed);
+	}
+#endif
+
 	void ScriptingSystem::RegisterCSharpClass(ScriptClass klass)
 	{
 		Ref<ScriptClass> scriptClass;
@@ -68,6 +88,7 @@ namespace Borealis
 			scriptClass = MakeRef<ScriptClass>(klass);
 			mScriptClasses[klass.GetKlassName()] = scriptClass;
 		}		
+		scriptClass->ResolveMethods();
 
 		void* iterator = nullptr;
 		while (MonoClassField* field = mono_class_get_fields(scriptClass->GetMonoClass(), &iterator))
@@ -88,22 +109,28 @@ namespace Borealis
 		
 	}
 
+	static MonoClassField* GetEnabledField()
+	{
+		if (!sData->mEnabledField)
+		{
+			auto klass = mono_class_from_name(mono_assembly_get_image(sData->mRoslynAssembly), "Borealis", "Behaviour");
+			sData->mEnabledField = mono_class_get_field_from_name(klass, "enabled");
+		}
+		return sData->mEnabledField;
+	}
+
 	bool ScriptingSystem::GetEnabled(Ref<ScriptInstance> instance)
 	{
-		auto klass = mono_class_from_name(mono_assembly_get_image(sData->mRoslynAssembly), "Borealis", "Behaviour");
-		auto field = mono_class_get_field_from_name(klass, "enabled");
 		bool output = true;
 		char s_fieldValueBuffer[1];
-		mono_field_get_value(instance->GetInstance(), field, s_fieldValueBuffer);
+		mono_field_get_value(instance->GetInstance(), GetEnabledField(), s_fieldValueBuffer);
 		output = *(bool*)s_fieldValueBuffer;
 		return output;
 	}
 
 	void ScriptingSystem::SetEnabled(Ref<ScriptInstance> instance, bool enabled)
 	{
-		auto klass = mono_class_from_name(mono_assembly_get_image(sData->mRoslynAssembly), "Borealis", "Behaviour");
-		auto field = mono_class_get_field_from_name(klass, "enabled");
-		mono_field_set_value(instance->GetInstance(), field, &enabled);
+		mono_field_set_value(instance->GetInstance(), GetEnabledField(), &enabled);
 	}
 
 	void ScriptingSystem::CompileCSharpQueue(std::string cSharpPath)
@@ -318,11 +345,13 @@ namespace Borealis
 	void ScriptingSystem::LoadScriptAssembliesNonThreaded(std::string filepath)
 	{
 		mono_domain_set(mono_get_root_domain(), false);
+		ManagedObjectCache::Clear();
 		mono_domain_unload(sData->mAppDomain);
 		char friendlyName[] = "BorealisAppDomain";
 		sData->mAppDomain = mono_domain_create_appdomain(friendlyName, nullptr);
 		mono_domain_set(sData->mAppDomain, false);
 		sData->mRoslynAssembly = LoadCSharpAssembly("resources/scripts/core/BorealisScriptCore.dll");
+		sData->mEnabledField = nullptr;
 		RegisterCSharpScriptsFromAssembly(sData->mRoslynAssembly);
 
 		sData->mScriptAssembly = LoadCSharpAssembly(filepath);
@@ -563,6 +592,14 @@ namespace Borealis
 	void ScriptingSystem::InitMono()
 	{
 		mono_set_assemblies_path("mono/lib/4.5");
+#ifdef BOREALIS_MANAGED_ALLOCATION_PROFILER
+		// Allocation events can only be turned on before the runtime starts, and they slow every allocation down
+		MonoProfilerHandle profiler = mono_profiler_create(&sProfiler);
+		if (mono_profiler_enable_allocations())
+		{
+			mono_profiler_set_gc_allocation_callback(profiler, OnManagedAllocation);
+		}
+#endif
 		sData->mRootDomain = mono_jit_init("BorealisJitRuntime");
 		BOREALIS_CORE_ASSERT(sData->mRootDomain, "Failed to initialize Mono runtime");
 
@@ -573,6 +610,7 @@ namespace Borealis
 		RegisterInternals();
 
 		sData->mRoslynAssembly = LoadCSharpAssembly("resources/scripts/core/BorealisScriptCore.dll");
+		sData->mEnabledField = nullptr;
 		
 		// Add all internal functions here
 		RegisterComponents();
@@ -584,6 +622,7 @@ namespace Borealis
 	{
 		mono_domain_set(mono_get_root_domain(), false);
 
+		ManagedObjectCache::Clear();
 		mono_domain_unload(sData->mAppDomain);
 		sData->mAppDomain = nullptr;
 
@@ -591,6 +630,29 @@ namespace Borealis
 		sData->mRootDomain = nullptr;
 	}
 
+	bool ScriptingSystem::IsManagedAllocationProfilerEnabled()
+	{
+#ifdef BOREALIS_MANAGED_ALLOCATION_PROFILER
+		return true;
+#else
+		return false;
+#endif
+	}
+
+	uint64_t ScriptingSystem::GetManagedAllocationCount()
+	{
+#ifdef BOREALIS_MANAGED_ALLOCATION_PROFILER
+		return sProfiler.mAllocations.load(std::memory_order_relaxed);
+#else
+		return 0;
+#endif
+	}
+
+	int ScriptingSystem::GetGarbageCollectionCount()
+	{
+		return sData && sData->mRootDomain ? mono_gc_collection_count(0) : 0;
+	}
+
 	void ScriptingSystem::Reload(AssetMetaData const& assetMetaData, Ref<Asset> const& reload)
 	{
 		for (auto [assetHandle, assetMetaDataFromRegistry] : Project::GetEditorAssetsManager()->GetAssetRegistry())
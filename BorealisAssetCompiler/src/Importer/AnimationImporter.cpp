@@ -16,6 +16,9 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include <assimp/scene.h>
 #include <assimp/postprocess.h>
 
+#include <algorithm>
+#include <array>
+#include <cmath>
 #include <fstream>
 
 #include "Importer/AnimationImporter.hpp"
@@ -43,6 +46,135 @@ namespace
 		return glm::quat(pOrientation.w, pOrientation.x, pOrientation.y, pOrientation.z);
 	}
 
+	// compact clip layout, read back by Borealis::Animation::LoadAnimation
+	constexpr char ClipMagic[4] = { 'B', 'A', 'N', 'M' };
+	constexpr uint32_t ClipVersion = 2;
+	constexpr uint32_t MaxClipFrames = 65536;	// frame numbers are stored as uint16_t
+
+	constexpr float ClipSampleRate = 30.f;		// resampled frames per second
+	constexpr float PositionTolerance = 1e-3f;	// units
+	constexpr float ScaleTolerance = 1e-4f;
+	constexpr float RotationTolerance = 1e-3f;	// radians
+
+	template <typename T>
+	void Write(std::ofstream& outFile, T const& value)
+	{
+		outFile.write(reinterpret_cast<const char*>(&value), sizeof(T));
+	}
+
+	/*!***********************************************************************
+		\brief
+			Index of the key pair around time, clamped to the track
+	*************************************************************************/
+	template <typename Key>
+	size_t FindKey(std::vector<Key> const& keys, float time)
+	{
+		auto next = std::upper_bound(keys.begin(), keys.end(), time,
+			[](float t, Key const& key) { return t < key.timeStamp; });
+		size_t index = static_cast<size_t>(next - keys.begin());
+		return std::min(index > 0 ? index - 1 : 0, keys.size() - 2);
+	}
+
+	template <typename Key>
+	float KeyFactor(Key const& k0, Key const& k1, float time)
+	{
+		float length = k1.timeStamp - k0.timeStamp;
+		return length > 0.f ? std::clamp((time - k0.timeStamp) / length, 0.f, 1.f) : 0.f;
+	}
+
+	glm::vec3 SamplePosition(std::vector<BorealisAssetCompiler::KeyPosition> const& keys, float time)
+	{
+		if (keys.size() == 1) return keys[0].position;
+		size_t i = FindKey(keys, time);
+		return glm::mix(keys[i].position, keys[i + 1].position, KeyFactor(keys[i], keys[i + 1], time));
+	}
+
+	glm::quat SampleRotation(std::vector<BorealisAssetCompiler::KeyRotation> const& keys, float time)
+	{
+		if (keys.size() == 1) return glm::normalize(keys[0].orientation);
+		size_t i = FindKey(keys, time);
+		return glm::normalize(glm::slerp(keys[i].orientation, keys[i + 1].orientation, KeyFactor(keys[i], keys[i + 1], time)));
+	}
+
+	glm::vec3 SampleScale(std::vector<BorealisAssetCompiler::KeyScale> const& keys, float time)
+	{
+		if (keys.size() == 1) return keys[0].scale;
+		size_t i = FindKey(keys, time);
+		return glm::mix(keys[i].scale, keys[i + 1].scale, KeyFactor(keys[i], keys[i + 1], time));
+	}
+
+	/*!***********************************************************************
+		\brief
+			Picks the frames to keep from a uniformly sampled track. A frame
+			is dropped when interpolating between the kept frames around it
+			stays within tolerance of every sample in between. A track that
+			never leaves tolerance of its first sample keeps one frame.
+	*************************************************************************/
+	template <typename T, typename Lerp, typename Close>
+	std::vector<uint16_t> ReduceKeys(std::vector<T> const& samples, std::vector<float> const& times, Lerp lerp, Close close)
+	{
+		std::vector<uint16_t> frames{ 0 };
+
+		size_t const count = samples.size();
+		if (std::all_of(samples.begin(), samples.end(), [&](T const& sample) { return close(sample, samples[0]); }))
+		{
+			return frames;
+		}
+
+		size_t anchor = 0;
+		for (size_t end = anchor + 2; end < count; ++end)
+		{
+			bool fits = true;
+			for (size_t k = anchor + 1; k < end && fits; ++k)
+			{
+				float t = (times[k] - times[anchor]) / (times[end] - times[anchor]);
+				fits = close(lerp(samples[anchor], samples[end], t), samples[k]);
+			}
+
+			if (!fits)
+			{
+				anchor = end - 1;
+				frames.push_back(static_cast<uint16_t>(anchor));
+			}
+		}
+
+		frames.push_back(static_cast<uint16_t>(count - 1));
+		return frames;
+	}
+
+	/*!***********************************************************************
+		\brief
+			Packs a unit quaternion into 48 bits by dropping its largest
+			component, which is rebuilt from the other three on load. The
+			two bit index of the dropped component sits in the top bits of
+			the first two values, the other three are 15 bit fixed point.
+	*************************************************************************/
+	std::array<uint16_t, 3> PackQuat(glm::quat q)
+	{
+		float components[4] = { q.x, q.y, q.z, q.w };
+
+		int largest = 0;
+		for (int i = 1; i < 4; ++i)
+		{
+			if (std::abs(components[i]) > std::abs(components[largest])) largest = i;
+		}
+
+		// q and -q are the same rotation, keep the dropped component positive
+		float sign = components[largest] < 0.f ? -1.f : 1.f;
+
+		constexpr float range = 0.70710678f; // the three smallest lie in [-1/sqrt(2), 1/sqrt(2)]
+		std::array<uint16_t, 3> packed{};
+		for (int i = 0, j = 0; i < 4; ++i)
+		{
+			if (i == largest) continue;
+			float normalized = std::clamp(components[i] * sign / range * 0.5f + 0.5f, 0.f, 1.f);
+			packed[j++] = static_cast<uint16_t>(std::lround(normalized * 32767.f));
+		}
+
+		packed[0] |= static_cast<uint16_t>((largest >> 1) << 15);
+		packed[1] |= static_cast<uint16_t>((largest & 1) << 15);
+		return packed;
+	}
 }
 
 namespace BorealisAssetCompiler
@@ -163,52 +295,77 @@ namespace BorealisAssetCompiler
 			return;
 		}
 
-		//save mDuration
-		outFile.write(reinterpret_cast<const char*>(&anim.mDuration), sizeof(anim.mDuration));
+		// every track is resampled on one uniform grid, so keys store a frame number instead of a time
+		float frameStep = anim.mTicksPerSecond > 0.f ? anim.mTicksPerSecond / ClipSampleRate : 1.f;
+		uint32_t frameCount = static_cast<uint32_t>(std::ceil(anim.mDuration / frameStep)) + 1;
+		if (frameCount > MaxClipFrames)
+		{
+			frameCount = MaxClipFrames;
+			frameStep = anim.mDuration / static_cast<float>(MaxClipFrames - 1);
+		}
+
+		std::vector<float> times(frameCount);
+		for (uint32_t frame = 0; frame < frameCount; ++frame)
+		{
+			times[frame] = std::min(static_cast<float>(frame) * frameStep, anim.mDuration);
+		}
 
-		//save mTicksPerSecond
-		outFile.write(reinterpret_cast<const char*>(&anim.mTicksPerSecond), sizeof(anim.mTicksPerSecond));
+		outFile.write(ClipMagic, sizeof(ClipMagic));
+		Write(outFile, ClipVersion);
+		Write(outFile, anim.mDuration);
+		Write(outFile, anim.mTicksPerSecond);
+		Write(outFile, frameStep);
 
-		/*
-			for(bone : mBones)
-				save bone
-		*/
 		uint32_t boneCount = static_cast<uint32_t>(anim.mBones.size());
-		outFile.write(reinterpret_cast<const char*>(&boneCount), sizeof(boneCount));
+		Write(outFile, boneCount);
+
+		std::vector<glm::vec3> positions(frameCount);
+		std::vector<glm::quat> rotations(frameCount);
+		std::vector<glm::vec3> scales(frameCount);
 
 		for (Bone const& bone : anim.mBones)
 		{
 			uint32_t nameLength = static_cast<uint32_t>(bone.mName.size());
-			outFile.write(reinterpret_cast<const char*>(&nameLength), sizeof(nameLength));
+			Write(outFile, nameLength);
 			outFile.write(bone.mName.data(), nameLength);
+			Write(outFile, bone.mId);
+
+			for (uint32_t frame = 0; frame < frameCount; ++frame)
+			{
+				positions[frame] = SamplePosition(bone.mPositions, times[frame]);
+				rotations[frame] = SampleRotation(bone.mRotations, times[frame]);
+				scales[frame] = SampleScale(bone.mScales, times[frame]);
+			}
 
-			// Write bone ID
-			outFile.write(reinterpret_cast<const char*>(&bone.mId), sizeof(bone.mId));
+			auto mixVec = [](glm::vec3 const& a, glm::vec3 const& b, float t) { return glm::mix(a, b, t); };
+			std::vector<uint16_t> positionFrames = ReduceKeys(positions, times, mixVec,
+				[](glm::vec3 const& a, glm::vec3 const& b) { return glm::length(a - b) <= PositionTolerance; });
+			std::vector<uint16_t> rotationFrames = ReduceKeys(rotations, times,
+				[](glm::quat const& a, glm::quat const& b, float t) { return glm::normalize(glm::slerp(a, b, t)); },
+				[](glm::quat const& a, glm::quat const& b) { return std::abs(glm::dot(a, b)) >= std::cos(RotationTolerance * 0.5f); });
+			std::vector<uint16_t> scaleFrames = ReduceKeys(scales, times, mixVec,
+				[](glm::vec3 const& a, glm::vec3 const& b) { return glm::length(a - b) <= ScaleTolerance; });
 
-			// Write the number of keyframes
-			outFile.write(reinterpret_cast<const char*>(&bone.mNumPositions), sizeof(bone.mNumPositions));
-			outFile.write(reinterpret_cast<const char*>(&bone.mNumRotations), sizeof(bone.mNumRotations));
-			outFile.write(reinterpret_cast<const char*>(&bone.mNumScalings), sizeof(bone.mNumScalings));
+			Write(outFile, static_cast<uint32_t>(positionFrames.size()));
+			Write(outFile, static_cast<uint32_t>(rotationFrames.size()));
+			Write(outFile, static_cast<uint32_t>(scaleFrames.size()));
 
-			// Write all position keyframes
-			for (const KeyPosition& pos : bone.mPositions)
+			for (uint16_t frame : positionFrames)
 			{
-				outFile.write(reinterpret_cast<const char*>(&pos.position), sizeof(pos.position));
-				outFile.write(reinterpret_cast<const char*>(&pos.timeStamp), sizeof(pos.timeStamp));
+				Write(outFile, frame);
+				Write(outFile, positions[frame]);
 			}
 
-			// Write all rotation keyframes
-			for (const KeyRotation& rot : bone.mRotations)
+			for (uint16_t frame : rotationFrames)
 			{
-				outFile.write(reinterpret_cast<const char*>(&rot.orientation), sizeof(rot.orientation));
-				outFile.write(reinterpret_cast<const char*>(&rot.timeStamp), sizeof(rot.timeStamp));
+				Write(outFile, frame);
+				Write(outFile, PackQuat(rotations[frame]));
 			}
 
-			// Write all scale keyframes
-			for (const KeyScale& scale : bone.mScales)
+			for (uint16_t frame : scaleFrames)
 			{
-				outFile.write(reinterpret_cast<const char*>(&scale.scale), sizeof(scale.scale));
-				outFile.write(reinterpret_cast<const char*>(&scale.timeStamp), sizeof(scale.timeStamp));
+				Write(outFile, frame);
+				Write(outFile, scales[frame]);
 			}
 		}
 
@@ -23,6 +23,8 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include <Panels/BTNodeEditorPanel.hpp>
 #include <Panels/SceneRendererPanel.hpp>
 #include <Graphics/EditorCamera.hpp>
+#include <Graphics/RenderGraph/RenderGraph.hpp>
+#include <Scene/SceneSnapshot.hpp>
 #include <EditorAssets/AssetImporter.hpp>
 
 namespace Borealis {
@@ -206,6 +208,28 @@ namespace Borealis {
 		*************************************************************************/
 		void UIToolbar();
 
+		/*!***********************************************************************
+			\brief
+				Rebuild the active scene's render graph config from the editor
+				view settings
+		*************************************************************************/
+		void BuildRenderGraphConfig();
+
+		/*!***********************************************************************
+			\brief
+				What the editor render graph config was last built for
+		*************************************************************************/
+		struct EditorRenderGraphKey
+		{
+			uint64_t scene = 0; // instance id, a reloaded scene may reuse the address
+			bool editorView = false;
+			bool runtimeView = false;
+			bool bloom = false;
+			bool particles = false;
+
+			bool operator==(EditorRenderGraphKey const&) const = default;
+		};
+
 
 		OrthographicCameraController mCamera;
 		Ref<Texture2D> mTexture;
@@ -213,6 +237,7 @@ namespace Borealis {
 		//Ref<FrameBuffer> mViewportFrameBuffer;
 		//Ref<FrameBuffer> mRuntimeFrameBuffer;
 		Ref<Scene> mEditorScene;
+		SceneSnapshot mPlaySnapshot; // editor state play mode restores on stop
 
 		glm::vec2 mViewportSize = { 0.0f, 0.0f };
 		glm::vec2 mRuntimeSize = { 0.0f, 0.0f };
@@ -245,6 +270,16 @@ namespace Borealis {
 		AssetImporter mAssetImporter;
 
 		Ref<FrameBuffer> mViewportFrameBuffer;
+
+		EditorRenderGraphKey mRenderGraphKey;
+		int mPickedEntityID = -1; //written by the object picking pass
+		Ref<CameraSource> mEditorCameraSource;
+		Ref<Vec2IntSource> mMouseSource;
+		Ref<IntSource> mEntityIDSource;
+		Ref<BoolSource> mViewPortHoveredSource;
+		Ref<IntListSource> mSelectedEntitiesSource;
+		Ref<BoolSource> mParticlesWireFrameSource;
+		Ref<BoolSource> mBloomBoolSource;
 	};
 }
 
@@ -141,7 +141,7 @@ namespace Borealis
 			}
 		}
 
-		anim->mBoneDataMap = boneDataMap;
+		anim->BindSkeleton(boneDataMap);
 	}
 
 	void AnimationImporter::ReadHierarchyData(AssimpNodeData& dest, aiNode const* src)
@@ -30,6 +30,8 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include <Prefab.hpp>
 #include <PrefabManager.hpp>
 #include <Core/TimeManager.hpp>
+#include <Core/LayerList.hpp>
+#include <Physics/PhysicsLayers.hpp>
 //	#include <Project/Project.hpp>
 #include "Audio/AudioEngine.hpp"
 #include <ResourceManager.hpp>
@@ -106,6 +108,118 @@ namespace Borealis {
 
 	static bool editorView = true;
 	static bool runtimeView = true;
+	static bool comparePakWithV1 = false;
+	static bool reportPlayChanges = false;
+
+	void EditorLayer::BuildRenderGraphConfig()
+	{
+		SceneManager::GetActiveScene()->SetRunTimeViewPort(runtimeView);
+		SceneManager::GetActiveScene()->SetRunTimeRenderPass();
+		RenderGraphConfig& fconfig = SceneManager::GetActiveScene()->GetRenderGraphConfig();
+
+		//add global source to render graph
+		fconfig.AddGlobalSource(mEditorCameraSource);
+		fconfig.AddGlobalSource(mMouseSource);
+		fconfig.AddGlobalSource(mEntityIDSource);
+		fconfig.AddGlobalSource(mViewPortHoveredSource);
+		fconfig.AddGlobalSource(mSelectedEntitiesSource);
+		fconfig.AddGlobalSource(mParticlesWireFrameSource);
+		fconfig.AddGlobalSource(mBloomBoolSource);
+
+		//forward rendering editor
+		if(editorView)
+		{
+			RenderPassConfig editorShadowPass(RenderPassType::Shadow, "editorShadowPass");
+			editorShadowPass.AddSinkLinkage("shadowMap", "ShadowMapBuffer")
+				.AddSinkLinkage("camera", "EditorCamera");
+			fconfig.AddPass(editorShadowPass);
+
+			RenderPassConfig editorRender3D(RenderPassType::Render3D, "editorRender3D");
+			editorRender3D.AddSinkLinkage("renderTarget", "EditorBuffer")
+				.AddSinkLinkage("accumulaionTarget", "accumulaionBuffer")
+				.AddSinkLinkage("shadowMap", "editorShadowPass.shadowMap")
+				.AddSinkLinkage("camera", "EditorCamera");
+			fconfig.AddPass(editorRender3D);
+
+			if (bloomForEditor)
+			{
+				RenderPassConfig bloomPass(RenderPassType::BloomPass, "EditorBloomPass");
+				bloomPass.AddSinkLinkage("renderTarget", "EditorBuffer");
+				bloomPass.AddSinkLinkage("bloomBool", "bloomBool");
+				fconfig.AddPass(bloomPass);
+			}
+
+			RenderPassConfig editorCorrectionPass(RenderPassType::CorrectionPass, "editorCorrectionPass");
+			editorCorrectionPass.AddSinkLinkage("renderTarget", "EditorBuffer");
+			fconfig.AddPass(editorCorrectionPass);
+
+			RenderPassConfig editorSkyBoxPass(RenderPassType::SkyboxPass, "editorSkyBox");
+			editorSkyBoxPass.AddSinkLinkage("renderTarget", "editorCorrectionPass.renderTarget");
+			editorSkyBoxPass.AddSinkLinkage("camera", "EditorCamera");
+			fconfig.AddPass(editorSkyBoxPass);
+
+			RenderPassConfig editorRender2D(RenderPassType::Render2D, "editorRender2D");
+			editorRender2D.AddSinkLinkage("renderTarget", "editorSkyBox.renderTarget")
+				.AddSinkLinkage("camera", "EditorCamera");
+			fconfig.AddPass(editorRender2D);
+			
+
+			if (particlesForEditor)
+			{
+				RenderPassConfig particleSystemPass(RenderPassType::ParticleSystemPass, "ParticleSystemEditor");
+				particleSystemPass.AddSinkLinkage("camera", "EditorCamera")
+					.AddSinkLinkage("particlesWireFrame", "particlesWireFrame")
+					.AddSinkLinkage("accumulaionTarget", "accumulaionBuffer")
+					.AddSinkLinkage("renderTarget", "EditorBuffer")
+					.AddSinkLinkage("camera", "EditorCamera");
+				fconfig.AddPass(particleSystemPass);
+			}
+
+			RenderPassConfig UIEditorWorldPass(RenderPassType::UIWorldPass, "editorUIWorldPass");
+			UIEditorWorldPass.AddSinkLinkage("renderTarget", "EditorBuffer");
+			UIEditorWorldPass.AddSinkLinkage("camera", "EditorCamera");
+			fconfig.AddPass(UIEditorWorldPass);
+
+			RenderPassConfig editorUIPass(RenderPassType::EditorUIPass, "EditorUI");
+			editorUIPass.AddSinkLinkage("renderTarget", "EditorBuffer")
+				.AddSinkLinkage("camera", "EditorCamera")
+				.AddSinkLinkage("runTimeRenderTarget", "RunTimeBuffer");
+			fconfig.AddPass(editorUIPass);
+
+			//RenderPassConfig editorHighlightPass(RenderPassType::EditorHighlightPass, "EditorHighlight");
+			//editorHighlightPass.AddSinkLinkage("camera", "EditorCamera")
+			//	.AddSinkLinkage("renderTarget", "ObjectPicking.renderTarget")
+			//	.AddSinkLinkage("SelectedEntities", "SelectedEntities")
+			//	.AddSinkLinkage("EntityIDSource", "ObjectPicking.EntityIDSource");
+			//fconfig.AddPass(editorHighlightPass);
+
+			RenderPassConfig ObjectPicking(RenderPassType::ObjectPicking, "ObjectPicking");
+			ObjectPicking.AddSinkLinkage("pixelBuffer", "PixelBuffer")
+				.AddSinkLinkage("renderTarget", "EditorBuffer")
+				.AddSinkLinkage("EntityIDSource", "EntityIDSource")
+				.AddSinkLinkage("ViewPortHovered", "ViewPortHovered")
+				.AddSinkLinkage("MouseSource", "MouseSource");
+			fconfig.AddPass(ObjectPicking);
+
+			RenderPassConfig highlightPass(RenderPassType::HighlightPass, "Highlight");
+			highlightPass.AddSinkLinkage("camera", "EditorCamera")
+				.AddSinkLinkage("renderTarget", "ObjectPicking.renderTarget");
+			fconfig.AddPass(highlightPass);
+
+			if(bloomForEditor)
+			{
+				RenderPassConfig editorBloomCompositePass(RenderPassType::BloomCompositePass, "editorBloomComposite");
+				editorBloomCompositePass.AddSinkLinkage("renderTarget", "Highlight.renderTarget");
+				editorBloomCompositePass.AddSinkLinkage("bloomBool", "bloomBool");
+				fconfig.AddPass(editorBloomCompositePass);
+			}
+
+			RenderPassConfig editorGammaPass(RenderPassType::GammaPass, "editorGammaPass");
+			editorGammaPass.AddSinkLinkage("renderTarget", "EditorBuffer");
+			fconfig.AddPass(editorGammaPass);
+
+		}
+	}
 
 	void EditorLayer::Init()
 	{
@@ -134,6 +248,8 @@ namespace Borealis {
 		
 		mEditorCamera = EditorCamera(60.0f, 1.778f, 0.3f, 1000.0f);
 		SCPanel.editorCamera = &mEditorCamera;
+		// Prefab links of entities destroyed during play come back on stop
+		SceneSnapshot::RegisterComponent<PrefabComponent>();
 		ScriptingSystem::InitCoreAssembly();
 		ResourceManager::Init();
 
@@ -188,10 +304,12 @@ namespace Borealis {
 			mEditorCamera.UpdateFn(dt);
 		}
 
+		SceneManager::GetActiveScene()->GetPhysicsStepPipeline().ResetTimings();
 		if (mSceneState == SceneState::Play)
 			SceneManager::GetActiveScene()->UpdateRuntime(dt); //update physics, scripts and audio
 
 		Renderer2D::ResetStats();
+		ParticleRenderer::ResetStats();
 		{
 			PROFILE_SCOPE("Renderer::Prep");
 
@@ -208,24 +326,26 @@ namespace Borealis {
 		}
 
 
-		int entityID = -1;
-
 		//setting up rendergraph
 		{
 			PROFILE_SCOPE("Renderer::Draw");
-			RenderGraphConfig dconfig;
-			//RenderGraphConfig fconfig;
 
-			SceneManager::GetActiveScene()->SetRunTimeViewPort(runtimeView);
-			SceneManager::GetActiveScene()->SetRunTimeRenderPass();
-			RenderGraphConfig& fconfig = SceneManager::GetActiveScene()->GetRenderGraphConfig();
+			Scene* activeScene = SceneManager::GetActiveScene().get();
 
-			//add global source to render graph
-			CameraSource editorCameraSource("EditorCamera", mEditorCamera);
-			dconfig.AddGlobalSource(MakeRef<CameraSource>(editorCameraSource));
+			//sources live across frames and are updated in place, the config is
+			//only rebuilt when the scene or the view settings change
+			if (!mEditorCameraSource)
+			{
+				mEditorCameraSource = MakeRef<CameraSource>("EditorCamera", mEditorCamera);
+				mMouseSource = MakeRef<Vec2IntSource>("MouseSource", 0, 0);
+				mEntityIDSource = MakeRef<IntSource>("EntityIDSource", mPickedEntityID);
+				mViewPortHoveredSource = MakeRef<BoolSource>("ViewPortHovered", mViewportHovered);
+				mSelectedEntitiesSource = MakeRef<IntListSource>("SelectedEntities", mSelectedEntities);
+				mParticlesWireFrameSource = MakeRef<BoolSource>("particlesWireFrame", particlesWireFrame);
+				mBloomBoolSource = MakeRef<BoolSource>("bloomBool", activeScene->GetSceneRenderConfig().bloom);
+			}
 
-			CameraSource feditorCameraSource("EditorCamera", mEditorCamera);
-			fconfig.AddGlobalSource(MakeRef<CameraSource>(feditorCameraSource));
+			mEditorCameraSource->Set(mEditorCamera);
 
 			auto [mx, my] = ImGui::GetMousePos();
 			mx -= mViewportBounds[0].x;
@@ -233,219 +353,31 @@ namespace Borealis {
 			glm::vec2 viewportSize{ mViewportBounds[1].x - mViewportBounds[0].x, mViewportBounds[1].y - mViewportBounds[0].y };
 			my = viewportSize.y - my;
 
-			int mouseX = (int)mx;
-			int mouseY = (int)my;
-
-			Vec2IntSource mouseSource("MouseSource", mouseX, mouseY);
-			fconfig.AddGlobalSource(MakeRef<Vec2IntSource>(mouseSource));
-
-			IntSource entityIDSource("EntityIDSource", entityID);
-			fconfig.AddGlobalSource(MakeRef<IntSource>(entityIDSource));
-
-			BoolSource viewPortHoveredSource("ViewPortHovered", mViewportHovered);
-			fconfig.AddGlobalSource(MakeRef<BoolSource>(viewPortHoveredSource));
-
-			IntListSource selectedEntities("SelectedEntities", mSelectedEntities);
-			fconfig.AddGlobalSource(MakeRef<IntListSource>(selectedEntities));
-
-			BoolSource particlesWireFrameSource("particlesWireFrame", particlesWireFrame);
-			fconfig.AddGlobalSource(MakeRef<BoolSource>(particlesWireFrameSource));
-
-			BoolSource bloomBoolSource("bloomBool", SceneManager::GetActiveScene()->GetSceneRenderConfig().bloom);
-			fconfig.AddGlobalSource(MakeRef<BoolSource>(bloomBoolSource));
-
-			////forward rendering
-			//if(runtimeView)
-			//{
-			//	RenderPassConfig shadowPass(RenderPassType::Shadow, "ShadowPass");
-			//	shadowPass.AddSinkLinkage("shadowMap", "ShadowMapBuffer");
-			//	shadowPass.AddSinkLinkage("camera", "RunTimeCamera");
-			//	fconfig.AddPass(shadowPass);
-
-			//	RenderPassConfig Render3D(RenderPassType::Render3D, "Render3D");
-			//	Render3D.AddSinkLinkage("renderTarget", "RunTimeBuffer");
-			//	Render3D.AddSinkLinkage("accumulaionTarget", "accumulaionBuffer");
-			//	Render3D.AddSinkLinkage("shadowMap", "ShadowPass.shadowMap");
-			//	Render3D.AddSinkLinkage("camera", "RunTimeCamera");
-			//	fconfig.AddPass(Render3D);
-
-			//	RenderPassConfig Render2D(RenderPassType::Render2D, "Render2D");
-			//	Render2D.AddSinkLinkage("renderTarget", "Render3D.renderTarget");
-			//	Render2D.AddSinkLinkage("camera", "RunTimeCamera");
-			//	fconfig.AddPass(Render2D);
-
-			//	RenderPassConfig bloomPass(RenderPassType::BloomPass, "bloomPass");
-			//	bloomPass.AddSinkLinkage("renderTarget", "Render2D.renderTarget");
-			//	bloomPass.AddSinkLinkage("bloomBool", "bloomBool");
-			//	fconfig.AddPass(bloomPass);
-
-			//	RenderPassConfig correctionPass(RenderPassType::CorrectionPass, "correctionPass");
-			//	correctionPass.AddSinkLinkage("renderTarget", "bloomPass.renderTarget");
-			//	fconfig.AddPass(correctionPass);
-
-			//	RenderPassConfig skyBoxPass(RenderPassType::SkyboxPass, "skyBox");
-			//	skyBoxPass.AddSinkLinkage("renderTarget", "correctionPass.renderTarget");
-			//	skyBoxPass.AddSinkLinkage("camera", "RunTimeCamera");
-			//	fconfig.AddPass(skyBoxPass);
-
-			//	RenderPassConfig particleSystemPass(RenderPassType::ParticleSystemPass, "ParticleSystem");
-			//	particleSystemPass.AddSinkLinkage("accumulaionTarget", "accumulaionBuffer")
-			//		.AddSinkLinkage("renderTarget", "skyBox.renderTarget")
-			//		.AddSinkLinkage("camera", "RunTimeCamera");
-			//	fconfig.AddPass(particleSystemPass);
-
-			//	RenderPassConfig UIWorldPass(RenderPassType::UIWorldPass, "UIWorldPass");
-			//	UIWorldPass.AddSinkLinkage("renderTarget", "ParticleSystem.renderTarget");
-			//	UIWorldPass.AddSinkLinkage("camera", "RunTimeCamera");
-			//	fconfig.AddPass(UIWorldPass);
-
-			//	RenderPassConfig RunTimeHighlight(RenderPassType::HighlightPass, "RunTimeHighlight");
-			//	RunTimeHighlight.AddSinkLinkage("camera", "RunTimeCamera");
-			//	RunTimeHighlight.AddSinkLinkage("renderTarget", "UIWorldPass.renderTarget");
-			//	fconfig.AddPass(RunTimeHighlight);
-
-			//	RenderPassConfig UIPass(RenderPassType::UIPass, "UIPass");
-			//	UIPass.AddSinkLinkage("renderTarget", "RunTimeHighlight.renderTarget");
-			//	UIPass.AddSinkLinkage("camera", "RunTimeCamera");
-			//	fconfig.AddPass(UIPass);
-
-			//	RenderPassConfig bloomCompositePass(RenderPassType::BloomCompositePass, "bloomComposite");
-			//	bloomCompositePass.AddSinkLinkage("renderTarget", "UIPass.renderTarget");
-			//	bloomCompositePass.AddSinkLinkage("bloomBool", "bloomBool");
-			//	fconfig.AddPass(bloomCompositePass);
-			//}
-
-			//forward rendering editor
-			if(editorView)
-			{
-				RenderPassConfig editorShadowPass(RenderPassType::Shadow, "editorShadowPass");
-				editorShadowPass.AddSinkLinkage("shadowMap", "ShadowMapBuffer")
-					.AddSinkLinkage("camera", "EditorCamera");
-				fconfig.AddPass(editorShadowPass);
-
-				RenderPassConfig editorRender3D(RenderPassType::Render3D, "editorRender3D");
-				editorRender3D.AddSinkLinkage("renderTarget", "EditorBuffer")
-					.AddSinkLinkage("accumulaionTarget", "accumulaionBuffer")
-					.AddSinkLinkage("shadowMap", "editorShadowPass.shadowMap")
-					.AddSinkLinkage("camera", "EditorCamera");
-				fconfig.AddPass(editorRender3D);
-
-				if (bloomForEditor)
-				{
-					RenderPassConfig bloomPass(RenderPassType::BloomPass, "EditorBloomPass");
-					bloomPass.AddSinkLinkage("renderTarget", "EditorBuffer");
-					bloomPass.AddSinkLinkage("bloomBool", "bloomBool");
-					fconfig.AddPass(bloomPass);
-				}
+			mMouseSource->mRefX = (int)mx;
+			mMouseSource->mRefY = (int)my;
 
-				RenderPassConfig editorCorrectionPass(RenderPassType::CorrectionPass, "editorCorrectionPass");
-				editorCorrectionPass.AddSinkLinkage("renderTarget", "EditorBuffer");
-				fconfig.AddPass(editorCorrectionPass);
-
-				RenderPassConfig editorSkyBoxPass(RenderPassType::SkyboxPass, "editorSkyBox");
-				editorSkyBoxPass.AddSinkLinkage("renderTarget", "editorCorrectionPass.renderTarget");
-				editorSkyBoxPass.AddSinkLinkage("camera", "EditorCamera");
-				fconfig.AddPass(editorSkyBoxPass);
-
-				RenderPassConfig editorRender2D(RenderPassType::Render2D, "editorRender2D");
-				editorRender2D.AddSinkLinkage("renderTarget", "editorSkyBox.renderTarget")
-					.AddSinkLinkage("camera", "EditorCamera");
-				fconfig.AddPass(editorRender2D);
-				
-
-				if (particlesForEditor)
-				{
-					RenderPassConfig particleSystemPass(RenderPassType::ParticleSystemPass, "ParticleSystemEditor");
-					particleSystemPass.AddSinkLinkage("camera", "EditorCamera")
-						.AddSinkLinkage("particlesWireFrame", "particlesWireFrame")
-						.AddSinkLinkage("accumulaionTarget", "accumulaionBuffer")
-						.AddSinkLinkage("renderTarget", "EditorBuffer")
-						.AddSinkLinkage("camera", "EditorCamera");
-					fconfig.AddPass(particleSystemPass);
-				}
-
-				RenderPassConfig UIEditorWorldPass(RenderPassType::UIWorldPass, "editorUIWorldPass");
-				UIEditorWorldPass.AddSinkLinkage("renderTarget", "EditorBuffer");
-				UIEditorWorldPass.AddSinkLinkage("camera", "EditorCamera");
-				fconfig.AddPass(UIEditorWorldPass);
-
-				RenderPassConfig editorUIPass(RenderPassType::EditorUIPass, "EditorUI");
-				editorUIPass.AddSinkLinkage("renderTarget", "EditorBuffer")
-					.AddSinkLinkage("camera", "EditorCamera")
-					.AddSinkLinkage("runTimeRenderTarget", "RunTimeBuffer");
-				fconfig.AddPass(editorUIPass);
-
-				//RenderPassConfig editorHighlightPass(RenderPassType::EditorHighlightPass, "EditorHighlight");
-				//editorHighlightPass.AddSinkLinkage("camera", "EditorCamera")
-				//	.AddSinkLinkage("renderTarget", "ObjectPicking.renderTarget")
-				//	.AddSinkLinkage("SelectedEntities", "SelectedEntities")
-				//	.AddSinkLinkage("EntityIDSource", "ObjectPicking.EntityIDSource");
-				//fconfig.AddPass(editorHighlightPass);
-
-				RenderPassConfig ObjectPicking(RenderPassType::ObjectPicking, "ObjectPicking");
-				ObjectPicking.AddSinkLinkage("pixelBuffer", "PixelBuffer")
-					.AddSinkLinkage("renderTarget", "EditorBuffer")
-					.AddSinkLinkage("EntityIDSource", "EntityIDSource")
-					.AddSinkLinkage("ViewPortHovered", "ViewPortHovered")
-					.AddSinkLinkage("MouseSource", "MouseSource");
-				fconfig.AddPass(ObjectPicking);
-
-				RenderPassConfig highlightPass(RenderPassType::HighlightPass, "Highlight");
-				highlightPass.AddSinkLinkage("camera", "EditorCamera")
-					.AddSinkLinkage("renderTarget", "ObjectPicking.renderTarget");
-				fconfig.AddPass(highlightPass);
-
-				if(bloomForEditor)
-				{
-					RenderPassConfig editorBloomCompositePass(RenderPassType::BloomCompositePass, "editorBloomComposite");
-					editorBloomCompositePass.AddSinkLinkage("renderTarget", "Highlight.renderTarget");
-					editorBloomCompositePass.AddSinkLinkage("bloomBool", "bloomBool");
-					fconfig.AddPass(editorBloomCompositePass);
-				}
-
-				RenderPassConfig editorGammaPass(RenderPassType::GammaPass, "editorGammaPass");
-				editorGammaPass.AddSinkLinkage("renderTarget", "EditorBuffer");
-				fconfig.AddPass(editorGammaPass);
-
-			}
-
-			//deferred rendering
+			mPickedEntityID = -1;
+			mViewPortHoveredSource->mRef = mViewportHovered;
+			//comparing does not allocate, copying the list does
+			if (mSelectedEntitiesSource->mList != mSelectedEntities)
 			{
-				RenderPassConfig geometryPass(RenderPassType::Geometry, "geometricPass");
-				geometryPass.AddSinkLinkage("gBuffer", "gBuffer");
-				geometryPass.AddSinkLinkage("camera", "RunTimeCamera");
-				dconfig.AddPass(geometryPass);
-
-				RenderPassConfig lightingPass(RenderPassType::Lighting, "lightPass");
-				lightingPass.AddSinkLinkage("gBuffer", "geometricPass.gBuffer");
-				lightingPass.AddSinkLinkage("renderTarget", "RunTimeBuffer");
-				lightingPass.AddSinkLinkage("viewProj", "geometricPass.camera");
-				dconfig.AddPass(lightingPass);
-
-				//add render2d
+				mSelectedEntitiesSource->mList = mSelectedEntities;
 			}
+			mParticlesWireFrameSource->mRef = particlesWireFrame;
+			mBloomBoolSource->mRef = activeScene->GetSceneRenderConfig().bloom;
 
-			//deferred rendering editor
+			EditorRenderGraphKey key{ activeScene->GetInstanceID(), editorView, runtimeView, bloomForEditor, particlesForEditor };
+			if (key != mRenderGraphKey || activeScene->GetRenderGraphConfig().passesConfigList.empty())
 			{
-				//RenderPassConfig editorGeometricPass(RenderPassType::Geometry, "editorGeometricPass");
-				//editorGeometricPass.AddSinkLinkage("gBuffer", "gBuffer");
-				//editorGeometricPass.AddSinkLinkage("camera", "EditorCamera");
-				//dconfig.AddPass(editorGeometricPass);
-
-				//RenderPassConfig editorLightPass(RenderPassType::Lighting, "editorLightPass");
-				//editorLightPass.AddSinkLinkage("gBuffer", "editorGeometricPass.gBuffer");
-				//editorLightPass.AddSinkLinkage("renderTarget", "EditorBuffer");
-				//editorLightPass.AddSinkLinkage("viewProj", "editorGeometricPass.camera");
-				//dconfig.AddPass(editorLightPass);
-
-				//add render2d
+				mRenderGraphKey = key;
+				BuildRenderGraphConfig();
 			}
 
-			SceneManager::GetActiveScene()->SetRenderGraphConfig(fconfig);
-			SceneManager::GetActiveScene()->UpdateRenderer(dt);	
+			activeScene->SetRenderGraphConfig(activeScene->GetRenderGraphConfig());
+			activeScene->UpdateRenderer(dt);	
 		}
 
-		mHoveredEntity = { (entt::entity)entityID , SceneManager::GetActiveScene().get() };
+		mHoveredEntity = { (entt::entity)mPickedEntityID , SceneManager::GetActiveScene().get() };
 
 
 		//mSceneState = SceneState::Edit;
@@ -643,6 +575,138 @@ namespace Borealis {
 				ImGui::Text("Quads: %d", stats.QuadCount);
 				ImGui::Text("Vertices: %d", stats.GetTotalVertexCount());
 				ImGui::Text("Indices: %d", stats.GetTotalIndexCount());
+				auto const& particleStats = ParticleRenderer::GetStats();
+				ImGui::Text("Particle Stats:");
+				ImGui::Text("Draw Calls: %u", particleStats.DrawCalls);
+				ImGui::Text("Particles: %u", particleStats.ParticleCount);
+				ImGui::Text("Uploaded Bytes: %u", particleStats.UploadedBytes);
+				auto const& graphStats = SceneManager::GetActiveScene()->GetRenderGraphStats();
+				ImGui::Text("RenderGraph Stats:");
+				ImGui::Text("Compiles: %u", graphStats.compiles);
+				ImGui::Text("Passes Allocated: %u", graphStats.passAllocations);
+				ImGui::Text("Sinks Allocated: %u", graphStats.sinkAllocations);
+				ImGui::Text("Source Lookups: %u", graphStats.sourceLookups);
+				auto& physicsStep = SceneManager::GetActiveScene()->GetPhysicsStepPipeline();
+				auto const& physicsTimings = physicsStep.GetTimings();
+				ImGui::Text("Physics Step Stats:");
+				ImGui::Text("Steps: %u", physicsTimings.steps);
+				ImGui::Text("Gather: %.3f ms", physicsTimings.gatherMs);
+				ImGui::Text("Push: %.3f ms", physicsTimings.pushMs);
+				ImGui::Text("Simulate: %.3f ms", physicsTimings.simulateMs);
+				ImGui::Text("Pull: %.3f ms", physicsTimings.pullMs);
+				ImGui::Text("Bodies: %u (pushed %u, pulled %u)", physicsTimings.bodies, physicsTimings.pushedBodies, physicsTimings.pulledBodies);
+				int physicsGrain = static_cast<int>(physicsStep.GetGrainSize());
+				if (ImGui::DragInt("Physics Grain Size", &physicsGrain, 1.f, 1, 1024))
+				{
+					physicsStep.SetGrainSize(static_cast<uint32_t>(physicsGrain));
+				}
+				// Drawn once a frame, so the difference is what the last frame allocated
+				static uint64_t lastManagedAllocations = 0;
+				uint64_t managedAllocations = ScriptingSystem::GetManagedAllocationCount();
+				ImGui::Text("Scripting Stats:");
+				if (ScriptingSystem::IsManagedAllocationProfilerEnabled())
+				{
+					ImGui::Text("Managed Allocations: %llu this frame, %llu total", managedAllocations - lastManagedAllocations, managedAllocations);
+				}
+				else
+				{
+					ImGui::Text("Managed Allocations: build with BOREALIS_MANAGED_ALLOCATION_PROFILER to count");
+				}
+				ImGui::Text("Garbage Collections: %d", ScriptingSystem::GetGarbageCollectionCount());
+				lastManagedAllocations = managedAllocations;
+				ImGui::Checkbox("Compare Pak With v1 On Build", &comparePakWithV1);
+				ImGui::Checkbox("Report Play Mode Changes", &reportPlayChanges);
+				if (ImGui::Button("Benchmark Property Access"))
+				{
+					PropertyBenchmark benchmark = Serialiser::BenchmarkProperties(*SceneManager::GetActiveScene(), 100);
+					BOREALIS_CORE_INFO("{0} properties, access {1:.0f}/s reflected vs {2:.0f}/s cached, serialise {3:.0f}/s reflected vs {4:.0f}/s cached",
+						benchmark.properties, benchmark.reflectedAccess, benchmark.cachedAccess, benchmark.reflectedSerialise, benchmark.cachedSerialise);
+				}
+				if (ImGui::Button("Benchmark Animation Scaling"))
+				{
+					RenderGraph::AnimationBenchmark benchmark = RenderGraph::BenchmarkAnimations(SceneManager::GetActiveScene()->GetRegistry());
+					if (benchmark.instances == 0)
+					{
+						BOREALIS_CORE_WARN("Animation benchmark needs an entity with an animation in the scene");
+					}
+					for (size_t i = 0; i < benchmark.frameMilliseconds.size(); ++i)
+					{
+						BOREALIS_CORE_INFO("{0} animated characters on {1} threads: {2:.3f} ms per frame, {3:.2f}x speedup",
+							benchmark.instances, i + 1, benchmark.frameMilliseconds[i], benchmark.frameMilliseconds[0] / benchmark.frameMilliseconds[i]);
+					}
+				}
+				if (ImGui::Button("Benchmark Active Hierarchy"))
+				{
+					Scene::ActiveHierarchyBenchmark benchmark = Scene::BenchmarkActiveHierarchy();
+					BOREALIS_CORE_INFO("{0} entities, active lookup {1:.3f} ms recursive vs {2:.3f} ms cached, refresh {3:.3f} ms",
+						benchmark.entities, benchmark.recursiveMilliseconds, benchmark.cachedMilliseconds, benchmark.refreshMilliseconds);
+				}
+				if (ImGui::TreeNode("Physics Layer Matrix"))
+				{
+					// Named layers only, the matrix is symmetric so each pair is shown once
+					std::vector<int> layers;
+					for (int i = 0; i < static_cast<int>(PhysicsLayers::LayerCount); i++)
+					{
+						if (LayerList::HasIndex(i)) layers.push_back(i);
+					}
+					for (size_t row = 0; row < layers.size(); row++)
+					{
+						ImGui::Text("%s", LayerList::IndexToLayer(layers[row]).c_str());
+						for (size_t column = row; column < layers.size(); column++)
+						{
+							bool collide = PhysicsLayers::GetCollision(layers[row], layers[column]);
+							ImGui::SameLine();
+							std::string id = "##PhysicsLayer" + std::to_string(layers[row]) + "_" + std::to_string(layers[column]);
+							if (ImGui::Checkbox(id.c_str(), &collide))
+							{
+								PhysicsLayers::SetCollision(layers[row], layers[column], collide);
+							}
+							if (ImGui::IsItemHovered())
+							{
+								ImGui::SetTooltip("%s / %s", LayerList::IndexToLayer(layers[row]).c_str(), LayerList::IndexToLayer(layers[column]).c_str());
+							}
+						}
+					}
+					ImGui::Separator();
+					ImGui::Text("Debris Layers (applies to bodies created after the change):");
+					for (int layer : layers)
+					{
+						bool debris = PhysicsLayers::IsDebrisLayer(layer);
+						if (ImGui::Checkbox(("Debris: " + LayerList::IndexToLayer(layer)).c_str(), &debris))
+						{
+							PhysicsLayers::SetDebrisMask(PhysicsLayers::GetDebrisMask() ^ (1u << layer));
+						}
+					}
+					ImGui::TreePop();
+				}
+				if (ImGui::TreeNode("Asset Memory"))
+				{
+					// Budgets of 0 never evict
+					auto assetManager = Project::GetEditorAssetsManager();
+					constexpr float bytesPerMB = 1024.f * 1024.f;
+					ImGui::Text("Resident: %.1f MB", assetManager->GetResidentBytes() / bytesPerMB);
+					for (AssetType type : { AssetType::Mesh, AssetType::Texture2D, AssetType::Material, AssetType::Animation, AssetType::BehaviourTreeData })
+					{
+						std::string name = AssetManager::AssetTypeToString(type);
+						auto residency = assetManager->GetResidency().find(type);
+						if (residency != assetManager->GetResidency().end())
+						{
+							ImGui::Text("%s: %.1f MB, %u assets, %u evicted", name.c_str(), residency->second.residentBytes / bytesPerMB,
+								residency->second.assetCount, residency->second.evictions);
+						}
+						else
+						{
+							ImGui::Text("%s: nothing loaded", name.c_str());
+						}
+
+						int budgetMB = static_cast<int>(assetManager->GetMemoryBudget(type) / (1024 * 1024));
+						if (ImGui::DragInt(("Budget (MB)##" + name).c_str(), &budgetMB, 1.f, 0, 16384))
+						{
+							assetManager->SetMemoryBudget(type, static_cast<uint64_t>(budgetMB) * 1024 * 1024);
+						}
+					}
+					ImGui::TreePop();
+				}
 				if (ImGui::Button("Toggle Light/Dark Mode"))
 				{
 					if (mLightMode)
@@ -1408,7 +1472,10 @@ namespace Borealis {
 			// Copy and paste assets
 			std::filesystem::create_directory(filepath + "\\Assets");
 			Project::CopyFolder(Project::GetProjectPath() + "\\Assets", filepath + "\\Assets", ".sc", true);
-			AssetManager::BuildPak(Project::GetProjectPath() + "\\Cache", filepath + "\\Data.pak");
+			Project::BuildSceneBinaries(Project::GetProjectPath() + "\\Assets", filepath + "\\Assets", true);
+			PakBuildOptions pakOptions;
+			pakOptions.compareWithV1 = comparePakWithV1;
+			AssetManager::BuildPak(Project::GetProjectPath() + "\\Cache", filepath + "\\Data.pak", pakOptions);
 			Project::CopyIndividualFile(Project::GetProjectPath() + "\\Cache\\CSharp_Assembly.dll", filepath + "\\CSharp_Assembly.dll");
 			Project::CopyIndividualFile(Project::GetProjectPath() + "\\AssetRegistry.brdb", filepath + "\\AssetRegistry.brdb", true);
 			Project::CopyIndividualFile(Project::GetProjectPath() + "\\Master.bank", filepath + "\\Master.bank");
@@ -1447,11 +1514,13 @@ namespace Borealis {
 		}
 		mSceneState = SceneState::Play;
 
-		Ref<Scene> copiedScene = Scene::Copy(SceneManager::GetActiveScene());
-		copiedScene->SetName(copiedScene->GetName() + "-runtime");
-		SceneManager::AddScene(copiedScene->GetName(), "");
+		// Play runs on the editor scene itself, the snapshot puts it back on stop
 		mEditorScene = SceneManager::GetActiveScene();
-		SceneManager::SetActiveScene(copiedScene);
+		mPlaySnapshot.Capture(*mEditorScene);
+		// Scripts get instances of their own, the snapshot keeps the editor's
+		mEditorScene->CloneScriptInstances(mPlaySnapshot.GetRegistry());
+		mEditorScene->SetName(mEditorScene->GetName() + "-runtime");
+		SceneManager::AddScene(mEditorScene->GetName(), "");
 		SCPanel.SetContext(SceneManager::GetActiveScene());
 		SceneManager::GetActiveScene()->RuntimeStart();
 	}
@@ -1462,6 +1531,19 @@ namespace Borealis {
 		SceneManager::GetActiveScene()->RuntimeEnd();
 		SCPanel.SetSelectedEntity({});
 		std::string tmpName = SceneManager::GetActiveScene()->GetName();
+
+		if (reportPlayChanges && SceneManager::GetActiveScene() == mEditorScene)
+		{
+			SceneSnapshotDiff diff = mPlaySnapshot.Diff(*mEditorScene);
+			if (!diff.Empty())
+			{
+				BOREALIS_CORE_INFO("Play mode changes reverted: {0} created, {1} destroyed, {2} moved, {3} components added, {4} removed",
+					diff.created.size(), diff.destroyed.size(), diff.moved.size(), diff.addedComponents, diff.removedComponents);
+			}
+		}
+
+		mPlaySnapshot.Restore(*mEditorScene);
+		mPlaySnapshot.Clear();
 		SceneManager::SetActiveScene(mEditorScene);
 		EditorSerialiser serialiser(nullptr);
 		SceneManager::RemoveScene(tmpName, serialiser);
@@ -18,6 +18,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include <Scene/Components.hpp>
 #include <Scene/SceneManager.hpp>
 #include <Scene/ReflectionInstance.hpp>
+#include <Scene/PropertyAccessor.hpp>
 #include <Scripting/ScriptingSystem.hpp>
 #include <Scripting/ScriptInstance.hpp>
 #include <Scripting/ScriptingUtils.hpp>
@@ -176,7 +177,19 @@ namespace Borealis
 		return tokens;
 	}
 
-	static bool DrawProperty(rttr::property& Property, ReflectionInstance& rInstance, bool* propertyDrawn)
+	// Current value of a property, read in place when the accessor cache found its member
+	template<typename T>
+	static T GetPropertyValue(rttr::property const& Property, ReflectionInstance& rInstance, PropertyAccessor const* accessor, void const* object)
+	{
+		if (accessor && accessor->IsDirect())
+		{
+			return accessor->Get<T>(object);
+		}
+		return Property.get_value(rInstance).get_value<T>();
+	}
+
+	static bool DrawProperty(rttr::property& Property, ReflectionInstance& rInstance, bool* propertyDrawn,
+		PropertyAccessor const* accessor = nullptr, void const* object = nullptr)
 	{
 		auto propType = Property.get_type();
 		auto propName = Property.get_name().to_string();
@@ -209,8 +222,7 @@ namespace Borealis
 
 		if (propType == rttr::type::get<glm::vec3>())
 		{
-			rttr::variant value = Property.get_value(rInstance);
-			glm::vec3 oldValue = value.get_value<glm::vec3>();
+			glm::vec3 oldValue = GetPropertyValue<glm::vec3>(Property, rInstance, accessor, object);
 			auto newValue = oldValue;
 
 			float min = 0;
@@ -291,7 +303,7 @@ namespace Borealis
 
 		if (propType == rttr::type::get<bool>())
 		{
-			bool oldValue = Property.get_value(rInstance).to_bool();
+			bool oldValue = GetPropertyValue<bool>(Property, rInstance, accessor, object);
 			bool newValue = oldValue;
 			if (ImGui::Checkbox(("##" + name + propName).c_str(), &newValue))
 			{
@@ -304,7 +316,7 @@ namespace Borealis
 		}
 		if (propType == rttr::type::get<float>())
 		{
-			float oldValue = Property.get_value(rInstance).to_float();
+			float oldValue = GetPropertyValue<float>(Property, rInstance, accessor, object);
 			float newValue = oldValue;
 			if (ImGui::DragFloat(("##" + name + propName).c_str(), &newValue))
 			{
@@ -316,7 +328,7 @@ namespace Borealis
 
 		if (propType == rttr::type::get<int>())
 		{
-			int oldValue = Property.get_value(rInstance).to_int();
+			int oldValue = GetPropertyValue<int>(Property, rInstance, accessor, object);
 			int newValue = oldValue;
 			if (ImGui::DragInt(("##" + name + propName).c_str(), &newValue))
 			{
@@ -769,11 +781,11 @@ namespace Borealis
 	{
 		bool isEdited = false;
 		ReflectionInstance rInstance(component);
-		auto properties = rInstance.get_type().get_properties();
-		for (auto Property : properties)
+		for (PropertyAccessor const& accessor : PropertyAccessorCache::Get<Type>())
 		{
+			rttr::property Property = accessor.property;
 			bool isPropertyDrawn = false;
-			isEdited = DrawProperty(Property, rInstance, &isPropertyDrawn) ? true : isEdited;
+			isEdited = DrawProperty(Property, rInstance, &isPropertyDrawn, &accessor, &component) ? true : isEdited;
 			if (isPropertyDrawn)
 			{
 				ImGui::PopID();
@@ -784,7 +796,7 @@ namespace Borealis
 			if (entity.HasComponent<PrefabComponent>() && isEdited)
 			{
 				auto& prefabComp = entity.GetComponent<PrefabComponent>();
-				prefabComp.mEditedComponentList.insert(rInstance.get_type().get_name().to_string() + ":" + Property.get_name().to_string());
+				prefabComp.mEditedComponentList.insert(rInstance.get_type().get_name().to_string() + ":" + accessor.name);
 			}
 		}
 		return isEdited;
@@ -2421,7 +2433,11 @@ namespace Borealis
 			char buffer[256];
 			memset(buffer, 0, sizeof(buffer));
 			strcpy_s(buffer, sizeof(buffer), tag.c_str());
-			ImGui::Checkbox("##Active", &entity.GetComponent<TagComponent>().active);
+			bool active = entity.GetComponent<TagComponent>().active;
+			if (ImGui::Checkbox("##Active", &active))
+			{
+				entity.SetActive(active);
+			}
 			ImGui::SameLine();
 			ImGui::SetNextItemWidth(ImGui::GetFontSize() * 8);
 			if (ImGui::InputText("##Name", buffer, sizeof(buffer)))
@@ -16,6 +16,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 
 #include <Scene/Components.hpp>
 #include <Scene/ComponentRegistry.hpp>
+#include <Scene/PropertyAccessor.hpp>
 #include "Prefab.hpp"
 #include <PrefabManager.hpp>
 #include <iostream>  // For testing/debugging purposes
@@ -188,24 +189,29 @@ namespace Borealis {
         rttr::instance srcInstance(src);
         rttr::instance dstInstance(dst);
 		std::string componentName = dstInstance.get_type().get_name().to_string();
-        auto properties = dstInstance.get_type().get_properties();
        
         // Retrieve the PrefabComponent to check edited properties
         if (!child->HasComponent<PrefabComponent>())
             return;
         auto& prefabComp = child->GetComponent<PrefabComponent>();
 
-        for (const auto& prop : properties)
+        for (PropertyAccessor const& accessor : PropertyAccessorCache::Get<ComponentType>())
         {
             // Skip updating if the property has been edited
-            if (prop.is_valid() && prop.get_value(srcInstance).is_valid())
+            const std::string fullComponentName = componentName + ":" + accessor.name;
+            if (prefabComp.mEditedComponentList.find(fullComponentName) != prefabComp.mEditedComponentList.end())
+                continue;
+
+            // Update only if the property was not edited
+            if (accessor.IsDirect())
+            {
+                accessor.Copy(&dst, &src);
+                continue;
+            }
+            rttr::variant value = accessor.property.get_value(srcInstance);
+            if (value.is_valid())
             {
-                const std::string fullComponentName = componentName + ":" + prop.get_name().to_string();
-                if (prefabComp.mEditedComponentList.find(fullComponentName) == prefabComp.mEditedComponentList.end())
-                {
-                    // Update only if the property was not edited
-                    prop.set_value(dstInstance, prop.get_value(srcInstance));
-                }
+                accessor.property.set_value(dstInstance, value);
             }
         }
     }
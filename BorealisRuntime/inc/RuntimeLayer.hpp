@@ -28,6 +28,7 @@ namespace BorealisRuntime
 	private:
 		Borealis::Ref<Borealis::FrameBuffer> mRuntimeFrameBuffer;
 		Borealis::EditorAssetManager mEditorAssetManager;
+		Borealis::Scene* mConfiguredScene = nullptr; //scene the render graph config was built for
 	};
 }
 
@@ -86,6 +86,9 @@ namespace BorealisRuntime
 	}
 	void RuntimeLayer::UpdateFn(float dt)
 	{
+		// Finishes streamed asset loads
+		Borealis::Project::GetEditorAssetsManager()->Update();
+
 		int windowWidth = Borealis::ApplicationManager::Get().GetWindow()->GetWidth();
 		int windowHeight = Borealis::ApplicationManager::Get().GetWindow()->GetHeight();
 		if (Borealis::FrameBufferProperties spec = Borealis::SceneManager::GetActiveScene()->GetRunTimeFB()->GetProperties();
@@ -111,9 +114,15 @@ namespace BorealisRuntime
 		Borealis::RenderCommand::BindBackBuffer();
 		Borealis::RenderCommand::Clear();
 
-		Borealis::SceneManager::GetActiveScene()->SetRunTimeViewPort(true);
-		Borealis::SceneManager::GetActiveScene()->SetRunTimeRenderPass();
-		Borealis::RenderGraphConfig fconfig = Borealis::SceneManager::GetActiveScene()->GetRenderGraphConfig();
+		//the config only changes with the scene, the render graph keeps its
+		//compiled passes until then
+		Borealis::Scene* activeScene = Borealis::SceneManager::GetActiveScene().get();
+		if (activeScene != mConfiguredScene || activeScene->GetRenderGraphConfig().passesConfigList.empty())
+		{
+			mConfiguredScene = activeScene;
+			activeScene->SetRunTimeViewPort(true);
+			activeScene->SetRunTimeRenderPass();
+			Borealis::RenderGraphConfig& fconfig = activeScene->GetRenderGraphConfig();
 		////set render graph config manually for now
 		//{
 		//	Borealis::RenderGraphConfig fconfig;
@@ -160,12 +169,14 @@ namespace BorealisRuntime
 		//	UIPass.AddSinkLinkage("camera", "RunTimeCamera");
 		//	fconfig.AddPass(UIPass);
 
-		Borealis::RenderPassConfig backBuffer(Borealis::RenderPassType::RenderToTarget, "BackBuffer");
-		backBuffer.AddSinkLinkage("renderSource", "RunTimeBuffer");
-		fconfig.AddPass(backBuffer);
+			Borealis::RenderPassConfig backBuffer(Borealis::RenderPassType::RenderToTarget, "BackBuffer");
+			backBuffer.AddSinkLinkage("renderSource", "RunTimeBuffer");
+			fconfig.AddPass(backBuffer);
+
+			activeScene->SetRenderGraphConfig(fconfig);
+		}
 
-		Borealis::SceneManager::GetActiveScene()->SetRenderGraphConfig(fconfig);
-		Borealis::SceneManager::GetActiveScene()->UpdateRenderer(dt);
+		activeScene->UpdateRenderer(dt);
 
 		if (Borealis::SceneManager::ToNextScene)
 		{
@@ -131,9 +131,9 @@ namespace Borealis
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
         internal extern static void Entity_SetTag(ulong id, string name);
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static void Entity_GetEntitiesFromTag(string tag, out GameObject[] entities);
+        internal extern static int Entity_GetEntitiesFromTag(string tag, GameObject[] entities);
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static void Entity_GetEntitiesFromLayer(int layer, out GameObject[] entities);
+        internal extern static int Entity_GetEntitiesFromLayer(int layer, GameObject[] entities);
 
         #endregion
 
@@ -340,6 +340,12 @@ namespace Borealis
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
         internal extern static void Physics_RaycastAll(Vector3 origin, Vector3 direction, float maxDistance, int layerMask, 
             out ulong[] entityID, out float[] distance, out Vector3[] normal, out Vector3[] point);
+
+        [MethodImplAttribute(MethodImplOptions.InternalCall)]
+        internal extern static int Physics_CastBatch(PhysicsQuery[] queries, int count, ulong[] entityIDs, float[] distances, Vector3[] normals, Vector3[] points);
+
+        [MethodImplAttribute(MethodImplOptions.InternalCall)]
+        internal extern static void Physics_OverlapBatch(PhysicsQuery[] queries, int count, ulong[] entityIDs, int maxHitsPerQuery, int[] hitCounts);
         #endregion
 
         #region CharacterController
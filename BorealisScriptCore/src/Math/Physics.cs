@@ -10,6 +10,125 @@ namespace Borealis
         public Vector3 point;
         public Collider collider;
     }
+    public enum QueryShape
+    {
+        Ray,
+        Sphere,
+        Box,
+        Capsule
+    }
+
+    // Layout matches Borealis::PhysicsQuery in the engine
+    [StructLayout(LayoutKind.Sequential)]
+    public struct PhysicsQuery
+    {
+        public Vector3 origin;
+        public Vector3 direction;
+        public Vector3 extents; // sphere: x is the radius, box: half extents, capsule: x is the radius and y the half height of the cylinder part
+        public Vector3 rotation; // degrees, used by box and capsule
+        public float maxDistance;
+        public int layerMask;
+        public QueryShape shape;
+
+        public static PhysicsQuery Ray(Vector3 origin, Vector3 direction, float maxDistance, int layerMask = Physics.DefaultRaycastLayers)
+        {
+            return new PhysicsQuery { origin = origin, direction = direction, maxDistance = maxDistance, layerMask = layerMask, shape = QueryShape.Ray };
+        }
+
+        public static PhysicsQuery Sphere(Vector3 origin, float radius, Vector3 direction, float maxDistance, int layerMask = Physics.DefaultRaycastLayers)
+        {
+            return new PhysicsQuery { origin = origin, direction = direction, extents = new Vector3(radius, radius, radius), maxDistance = maxDistance, layerMask = layerMask, shape = QueryShape.Sphere };
+        }
+
+        public static PhysicsQuery Box(Vector3 center, Vector3 halfExtents, Vector3 rotation, Vector3 direction, float maxDistance, int layerMask = Physics.DefaultRaycastLayers)
+        {
+            return new PhysicsQuery { origin = center, direction = direction, extents = halfExtents, rotation = rotation, maxDistance = maxDistance, layerMask = layerMask, shape = QueryShape.Box };
+        }
+
+        public static PhysicsQuery Capsule(Vector3 center, float radius, float halfHeight, Vector3 rotation, Vector3 direction, float maxDistance, int layerMask = Physics.DefaultRaycastLayers)
+        {
+            return new PhysicsQuery { origin = center, direction = direction, extents = new Vector3(radius, halfHeight, 0), rotation = rotation, maxDistance = maxDistance, layerMask = layerMask, shape = QueryShape.Capsule };
+        }
+    }
+
+    // Queries and results of one batch, keep it around and reuse it every frame so nothing is allocated
+    public class PhysicsQueryBatch
+    {
+        public PhysicsQuery[] queries;
+        public int count;
+
+        // Cast results, one per query, a miss has an entity ID of 0
+        public ulong[] entityIDs;
+        public float[] distances;
+        public Vector3[] normals;
+        public Vector3[] points;
+
+        // Overlap results, query i uses entries [i * maxHitsPerQuery, i * maxHitsPerQuery + hitCounts[i])
+        public ulong[] overlapIDs;
+        public int[] hitCounts;
+        public int maxHitsPerQuery;
+
+        public PhysicsQueryBatch(int capacity, int maxHitsPerQuery = 8)
+        {
+            this.maxHitsPerQuery = maxHitsPerQuery;
+            Allocate(capacity);
+        }
+
+        public void Clear()
+        {
+            count = 0;
+        }
+
+        public int Add(PhysicsQuery query)
+        {
+            if (count == queries.Length)
+            {
+                Allocate(queries.Length * 2);
+            }
+            queries[count] = query;
+            return count++;
+        }
+
+        // Runs every query as a cast, returns the number of queries that hit something
+        public int Cast()
+        {
+            return InternalCalls.Physics_CastBatch(queries, count, entityIDs, distances, normals, points);
+        }
+
+        // Runs every query as an overlap test
+        public void Overlap()
+        {
+            InternalCalls.Physics_OverlapBatch(queries, count, overlapIDs, maxHitsPerQuery, hitCounts);
+        }
+
+        public bool GetHit(int index, out RaycastHit hitInfo)
+        {
+            hitInfo = new RaycastHit();
+            if (entityIDs[index] == 0)
+            {
+                return false;
+            }
+            hitInfo.distance = distances[index];
+            hitInfo.normal = normals[index];
+            hitInfo.point = points[index];
+            hitInfo.transform = new Transform(entityIDs[index]);
+            hitInfo.collider = new Collider(entityIDs[index]);
+            return true;
+        }
+
+        private void Allocate(int capacity)
+        {
+            capacity = Math.Max(capacity, 1);
+            Array.Resize(ref queries, capacity);
+            Array.Resize(ref entityIDs, capacity);
+            Array.Resize(ref distances, capacity);
+            Array.Resize(ref normals, capacity);
+            Array.Resize(ref points, capacity);
+            Array.Resize(ref overlapIDs, capacity * maxHitsPerQuery);
+            Array.Resize(ref hitCounts, capacity);
+        }
+    }
+
     public class Physics
     {
         public const int DefaultRaycastLayers = 0;
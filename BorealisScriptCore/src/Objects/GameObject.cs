@@ -158,16 +158,32 @@ namespace Borealis
             InternalCalls.SetActive(value, out InstanceID);
         }
 
+        // Allocates a new array every call, use the overload taking a results array in per-frame code
         public static GameObject[] FindObjectsWithLayerMask(int mask)
         {
-            InternalCalls.Entity_GetEntitiesFromLayer(mask, out GameObject[] entities);
+            GameObject[] entities = new GameObject[InternalCalls.Entity_GetEntitiesFromLayer(mask, null)];
+            InternalCalls.Entity_GetEntitiesFromLayer(mask, entities);
             return entities;
         }
 
+        // Fills results with as many objects as fit, returns how many are on the layer
+        public static int FindObjectsWithLayerMask(int mask, GameObject[] results)
+        {
+            return InternalCalls.Entity_GetEntitiesFromLayer(mask, results);
+        }
+
+        // Allocates a new array every call, use the overload taking a results array in per-frame code
         public static GameObject[] FindGameObjectsWithTag(string tag)
         {
-            InternalCalls.Entity_GetEntitiesFromTag(tag, out GameObject[] entities);
+            GameObject[] entities = new GameObject[InternalCalls.Entity_GetEntitiesFromTag(tag, null)];
+            InternalCalls.Entity_GetEntitiesFromTag(tag, entities);
             return entities;
         }
+
+        // Fills results with as many objects as fit, returns how many have the tag
+        public static int FindGameObjectsWithTag(string tag, GameObject[] results)
+        {
+            return InternalCalls.Entity_GetEntitiesFromTag(tag, results);
+        }
     }
 }
@@ -23,6 +23,7 @@ workspace "Borealis"
 	IncludeDir["ImGuizmo"] = "Borealis/lib/ImGuizmo"
 	IncludeDir["FMOD"] = "Borealis/lib/FMOD"
 	IncludeDir["Tracy"] = "Borealis/lib/tracy"
+	IncludeDir["LZ4"] = "Borealis/lib/lz4"
 	IncludeDir["JoltPhysics"] = "Borealis/lib/JoltPhysics"
 	IncludeDir["Mono"] = "Borealis/lib/mono/include"
 	IncludeDir["xproperty"] = "Borealis/lib/xproperty/include"
@@ -117,6 +118,7 @@ workspace "Borealis"
 
 	group "Dependencies"
 		include "Borealis/lib/Tracy"
+		include "Borealis/lib/lz4"
 		include "BorealisEditor/lib/Assimp"
 		include "BorealisEditor/lib/imgui-node-editor"
 	group ""
@@ -166,6 +168,7 @@ workspace "Borealis"
 			"%{IncludeDir.ImGuizmo}",
 			"%{IncludeDir.FMOD}",
 			"%{IncludeDir.Tracy}",
+			"%{IncludeDir.LZ4}",
 			"%{IncludeDir.JoltPhysics}",
 			"%{IncludeDir.Mono}",
 			"%{IncludeDir.xproperty}",
@@ -180,6 +183,7 @@ workspace "Borealis"
 			"opengl32.lib",
 			"crypt32.lib",
 			"Tracy",
+			"LZ4",
 		}
 
 